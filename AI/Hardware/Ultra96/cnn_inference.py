@@ -1,3 +1,4 @@
+import time
 import torch
 import numpy as np
 from torch.nn.functional import pad
@@ -7,6 +8,11 @@ INPUT_SIZE = 64 * 81
 OUTPUT_SIZE = 11
 TARGET_LEN = 16000
 
+# Quantisation of log-mel features computed on the glove (EDGE_FEATURES)
+MEL_DB_MIN = -80.0
+MEL_DB_STEP = 0.5
+MEL_DB_SILENCE = -100.0 # code 0, AmplitudeToDB's floor for zero padding
+
 labels_dict = {0: "chair", 1: "table", 2: "lamp", 3: "TV", 4: "bed", 5: "plant", 6: "sofa",
                7: "ODM", 8: "ODM", 9: "up", 10: "down"}
 
@@ -33,9 +39,25 @@ def preprocess_audio(waveform, mel_transformer, db_transformer):
 
     return flattened
 
-def classify_audio(waveform, logger, dma, mel_transformer, db_transformer):
+def dequantize_features(features):
+    mel_db = features.astype(np.float32) * MEL_DB_STEP + MEL_DB_MIN
+    mel_db[features == 0] = MEL_DB_SILENCE
+    flattened = mel_db.view(np.uint32)
+
+    return flattened
+
+def classify_audio(waveform, logger, dma, mel_transformer, db_transformer, trace=None):
     flattened = preprocess_audio(waveform, mel_transformer, db_transformer)
 
+    return run_accel(flattened, logger, dma, trace)
+
+def classify_features(features, logger, dma, trace=None):
+    flattened = dequantize_features(features)
+
+    return run_accel(flattened, logger, dma, trace)
+
+# `trace`, if given, gets the DMA start and end in ms since the epoch
+def run_accel(flattened, logger, dma, trace=None):
     # Allocate buffers
     in_buffer = allocate(shape=(INPUT_SIZE,), dtype=np.uint32)
     logger.info("Input buffer allocated.")
@@ -46,12 +68,16 @@ def classify_audio(waveform, logger, dma, mel_transformer, db_transformer):
     logger.info("Input buffer data prepared.")
 
     # Start DMA transfer to the FPGA
+    if trace is not None:
+        trace["dmaStartMs"] = int(time.time() * 1000)
     dma.sendchannel.transfer(in_buffer)
     logger.info("DMA 0 transfer started.")
     dma.recvchannel.transfer(out_buffer)
 
     dma.sendchannel.wait()
     dma.recvchannel.wait()
+    if trace is not None:
+        trace["dmaDoneMs"] = int(time.time() * 1000)
     
     # Convert output to float
     logits = np.array([out_buffer[i].view(np.float32) for i in range(OUTPUT_SIZE)], dtype=np.float32)
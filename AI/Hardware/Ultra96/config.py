@@ -9,3 +9,7 @@ MQTT_USER = os.getenv("MQTT_USER", "")
 MQTT_PASS = os.getenv("MQTT_PASS", "")
 CERT_NAME = os.getenv("CERT_NAME", "")
 MODE = os.getenv("MODE", "dev")
+
+# int16s ahead of the samples or features in esp32/voice_data and
+# esp32/voice_features: [command flag, samples in utterance, trace id]
+VOICE_HEADER = 3
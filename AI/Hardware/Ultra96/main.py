@@ -3,10 +3,10 @@ import logging
 import time
 import json
 import numpy as np
-from config import MQTT_HOST, MQTT_PORT, MQTT_USER, MQTT_PASS
+from config import MQTT_HOST, MQTT_PORT, MQTT_USER, MQTT_PASS, VOICE_HEADER
 from mqtt_client import SecureMQTTClient
 from pynq import Overlay, PL
-from cnn_inference import classify_audio
+from cnn_inference import classify_audio, classify_features
 
 MIC_SR = 8000
 N_MELS = 64
@@ -25,6 +25,17 @@ def setup_logger():
 
     return logger
 
+def now_ms():
+    return int(time.time() * 1000)
+
+# Stage timestamps returned with the result, so the glove can break the
+# command's latency down on its own clock (hardware/.../src/trace.h)
+def trace_info(trace_id, chunk_times, complete_ms, timing):
+    trace = {"traceId": trace_id, "chunksMs": chunk_times, "completeMs": complete_ms}
+    trace.update(timing)
+    trace["sentMs"] = now_ms()
+    return trace
+
 def setup_ai_tools():
     mel_transformer = torchaudio.transforms.MelSpectrogram(sample_rate=MIC_SR, n_mels=N_MELS)
     db_transformer = torchaudio.transforms.AmplitudeToDB(stype="power")
@@ -39,6 +50,8 @@ def main():
     timeout = False
     pkt_counter = 0
     pkt_list = []
+    chunk_times = []
+    pending_features = []
 
     PL.reset()
     ol = Overlay('/home/xilinx/design_1.bit')
@@ -61,9 +74,18 @@ def main():
             start_time = time.time()
 
         in_pkt = np.frombuffer(data, dtype=np.int16)
+        chunk_times.append(now_ms())
         pkt_list.append(in_pkt)
         pkt_counter += 1
 
+    # Features callback for gloves running EDGE_FEATURES
+    def features_callback(data):
+        nonlocal start_time
+        start_time = time.time()
+        header = np.frombuffer(data[:2 * VOICE_HEADER], dtype=np.int16)
+        features = np.frombuffer(data[2 * VOICE_HEADER:], dtype=np.uint8)
+        pending_features.append((int(header[0]), int(header[2]) & 0xffff, now_ms(), features))
+
     # Setup MQTT client
     mqtt_client = SecureMQTTClient(
         username=MQTT_USER,
@@ -72,35 +94,45 @@ def main():
         port=MQTT_PORT,
         clientId="ultra96",
         ai_callback=ai_callback,
-        debug_callback=debug_callback
+        debug_callback=debug_callback,
+        features_callback=features_callback
     )
     mqtt_client.connect()
     mqtt_client.subscribe(topic="esp32/voice_data")
+    mqtt_client.subscribe(topic="esp32/voice_features")
     mqtt_client.subscribe(topic="esp32/command")
+    mqtt_client.subscribe(topic="esp32/clock_sync")
     
     try:
         while True:
-            # Check for 2s timeout once first packet received
-            if (len(pkt_list) >= 1 and time.time() - start_time > 2) or len(pkt_list) == 3:
-                timeout = True
-            
+            if pending_features:
+                flag, trace_id, received_ms, features = pending_features.pop(0)
+                complete_ms = now_ms()
+                timing = {}
+                pred = classify_features(features, logger, dma, timing)
+                if isDebugMode:
+                    end_time = time.time()
+                    out_pkt = {"status": "DEBUG", "info": {"receiveTime": int(start_time * 1000), "inferenceTime": int(1000 * (end_time - start_time)), "sendTime": int(end_time * 1000)}}
+                    isDebugMode = False
+                else:
+                    out_pkt = {"status": "SUCCESS", "info": {"command": command_dict[flag], "result": pred}}
+                out_pkt["trace"] = trace_info(trace_id, [received_ms], complete_ms, timing)
+                mqtt_client.publish("ultra96/voice_result", json.dumps(out_pkt))
+
+            # Wait until the whole utterance arrived, or 2s after the first packet
+            if len(pkt_list) >= 1:
+                expected = int(pkt_list[0][1])
+                received = sum(len(pkt) - VOICE_HEADER for pkt in pkt_list)
+                timeout = received >= expected or time.time() - start_time > 2
+
             if timeout == True:
-                if len(pkt_list) == 3:
-                    print(len(pkt_list[0]), len(pkt_list[1]), len(pkt_list[2]))
-                    print(pkt_list[0])
-                    waveform = np.append(pkt_list[0][1:], pkt_list[2][1:])
-                    command = command_dict[pkt_list[0][0]]
-                    pred = classify_audio(waveform, logger, dma, mel_transformer, db_transformer)
-                    if isDebugMode:
-                        end_time = time.time()
-                        out_pkt = {"status": "DEBUG", "info": {"receiveTime": int(start_time * 1000), "inferenceTime": int(1000 * (end_time - start_time)), "sendTime": int(end_time * 1000)}}
-                        isDebugMode = False
-                    else:
-                        out_pkt = {"status": "SUCCESS", "info": {"command": command, "result": pred}}
-                elif len(pkt_list) == 2:
-                    waveform = pkt_list[1][1:]
+                complete_ms = now_ms()
+                timing = {}
+                if received >= expected:
+                    waveform = np.concatenate([pkt[VOICE_HEADER:] for pkt in pkt_list])[:expected]
                     command = command_dict[pkt_list[0][0]]
-                    pred = classify_audio(waveform, logger, dma, mel_transformer, db_transformer)
+                    logger.info(f"Utterance of {expected} samples ({expected / MIC_SR:.2f}s)")
+                    pred = classify_audio(waveform, logger, dma, mel_transformer, db_transformer, timing)
                     if isDebugMode:
                         end_time = time.time()
                         out_pkt = {"status": "DEBUG", "info": {"receiveTime": int(start_time * 1000), "inferenceTime": int(1000 * (end_time - start_time)), "sendTime": int(end_time * 1000)}}
@@ -109,12 +141,14 @@ def main():
                         out_pkt = {"status": "SUCCESS", "info": {"command": command, "result": pred}}
                 else:
                     out_pkt = {"status": "FAILED", "info": "Did not receive all packets!"}
-                
+                out_pkt["trace"] = trace_info(int(pkt_list[0][2]) & 0xffff, list(chunk_times), complete_ms, timing)
+
                 pkt_counter = 0
                 timeout = False
                 pkt_list.clear()
+                chunk_times.clear()
                 json_pkt = json.dumps(out_pkt)
-                mqtt_client.publish("ultra96/voice_result", json_pkt)            
+                mqtt_client.publish("ultra96/voice_result", json_pkt)
     except KeyboardInterrupt:
         mqtt_client.disconnect()
 
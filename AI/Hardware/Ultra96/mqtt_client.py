@@ -6,7 +6,7 @@ from config import CERT_NAME, MODE
 from pathlib import Path
 
 class SecureMQTTClient:
-    def __init__(self, username, password, host="127.0.0.1", port=8883, clientId=None, ai_callback=None, debug_callback=None):
+    def __init__(self, username, password, host="127.0.0.1", port=8883, clientId=None, ai_callback=None, debug_callback=None, features_callback=None):
         self.host = host
         self.port = port
         self.client = mqtt.Client(client_id=clientId)
@@ -23,6 +23,7 @@ class SecureMQTTClient:
 
         self.ai_callback = ai_callback
         self.debug_callback = debug_callback
+        self.features_callback = features_callback
 
     def _loadCertificate(self):
         secrets_dir = Path(__file__).resolve().parent / "devices"
@@ -72,12 +73,24 @@ class SecureMQTTClient:
         if topic == "esp32/voice_data":
             data = msg.payload
             self.ai_callback(data)
+        elif topic == "esp32/voice_features":
+            self.features_callback(msg.payload)
+        elif topic == "esp32/clock_sync":
+            self._replyClock(msg.payload, time.time())
         elif topic == "esp32/command":
             data = msg.payload.decode()
             dict = json.loads(data)
             if dict["type"] == "DEBUG":
                 self.debug_callback()
 
+    # Clock offset exchange for the glove's voice traces: echo its send time
+    # with ours of receiving the request and of replying
+    def _replyClock(self, payload, receive_time):
+        request = json.loads(payload.decode())
+        reply = {"id": request["id"], "t0": request["t0"], "t1": int(receive_time * 1000),
+                 "t2": int(time.time() * 1000)}
+        self.client.publish("ultra96/clock_sync", json.dumps(reply))
+
     def isConnected(self):
         return self.client.is_connected()
 
@@ -0,0 +1,188 @@
+"""Quantises the CNN for the glove's on-device keyword-spotting fallback.
+
+Reads the float weights the FPGA build uses (AI/Hardware/CNN_weights.h),
+calibrates activation scales on log-mel features captured from the glove
+and writes int8 weights for hardware/CG4002_Hardware/src/kws.cpp:
+
+    python export_int8.py features/*.bin
+
+Each feature file is an esp32/voice_features payload (its 3 x int16 header,
+VOICE_HEADER in config.py, is skipped) or the bare MEL_BINS x MEL_FRAMES quantised log-mel codes.
+"""
+import argparse
+import re
+import numpy as np
+from config import VOICE_HEADER
+
+N_CLASSES = 11
+IN_H = 64
+IN_W = 81
+VOICE_HEADER_BYTES = 2 * VOICE_HEADER
+
+# Feature quantisation of melspec.h / cnn_inference.py
+MEL_DB_MIN = -80.0
+MEL_DB_STEP = 0.5
+MEL_DB_SILENCE = -100.0
+
+# conv layers as in CNN.py: (name, stride)
+CONVS = [("conv1", 2), ("conv2", 1), ("conv3", 2), ("conv4", 1), ("conv5", 2), ("conv6", 1)]
+# activation range kept when calibrating; the rest saturates
+CALIB_PERCENTILE = 99.99
+
+def load_float_weights(path):
+    weights = {}
+    pattern = re.compile(r"static const CNN_DTYPE (\w+)((?:\[\d+\])+) = \{(.*)\};")
+    with open(path) as f:
+        for line in f:
+            m = pattern.match(line.strip())
+            if not m:
+                continue
+            dims = [int(d) for d in re.findall(r"\[(\d+)\]", m.group(2))]
+            values = np.array([float(v) for v in m.group(3).split(",")], dtype=np.float64)
+            weights[m.group(1)] = values.reshape(dims)
+    return weights
+
+def load_features(path):
+    data = np.fromfile(path, dtype=np.uint8)
+    if data.size == VOICE_HEADER_BYTES + IN_H * IN_W:
+        data = data[VOICE_HEADER_BYTES:]
+    if data.size != IN_H * IN_W:
+        raise ValueError(f"{path}: {data.size} bytes is not a log-mel feature map")
+    return data.reshape(IN_H, IN_W)
+
+def dequantize_features(codes):
+    mel_db = codes.astype(np.float64) * MEL_DB_STEP + MEL_DB_MIN
+    mel_db[codes == 0] = MEL_DB_SILENCE
+    return mel_db
+
+def im2col(x, stride):
+    """x is [C][H][W]; returns patches [H_out * W_out][C * 9] for a padded 3x3 conv."""
+    c, h, w = x.shape
+    h_out = (h - 1) // stride + 1
+    w_out = (w - 1) // stride + 1
+    padded = np.zeros((c, h + 2, w + 2), dtype=x.dtype)
+    padded[:, 1:h + 1, 1:w + 1] = x
+    cols = np.empty((c, 3, 3, h_out, w_out), dtype=x.dtype)
+    for kh in range(3):
+        for kw in range(3):
+            cols[:, kh, kw] = padded[:, kh:kh + stride * h_out:stride, kw:kw + stride * w_out:stride]
+    return cols.reshape(c * 9, h_out * w_out).T, h_out, w_out
+
+def conv(x, w, b, stride):
+    cols, h_out, w_out = im2col(x, stride)
+    out = cols @ w.reshape(w.shape[0], -1).T + b
+    return out.T.reshape(w.shape[0], h_out, w_out)
+
+def float_forward(weights, mel_db):
+    x = mel_db[np.newaxis]
+    activations = []
+    for name, stride in CONVS:
+        x = np.maximum(conv(x, weights[name + "_w"], weights[name + "_b"], stride), 0)
+        activations.append(x)
+    pooled = x.mean(axis=(1, 2))
+    return weights["linear1_w"] @ pooled + weights["linear1_b"], activations
+
+def requant_multiplier(scale):
+    """scale ~= m / 2^shift with m a Q31 integer in [2^30, 2^31)."""
+    m, e = np.frexp(scale)
+    q = np.round(m * (1 << 31)).astype(np.int64)
+    e = np.where(q == 1 << 31, e + 1, e)
+    q = np.where(q == 1 << 31, 1 << 30, q)
+    return q, (31 - e).astype(np.int64)
+
+def quantize(weights, calib):
+    layers = []
+    in_scale = MEL_DB_STEP # int16 input: q - 160, silence -200
+    act_max = [[] for _ in CONVS]
+    for mel_db in calib:
+        _, activations = float_forward(weights, mel_db)
+        for i, a in enumerate(activations):
+            act_max[i].append(np.percentile(a, CALIB_PERCENTILE))
+    for i, (name, stride) in enumerate(CONVS):
+        w = weights[name + "_w"]
+        w_scale = np.maximum(np.abs(w).reshape(w.shape[0], -1).max(axis=1), 1e-8) / 127
+        out_scale = max(float(np.mean(act_max[i])), 1e-6) / 255
+        mult, shift = requant_multiplier(in_scale * w_scale / out_scale)
+        layers.append({
+            "name": name,
+            "stride": stride,
+            "w": np.round(w / w_scale[:, None, None, None]).astype(np.int64),
+            "b": np.round(weights[name + "_b"] / (in_scale * w_scale)).astype(np.int64),
+            "mult": mult,
+            "shift": shift,
+            "in_scale": in_scale,
+            "out_scale": out_scale,
+        })
+        in_scale = out_scale
+    # the pool sums instead of averaging, so its scale carries the 1 / (H * W)
+    pool_h, pool_w = IN_H, IN_W
+    for _, stride in CONVS:
+        pool_h, pool_w = (pool_h - 1) // stride + 1, (pool_w - 1) // stride + 1
+    in_scale /= pool_h * pool_w
+    w = weights["linear1_w"]
+    w_scale = np.maximum(np.abs(w).max(axis=1), 1e-8) / 127
+    linear = {
+        "w": np.round(w / w_scale[:, None]).astype(np.int64),
+        "b": np.round(weights["linear1_b"] / (in_scale * w_scale)).astype(np.int64),
+        "scale": in_scale * w_scale,
+    }
+    return layers, linear
+
+def int8_forward(layers, linear, codes):
+    """Bit-exact model of kws.cpp."""
+    x = np.where(codes == 0, -200, codes.astype(np.int64) - 160)[np.newaxis]
+    for layer in layers:
+        acc = conv(x, layer["w"], layer["b"], layer["stride"])
+        mult = layer["mult"][:, None, None]
+        shift = layer["shift"][:, None, None]
+        x = np.clip((acc * mult + (1 << (shift - 1))) >> shift, 0, 255)
+    pooled = x.sum(axis=(1, 2))
+    return (linear["w"] @ pooled + linear["b"]) * linear["scale"]
+
+def c_array(ctype, name, arr):
+    dims = "".join(f"[{d}]" for d in arr.shape)
+    flat = ", ".join(str(v) for v in arr.flatten())
+    return f"static const {ctype} {name}{dims} = {{ {flat} }};\n"
+
+def write_header(path, layers, linear, n_calib):
+    lines = [
+        "#pragma once\n",
+        "// Generated by AI/Soft/export_int8.py; do not edit.\n",
+        f"// int8 CNN weights, activation scales calibrated on {n_calib} feature maps.\n",
+        "// Weights are [out][kh][kw][in]; out = clamp((acc * m + round) >> s, 0, 255).\n",
+    ]
+    for layer in layers:
+        lines.append(f"// {layer['name']}: input scale {layer['in_scale']:.6g}, output scale {layer['out_scale']:.6g}\n")
+        name = layer["name"]
+        lines.append(c_array("int8_t", f"{name}_w", layer["w"].transpose(0, 2, 3, 1)))
+        lines.append(c_array("int32_t", f"{name}_b", layer["b"]))
+        lines.append(c_array("int32_t", f"{name}_m", layer["mult"]))
+        lines.append(c_array("uint8_t", f"{name}_s", layer["shift"]))
+    lines.append(c_array("int8_t", "linear1_w", linear["w"]))
+    lines.append(c_array("int32_t", "linear1_b", linear["b"]))
+    lines.append("// logit = acc * linear1_scale\n")
+    lines.append("static const float linear1_scale[%d] = { %s };\n"
+                 % (N_CLASSES, ", ".join(f"{v:.9g}f" for v in linear["scale"])))
+    with open(path, "w") as f:
+        f.writelines(lines)
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("features", nargs="+", help="calibration feature files")
+    parser.add_argument("--weights", default="../Hardware/CNN_weights.h")
+    parser.add_argument("--out", default="../../hardware/CG4002_Hardware/src/kws_weights.h")
+    args = parser.parse_args()
+
+    weights = load_float_weights(args.weights)
+    codes = [load_features(p) for p in args.features]
+    calib = [dequantize_features(c) for c in codes]
+    layers, linear = quantize(weights, calib)
+    write_header(args.out, layers, linear, len(codes))
+
+    # how often the int8 model agrees with the float model it came from
+    agree = 0
+    for c, mel_db in zip(codes, calib):
+        logits, _ = float_forward(weights, mel_db)
+        agree += int(np.argmax(logits) == np.argmax(int8_forward(layers, linear, c)))
+    print(f"Exported int8 weights to {args.out}")
+    print(f"int8 and float argmax agree on {agree}/{len(codes)} calibration inputs")
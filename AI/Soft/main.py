@@ -2,7 +2,7 @@ import time
 import soundfile as sf
 import numpy as np
 import json
-from config import MQTT_HOST, MQTT_PORT, MQTT_USER, MQTT_PASS
+from config import MQTT_HOST, MQTT_PORT, MQTT_USER, MQTT_PASS, VOICE_HEADER
 from mqtt_client import SecureMQTTClient
 
 counter = 0
@@ -13,8 +13,10 @@ def ai_callback(data):
     print(waveform)
     print(waveform.shape)
     command = waveform[0]
-    waveform = waveform[1:]
-    print(command)
+    length = waveform[1] # samples in the whole utterance, after VAD trimming
+    trace_id = waveform[2]
+    waveform = waveform[VOICE_HEADER:]
+    print(command, length, trace_id)
 
     sf.write(f"output{counter}.wav", waveform, 8000, subtype='PCM_16')
 
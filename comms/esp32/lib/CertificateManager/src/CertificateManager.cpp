@@ -1,109 +1,130 @@
 #include "CertificateManager.hpp"
+#include "Logger.hpp"
 
-CertificateManager::CertificateManager() {}
+CertificateManager::CertificateManager()
+    : data(nullptr), ca_length(0), client_cert_length(0), client_key_length(0) {}
 
 CertificateManager::~CertificateManager() { clearCertificates(); }
 
+static size_t fileSize(const char *path) {
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        LOG_ERROR("Failed to open file: %s", path);
+        return 0;
+    }
+    size_t size = file.size();
+    file.close();
+    if (size == 0) LOG_ERROR("File is empty: %s", path);
+    return size;
+}
+
 bool CertificateManager::loadCertificates() {
-    Serial.println("Initializing SPIFFS and loading certificates...");
+    LOG_INFO("Initializing SPIFFS and loading certificates...");
 
     if (!SPIFFS.begin(true)) {
-        Serial.println("ERROR: SPIFFS Mount Failed");
+        LOG_ERROR("SPIFFS Mount Failed");
         return false;
     }
 
-    bool success = true;
-
-    if (!loadFile("/esp32-ca.crt", ca_cert)) {
-        Serial.println("ERROR: Failed to load CA certificate");
-        success = false;
-    }
-
-    if (!loadFile("/esp32-client.crt", client_cert)) {
-        Serial.println("ERROR: Failed to load client certificate");
-        success = false;
+    clearCertificates();
+    size_t ca = fileSize(CA_CERT_PATH);
+    size_t cert = fileSize(CLIENT_CERT_PATH);
+    size_t key = fileSize(CLIENT_KEY_PATH);
+    if (ca == 0 || cert == 0 || key == 0) {
+        LOG_ERROR("Failed to load one or more certificates");
+        return false;
     }
 
-    if (!loadFile("/esp32-client.key", client_key)) {
-        Serial.println("ERROR: Failed to load private key");
-        success = false;
+    // one allocation for all three, parsed in place by the TLS client
+    data = static_cast<uint8_t *>(malloc(ca + cert + key));
+    if (!data) {
+        LOG_ERROR("Cannot allocate %u bytes for certificates", ca + cert + key);
+        return false;
     }
-
-    if (success) {
-        Serial.println("SUCCESS: All certificates loaded successfully");
-        printCertificateInfo();
-    } else {
-        Serial.println("ERROR: Failed to load one or more certificates");
+    bool success = loadFile(CA_CERT_PATH, data, ca) &&
+                   loadFile(CLIENT_CERT_PATH, data + ca, cert) &&
+                   loadFile(CLIENT_KEY_PATH, data + ca + cert, key);
+    if (!success) {
+        LOG_ERROR("Failed to load one or more certificates");
         clearCertificates();
+        return false;
     }
+    ca_length = ca;
+    client_cert_length = cert;
+    client_key_length = key;
 
-    return success;
+    LOG_INFO("All certificates loaded successfully");
+    printCertificateInfo();
+    return true;
 }
 
-void CertificateManager::applyCertificates(WiFiClientSecure* client) {
+bool CertificateManager::applyCertificates(TlsClient *client) {
     if (!client) {
-        Serial.println("ERROR: WiFiClientSecure pointer is null");
-        return;
+        LOG_ERROR("TlsClient pointer is null");
+        return false;
     }
 
     if (!isCertificatesLoaded()) {
-        Serial.println(
-            "ERROR: Certificates not loaded. Call loadCertificates() first.");
-        return;
+        LOG_ERROR("Certificates not loaded. Call loadCertificates() first.");
+        return false;
     }
 
-    Serial.println("Applying SSL certificates to WiFiClientSecure...");
+    LOG_INFO("Applying SSL certificates to TlsClient...");
 
-    client->setCACert(ca_cert.c_str());
-    client->setCertificate(client_cert.c_str());
-    client->setPrivateKey(client_key.c_str());
+    if (!client->setCredentials(getCACert(), ca_length, getClientCert(), client_cert_length,
+                                getClientKey(), client_key_length)) {
+        LOG_ERROR("Failed to apply SSL certificates");
+        return false;
+    }
 
-    Serial.println("SSL certificates applied successfully");
+    LOG_INFO("SSL certificates applied successfully");
+    return true;
 }
 
 void CertificateManager::printCertificateInfo() {
-    Serial.println("=== Certificate Information ===");
-    Serial.printf("CA Certificate: %d bytes\n", ca_cert.length());
-    Serial.printf("Client Certificate: %d bytes\n", client_cert.length());
-    Serial.printf("Private Key: %d bytes\n", client_key.length());
-    Serial.printf("Total certificate data: %d bytes\n",
-                  ca_cert.length() + client_cert.length() +
-                      client_key.length());
-    Serial.println("==============================");
+    LOG_INFO("=== Certificate Information ===");
+    LOG_INFO("CA Certificate: %u bytes", ca_length);
+    LOG_INFO("Client Certificate: %u bytes", client_cert_length);
+    LOG_INFO("Private Key: %u bytes", client_key_length);
+    LOG_INFO("Total certificate data: %u bytes",
+             ca_length + client_cert_length + client_key_length);
+    LOG_INFO("==============================");
 }
 
 bool CertificateManager::isCertificatesLoaded() const {
-    return (ca_cert.length() > 0 && client_cert.length() > 0 &&
-            client_key.length() > 0);
+    return data != nullptr && ca_length > 0 && client_cert_length > 0 && client_key_length > 0;
 }
 
 void CertificateManager::clearCertificates() {
-    ca_cert = "";
-    client_cert = "";
-    client_key = "";
-    Serial.println("Certificate data cleared from memory");
+    if (!data) return;
+    free(data);
+    data = nullptr;
+    ca_length = 0;
+    client_cert_length = 0;
+    client_key_length = 0;
+    LOG_INFO("Certificate data cleared from memory");
 }
 
-bool CertificateManager::loadFile(const char *path, String &content) {
+bool CertificateManager::loadFile(const char *path, uint8_t *buffer, size_t length) {
     if (!path) {
-        Serial.println("ERROR: File path is null");
+        LOG_ERROR("File path is null");
         return false;
     }
 
     File file = SPIFFS.open(path, "r");
     if (!file) {
-        Serial.printf("ERROR: Failed to open file: %s\n", path);
+        LOG_ERROR("Failed to open file: %s", path);
         return false;
     }
 
-    content = file.readString();
+    size_t read = file.read(buffer, length);
     file.close();
 
-    if (content.length() == 0) {
-        Serial.printf("ERROR: File is empty: %s\n", path);
+    if (read != length) {
+        LOG_ERROR("Short read from %s (%u of %u bytes)", path, read, length);
         return false;
     }
 
-    Serial.printf("SUCCESS: Loaded %s (%d bytes)\n", path, content.length());
+    LOG_INFO("Loaded %s (%u bytes)", path, length);
     return true;
-}
\ No newline at end of file
+}
@@ -3,29 +3,39 @@
 
 #include <Arduino.h>
 #include <SPIFFS.h>
-#include <WiFiClientSecure.h>
+#include "TlsClient.hpp"
 
+const char CA_CERT_PATH[] = "/esp32-ca.der";
+const char CLIENT_CERT_PATH[] = "/esp32-client.der";
+const char CLIENT_KEY_PATH[] = "/esp32-client-key.der";
+
+// DER credentials from SPIFFS, read into one buffer that the TLS client
+// parses in place, so it has to live as long as the client does.
 class CertificateManager {
 private:
-    String ca_cert;
-    String client_cert;
-    String client_key;
-    
-    bool loadFile(const char* path, String& content);
+    uint8_t* data;
+    size_t ca_length;
+    size_t client_cert_length;
+    size_t client_key_length;
+
+    bool loadFile(const char* path, uint8_t* buffer, size_t length);
 
 public:
     CertificateManager();
     ~CertificateManager();
     
     bool loadCertificates();
-    void applyCertificates(WiFiClientSecure* client);    
+    bool applyCertificates(TlsClient* client);
     bool isCertificatesLoaded() const;
     void clearCertificates();
     void printCertificateInfo();
     
-    const String& getCACert() const { return ca_cert; }
-    const String& getClientCert() const { return client_cert; }
-    const String& getClientKey() const { return client_key; }
+    const uint8_t* getCACert() const { return data; }
+    size_t getCACertLength() const { return ca_length; }
+    const uint8_t* getClientCert() const { return data + ca_length; }
+    size_t getClientCertLength() const { return client_cert_length; }
+    const uint8_t* getClientKey() const { return data + ca_length + client_cert_length; }
+    size_t getClientKeyLength() const { return client_key_length; }
 };
 
-#endif // CERTIFICATE_MANAGER_HPP
\ No newline at end of file
+#endif // CERTIFICATE_MANAGER_HPP
@@ -0,0 +1,172 @@
+#include "Logger.hpp"
+
+static_assert((LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) == 0, "LOG_RING_SLOTS must be a power of two");
+
+Logger::Record Logger::ring[LOG_RING_SLOTS];
+std::atomic<uint32_t> Logger::writePosition(0);
+uint32_t Logger::readPosition = 0;
+std::atomic<uint32_t> Logger::droppedCount(0);
+TaskHandle_t Logger::drainTask = nullptr;
+
+static const char LEVEL_NAMES[] = "?EWID";
+
+// Bounded multi-producer queue (Vyukov). A slot's sequence is the ring
+// position, rounded down to a whole lap, that may claim it next; one more
+// once that record is committed. Zeroed slots are free for the first lap,
+// so the ring needs no setup.
+Logger::Record* Logger::claim() {
+    const uint32_t mask = LOG_RING_SLOTS - 1;
+    uint32_t position = writePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Record& record = ring[position & mask];
+        uint32_t lap = position & ~mask;
+        int32_t diff = (int32_t)(record.sequence.load(std::memory_order_acquire) - lap);
+        if (diff == 0) {
+            if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return &record;
+            }
+        } else if (diff < 0) {
+            // the drain task has not caught up with this slot yet
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            position = writePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::commit(Record* record) {
+    uint32_t lap = record->sequence.load(std::memory_order_relaxed);
+    record->sequence.store(lap + 1, std::memory_order_release);
+}
+
+void Logger::begin(UBaseType_t priority, BaseType_t core) {
+    if (drainTask) return;
+    xTaskCreatePinnedToCore(drain, "LogTask", 3072, nullptr, priority, &drainTask, core);
+}
+
+bool Logger::drainOne(char* line, size_t size) {
+    const uint32_t mask = LOG_RING_SLOTS - 1;
+    Record& record = ring[readPosition & mask];
+    uint32_t lap = readPosition & ~mask;
+    if (record.sequence.load(std::memory_order_acquire) != lap + 1) return false;
+    size_t n = format(record, line, size);
+    record.sequence.store(lap + LOG_RING_SLOTS, std::memory_order_release);
+    readPosition++;
+    Serial.write(reinterpret_cast<const uint8_t*>(line), n);
+    return true;
+}
+
+void Logger::drain(void* parameter) {
+    char line[LOG_LINE_SIZE];
+    uint32_t reportedDrops = 0;
+    while (1) {
+        while (drainOne(line, sizeof(line))) {
+        }
+        uint32_t drops = dropped();
+        if (drops != reportedDrops) {
+            Serial.printf("W (log) %u messages dropped\n", (unsigned)(drops - reportedDrops));
+            reportedDrops = drops;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL));
+    }
+}
+
+// printf over the recorded arguments: every conversion takes the next
+// argument, whose tag decides how it is passed on to snprintf.
+size_t Logger::format(const Record& record, char* line, size_t size) {
+    size_t n = 0;
+    auto append = [&](int written) {
+        if (written > 0) n += written;
+        if (n > size - 2) n = size - 2; // room for the newline
+    };
+    append(snprintf(line, size, "%c (%u) ", LEVEL_NAMES[record.level < 5 ? record.level : 0],
+                    (unsigned)record.millis));
+    const uint8_t* arg = record.data;
+    const uint8_t* end = record.data + record.length;
+    const char* f = record.format;
+    while (*f && n < size - 2) {
+        if (*f != '%' || f[1] == '%') {
+            line[n++] = *f;
+            f += *f == '%' ? 2 : 1;
+            continue;
+        }
+        // keep flags, width and precision; the tag replaces any length modifier
+        char spec[16] = "%";
+        size_t s = 1;
+        f++;
+        while (*f && strchr("-+ #0123456789.", *f) && s < sizeof(spec) - 4) spec[s++] = *f++;
+        while (*f && strchr("hlLqjzt", *f)) f++;
+        char conversion = *f ? *f++ : 's';
+
+        uint8_t tag = arg < end ? *arg++ : 0xff;
+        int64_t integer = 0;
+        double real = 0;
+        char text[LOG_RECORD_BYTES] = "?";
+        switch (tag) {
+        case INT32: {
+            int32_t v;
+            memcpy(&v, arg, 4);
+            integer = v;
+            real = v;
+            arg += 4;
+            break;
+        }
+        case UINT32:
+        case POINTER: {
+            uint32_t v;
+            memcpy(&v, arg, 4);
+            integer = v;
+            real = v;
+            arg += 4;
+            break;
+        }
+        case INT64:
+        case UINT64:
+            memcpy(&integer, arg, 8);
+            real = tag == INT64 ? (double)integer : (double)(uint64_t)integer;
+            arg += 8;
+            break;
+        case DOUBLE:
+            memcpy(&real, arg, 8);
+            integer = (int64_t)real;
+            arg += 8;
+            break;
+        case STRING: {
+            uint8_t length = *arg++;
+            memcpy(text, arg, length);
+            text[length] = '\0';
+            arg += length;
+            break;
+        }
+        default: // missing argument
+            arg = end;
+            break;
+        }
+
+        if (conversion == 'c' && tag != STRING) {
+            spec[s++] = 'c';
+            spec[s] = '\0';
+            append(snprintf(line + n, size - n, spec, (int)integer));
+        } else if (strchr("diouxX", conversion) && tag != STRING) {
+            spec[s++] = 'l';
+            spec[s++] = 'l';
+            spec[s++] = conversion;
+            spec[s] = '\0';
+            append(snprintf(line + n, size - n, spec, (long long)integer));
+        } else if (strchr("fFeEgGaA", conversion) && tag != STRING) {
+            spec[s++] = conversion;
+            spec[s] = '\0';
+            append(snprintf(line + n, size - n, spec, real));
+        } else if (conversion == 'p' && tag != STRING) {
+            append(snprintf(line + n, size - n, "%p", (void*)(uintptr_t)integer));
+        } else {
+            spec[s++] = 's';
+            spec[s] = '\0';
+            append(snprintf(line + n, size - n, spec, text));
+        }
+    }
+    if (n == 0 || line[n - 1] != '\n') line[n++] = '\n';
+    line[n] = '\0';
+    return n;
+}
@@ -0,0 +1,141 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include <type_traits>
+
+// Leveled logging that stays off the caller's hot path. Call sites above
+// LOGGER_LEVEL compile to nothing (their arguments are not evaluated);
+// the rest copy the format pointer and raw arguments into a lock-free
+// ring, and a low-priority task formats them and writes them to Serial.
+//
+// Formats must be string literals (only the pointer is kept). String
+// arguments are copied, truncated to what fits the record.
+#define LOGGER_NONE 0
+#define LOGGER_ERROR 1
+#define LOGGER_WARN 2
+#define LOGGER_INFO 3
+#define LOGGER_DEBUG 4
+
+#ifndef LOGGER_LEVEL
+#define LOGGER_LEVEL LOGGER_INFO
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_ERROR
+#define LOG_ERROR(...) Logger::write(LOGGER_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+#if LOGGER_LEVEL >= LOGGER_WARN
+#define LOG_WARN(...) Logger::write(LOGGER_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+#if LOGGER_LEVEL >= LOGGER_INFO
+#define LOG_INFO(...) Logger::write(LOGGER_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+#if LOGGER_LEVEL >= LOGGER_DEBUG
+#define LOG_DEBUG(...) Logger::write(LOGGER_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+const uint16_t LOG_RING_SLOTS = 32;    // power of two
+const uint8_t LOG_RECORD_BYTES = 80;   // encoded arguments per record
+const uint16_t LOG_LINE_SIZE = 192;    // longest formatted line
+const uint32_t LOG_DRAIN_INTERVAL = 20; // ms between drains
+const UBaseType_t LOG_DRAIN_PRIORITY = 1;
+
+class Logger {
+public:
+    // Starts the drain task; records written before it are kept until the
+    // ring fills up.
+    static void begin(UBaseType_t priority = LOG_DRAIN_PRIORITY, BaseType_t core = 1);
+    // Records dropped because the ring was full.
+    static uint32_t dropped() { return droppedCount.load(std::memory_order_relaxed); }
+
+    template <typename... Args>
+    static void write(uint8_t level, const char* format, const Args&... args) {
+        Record* record = claim();
+        if (!record) return;
+        record->millis = millis();
+        record->format = format;
+        record->level = level;
+        record->length = 0;
+        encode(*record, args...);
+        commit(record);
+    }
+
+private:
+    // argument encodings, each a tag byte followed by the value
+    enum Tag : uint8_t { INT32, UINT32, INT64, UINT64, DOUBLE, STRING, POINTER };
+
+    struct Record {
+        std::atomic<uint32_t> sequence; // lap the slot is in, see claim()
+        uint32_t millis;
+        const char* format;
+        uint8_t level;
+        uint8_t length;
+        uint8_t data[LOG_RECORD_BYTES];
+    };
+
+    static Record ring[LOG_RING_SLOTS];
+    static std::atomic<uint32_t> writePosition;
+    static uint32_t readPosition;
+    static std::atomic<uint32_t> droppedCount;
+    static TaskHandle_t drainTask;
+
+    static Record* claim();
+    static void commit(Record* record);
+    static bool drainOne(char* line, size_t size);
+    static void drain(void* parameter);
+    static size_t format(const Record& record, char* line, size_t size);
+
+    static void put(Record& record, Tag tag, const void* value, uint8_t size) {
+        if (record.length + 1 + size > LOG_RECORD_BYTES) return;
+        record.data[record.length++] = tag;
+        memcpy(&record.data[record.length], value, size);
+        record.length += size;
+    }
+
+    static void putString(Record& record, const char* s) {
+        if (!s) s = "(null)";
+        if (record.length + 2 > LOG_RECORD_BYTES) return;
+        size_t n = strnlen(s, LOG_RECORD_BYTES - record.length - 2);
+        record.data[record.length++] = STRING;
+        record.data[record.length++] = (uint8_t)n;
+        memcpy(&record.data[record.length], s, n);
+        record.length += n;
+    }
+
+    static void encode(Record&) {}
+
+    template <typename T, typename... Rest>
+    static void encode(Record& record, const T& value, const Rest&... rest) {
+        encodeOne(record, value);
+        encode(record, rest...);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+    encodeOne(Record& record, T value) {
+        if (sizeof(T) > 4) {
+            int64_t v = (int64_t)value;
+            put(record, std::is_signed<T>::value ? INT64 : UINT64, &v, sizeof(v));
+        } else {
+            int32_t v = (int32_t)value;
+            put(record, std::is_signed<T>::value ? INT32 : UINT32, &v, sizeof(v));
+        }
+    }
+
+    static void encodeOne(Record& record, double value) { put(record, DOUBLE, &value, sizeof(value)); }
+    static void encodeOne(Record& record, const char* value) { putString(record, value); }
+    static void encodeOne(Record& record, const String& value) { putString(record, value.c_str()); }
+    static void encodeOne(Record& record, const void* value) { put(record, POINTER, &value, sizeof(value)); }
+};
+
+#endif
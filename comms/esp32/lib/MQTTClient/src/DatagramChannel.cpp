@@ -0,0 +1,56 @@
+#include "DatagramChannel.hpp"
+#include "Logger.hpp"
+#include <WiFi.h>
+
+DatagramChannel::DatagramChannel() : port(0), routes(), routeCount(0), lock(nullptr), stats() {}
+
+bool DatagramChannel::setGateway(const char* address, uint16_t gatewayPort) {
+    if (!gateway.fromString(address)) {
+        LOG_ERROR("Invalid datagram gateway %s", address);
+        return false;
+    }
+    if (!lock) lock = xSemaphoreCreateMutex();
+    port = gatewayPort;
+    return lock != nullptr;
+}
+
+bool DatagramChannel::addRoute(const char* topic, uint16_t topicId) {
+    if (routeCount == DATAGRAM_ROUTES || strlen(topic) >= DATAGRAM_TOPIC_SIZE) return false;
+    Route& route = routes[routeCount++];
+    strcpy(route.topic, topic);
+    route.topicId = topicId;
+    route.sequence = 0;
+    return true;
+}
+
+int8_t DatagramChannel::routeIndex(const char* topic) const {
+    for (uint8_t i = 0; i < routeCount; i++) {
+        if (strcmp(routes[i].topic, topic) == 0) return i;
+    }
+    return -1;
+}
+
+bool DatagramChannel::hasRoute(const char* topic) const {
+    return routeIndex(topic) >= 0;
+}
+
+bool DatagramChannel::send(const char* topic, const uint8_t* data, size_t length) {
+    int8_t index = routeIndex(topic);
+    if (index < 0 || !lock) return false;
+    Route* route = &routes[index];
+    uint8_t packet[MQTTSN_MAX_PACKET];
+    xSemaphoreTake(lock, portMAX_DELAY);
+    size_t n = mqttSnEncodePublish(packet, sizeof(packet), route->topicId, route->sequence, data, length);
+    bool sent = n > 0 && WiFi.status() == WL_CONNECTED && udp.beginPacket(gateway, port) &&
+                udp.write(packet, n) == n && udp.endPacket();
+    if (sent) {
+        // only sent datagrams use up a number, so gaps at the receiver are losses
+        route->sequence++;
+        stats.sent++;
+        stats.bytes += n;
+    } else {
+        stats.failed++;
+    }
+    xSemaphoreGive(lock);
+    return sent;
+}
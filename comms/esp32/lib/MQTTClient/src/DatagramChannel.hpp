@@ -0,0 +1,55 @@
+#ifndef DATAGRAM_CHANNEL_HPP
+#define DATAGRAM_CHANNEL_HPP
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "MqttSn.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+const uint8_t DATAGRAM_ROUTES = 4;
+const uint8_t DATAGRAM_TOPIC_SIZE = 48;
+
+struct DatagramStats {
+    uint32_t sent;
+    uint32_t failed;    // no WiFi, or the stack refused the datagram
+    uint32_t bytes;
+};
+
+// Topics that bypass the TLS connection: every publish is one MQTT-SN
+// QoS -1 datagram to a gateway, which forwards it to the broker. Meant for
+// small streams that are stale as soon as a newer message exists (gesture
+// frames), where a lost packet should cost that one message instead of
+// holding every newer one behind a TCP retransmission. Datagrams are
+// neither encrypted nor retried, and carry a per-topic sequence number.
+class DatagramChannel {
+private:
+    struct Route {
+        char topic[DATAGRAM_TOPIC_SIZE];
+        uint16_t topicId;     // predefined on the gateway
+        uint16_t sequence;
+    };
+
+    WiFiUDP udp;
+    IPAddress gateway;
+    uint16_t port;
+    Route routes[DATAGRAM_ROUTES];
+    uint8_t routeCount;
+    SemaphoreHandle_t lock;   // created with the gateway; senders may be any task
+    DatagramStats stats;
+
+    int8_t routeIndex(const char* topic) const;  // -1 if none
+
+public:
+    DatagramChannel();
+
+    // `address` is an IP literal: no DNS lookup on the publishing task.
+    bool setGateway(const char* address, uint16_t port = MQTTSN_DEFAULT_PORT);
+    bool addRoute(const char* topic, uint16_t topicId);
+    bool hasRoute(const char* topic) const;
+    // False if the topic has no route or the datagram did not go out.
+    bool send(const char* topic, const uint8_t* data, size_t length);
+    const DatagramStats& getStats() const { return stats; }
+};
+
+#endif
@@ -0,0 +1,126 @@
+#include "LinkMetrics.hpp"
+#include <Arduino.h>
+
+void LatencyHistogram::record(uint32_t us) {
+    uint8_t i = 0;
+    while (i < METRICS_BUCKETS - 1 && us >= (METRICS_BUCKET_US << i)) i++;
+    buckets[i]++;
+    count++;
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t p) const {
+    if (count == 0) return 0;
+    uint32_t rank = ((uint64_t)count * p + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < METRICS_BUCKETS - 1; i++) {
+        seen += buckets[i];
+        // the bucket bound, but never above what was actually seen
+        if (seen >= rank) return (METRICS_BUCKET_US << i) < maxUs ? METRICS_BUCKET_US << i : maxUs;
+    }
+    return maxUs;
+}
+
+LinkMetrics::LinkMetrics()
+    : publishes(), roundTrips(), publishFailures(0), topics(), topicCount(0), probeSequence(0), probeSentUs(0),
+      probeOutstanding(false), probesSent(0), probesLost(0), lastRttUs(0), rssiLast(0), rssiMin(0), rssiTotal(0),
+      rssiSamples(0) {
+    strcpy(topics[METRICS_TOPICS].topic, "other");
+}
+
+// Linear search: there are only a handful of topics and the first ones
+// registered are the busy ones.
+TopicTraffic& LinkMetrics::traffic(const char* topic) {
+    for (uint8_t i = 0; i < topicCount; i++) {
+        if (strcmp(topics[i].topic, topic) == 0) return topics[i];
+    }
+    if (topicCount == METRICS_TOPICS || strlen(topic) >= METRICS_TOPIC_SIZE) return topics[METRICS_TOPICS];
+    strcpy(topics[topicCount].topic, topic);
+    return topics[topicCount++];
+}
+
+void LinkMetrics::recordPublish(const char* topic, size_t bytes, uint32_t durationUs, bool ok) {
+    publishes.record(durationUs);
+    if (!ok) {
+        publishFailures++;
+        return;
+    }
+    TopicTraffic& t = traffic(topic);
+    t.messages++;
+    t.bytes += bytes;
+}
+
+void LinkMetrics::recordRssi(int8_t rssi) {
+    // 0 means the station is not associated
+    if (rssi == 0) return;
+    rssiLast = rssi;
+    if (rssiSamples == 0 || rssi < rssiMin) rssiMin = rssi;
+    rssiTotal += rssi;
+    rssiSamples++;
+}
+
+size_t LinkMetrics::startProbe(uint8_t* payload, size_t size) {
+    if (size < sizeof(probeSequence)) return 0;
+    if (probeOutstanding) probesLost++;
+    probeSequence++;
+    memcpy(payload, &probeSequence, sizeof(probeSequence));
+    probeSentUs = micros();
+    probeOutstanding = true;
+    probesSent++;
+    return sizeof(probeSequence);
+}
+
+bool LinkMetrics::probeReply(const uint8_t* payload, size_t length) {
+    uint32_t sequence;
+    if (length != sizeof(sequence)) return false;
+    memcpy(&sequence, payload, sizeof(sequence));
+    // a late reply to a probe already counted as lost is ignored
+    if (!probeOutstanding || sequence != probeSequence) return true;
+    probeOutstanding = false;
+    lastRttUs = micros() - probeSentUs;
+    roundTrips.record(lastRttUs);
+    return true;
+}
+
+void LinkMetrics::expireProbe() {
+    if (probeOutstanding && micros() - probeSentUs > METRICS_PROBE_TIMEOUT * 1000) {
+        probeOutstanding = false;
+        probesLost++;
+    }
+}
+
+size_t LinkMetrics::snapshot(char* json, size_t size, const ConnectionStats& connection) {
+    int n = snprintf(json, size,
+                     "{\"type\": \"LINK\", \"rssi\": {\"last\": %d, \"min\": %d, \"avg\": %d}, "
+                     "\"publish\": {\"count\": %u, \"failed\": %u, \"avgUs\": %u, \"p50Us\": %u, \"p99Us\": %u, "
+                     "\"maxUs\": %u, \"hist\": [",
+                     rssiLast, rssiMin, (int)(rssiSamples ? rssiTotal / (int32_t)rssiSamples : 0), publishes.count,
+                     publishFailures, (uint32_t)(publishes.count ? publishes.totalUs / publishes.count : 0),
+                     publishes.percentile(50), publishes.percentile(99), publishes.maxUs);
+    for (uint8_t i = 0; i < METRICS_BUCKETS && n < (int)size; i++) {
+        n += snprintf(json + n, size - n, "%s%u", i ? ", " : "", publishes.buckets[i]);
+    }
+    if (n < (int)size) {
+        n += snprintf(json + n, size - n,
+                      "]}, \"rtt\": {\"probes\": %u, \"lost\": %u, \"lastUs\": %u, \"p50Us\": %u, \"p99Us\": %u, "
+                      "\"maxUs\": %u}, \"reconnect\": {\"connects\": %u, \"failures\": %u, \"lastConnectMs\": %u, "
+                      "\"lastOutageMs\": %u, \"maxOutageMs\": %u}, \"topics\": [",
+                      probesSent, probesLost, lastRttUs, roundTrips.percentile(50), roundTrips.percentile(99),
+                      roundTrips.maxUs, connection.connects, connection.failures, connection.lastConnectMs,
+                      connection.lastOutageMs, connection.maxOutageMs);
+    }
+    // topics go in whole and the closing "]}" always fits, so the JSON stays valid
+    const int closing = 2;
+    if (n + closing >= (int)size) return 0;
+    for (uint8_t i = 0; i <= METRICS_TOPICS; i++) {
+        const TopicTraffic& t = topics[i];
+        if (i < METRICS_TOPICS ? i >= topicCount : t.messages == 0) continue;
+        int entry = snprintf(json + n, size - n - closing, "%s{\"topic\": \"%s\", \"messages\": %u, \"bytes\": %u}",
+                             json[n - 1] == '[' ? "" : ", ", t.topic, t.messages, t.bytes);
+        if (n + entry + closing >= (int)size) break;
+        n += entry;
+    }
+    n += snprintf(json + n, size - n, "]}");
+    return n;
+}
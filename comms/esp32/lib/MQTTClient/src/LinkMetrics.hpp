@@ -0,0 +1,93 @@
+#ifndef LINK_METRICS_HPP
+#define LINK_METRICS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Link quality and publish cost, recorded by the task running
+// MQTTClient::loop() and published by it as one compact JSON snapshot.
+// Recording is a few counter updates, so it stays on in production.
+const char MQTT_DEBUG_TOPIC[] = "debug/status";
+const char MQTT_PROBE_TOPIC_PREFIX[] = "esp32/probe/";  // followed by the client id
+
+const uint8_t METRICS_BUCKETS = 12;       // powers of two from METRICS_BUCKET_US up
+const uint32_t METRICS_BUCKET_US = 128;   // upper bound of the first bucket
+const uint8_t METRICS_TOPICS = 8;         // topics counted separately, the rest as "other"
+const uint8_t METRICS_TOPIC_SIZE = 32;
+const uint32_t METRICS_SNAPSHOT_INTERVAL = 30000;  // ms, 0 turns the snapshot off
+const uint32_t METRICS_PROBE_INTERVAL = 10000;     // ms, 0 turns the probe off
+const uint32_t METRICS_PROBE_TIMEOUT = 5000;       // ms before a probe counts as lost
+// every counter at its widest and all topics at METRICS_TOPIC_SIZE - 1
+// come to 1482 bytes
+const uint16_t METRICS_SNAPSHOT_SIZE = 1536;
+
+// Durations in log2 buckets: bucket i counts values below
+// METRICS_BUCKET_US << i, the last one everything longer.
+struct LatencyHistogram {
+    uint32_t buckets[METRICS_BUCKETS];
+    uint32_t count;
+    uint64_t totalUs;
+    uint32_t maxUs;
+
+    void record(uint32_t us);
+    // Upper bound of the bucket holding the p-th percentile, capped at
+    // maxUs; 0 if empty.
+    uint32_t percentile(uint8_t p) const;
+};
+
+struct ConnectionStats {
+    uint32_t connects;
+    uint32_t failures;
+    uint32_t lastConnectMs;   // TCP, TLS and MQTT CONNECT together
+    uint32_t lastOutageMs;    // connection lost until connected again
+    uint32_t maxOutageMs;
+};
+
+struct TopicTraffic {
+    char topic[METRICS_TOPIC_SIZE];
+    uint32_t messages;
+    uint32_t bytes;
+};
+
+class LinkMetrics {
+private:
+    LatencyHistogram publishes;   // time spent in the publish call
+    LatencyHistogram roundTrips;  // probe published until it came back
+    uint32_t publishFailures;
+    TopicTraffic topics[METRICS_TOPICS + 1];  // the last one is "other"
+    uint8_t topicCount;
+    // broker round-trip probe, one outstanding at a time
+    uint32_t probeSequence;
+    uint32_t probeSentUs;
+    bool probeOutstanding;
+    uint32_t probesSent;
+    uint32_t probesLost;
+    uint32_t lastRttUs;
+    int8_t rssiLast;
+    int8_t rssiMin;
+    int32_t rssiTotal;
+    uint32_t rssiSamples;
+
+    TopicTraffic& traffic(const char* topic);
+
+public:
+    LinkMetrics();
+
+    void recordPublish(const char* topic, size_t bytes, uint32_t durationUs, bool ok);
+    void recordRssi(int8_t rssi);
+
+    // Fills the probe payload and returns its length. An earlier probe
+    // still unanswered is counted as lost.
+    size_t startProbe(uint8_t* payload, size_t size);
+    // Matches a reply against the outstanding probe; false if it is not one.
+    bool probeReply(const uint8_t* payload, size_t length);
+    // Gives up on a probe unanswered for METRICS_PROBE_TIMEOUT.
+    void expireProbe();
+
+    // Writes the snapshot as JSON, with the reconnect counters MQTTClient
+    // keeps, and returns its length. Topics that do not fit `size` are
+    // left out whole; 0 if not even the rest fits.
+    size_t snapshot(char* json, size_t size, const ConnectionStats& connection);
+};
+
+#endif
@@ -1,70 +1,118 @@
 #include "MQTTClient.hpp"
+#include "Logger.hpp"
 #include "esp_system.h"
 #include <Arduino.h>
+#include <WiFi.h>
 
-MQTTClient* MQTTClient::instance = nullptr;
-std::map<String, std::function<void(const String&)>> MQTTClient::topicCallbacks;
+MQTTClient::MQTTClient(TlsClient& client, CertificateManager& certManager)
+    : tlsClient(client), certificateManager(certManager), 
+      mqttClient(client), lastReconnectAttempt(0), lastMessageTime(0), connection(),
+      disconnectedAt(0), metrics(), snapshotInterval(METRICS_SNAPSHOT_INTERVAL),
+      probeInterval(METRICS_PROBE_INTERVAL), lastSnapshot(0), lastProbe(0), topicCallbacks(), sentCallback(), deviceId(),
+      topicNamespace() {
+    probeTopic[0] = '\0';
+}
 
-MQTTClient::MQTTClient(WiFiClientSecure& client, CertificateManager& certManager)
-    : wifiClient(client), certificateManager(certManager), 
-      mqttClient(client), lastReconnectAttempt(0), lastMessageTime(0) {
-    instance = this;
+void MQTTClient::setDevice(const char* id, bool namespaced) {
+    snprintf(deviceId, sizeof(deviceId), "%s", id);
+    if (namespaced) {
+        snprintf(topicNamespace, sizeof(topicNamespace), "%s%s/", MQTT_NAMESPACE_ROOT, deviceId);
+    } else {
+        topicNamespace[0] = '\0';
+    }
 }
 
-String MQTTClient::generateClientId() {
-    return "ESP32Client-" + String(random(0xffff), HEX);
+// Topic as the broker sees it; `buffer` holds MQTT_WIRE_TOPIC_SIZE bytes.
+const char* MQTTClient::wireTopic(const char* topic, char* buffer) const {
+    if (!topicNamespace[0]) return topic;
+    snprintf(buffer, MQTT_WIRE_TOPIC_SIZE, "%s%s", topicNamespace, topic);
+    return buffer;
 }
 
 bool MQTTClient::loadCertificates() {
-    Serial.println("Loading SSL certificates...");
+    LOG_INFO("Loading SSL certificates...");
     
     if (!certificateManager.loadCertificates()) {
-        Serial.println("ERROR: Failed to load certificates");
+        LOG_ERROR("Failed to load certificates");
         return false;
     }
     
-    certificateManager.applyCertificates(&wifiClient);
-    return true;
+    return certificateManager.applyCertificates(&tlsClient);
 }
 
 bool MQTTClient::initialize() {
     if (!loadCertificates()) {
-        Serial.println("WARNING: SSL certificate loading failed. Connection may be insecure.");
+        LOG_WARN("SSL certificate loading failed. The broker cannot be reached without them.");
     }
     
     mqttClient.setServer(MQTT_HOST, atoi(MQTT_PORT_NUMBER));
-    mqttClient.setCallback(messageCallback);
+    mqttClient.setCallback([this](char* topic, byte* payload, unsigned int length) {
+        handleMessage(topic, payload, length);
+    });
     mqttClient.setBufferSize(BUFFER_SIZE);
     mqttClient.setSocketTimeout(NETWORK_TIMEOUT);
 
+    if (!deviceId[0]) {
+        // stable across reboots and unique per board, unlike a random id
+        uint64_t mac = ESP.getEfuseMac();
+        snprintf(deviceId, sizeof(deviceId), "%s%02x%02x%02x", MQTT_CLIENT_ID_PREFIX, (unsigned)(mac >> 24) & 0xff,
+                 (unsigned)(mac >> 32) & 0xff, (unsigned)(mac >> 40) & 0xff);
+    }
+    char spillPath[QUEUE_SPILL_PATH_SIZE];
+    if (topicNamespace[0]) {
+        snprintf(spillPath, sizeof(spillPath), "/%s.spill", deviceId);
+    } else {
+        strcpy(spillPath, QUEUE_SPILL_PATH);
+    }
+    if (!outbound.begin(spillPath)) {
+        LOG_ERROR("Failed to create the outbound queues");
+        return false;
+    }
+
     randomSeed(esp_random());
     
-    Serial.println("MQTT client initialized.");
+    LOG_INFO("MQTT client initialized.");
     return true;
 }
 
 bool MQTTClient::connect() {
     if (mqttClient.connected()) return true;
     
-    Serial.print("Connecting to MQTT broker...");
-    String clientId = generateClientId();
-    
-    if (mqttClient.connect(clientId.c_str(), MQTT_USER, MQTT_PASS)) {
-        Serial.println(" connected!");
+    LOG_INFO("Connecting to MQTT broker...");
+    unsigned long start = millis();
+    if (mqttClient.connect(deviceId, MQTT_USER, MQTT_PASS)) {
+        unsigned long now = millis();
+        connection.connects++;
+        connection.lastConnectMs = now - start;
+        if (disconnectedAt) {
+            connection.lastOutageMs = now - disconnectedAt;
+            if (connection.lastOutageMs > connection.maxOutageMs) connection.maxOutageMs = connection.lastOutageMs;
+            disconnectedAt = 0;
+            LOG_INFO("Reconnected after %lu ms", (unsigned long)connection.lastOutageMs);
+        }
+        LOG_INFO("Connected to MQTT broker as %s in %lu ms", deviceId, (unsigned long)connection.lastConnectMs);
         
         publishStatus("online");
         
-        if (mqttClient.subscribe(MQTT_COMMAND_TOPIC)) {
-            Serial.println("Subscribed to command topic.");
+        char buffer[MQTT_WIRE_TOPIC_SIZE];
+        if (mqttClient.subscribe(wireTopic(MQTT_COMMAND_TOPIC, buffer))) {
+            LOG_INFO("Subscribed to command topic.");
         } else {
-            Serial.println("WARNING: Failed to subscribe to command topic.");
+            LOG_WARN("Failed to subscribe to command topic.");
+        }
+        // already unique per device, so never namespaced
+        snprintf(probeTopic, sizeof(probeTopic), "%s%s", MQTT_PROBE_TOPIC_PREFIX, deviceId);
+        mqttClient.subscribe(probeTopic);
+        // the session is clean, so callbacks need their subscriptions again
+        for (uint8_t i = 0; i < topicCallbacks.size(); i++) {
+            subscribe(topicCallbacks.filter(i));
         }
         
         return true;
     }
     
-    Serial.print(" failed! Error code: ");
-    Serial.println(mqttClient.state());
+    connection.failures++;
+    LOG_ERROR("MQTT connection failed! Error code: %d", mqttClient.state());
     return false;
 }
 
@@ -78,11 +126,9 @@ void MQTTClient::handleReconnection() {
     if (now - lastReconnectAttempt > MQTT_RECONNECT_DELAY) {
         lastReconnectAttempt = now;
         
-        Serial.println("Attempting MQTT reconnection...");
+        LOG_INFO("Attempting MQTT reconnection...");
         if (!connect()) {
-            Serial.print("MQTT reconnection failed. Retrying in ");
-            Serial.print(MQTT_RECONNECT_DELAY / 1000);
-            Serial.println(" seconds...");
+            LOG_WARN("MQTT reconnection failed. Retrying in %lu seconds...", MQTT_RECONNECT_DELAY / 1000);
         }
     }
 }
@@ -90,82 +136,318 @@ void MQTTClient::handleReconnection() {
 void MQTTClient::loop() {
     if (mqttClient.connected()) {
         mqttClient.loop();
+        serviceMetrics();
     } else {
+        if (!disconnectedAt && connection.connects > 0) disconnectedAt = millis();
         handleReconnection();
     }
+    drainOutbound();
+}
+
+// Control first, then anything spilled during an outage (it is older than
+// what is queued behind it), then normal and bulk traffic. A QoS 1 head
+// that fails blocks its queue, so per-priority order is kept.
+void MQTTClient::drainOutbound() {
+    uint8_t budget = QUEUE_DRAIN_BUDGET;
+    OutboundEntry entry;
+    for (uint8_t priority = 0; priority < PRIORITY_COUNT && budget > 0; priority++) {
+        if (priority == PRIORITY_NORMAL) {
+            for (uint8_t i = 0; i < QUEUE_REPLAY_BUDGET && budget > 0; i++) {
+                if (!mqttClient.connected() || !outbound.hasSpilled() || !replaySpilled()) break;
+                budget--;
+            }
+        }
+        while (budget > 0 && outbound.peek(priority, entry)) {
+            budget--;
+            if (!sendQueued(priority, entry)) break;
+        }
+    }
+}
+
+// False when the entry stays queued for another attempt.
+bool MQTTClient::sendQueued(uint8_t priority, OutboundEntry& entry) {
+    if (mqttClient.connected()) {
+        bool sent = entry.source
+                        ? publishStream(entry.topic, entry.length, *entry.source)
+                        : publishFlat(entry.topic, entry.data ? entry.data : entry.payload, entry.length);
+        if (sent) {
+            LOG_DEBUG("Published queued %s (%u bytes)", entry.topic, entry.length);
+            outbound.complete(priority, entry, OUTBOUND_SENT);
+            if (sentCallback) sentCallback(entry.topic);
+            return true;
+        }
+        LOG_WARN("Failed to publish queued %s", entry.topic);
+        if (entry.qos > 0 && outbound.retry(priority) < QUEUE_MAX_ATTEMPTS) return false;
+    }
+    if (entry.qos == 0) {
+        outbound.complete(priority, entry, OUTBOUND_DROPPED);
+    } else if (outbound.spill(entry, priority)) {
+        outbound.complete(priority, entry, OUTBOUND_SPILLED);
+    } else {
+        outbound.complete(priority, entry, OUTBOUND_DROPPED);
+    }
+    return true;
+}
+
+bool MQTTClient::replaySpilled() {
+    return outbound.replayOne([this](const char* topic, size_t length, File& file) {
+        uint32_t start = micros();
+        if (!beginPublish(topic, length)) return false;
+        uint8_t chunk[QUEUE_REPLAY_CHUNK];
+        size_t remaining = length;
+        while (remaining > 0) {
+            size_t n = file.read(chunk, remaining < sizeof(chunk) ? remaining : sizeof(chunk));
+            if (n == 0 || mqttClient.write(chunk, n) != n) break;
+            remaining -= n;
+        }
+        // a short message cannot be taken back, so the connection is dropped
+        // rather than leaving the broker waiting for the rest of it
+        if (remaining > 0) {
+            LOG_ERROR("Replay of %s cut short", topic);
+            mqttClient.disconnect();
+            return false;
+        }
+        LOG_DEBUG("Replayed %s (%u bytes)", topic, length);
+        bool sent = mqttClient.endPublish() == 1;
+        metrics.recordPublish(topic, length, micros() - start, sent);
+        return sent;
+    });
+}
+
+bool MQTTClient::fitsBuffer(const char* topic, size_t length) const {
+    return MQTT_PUBLISH_OVERHEAD + strlen(topic) + length <= BUFFER_SIZE;
+}
+
+// Small packets go out in one write from the packet buffer, larger ones
+// are streamed straight from `data`.
+bool MQTTClient::publishFlat(const char* topic, const uint8_t* data, size_t length, bool retain) {
+    char buffer[MQTT_WIRE_TOPIC_SIZE];
+    const char* wire = wireTopic(topic, buffer);
+    if (fitsBuffer(wire, length)) {
+        uint32_t start = micros();
+        bool sent = mqttClient.publish(wire, data, length, retain);
+        metrics.recordPublish(topic, length, micros() - start, sent);
+        return sent;
+    }
+    PayloadSource source = [data, length](size_t offset, const uint8_t*& span) {
+        span = data + offset;
+        return length - offset;
+    };
+    return publishStream(topic, length, source, retain);
+}
+
+bool MQTTClient::beginPublish(const char* topic, size_t length, bool retain) {
+    char buffer[MQTT_WIRE_TOPIC_SIZE];
+    return mqttClient.connected() && mqttClient.beginPublish(wireTopic(topic, buffer), length, retain);
+}
+
+size_t MQTTClient::write(const uint8_t* data, size_t size) {
+    return mqttClient.write(data, size);
+}
+
+bool MQTTClient::endPublish() {
+    return mqttClient.endPublish() == 1;
+}
+
+bool MQTTClient::publishStream(const char* topic, size_t length, const PayloadSource& source, bool retain) {
+    uint32_t start = micros();
+    if (!beginPublish(topic, length, retain)) return false;
+    size_t offset = 0;
+    while (offset < length) {
+        const uint8_t* data;
+        size_t n = source(offset, data);
+        if (n == 0) break;
+        if (n > length - offset) n = length - offset;
+        if (write(data, n) != n) break;
+        offset += n;
+    }
+    if (offset < length) {
+        LOG_ERROR("Publish to %s cut short at %u of %u bytes", topic, offset, length);
+        mqttClient.disconnect();
+        metrics.recordPublish(topic, length, micros() - start, false);
+        return false;
+    }
+    bool sent = endPublish();
+    metrics.recordPublish(topic, length, micros() - start, sent);
+    return sent;
+}
+
+void MQTTClient::setMetricsInterval(uint32_t ms, uint32_t probeMs) {
+    snapshotInterval = ms;
+    probeInterval = probeMs;
+}
+
+size_t MQTTClient::metricsSnapshot(char* json, size_t size) {
+    return metrics.snapshot(json, size, connection);
+}
+
+// Runs on every connected loop(), so the common case is two comparisons.
+void MQTTClient::serviceMetrics() {
+    unsigned long now = millis();
+    metrics.expireProbe();
+    if (probeInterval && now - lastProbe >= probeInterval) {
+        lastProbe = now;
+        metrics.recordRssi(WiFi.RSSI());
+        uint8_t payload[4];
+        size_t n = metrics.startProbe(payload, sizeof(payload));
+        // straight to PubSubClient: probes are not counted as traffic
+        mqttClient.publish(probeTopic, payload, n, false);
+    }
+    if (snapshotInterval && now - lastSnapshot >= snapshotInterval) {
+        lastSnapshot = now;
+        size_t n = metrics.snapshot(snapshotJson, sizeof(snapshotJson), connection);
+        if (n > 0) publishFlat(MQTT_DEBUG_TOPIC, reinterpret_cast<const uint8_t*>(snapshotJson), n);
+    }
+}
+
+bool MQTTClient::routeOverDatagram(const char* topic, uint16_t topicId) {
+    return datagram.addRoute(topic, topicId);
+}
+
+bool MQTTClient::setDatagramGateway(const char* address, uint16_t port) {
+    return datagram.setGateway(address, port);
+}
+
+bool MQTTClient::enqueue(const char* topic, const uint8_t* data, size_t size, uint8_t priority, uint8_t qos) {
+    if (datagram.hasRoute(topic)) {
+        if (!datagram.send(topic, data, size)) return false;
+        if (sentCallback) sentCallback(topic);
+        return true;
+    }
+    if (size > QUEUE_INLINE_SIZE || strlen(topic) >= QUEUE_TOPIC_SIZE) return false;
+    OutboundEntry entry;
+    strcpy(entry.topic, topic);
+    entry.data = nullptr;
+    entry.source = nullptr;
+    entry.length = size;
+    entry.qos = qos;
+    entry.done = nullptr;
+    entry.sent = nullptr;
+    memcpy(entry.payload, data, size);
+    return outbound.push(entry, priority);
+}
+
+bool MQTTClient::enqueueAndWait(const char* topic, const uint8_t* data, size_t size, uint8_t priority, uint8_t qos) {
+    if (strlen(topic) >= QUEUE_TOPIC_SIZE) return false;
+    OutboundEntry entry;
+    strcpy(entry.topic, topic);
+    entry.data = data;
+    entry.source = nullptr;
+    entry.length = size;
+    entry.qos = qos;
+    return pushAndWait(entry, priority);
+}
+
+bool MQTTClient::enqueueStreamAndWait(const char* topic, size_t length, const PayloadSource& source,
+                                      uint8_t priority, uint8_t qos) {
+    if (strlen(topic) >= QUEUE_TOPIC_SIZE) return false;
+    OutboundEntry entry;
+    strcpy(entry.topic, topic);
+    entry.data = nullptr;
+    entry.source = &source;
+    entry.length = length;
+    entry.qos = qos;
+    return pushAndWait(entry, priority);
+}
+
+bool MQTTClient::pushAndWait(OutboundEntry& entry, uint8_t priority) {
+    bool sent = false;
+    entry.done = xSemaphoreCreateBinary();
+    entry.sent = &sent;
+    if (!entry.done) return false;
+    if (outbound.push(entry, priority, portMAX_DELAY)) {
+        // the looping task always answers, even when the publish fails
+        xSemaphoreTake(entry.done, portMAX_DELAY);
+    }
+    vSemaphoreDelete(entry.done);
+    return sent;
+}
+
+bool MQTTClient::waitForOutbound(uint32_t ms) {
+    return outbound.wait(ms);
+}
+
+uint32_t MQTTClient::outboundWaiting() const {
+    return outbound.waiting();
+}
+
+const OutboundStats& MQTTClient::outboundStats() {
+    return outbound.getStats();
 }
 
 void MQTTClient::publishStatus(const String& status) {
     if (mqttClient.connected()) {
-        mqttClient.publish(MQTT_STATUS_TOPIC, status.c_str(), true); // retained
-        Serial.println("Status published: " + status);
+        publishFlat(MQTT_STATUS_TOPIC, reinterpret_cast<const uint8_t*>(status.c_str()), status.length(),
+                    true); // retained
+        LOG_INFO("Status published: %s", status);
     }
 }
 
 bool MQTTClient::publish(const String& topic, const String& message, bool retain) {
     if (mqttClient.connected()) {
-        bool result = mqttClient.publish(topic.c_str(), message.c_str(), retain);
+        bool result = publishFlat(topic.c_str(), reinterpret_cast<const uint8_t*>(message.c_str()),
+                                  message.length(), retain);
         if (result) {
-            Serial.println("Published to " + topic + ": " + message);
+            LOG_DEBUG("Published to %s: %s", topic, message);
         } else {
-            Serial.println("ERROR: Failed to publish to " + topic);
+            LOG_ERROR("Failed to publish to %s", topic);
         }
         return result;
     }
-    Serial.println("ERROR: Cannot publish - MQTT not connected!");
+    LOG_ERROR("Cannot publish - MQTT not connected!");
     return false;
 }
 
 bool MQTTClient::subscribe(const String& topic) {
     if (mqttClient.connected()) {
-        bool result = mqttClient.subscribe(topic.c_str());
+        char buffer[MQTT_WIRE_TOPIC_SIZE];
+        bool result = mqttClient.subscribe(wireTopic(topic.c_str(), buffer));
         if (result) {
-            Serial.println("Subscribed to: " + topic);
+            LOG_INFO("Subscribed to: %s", topic);
         } else {
-            Serial.println("ERROR: Failed to subscribe to: " + topic);
+            LOG_ERROR("Failed to subscribe to: %s", topic);
         }
         return result;
     }
-    Serial.println("ERROR: Cannot subscribe - MQTT not connected!");
+    LOG_ERROR("Cannot subscribe - MQTT not connected!");
     return false;
 }
 
 bool MQTTClient::publishBinary(const String& topic, const uint8_t* data, size_t size) {
-    char buffer[BUFFER_SIZE];
+    return publishBinary(topic.c_str(), data, size);
+}
+
+bool MQTTClient::publishBinary(const char* topic, const uint8_t* data, size_t size) {
     if (mqttClient.connected()) {
-        bool result = mqttClient.publish(topic.c_str(), data, size, false);
+        bool result = publishFlat(topic, data, size);
         if (result) {
-            Serial.print("Published binary to ");
-            Serial.print(topic);
-            Serial.print(" (");
-            Serial.print(sizeof(data));
-            Serial.println(" bytes)");
+            LOG_DEBUG("Published binary to %s (%u bytes)", topic, size);
         } else {
-            Serial.println("ERROR: Failed to publish to " + topic);
+            LOG_ERROR("Failed to publish to %s", topic);
         }
         return result;
     }
-    Serial.println("ERROR: Cannot publish - MQTT not connected!");
+    LOG_ERROR("Cannot publish - MQTT not connected!");
     return false;
 }
 
-void MQTTClient::registerCallback(const String& topic, std::function<void(const String& message)> callback) {
-    topicCallbacks[topic] = callback;
+bool MQTTClient::registerCallback(const char* filter, MessageCallback callback) {
+    if (!topicCallbacks.add(filter, callback)) {
+        LOG_ERROR("Cannot register callback for %s", filter);
+        return false;
+    }
+    return true;
 }
 
-void MQTTClient::messageCallback(char* topic, byte* payload, unsigned int length) {
-    String message;
-    for (unsigned int i = 0; i < length; i++) {
-        message += (char)payload[i];
+void MQTTClient::handleMessage(char* topic, byte* payload, unsigned int length) {
+    LOG_DEBUG("Message received [%s] (%u bytes)", topic, length);
+    if (strcmp(topic, probeTopic) == 0) {
+        metrics.probeReply(payload, length);
+        return;
     }
-
-    String topicStr = String(topic);
-    Serial.printf("Message received [%s]: %s\n", topic, message.c_str());
-
-    auto it = topicCallbacks.find(topicStr);
-    if (it != topicCallbacks.end()) {
-        it->second(message); 
-    } else {
-        Serial.println("No callback registered for this topic.");
+    size_t prefix = strlen(topicNamespace);
+    if (prefix && strncmp(topic, topicNamespace, prefix) == 0) topic += prefix;
+    if (topicCallbacks.dispatch(topic, payload, length) == 0) {
+        LOG_DEBUG("No callback registered for %s", topic);
     }
 }
\ No newline at end of file
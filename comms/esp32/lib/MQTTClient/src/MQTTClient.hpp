@@ -2,10 +2,12 @@
 #define MQTT_CLIENT_HPP
 
 #include <PubSubClient.h>
-#include <WiFiClientSecure.h>
+#include "TlsClient.hpp"
 #include "CertificateManager.hpp"
-#include <map>
-#include <functional>
+#include "DatagramChannel.hpp"
+#include "LinkMetrics.hpp"
+#include "OutboundQueue.hpp"
+#include "TopicTable.hpp"
 
 const char MQTT_HOST[] = MQTT_SERVER;
 const char MQTT_PORT_NUMBER[] = MQTT_PORT;
@@ -16,24 +18,64 @@ const char MQTT_COMMAND_TOPIC[] = "esp32/command";
 
 const unsigned long MQTT_RECONNECT_DELAY = 5000;
 const unsigned long MESSAGE_PUBLISH_INTERVAL = 3000;
-const uint16_t BUFFER_SIZE = 65535;
+// PubSubClient's packet buffer, allocated once on the heap. Inbound
+// messages must fit it; longer outbound ones are streamed to the socket.
+const uint16_t BUFFER_SIZE = 2048;
+const uint8_t MQTT_PUBLISH_OVERHEAD = 7;  // fixed header and topic length
 const uint16_t NETWORK_TIMEOUT = 2;
 
+// Each client is one device: its id is the MQTT client id, and with a
+// namespace every topic it publishes or subscribes to is sent as
+// "<MQTT_NAMESPACE_ROOT><id>/<topic>", so several devices share a broker.
+const char MQTT_CLIENT_ID_PREFIX[] = "ESP32Client-";
+const char MQTT_NAMESPACE_ROOT[] = "glove/";
+const uint8_t MQTT_DEVICE_ID_SIZE = 24;
+const uint8_t MQTT_NAMESPACE_SIZE = 32;
+const uint8_t MQTT_WIRE_TOPIC_SIZE = MQTT_NAMESPACE_SIZE + TOPIC_FILTER_SIZE;
+
+typedef std::function<void(const char* topic)> SentCallback;
+
 class MQTTClient {
 private:
-    WiFiClientSecure& wifiClient;
+    TlsClient& tlsClient;
     CertificateManager& certificateManager;
     PubSubClient mqttClient;
     unsigned long lastReconnectAttempt;
     unsigned long lastMessageTime;
-    static std::map<String, std::function<void(const String&)>> topicCallbacks;
+    OutboundQueue outbound;
+    DatagramChannel datagram;
+    ConnectionStats connection;
+    unsigned long disconnectedAt;  // 0 while connected or before the first connect
+    LinkMetrics metrics;
+    char probeTopic[QUEUE_TOPIC_SIZE];
+    uint32_t snapshotInterval;
+    uint32_t probeInterval;
+    unsigned long lastSnapshot;
+    unsigned long lastProbe;
+    char snapshotJson[METRICS_SNAPSHOT_SIZE];  // too large for the looping task's stack
+    TopicTable topicCallbacks;
+    SentCallback sentCallback;
+    char deviceId[MQTT_DEVICE_ID_SIZE];
+    char topicNamespace[MQTT_NAMESPACE_SIZE];  // empty, or "<root><id>/"
     
-    String generateClientId();
     bool loadCertificates();
+    const char* wireTopic(const char* topic, char* buffer) const;
+    void handleMessage(char* topic, byte* payload, unsigned int length);
+    bool sendQueued(uint8_t priority, OutboundEntry& entry);
+    bool replaySpilled();
+    bool fitsBuffer(const char* topic, size_t length) const;
+    bool publishFlat(const char* topic, const uint8_t* data, size_t length, bool retain = false);
+    bool pushAndWait(OutboundEntry& entry, uint8_t priority);
+    void serviceMetrics();
 
 public:
-    MQTTClient(WiFiClientSecure& client, CertificateManager& certManager);
+    MQTTClient(TlsClient& client, CertificateManager& certManager);
     
+    // Before initialize(). Without it the id is MQTT_CLIENT_ID_PREFIX and
+    // the last three bytes of the MAC, and topics are not namespaced. A
+    // namespaced device also spills to its own file, "/<id>.spill".
+    void setDevice(const char* id, bool namespaced);
+    const char* getDeviceId() const { return deviceId; }
     bool initialize();
     bool connect();
     bool isConnected();
@@ -43,11 +85,67 @@ public:
     bool publish(const String& topic, const String& message, bool retain = false);
     bool subscribe(const String& topic);
     bool publishBinary(const String& topic, const uint8_t* data, size_t size);
+    bool publishBinary(const char* topic, const uint8_t* data, size_t size);
+
+    // Streaming publish for the task running loop(): `length` bytes must be
+    // written between beginPublish() and endPublish(), in any number of
+    // pieces, and never pass through the packet buffer. publishStream()
+    // pulls them from `source`; a short payload drops the connection, as
+    // the broker would otherwise wait for the rest of it.
+    bool beginPublish(const char* topic, size_t length, bool retain = false);
+    size_t write(const uint8_t* data, size_t size);
+    bool endPublish();
+    bool publishStream(const char* topic, size_t length, const PayloadSource& source, bool retain = false);
+
+    // Queued publishes, sent by loop() in priority order. enqueue() copies
+    // up to QUEUE_INLINE_SIZE bytes and returns at once; enqueueAndWait()
+    // sends `data` in place and blocks until it was sent, spilled or dropped.
+    bool enqueue(const char* topic, const uint8_t* data, size_t size,
+                 uint8_t priority = PRIORITY_NORMAL, uint8_t qos = 0);
+    bool enqueueAndWait(const char* topic, const uint8_t* data, size_t size,
+                        uint8_t priority = PRIORITY_BULK, uint8_t qos = 1);
+    // Like enqueueAndWait() for a payload in pieces; `source` must stay
+    // valid until it returns.
+    bool enqueueStreamAndWait(const char* topic, size_t length, const PayloadSource& source,
+                              uint8_t priority = PRIORITY_BULK, uint8_t qos = 1);
+    // Sends `topic` as MQTT-SN datagrams to the gateway instead of over TLS
+    // (see DatagramChannel); `topicId` must map to it on the gateway.
+    // enqueue() on such a topic sends from the calling task right away and
+    // never queues: without WiFi the message is dropped, as it would be stale
+    // by the time it could go out.
+    bool routeOverDatagram(const char* topic, uint16_t topicId);
+    bool setDatagramGateway(const char* address, uint16_t port = MQTTSN_DEFAULT_PORT);
+    const DatagramStats& datagramStats() const { return datagram.getStats(); }
+    // Called with the topic (without the namespace) once a queued publish
+    // was handed to the socket or a datagram was sent, on the task that
+    // sent it. Spilled messages replayed later do not count. Set it before
+    // connect().
+    void onSent(SentCallback callback) { sentCallback = callback; }
+    // The part of loop() that empties the queues, for the looping task
+    // while there is no network to connect over yet: disconnected, QoS 1
+    // messages are spilled and the rest dropped, so no producer blocked in
+    // enqueueAndWait() waits for the network.
+    void drainOutbound();
+    // Blocks the looping task until something is queued or `ms` passed.
+    bool waitForOutbound(uint32_t ms);
+    uint32_t outboundWaiting() const;
+    const OutboundStats& outboundStats();
+    const ConnectionStats& connectionStats() const { return connection; }
+    const TlsStats& tlsStats() const { return tlsClient.getStats(); }
+
+    // loop() publishes a link snapshot (RSSI, publish call durations,
+    // broker round trips, reconnects, bytes per topic) on MQTT_DEBUG_TOPIC
+    // every `ms`, and probes the round trip every `probeMs` by publishing
+    // to its own probe topic. 0 turns either off. The round trip ends when
+    // loop() reads the reply, so it includes up to one poll interval.
+    void setMetricsInterval(uint32_t ms, uint32_t probeMs = METRICS_PROBE_INTERVAL);
+    size_t metricsSnapshot(char* json, size_t size);
     
-    static void messageCallback(char* topic, byte* payload, unsigned int length);
-    void registerCallback(const String& topic, std::function<void(const String& message)> callback);
-    
-    static MQTTClient* instance;
+    // `filter` may use the + and # wildcards, and is subscribed to on every
+    // connect. Register before connect(): the table is read from the task
+    // running loop() without a lock. Callbacks see topics without the
+    // device namespace.
+    bool registerCallback(const char* filter, MessageCallback callback);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "MqttSn.hpp"
+#include <string.h>
+
+size_t mqttSnEncodePublish(uint8_t* packet, size_t size, uint16_t topicId, uint16_t sequence,
+                           const uint8_t* payload, size_t length) {
+    // the length is one byte up to 255, else 0x01 and two bytes
+    size_t total = MQTTSN_PUBLISH_HEADER + length;
+    size_t lengthBytes = total > 255 ? 3 : 1;
+    total += lengthBytes - 1;
+    if (total > size || total > 0xffff) return 0;
+    uint8_t* p = packet;
+    if (lengthBytes == 1) {
+        *p++ = total;
+    } else {
+        *p++ = 0x01;
+        *p++ = total >> 8;
+        *p++ = total & 0xff;
+    }
+    *p++ = MQTTSN_PUBLISH;
+    *p++ = MQTTSN_FLAGS_QOS_M1 | MQTTSN_TOPIC_PREDEFINED;
+    *p++ = topicId >> 8;
+    *p++ = topicId & 0xff;
+    *p++ = sequence >> 8;
+    *p++ = sequence & 0xff;
+    memcpy(p, payload, length);
+    return total;
+}
+
+bool mqttSnDecodePublish(const uint8_t* packet, size_t length, uint16_t& topicId, uint16_t& sequence,
+                         const uint8_t*& payload, size_t& payloadLength) {
+    if (length < MQTTSN_PUBLISH_HEADER) return false;
+    size_t total = packet[0];
+    const uint8_t* p = packet + 1;
+    if (total == 0x01) {
+        if (length < MQTTSN_PUBLISH_HEADER + 2) return false;
+        total = packet[1] << 8 | packet[2];
+        p = packet + 3;
+    }
+    if (total != length) return false;
+    if (p[0] != MQTTSN_PUBLISH || p[1] != (MQTTSN_FLAGS_QOS_M1 | MQTTSN_TOPIC_PREDEFINED)) return false;
+    topicId = p[2] << 8 | p[3];
+    sequence = p[4] << 8 | p[5];
+    payload = p + 6;
+    payloadLength = packet + length - payload;
+    return true;
+}
+
+SequenceFilter::SequenceFilter(uint32_t resetMs)
+    : last(0), lastMs(0), started(false), resetMs(resetMs), staleCount(0) {}
+
+bool SequenceFilter::accept(uint16_t sequence, uint32_t nowMs) {
+    if (started && nowMs - lastMs < resetMs && (int16_t)(sequence - last) <= 0) {
+        staleCount++;
+        return false;
+    }
+    started = true;
+    last = sequence;
+    lastMs = nowMs;
+    return true;
+}
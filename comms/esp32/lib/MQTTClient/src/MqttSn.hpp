@@ -0,0 +1,46 @@
+#ifndef MQTT_SN_HPP
+#define MQTT_SN_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// MQTT-SN 1.2 PUBLISH with QoS -1: a single datagram to a gateway, with no
+// connection, registration or acknowledgement, addressed by a topic id
+// predefined on the gateway. The message id is unused at QoS -1; here it
+// carries a per-topic sequence number so receivers can drop frames that
+// arrive after a newer one. Plain C++, so host tools share it.
+const uint8_t MQTTSN_PUBLISH = 0x0c;
+const uint8_t MQTTSN_FLAGS_QOS_M1 = 0x60;       // QoS bits 11
+const uint8_t MQTTSN_TOPIC_PREDEFINED = 0x01;
+const uint8_t MQTTSN_PUBLISH_HEADER = 7;        // with the 1-byte length
+const uint16_t MQTTSN_MAX_PACKET = 512;
+const uint16_t MQTTSN_DEFAULT_PORT = 1885;
+
+// Writes the datagram into `packet` and returns its length, 0 if it does
+// not fit `size`.
+size_t mqttSnEncodePublish(uint8_t* packet, size_t size, uint16_t topicId, uint16_t sequence,
+                           const uint8_t* payload, size_t length);
+// Parses a QoS -1 PUBLISH with a predefined topic id; `payload` points into
+// `packet`. False for anything else.
+bool mqttSnDecodePublish(const uint8_t* packet, size_t length, uint16_t& topicId, uint16_t& sequence,
+                         const uint8_t*& payload, size_t& payloadLength);
+
+// Accepts a sequence number only if it is newer than the last accepted one
+// (16-bit serial arithmetic). After `resetMs` without traffic anything is
+// accepted again, so a restarted sender is not locked out.
+class SequenceFilter {
+private:
+    uint16_t last;
+    uint32_t lastMs;
+    bool started;
+    uint32_t resetMs;
+    uint32_t staleCount;
+
+public:
+    explicit SequenceFilter(uint32_t resetMs = 2000);
+
+    bool accept(uint16_t sequence, uint32_t nowMs);
+    uint32_t stale() const { return staleCount; }
+};
+
+#endif
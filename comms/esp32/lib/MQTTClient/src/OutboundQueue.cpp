@@ -0,0 +1,184 @@
+#include "OutboundQueue.hpp"
+#include "Logger.hpp"
+
+OutboundQueue::OutboundQueue()
+    : pending(nullptr), spillPath(), spillSize(0), replayOffset(0), bootSpillSize(0), spillTorn(false), pushed(0),
+      rejected(0), stats() {
+    for (uint8_t p = 0; p < PRIORITY_COUNT; p++) {
+        queues[p] = nullptr;
+        attempts[p] = 0;
+    }
+}
+
+bool OutboundQueue::begin(const char* path) {
+    if (pending) return true;
+    snprintf(spillPath, sizeof(spillPath), "%s", path);
+    UBaseType_t total = 0;
+    for (uint8_t p = 0; p < PRIORITY_COUNT; p++) {
+        queues[p] = xQueueCreate(QUEUE_LENGTH[p], sizeof(OutboundEntry));
+        if (!queues[p]) return false;
+        total += QUEUE_LENGTH[p];
+    }
+    pending = xSemaphoreCreateCounting(total, 0);
+    if (!pending) return false;
+
+    // messages left over from before a reboot are replayed like any other,
+    // up to a record torn by a power cut
+    if (SPIFFS.exists(spillPath)) {
+        File file = SPIFFS.open(spillPath, FILE_READ);
+        if (file) {
+            uint32_t size = file.size();
+            uint32_t offset = 0;
+            SpillHeader header;
+            while (offset + sizeof(header) <= size && file.seek(offset) &&
+                   file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) == sizeof(header)) {
+                uint32_t next = offset + sizeof(header) + header.topicLength + header.length;
+                if (header.topicLength >= QUEUE_TOPIC_SIZE || next > size) break;
+                offset = next;
+            }
+            file.close();
+            spillSize = offset;
+            bootSpillSize = offset;
+            if (offset == 0) {
+                clearSpill();
+            } else {
+                spillTorn = offset < size;
+                LOG_INFO("%u spilled bytes waiting for replay", spillSize);
+            }
+        }
+    }
+    return true;
+}
+
+bool OutboundQueue::push(OutboundEntry& entry, uint8_t priority, TickType_t timeout) {
+    if (priority >= PRIORITY_COUNT) priority = PRIORITY_BULK;
+    entry.enqueuedUs = micros();
+    if (!pending || xQueueSend(queues[priority], &entry, timeout) != pdTRUE) {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        LOG_WARN("Outbound queue %u full, dropping %s", priority, entry.topic);
+        return false;
+    }
+    pushed.fetch_add(1, std::memory_order_relaxed);
+    xSemaphoreGive(pending);
+    return true;
+}
+
+bool OutboundQueue::wait(uint32_t ms) {
+    return pending && xSemaphoreTake(pending, pdMS_TO_TICKS(ms)) == pdTRUE;
+}
+
+uint32_t OutboundQueue::waiting() const {
+    uint32_t total = 0;
+    for (uint8_t p = 0; p < PRIORITY_COUNT; p++) {
+        if (queues[p]) total += uxQueueMessagesWaiting(queues[p]);
+    }
+    return total;
+}
+
+bool OutboundQueue::peek(uint8_t priority, OutboundEntry& entry) {
+    if (!queues[priority]) return false;
+    uint16_t depth = uxQueueMessagesWaiting(queues[priority]);
+    if (depth > stats.maxDepth[priority]) stats.maxDepth[priority] = depth;
+    return xQueuePeek(queues[priority], &entry, 0) == pdTRUE;
+}
+
+void OutboundQueue::complete(uint8_t priority, OutboundEntry& entry, OutboundOutcome outcome) {
+    // `entry` is the peeked copy, so the head can be discarded in place
+    xQueueReceive(queues[priority], &entry, 0);
+    attempts[priority] = 0;
+    if (outcome == OUTBOUND_SENT) {
+        stats.sent++;
+        delivered(priority, micros() - entry.enqueuedUs);
+    } else if (outcome == OUTBOUND_DROPPED) {
+        stats.dropped++;
+    }
+    if (entry.done) {
+        *entry.sent = outcome != OUTBOUND_DROPPED;
+        xSemaphoreGive(entry.done);
+    }
+}
+
+uint8_t OutboundQueue::retry(uint8_t priority) {
+    stats.retries++;
+    return ++attempts[priority];
+}
+
+void OutboundQueue::delivered(uint8_t priority, uint32_t latencyUs) {
+    stats.delivered[priority]++;
+    stats.totalLatencyUs[priority] += latencyUs;
+    if (latencyUs > stats.maxLatencyUs[priority]) stats.maxLatencyUs[priority] = latencyUs;
+}
+
+bool OutboundQueue::spill(const OutboundEntry& entry, uint8_t priority) {
+    if (spillTorn) {
+        LOG_WARN("Spill file torn until replayed, dropping %s", entry.topic);
+        return false;
+    }
+    SpillHeader header;
+    header.priority = priority;
+    header.topicLength = strnlen(entry.topic, QUEUE_TOPIC_SIZE - 1);
+    header.reserved = 0;
+    header.length = entry.length;
+    // milliseconds, so the age survives a reboot as well as micros() would
+    header.enqueuedMs = millis() - (micros() - entry.enqueuedUs) / 1000;
+
+    uint32_t size = sizeof(header) + header.topicLength + header.length;
+    if (spillSize + size > QUEUE_SPILL_MAX_BYTES) {
+        LOG_WARN("Spill file full, dropping %s", entry.topic);
+        return false;
+    }
+    File file = SPIFFS.open(spillPath, FILE_APPEND);
+    if (!file) {
+        LOG_ERROR("Cannot open %s", spillPath);
+        return false;
+    }
+    size_t written = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    written += file.write(reinterpret_cast<const uint8_t*>(entry.topic), header.topicLength);
+    if (entry.source) {
+        for (size_t offset = 0; offset < entry.length;) {
+            const uint8_t* data;
+            size_t n = (*entry.source)(offset, data);
+            if (n == 0) break;
+            if (n > entry.length - offset) n = entry.length - offset;
+            written += file.write(data, n);
+            offset += n;
+        }
+    } else {
+        written += file.write(entry.data ? entry.data : entry.payload, header.length);
+    }
+    file.close();
+    if (written != size) {
+        // SPIFFS cannot cut the torn record off, and appending behind it
+        // would misalign replay: spill nothing more until the records
+        // before it are replayed and the file is removed
+        LOG_ERROR("Short write to %s", spillPath);
+        if (replayOffset >= spillSize) {
+            clearSpill();
+        } else {
+            spillTorn = true;
+        }
+        return false;
+    }
+    spillSize += size;
+    stats.spilled++;
+    return true;
+}
+
+void OutboundQueue::clearSpill() {
+    SPIFFS.remove(spillPath);
+    spillSize = 0;
+    replayOffset = 0;
+    bootSpillSize = 0;
+    spillTorn = false;
+}
+
+const OutboundStats& OutboundQueue::getStats() {
+    stats.enqueued = pushed.load(std::memory_order_relaxed);
+    stats.rejected = rejected.load(std::memory_order_relaxed);
+    for (uint8_t p = 0; p < PRIORITY_COUNT; p++) {
+        stats.depth[p] = queues[p] ? uxQueueMessagesWaiting(queues[p]) : 0;
+        if (stats.depth[p] > stats.maxDepth[p]) stats.maxDepth[p] = stats.depth[p];
+    }
+    stats.spillBytes = spillSize - replayOffset;
+    return stats;
+}
@@ -0,0 +1,165 @@
+#ifndef OUTBOUND_QUEUE_HPP
+#define OUTBOUND_QUEUE_HPP
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <atomic>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "Logger.hpp"
+
+// Publishes waiting for the task that runs MQTTClient::loop(). Each
+// priority has its own bounded queue and lower numbers are drained first,
+// so control messages overtake voice chunks.
+enum PublishPriority : uint8_t { PRIORITY_CONTROL, PRIORITY_NORMAL, PRIORITY_BULK, PRIORITY_COUNT };
+
+// QoS 0 messages are dropped when they cannot be sent. QoS 1 messages are
+// retried and, while the broker is unreachable, spilled to SPIFFS and
+// replayed after the reconnect (also across reboots). PubSubClient cannot
+// publish with QoS 1 itself, so "delivered" means handed to the socket.
+const uint8_t QUEUE_TOPIC_SIZE = 48;
+const uint16_t QUEUE_INLINE_SIZE = 320;
+const uint8_t QUEUE_LENGTH[PRIORITY_COUNT] = {4, 8, 4};
+const uint8_t QUEUE_MAX_ATTEMPTS = 3;     // failed sends before a QoS 1 message is spilled
+const uint8_t QUEUE_DRAIN_BUDGET = 8;     // messages per loop(), so keepalives still run
+const uint8_t QUEUE_REPLAY_BUDGET = 4;    // spilled messages per loop()
+const uint16_t QUEUE_REPLAY_CHUNK = 256;  // bytes streamed from SPIFFS per write
+const uint32_t QUEUE_SPILL_MAX_BYTES = 128 * 1024;
+const char QUEUE_SPILL_PATH[] = "/outbound.spill";
+const uint8_t QUEUE_SPILL_PATH_SIZE = 32;  // SPIFFS limit, terminator included
+
+// A payload produced in pieces: points `data` at the bytes available from
+// `offset` on and returns how many there are (0 if none). A failed send is
+// restarted from offset 0, so a source must not consume what it returns.
+typedef std::function<size_t(size_t offset, const uint8_t*& data)> PayloadSource;
+
+struct OutboundEntry {
+    char topic[QUEUE_TOPIC_SIZE];
+    const uint8_t* data;      // NULL when the payload is inline
+    const PayloadSource* source; // set instead of data for streamed payloads
+    size_t length;
+    uint8_t qos;
+    uint32_t enqueuedUs;
+    SemaphoreHandle_t done;   // given once the entry is sent, spilled or dropped
+    bool* sent;               // true when it was sent or spilled
+    uint8_t payload[QUEUE_INLINE_SIZE];
+};
+
+enum OutboundOutcome : uint8_t { OUTBOUND_SENT, OUTBOUND_SPILLED, OUTBOUND_DROPPED };
+
+struct OutboundStats {
+    uint32_t enqueued;
+    uint32_t sent;
+    uint32_t rejected;        // queue full on enqueue
+    uint32_t dropped;         // QoS 0 that failed, or QoS 1 with the spill file full
+    uint32_t retries;
+    uint32_t spilled;
+    uint32_t replayed;
+    uint32_t spillBytes;      // waiting in SPIFFS
+    uint16_t depth[PRIORITY_COUNT];
+    uint16_t maxDepth[PRIORITY_COUNT];
+    // enqueue to wire, per priority
+    uint32_t delivered[PRIORITY_COUNT];
+    uint64_t totalLatencyUs[PRIORITY_COUNT];
+    uint32_t maxLatencyUs[PRIORITY_COUNT];
+};
+
+class OutboundQueue {
+private:
+    // on-flash layout of a spilled message, followed by topic and payload
+    struct SpillHeader {
+        uint8_t priority;
+        uint8_t topicLength;
+        uint16_t reserved;
+        uint32_t length;
+        uint32_t enqueuedMs;
+    };
+
+    QueueHandle_t queues[PRIORITY_COUNT];
+    SemaphoreHandle_t pending;
+    char spillPath[QUEUE_SPILL_PATH_SIZE];
+    uint32_t spillSize;     // bytes in the spill file, replayed ones included
+    uint32_t replayOffset;  // start of the oldest message not replayed yet
+    uint32_t bootSpillSize; // spilled before this boot, so of unknown age
+    bool spillTorn;         // a short write follows spillSize
+    // counted by the producers, folded into stats by getStats()
+    std::atomic<uint32_t> pushed;
+    std::atomic<uint32_t> rejected;
+    uint8_t attempts[PRIORITY_COUNT]; // failed sends of each queue's head
+    OutboundStats stats;
+
+    void delivered(uint8_t priority, uint32_t latencyUs);
+    void clearSpill();
+
+public:
+    OutboundQueue();
+
+    // `path` is the spill file; every queue needs its own.
+    bool begin(const char* path = QUEUE_SPILL_PATH);
+    // Any task. False if the queue stayed full for `timeout`.
+    bool push(OutboundEntry& entry, uint8_t priority, TickType_t timeout = 0);
+    // Blocks until something was pushed or `ms` passed.
+    bool wait(uint32_t ms);
+    // Messages still queued, not counting spilled ones.
+    uint32_t waiting() const;
+
+    // Draining task only. peek() leaves the head in place until complete()
+    // removes it and releases a waiting producer.
+    bool peek(uint8_t priority, OutboundEntry& entry);
+    void complete(uint8_t priority, OutboundEntry& entry, OutboundOutcome outcome);
+    // Counts a failed send of the head and returns the attempts so far.
+    uint8_t retry(uint8_t priority);
+    // Appends the entry to the spill file; false if it is full, or torn
+    // by a short write and not replayed yet.
+    bool spill(const OutboundEntry& entry, uint8_t priority);
+    bool hasSpilled() const { return replayOffset < spillSize; }
+    // Hands the oldest spilled message to `send(topic, length, file)`, with
+    // the file positioned at the payload, and removes it once `send`
+    // returns true.
+    template <typename Send>
+    bool replayOne(Send send);
+
+    const OutboundStats& getStats();
+};
+
+template <typename Send>
+bool OutboundQueue::replayOne(Send send) {
+    File file = SPIFFS.open(spillPath, FILE_READ);
+    if (!file || !file.seek(replayOffset)) {
+        if (file) file.close();
+        clearSpill();
+        return false;
+    }
+    SpillHeader header;
+    char topic[QUEUE_TOPIC_SIZE];
+    bool ok = file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) == sizeof(header) &&
+              header.topicLength < QUEUE_TOPIC_SIZE &&
+              replayOffset + sizeof(header) + header.topicLength + header.length <= spillSize &&
+              file.read(reinterpret_cast<uint8_t*>(topic), header.topicLength) == header.topicLength;
+    if (!ok) {
+        // spillSize only ever covers whole records, so the file is damaged
+        LOG_ERROR("Bad record in %s, dropping %u spilled bytes", spillPath, spillSize - replayOffset);
+        file.close();
+        clearSpill();
+        return false;
+    }
+    topic[header.topicLength] = '\0';
+    bool sent = send(topic, (size_t)header.length, file);
+    file.close();
+    if (!sent) return false;
+
+    bool sameBoot = replayOffset >= bootSpillSize;
+    replayOffset += sizeof(header) + header.topicLength + header.length;
+    stats.replayed++;
+    // millis() restarted since an older record was spilled
+    if (sameBoot) {
+        delivered(header.priority < PRIORITY_COUNT ? header.priority : PRIORITY_BULK,
+                  (millis() - header.enqueuedMs) * 1000);
+    }
+    if (replayOffset >= spillSize) clearSpill();
+    return true;
+}
+
+#endif
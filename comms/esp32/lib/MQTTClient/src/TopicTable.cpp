@@ -0,0 +1,112 @@
+#include "TopicTable.hpp"
+#include <string.h>
+
+TopicTable::TopicTable() : count(0) {}
+
+// FNV-1a, returning the length as well so the topic is only walked once
+uint32_t TopicTable::hashTopic(const char* topic, size_t& length) {
+    uint32_t hash = 2166136261u;
+    const char* p = topic;
+    for (; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    length = p - topic;
+    return hash;
+}
+
+bool TopicTable::compile(const char* filter, Entry& entry) {
+    size_t length = strlen(filter);
+    if (length == 0 || length >= TOPIC_FILTER_SIZE) return false;
+    memcpy(entry.filter, filter, length + 1);
+    entry.levelCount = 0;
+    entry.wildcard = false;
+    entry.multiLevel = false;
+
+    size_t start = 0;
+    for (size_t i = 0; i <= length; i++) {
+        if (i < length && filter[i] != '/') continue;
+        if (entry.levelCount == TOPIC_MAX_LEVELS) return false;
+        Level& level = entry.levels[entry.levelCount++];
+        level.offset = start;
+        level.length = i - start;
+        const char* text = filter + start;
+        // wildcards must fill a whole level, and # must be the last one
+        bool plus = memchr(text, '+', level.length) != nullptr;
+        bool hash = memchr(text, '#', level.length) != nullptr;
+        if ((plus || hash) && level.length != 1) return false;
+        if (hash && i != length) return false;
+        entry.wildcard |= plus || hash;
+        entry.multiLevel = hash;
+        start = i + 1;
+    }
+    size_t ignored;
+    entry.hash = hashTopic(filter, ignored);
+    return true;
+}
+
+bool TopicTable::matches(const Entry& entry, const char* topic, size_t length) {
+    // $SYS and the like are not matched by a leading wildcard
+    if (topic[0] == '$' && entry.wildcard) {
+        char first = entry.filter[0];
+        if ((first == '+' || first == '#') && entry.levels[0].length == 1) return false;
+    }
+    size_t position = 0;
+    bool exhausted = false;
+    for (uint8_t i = 0; i < entry.levelCount; i++) {
+        if (entry.multiLevel && i == entry.levelCount - 1) return true;
+        if (exhausted) return false;
+        const Level& level = entry.levels[i];
+        const char* text = entry.filter + level.offset;
+        const char* slash = static_cast<const char*>(memchr(topic + position, '/', length - position));
+        size_t end = slash ? slash - topic : length;
+        bool any = level.length == 1 && text[0] == '+';
+        if (!any && (end - position != level.length || memcmp(topic + position, text, level.length) != 0)) {
+            return false;
+        }
+        if (slash) {
+            position = end + 1;
+        } else {
+            exhausted = true;
+        }
+    }
+    return exhausted;
+}
+
+bool TopicTable::add(const char* filter, MessageCallback callback) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(entries[i].filter, filter) == 0) {
+            entries[i].callback = callback;
+            return true;
+        }
+    }
+    if (count == TOPIC_TABLE_SIZE || !compile(filter, entries[count])) return false;
+    entries[count++].callback = callback;
+    return true;
+}
+
+bool TopicTable::remove(const char* filter) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(entries[i].filter, filter) != 0) continue;
+        for (uint8_t j = i + 1; j < count; j++) entries[j - 1] = entries[j];
+        entries[--count].callback = nullptr;
+        return true;
+    }
+    return false;
+}
+
+uint8_t TopicTable::dispatch(const char* topic, const uint8_t* payload, size_t length) const {
+    size_t topicLength;
+    uint32_t hash = hashTopic(topic, topicLength);
+    uint8_t matched = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        const Entry& entry = entries[i];
+        bool match = entry.wildcard ? matches(entry, topic, topicLength)
+                                    : entry.hash == hash && strcmp(entry.filter, topic) == 0;
+        if (match) {
+            entry.callback(topic, payload, length);
+            matched++;
+        }
+    }
+    return matched;
+}
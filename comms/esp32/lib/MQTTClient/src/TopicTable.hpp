@@ -0,0 +1,58 @@
+#ifndef TOPIC_TABLE_HPP
+#define TOPIC_TABLE_HPP
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+// Inbound message handler. `payload` points into PubSubClient's buffer and
+// is only valid during the call; it is not NUL-terminated.
+typedef std::function<void(const char* topic, const uint8_t* payload, size_t length)> MessageCallback;
+
+const uint8_t TOPIC_TABLE_SIZE = 16;
+const uint8_t TOPIC_FILTER_SIZE = 64;
+const uint8_t TOPIC_MAX_LEVELS = 8;
+
+// Topic filters compiled once at registration, so dispatch neither
+// allocates nor copies. Supports the MQTT wildcards: `+` matches one level
+// and a trailing `#` matches the parent and everything below it. Filters
+// without wildcards are matched by hash first.
+class TopicTable {
+private:
+    struct Level {
+        uint8_t offset;
+        uint8_t length;
+    };
+
+    struct Entry {
+        char filter[TOPIC_FILTER_SIZE];
+        Level levels[TOPIC_MAX_LEVELS];
+        uint8_t levelCount;
+        bool wildcard;      // contains + or #
+        bool multiLevel;    // ends in #
+        uint32_t hash;      // of the whole filter when it has no wildcards
+        MessageCallback callback;
+    };
+
+    Entry entries[TOPIC_TABLE_SIZE];
+    uint8_t count;
+
+    static uint32_t hashTopic(const char* topic, size_t& length);
+    static bool compile(const char* filter, Entry& entry);
+    static bool matches(const Entry& entry, const char* topic, size_t length);
+
+public:
+    TopicTable();
+
+    // Replaces the callback of an identical filter. False if the filter is
+    // malformed, too long or the table is full.
+    bool add(const char* filter, MessageCallback callback);
+    bool remove(const char* filter);
+    // Calls every matching callback, in registration order, and returns
+    // how many there were.
+    uint8_t dispatch(const char* topic, const uint8_t* payload, size_t length) const;
+    uint8_t size() const { return count; }
+    const char* filter(uint8_t index) const { return entries[index].filter; }
+};
+
+#endif
@@ -1,52 +1,149 @@
 #include "Setup.hpp"
+#include "Logger.hpp"
 #include "time.h"
 #include "esp_wpa2.h"
-#include <WiFiClientSecure.h>
+#include <Preferences.h>
+#include <WiFi.h>
 
 const char *ntpServer = "pool.ntp.org";
 const long gmtOffset_sec = 0;
 const int daylightOffset_sec = 0;
 
-void setupTime() {
-    configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
-    Serial.println("Waiting for time sync...");
-    struct tm timeinfo;
-    while (!getLocalTime(&timeinfo)) {
-        Serial.print(".");
-        delay(500);
+// anything before this is the RTC's power-on default, not a synced clock
+static const time_t TIME_VALID_AFTER = 1600000000;
+
+enum WifiState { WIFI_IDLE, WIFI_CACHED, WIFI_SCANNING, WIFI_UP };
+
+static WifiState wifiState = WIFI_IDLE;
+static BootTimes times;
+static uint8_t cachedChannel = 0;
+static uint8_t cachedBssid[6];
+
+// Channel and BSSID of the last access point, kept in NVS so the next boot
+// can join without scanning every channel.
+static bool loadAp() {
+    Preferences prefs;
+    if (!prefs.begin("wifi", true)) return false;
+    cachedChannel = prefs.getUChar("channel", 0);
+    bool ok = cachedChannel != 0 && prefs.getBytes("bssid", cachedBssid, sizeof(cachedBssid)) == sizeof(cachedBssid);
+    prefs.end();
+    return ok;
+}
+
+static void saveAp() {
+    uint8_t channel = WiFi.channel();
+    uint8_t *bssid = WiFi.BSSID();
+    if (!bssid) return;
+    // only write when the AP changed, to spare the flash
+    if (channel == cachedChannel && memcmp(bssid, cachedBssid, sizeof(cachedBssid)) == 0) return;
+    Preferences prefs;
+    if (!prefs.begin("wifi", false)) return;
+    prefs.putUChar("channel", channel);
+    prefs.putBytes("bssid", bssid, sizeof(cachedBssid));
+    prefs.end();
+    cachedChannel = channel;
+    memcpy(cachedBssid, bssid, sizeof(cachedBssid));
+}
+
+static bool configureStaticIp() {
+    if (static_ip[0] == '\0') return false;
+    IPAddress ip, gw, mask, server;
+    if (!ip.fromString(static_ip) || !gw.fromString(static_gateway) || !mask.fromString(static_subnet)) {
+        LOG_ERROR("Invalid static IP configuration, using DHCP");
+        return false;
     }
-    Serial.println("\nTime synchronized");
+    if (!server.fromString(static_dns)) server = gw;
+    return WiFi.config(ip, gw, mask, server);
+}
 
-    time_t now = time(nullptr);
-    Serial.print("Current Time: ");
-    Serial.println(ctime(&now));
+static void associate(bool cached) {
+    const char *passphrase = strcmp(ssid_mode, "PEAP") == 0 ? nullptr : pass;
+    if (cached) {
+        WiFi.begin(ssid, passphrase, cachedChannel, cachedBssid);
+    } else {
+        WiFi.begin(ssid, passphrase);
+    }
 }
 
-void setupWifi() {
-    if (strcmp(ssid_mode, "PEAP") == 0) {
-        Serial.print("Connecting to WPA2-Enterprise SSID: ");
-        Serial.println(ssid);
+void beginWifi() {
+    times.wifiStartMs = millis();
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_STA);
+    // the channel/BSSID cache below replaces the SDK's own flash copy
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(true);
 
-        WiFi.disconnect(true);
-        WiFi.mode(WIFI_STA);
+    if (strcmp(ssid_mode, "PEAP") == 0) {
+        LOG_INFO("Connecting to WPA2-Enterprise SSID: %s", ssid);
 
         // Set WPA2 Enterprise credentials
         esp_wifi_sta_wpa2_ent_set_identity((uint8_t *)WIFI_SSID, strlen(WIFI_SSID));
         esp_wifi_sta_wpa2_ent_set_username((uint8_t *)WIFI_USER, strlen(WIFI_USER));
         esp_wifi_sta_wpa2_ent_set_password((uint8_t *)WIFI_PASS, strlen(WIFI_PASS));
         esp_wifi_sta_wpa2_ent_enable();
-        WiFi.begin(ssid);
     } else {
-        Serial.print("Attempting to connect to WPA SSID: ");
-        Serial.println(ssid);
-        WiFi.begin(ssid, pass);
+        LOG_INFO("Attempting to connect to WPA SSID: %s", ssid);
     }
-    while (WiFi.status() != WL_CONNECTED) {
-        Serial.print(".");
-        delay(100);
+
+    times.staticIp = configureStaticIp();
+    bool cached = loadAp();
+    if (cached) LOG_INFO("Joining cached AP on channel %u", cachedChannel);
+    associate(cached);
+    wifiState = cached ? WIFI_CACHED : WIFI_SCANNING;
+}
+
+bool wifiReady() {
+    if (WiFi.status() == WL_CONNECTED) {
+        if (wifiState != WIFI_UP) {
+            times.wifiMs = millis();
+            times.cachedAp = wifiState == WIFI_CACHED;
+            wifiState = WIFI_UP;
+            saveAp();
+            LOG_INFO("Connected to the WiFi network in %u ms", times.wifiMs - times.wifiStartMs);
+            LOG_INFO("Local ESP32 IP: %s", WiFi.localIP().toString());
+        }
+        return true;
+    }
+    if (wifiState == WIFI_CACHED && millis() - times.wifiStartMs > WIFI_CACHED_TIMEOUT) {
+        // the AP moved or changed channel: forget it and scan
+        LOG_WARN("Cached AP did not answer, scanning");
+        cachedChannel = 0;
+        WiFi.disconnect();
+        associate(false);
+        wifiState = WIFI_SCANNING;
     }
+    // after the first connect the SDK reconnects by itself
+    return false;
+}
+
+void beginTime() {
+    // SNTP runs in the background and retries until the network is up
+    configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
+}
+
+bool timeReady() {
+    if (times.timeMs) return true;
+    time_t now = time(nullptr);
+    if (now < TIME_VALID_AFTER) return false;
+    times.timeMs = millis();
+    LOG_INFO("Time synchronized");
+    LOG_INFO("Current Time: %s", ctime(&now));
+    return true;
+}
 
-    Serial.println("\nConnected to the WiFi network");
-    Serial.print("Local ESP32 IP: ");
-    Serial.println(WiFi.localIP());
+const BootTimes &bootTimes() { return times; }
+
+void setupTime() {
+    beginTime();
+    LOG_INFO("Waiting for time sync...");
+    while (!timeReady()) {
+        delay(500);
+    }
+}
+
+void setupWifi() {
+    beginWifi();
+    while (!wifiReady()) {
+        delay(100);
+    }
 }
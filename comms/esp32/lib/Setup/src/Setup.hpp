@@ -1,15 +1,57 @@
 #ifndef SETUP_HPP
 #define SETUP_HPP
 
+#include <stdint.h>
+
+#ifndef WIFI_STATIC_IP
+#define WIFI_STATIC_IP ""
+#endif
+#ifndef WIFI_GATEWAY
+#define WIFI_GATEWAY ""
+#endif
+#ifndef WIFI_SUBNET
+#define WIFI_SUBNET ""
+#endif
+#ifndef WIFI_DNS
+#define WIFI_DNS ""
+#endif
+
 const char ssid_mode[] = WIFI_MODE;
 const char ssid[] = WIFI_SSID;
 const char user[] = WIFI_USER;
 const char pass[] = WIFI_PASS;
+// Skips DHCP when set (dotted quads); the gateway doubles as DNS server
+// unless WIFI_DNS is given.
+const char static_ip[] = WIFI_STATIC_IP;
+const char static_gateway[] = WIFI_GATEWAY;
+const char static_subnet[] = WIFI_SUBNET;
+const char static_dns[] = WIFI_DNS;
 
 extern const char *ntpServer;
 extern const long gmtOffset_sec;
 extern const int daylightOffset_sec;
 
+// Time on the cached channel/BSSID before falling back to a full scan.
+const uint32_t WIFI_CACHED_TIMEOUT = 3000;
+
+// Milestones of the bring-up, in ms since boot; 0 until reached.
+struct BootTimes {
+    uint32_t wifiStartMs;
+    uint32_t wifiMs;     // associated and addressed
+    uint32_t timeMs;     // first NTP sync
+    bool cachedAp;       // joined through the cached channel/BSSID
+    bool staticIp;
+};
+
+// Non-blocking bring-up: beginWifi() and beginTime() return at once, and
+// wifiReady()/timeReady() are polled until they report true.
+void beginWifi();
+bool wifiReady();
+void beginTime();
+bool timeReady();
+const BootTimes &bootTimes();
+
+// Blocking versions of the above.
 void setupTime();
 void setupWifi();
 
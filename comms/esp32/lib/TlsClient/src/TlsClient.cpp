@@ -0,0 +1,274 @@
+#include "TlsClient.hpp"
+#include "Logger.hpp"
+#include "mbedtls/error.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/version.h"
+
+// mbedTLS 3 (arduino-esp32 3.x, ESP-IDF 5) made the handshake state private
+// and wants an RNG for key parsing; the platform is pinned to 2.x, this keeps
+// a platform update building.
+#if MBEDTLS_VERSION_MAJOR >= 3
+#define SSL_STATE(ssl) ((ssl).MBEDTLS_PRIVATE(state))
+#else
+#define SSL_STATE(ssl) ((ssl).state)
+#endif
+
+TlsClient::TlsClient()
+    : configured(false), hasSession(false), established(false), peeked(-1), stats() {
+    mbedtls_entropy_init(&entropy);
+    mbedtls_ctr_drbg_init(&drbg);
+    mbedtls_ssl_config_init(&config);
+    mbedtls_x509_crt_init(&caChain);
+    mbedtls_x509_crt_init(&ownCert);
+    mbedtls_pk_init(&ownKey);
+    mbedtls_ssl_init(&ssl);
+    mbedtls_ssl_session_init(&session);
+}
+
+TlsClient::~TlsClient() {
+    stop();
+    mbedtls_ssl_session_free(&session);
+    mbedtls_ssl_free(&ssl);
+    mbedtls_pk_free(&ownKey);
+    mbedtls_x509_crt_free(&ownCert);
+    mbedtls_x509_crt_free(&caChain);
+    mbedtls_ssl_config_free(&config);
+    mbedtls_ctr_drbg_free(&drbg);
+    mbedtls_entropy_free(&entropy);
+}
+
+void TlsClient::logError(const char* what, int error) {
+    char text[96];
+    mbedtls_strerror(error, text, sizeof(text));
+    LOG_ERROR("%s failed: -0x%04x %s", what, -error, text);
+}
+
+bool TlsClient::setCredentials(const uint8_t* ca, size_t caLength, const uint8_t* cert, size_t certLength,
+                               const uint8_t* key, size_t keyLength) {
+    if (configured) {
+        LOG_WARN("TLS credentials are already set");
+        return false;
+    }
+    int ret = mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy, nullptr, 0);
+    if (ret) {
+        logError("Seeding the TLS RNG", ret);
+        return false;
+    }
+    if ((ret = mbedtls_x509_crt_parse_der_nocopy(&caChain, ca, caLength)) != 0) {
+        logError("Parsing the CA certificate", ret);
+        return false;
+    }
+    if ((ret = mbedtls_x509_crt_parse_der_nocopy(&ownCert, cert, certLength)) != 0) {
+        logError("Parsing the client certificate", ret);
+        return false;
+    }
+#if MBEDTLS_VERSION_MAJOR >= 3
+    ret = mbedtls_pk_parse_key(&ownKey, key, keyLength, nullptr, 0, mbedtls_ctr_drbg_random, &drbg);
+#else
+    ret = mbedtls_pk_parse_key(&ownKey, key, keyLength, nullptr, 0);
+#endif
+    if (ret != 0) {
+        logError("Parsing the private key", ret);
+        return false;
+    }
+    ret = mbedtls_ssl_config_defaults(&config, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                      MBEDTLS_SSL_PRESET_DEFAULT);
+    if (ret) {
+        logError("Configuring TLS", ret);
+        return false;
+    }
+    mbedtls_ssl_conf_authmode(&config, MBEDTLS_SSL_VERIFY_REQUIRED);
+    mbedtls_ssl_conf_ca_chain(&config, &caChain, nullptr);
+    mbedtls_ssl_conf_rng(&config, mbedtls_ctr_drbg_random, &drbg);
+    if ((ret = mbedtls_ssl_conf_own_cert(&config, &ownCert, &ownKey)) != 0) {
+        logError("Configuring the client certificate", ret);
+        return false;
+    }
+    // the record buffers are allocated once here and kept across connections
+    if ((ret = mbedtls_ssl_setup(&ssl, &config)) != 0) {
+        logError("Setting up TLS", ret);
+        return false;
+    }
+    mbedtls_ssl_set_bio(&ssl, &tcp, sendCallback, receiveCallback, nullptr);
+    configured = true;
+    return true;
+}
+
+void TlsClient::forgetSession() {
+    mbedtls_ssl_session_free(&session);
+    mbedtls_ssl_session_init(&session);
+    hasSession = false;
+}
+
+int TlsClient::sendCallback(void* context, const unsigned char* buffer, size_t length) {
+    WiFiClient* tcp = static_cast<WiFiClient*>(context);
+    if (!tcp->connected()) return MBEDTLS_ERR_NET_CONN_RESET;
+    size_t written = tcp->write(buffer, length);
+    return written > 0 ? (int)written : MBEDTLS_ERR_SSL_WANT_WRITE;
+}
+
+int TlsClient::receiveCallback(void* context, unsigned char* buffer, size_t length) {
+    WiFiClient* tcp = static_cast<WiFiClient*>(context);
+    int n = tcp->read(buffer, length);
+    if (n > 0) return n;
+    return tcp->connected() ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_CONN_RESET;
+}
+
+bool TlsClient::handshake(const char* host) {
+    int ret = mbedtls_ssl_session_reset(&ssl);
+    if (ret == 0) ret = mbedtls_ssl_set_hostname(&ssl, host);
+    if (ret == 0 && hasSession) ret = mbedtls_ssl_set_session(&ssl, &session);
+    if (ret) {
+        logError("Preparing the TLS handshake", ret);
+        return false;
+    }
+
+    // Stepped by hand to tell the two kinds apart: a resumed TLS 1.2
+    // handshake goes from ServerHello straight to the server's
+    // ChangeCipherSpec, only a full one sends a ClientKeyExchange.
+    bool full = false;
+    uint32_t start = millis();
+    while (SSL_STATE(ssl) != MBEDTLS_SSL_HANDSHAKE_OVER) {
+        if (SSL_STATE(ssl) == MBEDTLS_SSL_CLIENT_KEY_EXCHANGE) full = true;
+        ret = mbedtls_ssl_handshake_step(&ssl);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if (millis() - start > TLS_HANDSHAKE_TIMEOUT) {
+                ret = MBEDTLS_ERR_SSL_TIMEOUT;
+                break;
+            }
+            delay(1);
+        } else if (ret != 0) {
+            break;
+        }
+    }
+    uint32_t elapsed = millis() - start;
+    if (ret != 0) {
+        stats.failures++;
+        logError("TLS handshake", ret);
+        // the cached session may be what the broker rejected
+        forgetSession();
+        return false;
+    }
+
+    stats.handshakes++;
+    stats.lastHandshakeMs = elapsed;
+    stats.lastResumed = !full;
+    if (elapsed > stats.maxHandshakeMs) stats.maxHandshakeMs = elapsed;
+    if (full) {
+        stats.totalFullMs += elapsed;
+    } else {
+        stats.resumed++;
+        stats.totalResumedMs += elapsed;
+    }
+    // keep the session (or its renewed ticket) for the next connect
+    forgetSession();
+    hasSession = mbedtls_ssl_get_session(&ssl, &session) == 0;
+    LOG_INFO("TLS handshake took %u ms (%s)", elapsed, full ? "full" : "resumed");
+    return true;
+}
+
+int TlsClient::connect(IPAddress ip, uint16_t port) {
+    String host = ip.toString();
+    return connect(host.c_str(), port);
+}
+
+int TlsClient::connect(const char* host, uint16_t port) {
+    if (!configured) {
+        LOG_ERROR("TLS credentials not set");
+        return 0;
+    }
+    stop();
+    if (!tcp.connect(host, port)) {
+        LOG_ERROR("TCP connection to %s:%u failed", host, port);
+        return 0;
+    }
+    tcp.setNoDelay(true);
+    if (!handshake(host)) {
+        tcp.stop();
+        return 0;
+    }
+    established = true;
+    return 1;
+}
+
+size_t TlsClient::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t TlsClient::write(const uint8_t* buffer, size_t size) {
+    if (!established) return 0;
+    size_t written = 0;
+    uint32_t start = millis();
+    while (written < size) {
+        int ret = mbedtls_ssl_write(&ssl, buffer + written, size - written);
+        if (ret > 0) {
+            written += ret;
+        } else if ((ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) &&
+                   millis() - start < TLS_WRITE_TIMEOUT) {
+            delay(1);
+        } else {
+            logError("TLS write", ret);
+            stop();
+            break;
+        }
+    }
+    return written;
+}
+
+int TlsClient::available() {
+    if (!established) return 0;
+    if (mbedtls_ssl_get_bytes_avail(&ssl) == 0 && tcp.available() > 0) {
+        // decrypt the next record so its plaintext is counted
+        int ret = mbedtls_ssl_read(&ssl, nullptr, 0);
+        if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if (ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) logError("TLS read", ret);
+            stop();
+            return 0;
+        }
+    }
+    return (peeked >= 0 ? 1 : 0) + mbedtls_ssl_get_bytes_avail(&ssl);
+}
+
+int TlsClient::read() {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+int TlsClient::read(uint8_t* buffer, size_t size) {
+    if (!established || size == 0) return -1;
+    size_t n = 0;
+    if (peeked >= 0) {
+        buffer[n++] = peeked;
+        peeked = -1;
+        if (n == size) return n;
+    }
+    int ret = mbedtls_ssl_read(&ssl, buffer + n, size - n);
+    if (ret > 0) return n + ret;
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+        if (ret != 0 && ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) logError("TLS read", ret);
+        stop();
+    }
+    return n > 0 ? (int)n : -1;
+}
+
+int TlsClient::peek() {
+    if (peeked < 0) peeked = read();
+    return peeked;
+}
+
+void TlsClient::flush() {
+    // writes go straight to the socket
+}
+
+void TlsClient::stop() {
+    if (established) mbedtls_ssl_close_notify(&ssl);
+    established = false;
+    peeked = -1;
+    tcp.stop();
+}
+
+uint8_t TlsClient::connected() {
+    if (!established) return 0;
+    // data already received can still be read after the peer closed
+    return tcp.connected() || peeked >= 0 || mbedtls_ssl_get_bytes_avail(&ssl) > 0;
+}
@@ -0,0 +1,81 @@
+#ifndef TLS_CLIENT_HPP
+#define TLS_CLIENT_HPP
+
+#include <Arduino.h>
+#include <Client.h>
+#include <WiFiClient.h>
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+
+const uint32_t TLS_HANDSHAKE_TIMEOUT = 10000; // ms
+const uint32_t TLS_WRITE_TIMEOUT = 5000;      // ms
+
+struct TlsStats {
+    uint32_t handshakes;      // successful ones
+    uint32_t resumed;         // of those, abbreviated with a cached session
+    uint32_t failures;
+    uint32_t lastHandshakeMs;
+    bool lastResumed;
+    uint32_t maxHandshakeMs;
+    uint32_t totalFullMs;
+    uint32_t totalResumedMs;
+};
+
+// TLS over a WiFiClient with mbedTLS, for PubSubClient. Unlike
+// WiFiClientSecure, which re-parses PEM strings and does a full handshake
+// on every connect, the credentials are parsed once from DER, the SSL
+// context is reused across connections, and the session of the last
+// handshake is offered on the next one so a reconnect can skip the
+// certificate exchange and key agreement (if the broker resumes it).
+class TlsClient : public Client {
+private:
+    WiFiClient tcp;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_ssl_config config;
+    mbedtls_x509_crt caChain;
+    mbedtls_x509_crt ownCert;
+    mbedtls_pk_context ownKey;
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_session session;
+    bool configured;
+    bool hasSession;
+    bool established;
+    int peeked; // byte held back by peek(), or -1
+    TlsStats stats;
+
+    static int sendCallback(void* context, const unsigned char* buffer, size_t length);
+    static int receiveCallback(void* context, unsigned char* buffer, size_t length);
+    bool handshake(const char* host);
+    void logError(const char* what, int error);
+
+public:
+    TlsClient();
+    ~TlsClient();
+
+    // Parses the DER credentials. The certificates are referenced, not
+    // copied, so the buffers must outlive the client.
+    bool setCredentials(const uint8_t* ca, size_t caLength, const uint8_t* cert, size_t certLength,
+                        const uint8_t* key, size_t keyLength);
+    // Makes the next connect a full handshake.
+    void forgetSession();
+    const TlsStats& getStats() const { return stats; }
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char* host, uint16_t port) override;
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t size) override;
+    int peek() override;
+    void flush() override;
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override { return connected(); }
+};
+
+#endif
@@ -0,0 +1,118 @@
+// Host benchmark of inbound dispatch: the old copy-into-String and
+// std::map lookup against TopicTable, with exact and wildcard filters.
+//
+//   pio run -e native_bench && .pio/build/native_bench/program [--rate N]
+//
+// --rate is the inbound messages per second to express the cost as a share
+// of one core (default 50, the voice results and commands of a few gloves).
+// Host numbers only rank the approaches; scale by the ESP32's clock for
+// absolute figures. Heap allocations are counted through operator new.
+#include "TopicTable.hpp"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+static volatile size_t sink = 0;
+
+// The previous MQTTClient::messageCallback, with std::string for String.
+struct LegacyTable {
+    std::map<std::string, std::function<void(const std::string&)>> callbacks;
+
+    void dispatch(char* topic, uint8_t* payload, unsigned int length) {
+        std::string message;
+        for (unsigned int i = 0; i < length; i++) {
+            message += (char)payload[i];
+        }
+        std::string topicStr = std::string(topic);
+        auto it = callbacks.find(topicStr);
+        if (it != callbacks.end()) it->second(message);
+    }
+};
+
+static const char* const EXACT_FILTERS[] = {"ultra96/voice_result", "esp32/command", "esp32/config",
+                                            "ultra96/gesture_result", "visualiser/state", "debug/control"};
+static const char* const WILDCARD_FILTERS[] = {"ultra96/+", "esp32/#", "visualiser/+/state", "debug/#",
+                                               "+/ping", "glove/+/command"};
+static const char* const TOPICS[] = {"ultra96/voice_result", "esp32/command", "ultra96/gesture_result"};
+const int TOPIC_COUNT = sizeof(TOPICS) / sizeof(TOPICS[0]);
+
+struct Result {
+    double ns;
+    double allocations;
+};
+
+template <typename Dispatch>
+static Result measure(Dispatch dispatch, int iterations) {
+    size_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) dispatch(i % TOPIC_COUNT);
+    auto end = std::chrono::steady_clock::now();
+    Result r;
+    r.ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    r.allocations = (double)(allocations - before) / iterations;
+    return r;
+}
+
+static void report(const char* name, size_t bytes, Result r, int rate) {
+    printf("%-22s %6zu %10.1f %12.2f %10.4f\n", name, bytes, r.ns, r.allocations, r.ns * rate / 1e7);
+}
+
+int main(int argc, char** argv) {
+    int rate = 50;
+    int iterations = 200000;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--rate") && i + 1 < argc) {
+            rate = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--rate N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    LegacyTable legacy;
+    TopicTable exact, wildcard;
+    for (const char* f : EXACT_FILTERS) {
+        legacy.callbacks[f] = [](const std::string& m) { sink += m.size(); };
+        exact.add(f, [](const char*, const uint8_t*, size_t length) { sink += length; });
+    }
+    for (const char* f : WILDCARD_FILTERS) {
+        wildcard.add(f, [](const char*, const uint8_t*, size_t length) { sink += length; });
+    }
+
+    char topics[TOPIC_COUNT][64];
+    for (int t = 0; t < TOPIC_COUNT; t++) strcpy(topics[t], TOPICS[t]);
+
+    printf("%-22s %6s %10s %12s %10s\n", "dispatch", "bytes", "ns/msg", "allocs/msg", "%core");
+    const size_t SIZES[] = {64, 1024};
+    for (size_t bytes : SIZES) {
+        static uint8_t payload[1024];
+        memset(payload, 'x', bytes);
+        report("String + std::map", bytes,
+               measure([&](int t) { legacy.dispatch(topics[t], payload, bytes); }, iterations), rate);
+        report("TopicTable exact", bytes,
+               measure([&](int t) { exact.dispatch(topics[t], payload, bytes); }, iterations), rate);
+        report("TopicTable wildcard", bytes,
+               measure([&](int t) { wildcard.dispatch(topics[t], payload, bytes); }, iterations), rate);
+    }
+    printf("%%core at %d messages/s\n", rate);
+    return sink == 0;
+}
@@ -0,0 +1,189 @@
+// Stand-in MQTT-SN gateway for gloves built with -D GESTURE_GATEWAY: takes
+// QoS -1 PUBLISH datagrams with predefined topic ids on a UDP port, drops
+// frames older than the newest one seen from that glove and topic, and
+// republishes the rest at QoS 0 to the broker over plain MQTT. Run it on
+// the broker host or next to the access point.
+//
+//   pio run -e native_gateway
+//   .pio/build/native_gateway/program [--listen P] [--host H] [--port P]
+//       [--user U --pass P] [--topic ID=TOPIC ...] [--reset-ms N] [--stats-every S]
+//
+// Without --topic, id 1 maps to esp32/gesture_data (GESTURE_TOPIC_ID on
+// the glove). A namespaced glove needs its own id mapped to its full
+// topic, e.g. --topic 2=glove/glove-2/esp32/gesture_data. Every
+// --stats-every seconds one line reports the datagrams of that interval.
+#include "MqttSn.hpp"
+#include "../loadgen/MqttSocket.hpp"
+#include <arpa/inet.h>
+#include <chrono>
+#include <map>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+static const uint16_t KEEP_ALIVE_S = 60;
+static const int RECONNECT_MS = 1000;
+
+struct Options {
+    uint16_t listenPort = MQTTSN_DEFAULT_PORT;
+    std::string host = "127.0.0.1";
+    uint16_t port = 1883;
+    std::string user;
+    std::string pass;
+    std::map<uint16_t, std::string> topics;
+    uint32_t resetMs = 2000;
+    int statsEveryS = 10;
+};
+
+struct Counters {
+    uint32_t received = 0;
+    uint32_t forwarded = 0;
+    uint32_t stale = 0;     // older than a frame already forwarded
+    uint32_t malformed = 0; // not a QoS -1 PUBLISH with a predefined id
+    uint32_t unknown = 0;   // topic id without a --topic mapping
+    uint32_t offline = 0;   // broker connection down
+};
+
+static uint32_t nowMs() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--listen P] [--host H] [--port P] [--user U] [--pass P] [--topic ID=TOPIC ...]\n"
+            "       [--reset-ms N] [--stats-every S]\n",
+            program);
+    exit(2);
+}
+
+static bool connectBroker(MqttSocket& mqtt, const Options& options) {
+    if (!mqtt.connect(options.host.c_str(), options.port, "mqtt-sn-gateway", options.user.c_str(),
+                      options.pass.c_str(), KEEP_ALIVE_S)) {
+        fprintf(stderr, "cannot reach the broker at %s:%u\n", options.host.c_str(), options.port);
+        return false;
+    }
+    return true;
+}
+
+static void printCounters(const Counters& c, double seconds, size_t senders) {
+    printf("%.0f s: %u received, %u forwarded, %u stale, %u malformed, %u unknown, %u offline, %zu senders\n",
+           seconds, c.received, c.forwarded, c.stale, c.malformed, c.unknown, c.offline, senders);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) usage(argv[0]);
+        const char* value = argv[++i];
+        if (arg == "--listen") {
+            options.listenPort = (uint16_t)atoi(value);
+        } else if (arg == "--host") {
+            options.host = value;
+        } else if (arg == "--port") {
+            options.port = (uint16_t)atoi(value);
+        } else if (arg == "--user") {
+            options.user = value;
+        } else if (arg == "--pass") {
+            options.pass = value;
+        } else if (arg == "--topic") {
+            const char* equals = strchr(value, '=');
+            if (!equals || equals == value || !equals[1]) usage(argv[0]);
+            options.topics[(uint16_t)atoi(value)] = equals + 1;
+        } else if (arg == "--reset-ms") {
+            options.resetMs = (uint32_t)atoi(value);
+        } else if (arg == "--stats-every") {
+            options.statsEveryS = atoi(value);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (options.statsEveryS <= 0) usage(argv[0]);
+    if (options.topics.empty()) options.topics[1] = "esp32/gesture_data";
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(options.listenPort);
+    if (fd < 0 || bind(fd, (sockaddr*)&address, sizeof(address)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    MqttSocket mqtt;
+    bool online = connectBroker(mqtt, options);
+    uint32_t lastAttemptMs = nowMs();
+    uint32_t lastPingMs = lastAttemptMs;
+    uint32_t lastStatsMs = lastAttemptMs;
+    for (const auto& topic : options.topics) {
+        printf("topic %u -> %s\n", topic.first, topic.second.c_str());
+    }
+    printf("listening on udp/%u, forwarding to %s:%u\n", options.listenPort, options.host.c_str(), options.port);
+    fflush(stdout);
+
+    // one filter per sender address and topic id
+    std::map<std::pair<uint32_t, uint16_t>, SequenceFilter> filters;
+    Counters counters;
+    uint8_t packet[MQTTSN_MAX_PACKET];
+    for (;;) {
+        pollfd waiting = {fd, POLLIN, 0};
+        int ready = ::poll(&waiting, 1, 100);
+        uint32_t now = nowMs();
+        if (ready > 0) {
+            sockaddr_in sender = {};
+            socklen_t senderLength = sizeof(sender);
+            ssize_t n = recvfrom(fd, packet, sizeof(packet), 0, (sockaddr*)&sender, &senderLength);
+            if (n > 0) {
+                counters.received++;
+                uint16_t topicId, sequence;
+                const uint8_t* payload;
+                size_t length;
+                if (!mqttSnDecodePublish(packet, (size_t)n, topicId, sequence, payload, length)) {
+                    counters.malformed++;
+                } else if (!options.topics.count(topicId)) {
+                    counters.unknown++;
+                } else {
+                    std::pair<uint32_t, uint16_t> key(sender.sin_addr.s_addr, topicId);
+                    auto filter = filters.emplace(key, SequenceFilter(options.resetMs)).first;
+                    if (!filter->second.accept(sequence, now)) {
+                        counters.stale++;
+                    } else if (online && mqtt.publish(options.topics[topicId].c_str(), payload, length, 0)) {
+                        counters.forwarded++;
+                    } else {
+                        // frames are only worth anything now, so nothing is buffered
+                        counters.offline++;
+                        online = false;
+                    }
+                }
+            }
+        }
+
+        if (online) {
+            online = mqtt.poll(0);
+            if (online && now - lastPingMs >= KEEP_ALIVE_S * 1000 / 2) {
+                online = mqtt.ping();
+                lastPingMs = now;
+            }
+        } else if (now - lastAttemptMs >= RECONNECT_MS) {
+            online = connectBroker(mqtt, options);
+            lastAttemptMs = now;
+            lastPingMs = now;
+        }
+
+        if (now - lastStatsMs >= (uint32_t)options.statsEveryS * 1000) {
+            printCounters(counters, (now - lastStatsMs) / 1e3, filters.size());
+            counters = Counters();
+            lastStatsMs = now;
+        }
+    }
+}
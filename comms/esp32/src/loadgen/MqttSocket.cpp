@@ -0,0 +1,250 @@
+#include "MqttSocket.hpp"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+enum PacketType : uint8_t {
+    CONNECT = 1,
+    CONNACK = 2,
+    PUBLISH = 3,
+    PUBACK = 4,
+    SUBSCRIBE = 8,
+    SUBACK = 9,
+    PINGREQ = 12,
+    PINGRESP = 13,
+};
+
+const int CONNECT_TIMEOUT_MS = 5000;
+
+static void putString(std::vector<uint8_t>& body, const char* s, size_t length) {
+    body.push_back(length >> 8);
+    body.push_back(length & 0xff);
+    body.insert(body.end(), s, s + length);
+}
+
+static void putString(std::vector<uint8_t>& body, const char* s) { putString(body, s, strlen(s)); }
+
+// Fixed header: type and flags, then the remaining length in 7-bit groups.
+static size_t putHeader(uint8_t* header, uint8_t typeAndFlags, size_t remaining) {
+    size_t n = 0;
+    header[n++] = typeAndFlags;
+    do {
+        uint8_t digit = remaining & 0x7f;
+        remaining >>= 7;
+        header[n++] = digit | (remaining ? 0x80 : 0);
+    } while (remaining);
+    return n;
+}
+
+MqttSocket::MqttSocket()
+    : fd(-1), nextPacketId(0), publishCount(0), pubackCount(0), subscribed(false), parsed(0) {}
+
+MqttSocket::~MqttSocket() { close(); }
+
+bool MqttSocket::connect(const char* host, uint16_t port, const char* clientId, const char* user, const char* pass,
+                         uint16_t keepAliveSeconds) {
+    close();
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses;
+    char service[8];
+    snprintf(service, sizeof(service), "%u", port);
+    if (getaddrinfo(host, service, &hints, &addresses) != 0) return false;
+    for (addrinfo* a = addresses; a && fd < 0; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (fd >= 0 && ::connect(fd, a->ai_addr, a->ai_addrlen) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+    if (fd < 0) return false;
+    // each publish goes out on its own, as from the glove
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    std::vector<uint8_t> body;
+    putString(body, "MQTT");
+    body.push_back(4); // protocol level 3.1.1
+    bool login = user && user[0];
+    body.push_back(0x02 | (login ? 0xc0 : 0)); // clean session, user and password
+    body.push_back(keepAliveSeconds >> 8);
+    body.push_back(keepAliveSeconds & 0xff);
+    putString(body, clientId);
+    if (login) {
+        putString(body, user);
+        putString(body, pass ? pass : "");
+    }
+    if (!sendPacket(CONNECT << 4, body)) return false;
+
+    std::vector<uint8_t> reply;
+    for (int waited = 0; waited < CONNECT_TIMEOUT_MS; waited += 100) {
+        uint8_t type = takePacket(reply);
+        if (type == CONNACK) {
+            if (reply.size() == 2 && reply[1] == 0) return true;
+            close();
+            return false;
+        }
+        if (!readSome(100)) break;
+    }
+    close();
+    return false;
+}
+
+void MqttSocket::close() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    inbound.clear();
+    parsed = 0;
+    subscribed = false;
+}
+
+bool MqttSocket::sendAll(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            close();
+            return false;
+        }
+        data += n;
+        length -= n;
+    }
+    return true;
+}
+
+bool MqttSocket::sendPacket(uint8_t typeAndFlags, const std::vector<uint8_t>& body) {
+    if (fd < 0) return false;
+    uint8_t header[5];
+    size_t n = putHeader(header, typeAndFlags, body.size());
+    outbound.assign(header, header + n);
+    outbound.insert(outbound.end(), body.begin(), body.end());
+    return sendAll(outbound.data(), outbound.size());
+}
+
+uint16_t MqttSocket::packetId() {
+    if (++nextPacketId == 0) nextPacketId = 1;
+    return nextPacketId;
+}
+
+bool MqttSocket::publish(const char* topic, const uint8_t* payload, size_t length, uint8_t qos) {
+    if (fd < 0) return false;
+    // one send, so the packet leaves as one segment
+    size_t topicLength = strlen(topic);
+    size_t remaining = 2 + topicLength + (qos ? 2 : 0) + length;
+    uint8_t header[5];
+    size_t n = putHeader(header, PUBLISH << 4 | (qos ? 0x02 : 0), remaining);
+    outbound.assign(header, header + n);
+    putString(outbound, topic, topicLength);
+    if (qos) {
+        uint16_t id = packetId();
+        outbound.push_back(id >> 8);
+        outbound.push_back(id & 0xff);
+    }
+    outbound.insert(outbound.end(), payload, payload + length);
+    if (!sendAll(outbound.data(), outbound.size())) return false;
+    publishCount++;
+    return true;
+}
+
+bool MqttSocket::subscribe(const char* filter, uint8_t qos, Handler messageHandler) {
+    handler = messageHandler;
+    std::vector<uint8_t> body;
+    uint16_t id = packetId();
+    body.push_back(id >> 8);
+    body.push_back(id & 0xff);
+    putString(body, filter);
+    body.push_back(qos);
+    if (!sendPacket(SUBSCRIBE << 4 | 0x02, body)) return false;
+    for (int waited = 0; waited < CONNECT_TIMEOUT_MS && !subscribed; waited += 100) {
+        if (!poll(100)) return false;
+    }
+    return subscribed;
+}
+
+bool MqttSocket::ping() { return sendPacket(PINGREQ << 4, std::vector<uint8_t>()); }
+
+bool MqttSocket::readSome(int timeoutMs) {
+    if (fd < 0) return false;
+    pollfd p = {fd, POLLIN, 0};
+    int ready = ::poll(&p, 1, timeoutMs);
+    if (ready < 0) return errno == EINTR;
+    if (ready == 0) return true;
+    if (parsed > 0) {
+        inbound.erase(inbound.begin(), inbound.begin() + parsed);
+        parsed = 0;
+    }
+    uint8_t buffer[16384];
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n < 0 && errno == EINTR) return true;
+    if (n <= 0) {
+        close();
+        return false;
+    }
+    inbound.insert(inbound.end(), buffer, buffer + n);
+    return true;
+}
+
+uint8_t MqttSocket::takePacket(std::vector<uint8_t>& body) {
+    size_t remaining = 0;
+    size_t i = parsed + 1;
+    for (int shift = 0;; shift += 7, i++) {
+        if (i >= inbound.size() || shift > 21) return 0;
+        remaining |= (size_t)(inbound[i] & 0x7f) << shift;
+        if (!(inbound[i] & 0x80)) break;
+    }
+    size_t start = i + 1;
+    if (inbound.size() < start + remaining) return 0;
+    uint8_t typeAndFlags = inbound[parsed];
+    body.assign(inbound.begin() + start, inbound.begin() + start + remaining);
+    parsed = start + remaining;
+    // the flags only matter for PUBLISH, where handlePacket needs the QoS
+    if ((typeAndFlags >> 4) == PUBLISH) body.insert(body.begin(), typeAndFlags);
+    return typeAndFlags >> 4;
+}
+
+void MqttSocket::handlePacket(uint8_t type, const std::vector<uint8_t>& body) {
+    switch (type) {
+    case PUBACK:
+        pubackCount++;
+        break;
+    case SUBACK:
+        subscribed = body.size() >= 3 && body[2] != 0x80;
+        break;
+    case PUBLISH: {
+        // body[0] is the fixed header byte, see takePacket()
+        uint8_t qos = (body[0] >> 1) & 0x03;
+        if (body.size() < 3) return;
+        size_t topicLength = body[1] << 8 | body[2];
+        size_t offset = 3 + topicLength;
+        if (offset + (qos ? 2 : 0) > body.size()) return;
+        const char* topic = reinterpret_cast<const char*>(&body[3]);
+        if (qos) {
+            std::vector<uint8_t> ack(body.begin() + offset, body.begin() + offset + 2);
+            offset += 2;
+            sendPacket(PUBACK << 4, ack);
+        }
+        if (handler) handler(topic, topicLength, body.data() + offset, body.size() - offset);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+bool MqttSocket::poll(int timeoutMs) {
+    if (!readSome(timeoutMs)) return false;
+    std::vector<uint8_t> body;
+    while (uint8_t type = takePacket(body)) {
+        handlePacket(type, body);
+    }
+    return fd >= 0;
+}
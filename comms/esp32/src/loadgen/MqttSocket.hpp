@@ -0,0 +1,55 @@
+#ifndef MQTT_SOCKET_HPP
+#define MQTT_SOCKET_HPP
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Just enough MQTT 3.1.1 over a plain TCP socket for the load generator:
+// clean-session CONNECT, QoS 0 and 1 PUBLISH (without waiting for the
+// PUBACK), SUBSCRIBE and PINGREQ. Not thread-safe; one per thread.
+class MqttSocket {
+public:
+    typedef std::function<void(const char* topic, size_t topicLength, const uint8_t* payload, size_t length)>
+        Handler;
+
+    MqttSocket();
+    ~MqttSocket();
+
+    // Blocks until CONNACK; `user` may be empty.
+    bool connect(const char* host, uint16_t port, const char* clientId, const char* user, const char* pass,
+                 uint16_t keepAliveSeconds);
+    void close();
+    bool publish(const char* topic, const uint8_t* payload, size_t length, uint8_t qos);
+    // Blocks until SUBACK; inbound messages go to `handler`.
+    bool subscribe(const char* filter, uint8_t qos, Handler handler);
+    bool ping();
+    // Handles whatever arrives within `timeoutMs`, acknowledging QoS 1
+    // messages. False once the connection is gone.
+    bool poll(int timeoutMs);
+
+    uint32_t published() const { return publishCount; }
+    uint32_t acknowledged() const { return pubackCount; }
+
+private:
+    int fd;
+    uint16_t nextPacketId;
+    uint32_t publishCount;
+    uint32_t pubackCount;
+    bool subscribed;
+    Handler handler;
+    std::vector<uint8_t> inbound;  // bytes read, parsed up to `parsed`
+    size_t parsed;
+    std::vector<uint8_t> outbound; // packet being built
+
+    bool sendAll(const uint8_t* data, size_t length);
+    bool sendPacket(uint8_t type, const std::vector<uint8_t>& body);
+    bool readSome(int timeoutMs);
+    // Parses one complete packet from `inbound`; 0 if there is none yet.
+    uint8_t takePacket(std::vector<uint8_t>& body);
+    void handlePacket(uint8_t type, const std::vector<uint8_t>& body);
+    uint16_t packetId();
+};
+
+#endif
@@ -0,0 +1,387 @@
+// Load generator for the broker path: N simulated gloves, each with its
+// own connection and topic namespace, publish gesture and voice traffic
+// to a local mosquitto while a sink subscribed to every namespace checks
+// what arrives. Each step reports message rates, end-to-end latency
+// percentiles and loss, and the number of gloves grows from step to step.
+//
+//   pio run -e native_loadgen
+//   .pio/build/native_loadgen/program --gloves 1,2,4,8,16 [--duration S]
+//       [--host H] [--port P] [--user U --pass P] [--trace FILE]
+//       [--gesture-hz N] [--gesture-bytes N] [--voice-every S] [--voice-ms N]
+//
+// Without --trace every glove streams gestures at --gesture-hz and records
+// a --voice-ms utterance every --voice-every seconds, published in
+// VOICE_CHUNK_SAMPLES chunks like the glove does. --trace replays the
+// publishes of the native glove simulation instead (the "publish" lines of
+// `sim -v`), looped and started at a random offset per glove.
+//
+// Every payload starts with a LoadHeader; the rest is padding up to the
+// real message size. Latency is publish call to sink delivery on one host
+// clock, so it covers the broker and both sockets, not the glove's WiFi.
+#include "MqttSocket.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+// must match MQTT_NAMESPACE_ROOT in lib/MQTTClient/src/MQTTClient.hpp
+static const char NAMESPACE_ROOT[] = "glove/";
+static const char GESTURE_TOPIC[] = "esp32/gesture_data";
+static const char VOICE_TOPIC[] = "esp32/voice_data";
+static const uint32_t LOAD_MAGIC = 0x4e45474c; // "LGEN"
+static const int SAMPLING_RATE = 8000;         // as on the glove, see constants.h
+static const int VOICE_CHUNK_SAMPLES = 8000;
+static const int VOICE_HEADER_BYTES = 6;
+static const uint16_t KEEP_ALIVE_S = 60;
+
+struct LoadHeader {
+    uint32_t magic;
+    uint32_t step;     // stragglers from an earlier step are ignored
+    uint32_t glove;
+    uint32_t sequence; // per glove, from 0
+    uint64_t sentUs;
+};
+
+struct Options {
+    std::string host = "127.0.0.1";
+    uint16_t port = 1883;
+    std::string user;
+    std::string pass;
+    std::vector<int> gloves = {1, 2, 4, 8};
+    int durationS = 10;
+    int graceMs = 2000;
+    double gestureHz = 6.25;  // a full batch every GESTURE_MIN_INTERVAL
+    size_t gestureBytes = 265; // GESTURE_FRAME_SIZE
+    double voiceEveryS = 5;
+    int voiceMs = 2000;
+    std::string trace;
+};
+
+struct Event {
+    uint64_t atUs;  // from the start of the schedule
+    std::string topic;
+    size_t bytes;
+    uint8_t qos;
+};
+
+static uint64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// QoS as in TOPIC_CLASSES on the glove: voice is QoS 1, the rest QoS 0.
+static uint8_t topicQos(const std::string& topic) {
+    return topic.find("voice") != std::string::npos ? 1 : 0;
+}
+
+// One period of a glove's traffic, replayed in a loop.
+static std::vector<Event> syntheticSchedule(const Options& options, uint64_t& periodUs) {
+    std::vector<Event> events;
+    periodUs = (uint64_t)(options.voiceEveryS * 1e6);
+    if (options.gestureHz > 0) {
+        uint64_t interval = (uint64_t)(1e6 / options.gestureHz);
+        for (uint64_t t = 0; t < periodUs; t += interval) {
+            events.push_back({t, GESTURE_TOPIC, options.gestureBytes, 0});
+        }
+    }
+    // the utterance is published once recording ends, chunk after chunk
+    int samples = options.voiceMs * SAMPLING_RATE / 1000;
+    uint64_t recorded = std::min<uint64_t>((uint64_t)options.voiceMs * 1000, periodUs - 1);
+    for (int offset = 0; offset < samples; offset += VOICE_CHUNK_SAMPLES) {
+        int n = std::min(VOICE_CHUNK_SAMPLES, samples - offset);
+        events.push_back({recorded, VOICE_TOPIC, (size_t)(VOICE_HEADER_BYTES + 2 * n), 1});
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.atUs < b.atUs; });
+    return events;
+}
+
+// Lines like "   123.000 ms  publish esp32/gesture_data (118 bytes)".
+static bool loadTrace(const std::string& path, std::vector<Event>& events, uint64_t& periodUs) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        double ms;
+        char topic[128];
+        size_t bytes;
+        if (sscanf(line, "%lf ms publish %127s (%zu bytes)", &ms, topic, &bytes) == 3) {
+            events.push_back({(uint64_t)(ms * 1000), topic, bytes, topicQos(topic)});
+        }
+    }
+    fclose(file);
+    if (events.empty()) return false;
+    uint64_t first = events.front().atUs;
+    for (Event& e : events) e.atUs -= first;
+    periodUs = events.back().atUs + 1000000; // a second of quiet before it loops
+    return true;
+}
+
+// What the sink saw of one glove.
+struct Received {
+    std::vector<uint8_t> seen; // by sequence number
+    uint32_t unique = 0;
+    uint32_t duplicates = 0;
+};
+
+struct StepResult {
+    int gloves;
+    double seconds;
+    uint64_t sent;
+    uint64_t sentBytes;
+    uint64_t qos1Sent;
+    uint64_t qos1Acked;
+    uint64_t received;
+    uint64_t receivedBytes;
+    uint64_t duplicates;
+    uint32_t disconnects;
+    std::vector<uint32_t> latencyUs;
+};
+
+static std::atomic<uint64_t> sentTotal(0), sentBytesTotal(0), qos1Total(0), ackedTotal(0);
+static std::atomic<uint32_t> disconnectTotal(0);
+
+static void runGlove(const Options& options, uint32_t step, uint32_t index, const std::vector<Event>& schedule,
+                     uint64_t periodUs, uint64_t startUs, uint64_t endUs) {
+    char clientId[32];
+    snprintf(clientId, sizeof(clientId), "loadgen-%u", index);
+    std::string prefix = std::string(NAMESPACE_ROOT) + clientId + "/";
+    MqttSocket mqtt;
+    if (!mqtt.connect(options.host.c_str(), options.port, clientId, options.user.c_str(), options.pass.c_str(),
+                      KEEP_ALIVE_S)) {
+        disconnectTotal++;
+        return;
+    }
+    std::mt19937 random(step * 1000 + index);
+    uint64_t phase = periodUs ? random() % periodUs : 0;
+    std::vector<uint8_t> payload;
+    LoadHeader header = {LOAD_MAGIC, step, index, 0, 0};
+    uint64_t sentBytes = 0;
+    uint32_t qos1 = 0;
+    uint64_t lastSendUs = nowUs();
+
+    // walk the looped schedule from `phase` on until the step ends
+    size_t next = std::lower_bound(schedule.begin(), schedule.end(), phase,
+                                   [](const Event& e, uint64_t t) { return e.atUs < t; }) -
+                  schedule.begin();
+    uint64_t loopStartUs = startUs - phase;
+    while (true) {
+        if (next == schedule.size()) {
+            next = 0;
+            loopStartUs += periodUs;
+        }
+        const Event& event = schedule[next++];
+        uint64_t dueUs = loopStartUs + event.atUs;
+        if (dueUs >= endUs) break;
+        for (uint64_t now = nowUs(); now < dueUs; now = nowUs()) {
+            if (!mqtt.poll((int)std::min<uint64_t>((dueUs - now + 999) / 1000, 100))) break;
+            if (now - lastSendUs > KEEP_ALIVE_S * 500000ull) {
+                mqtt.ping();
+                lastSendUs = now;
+            }
+        }
+        payload.assign(std::max(event.bytes, sizeof(LoadHeader)), 0);
+        header.sentUs = nowUs();
+        memcpy(payload.data(), &header, sizeof(header));
+        std::string topic = prefix + event.topic;
+        if (!mqtt.publish(topic.c_str(), payload.data(), payload.size(), event.qos)) {
+            disconnectTotal++;
+            // a fresh session, like the glove reconnecting
+            if (!mqtt.connect(options.host.c_str(), options.port, clientId, options.user.c_str(),
+                              options.pass.c_str(), KEEP_ALIVE_S)) {
+                break;
+            }
+            continue;
+        }
+        header.sequence++;
+        sentBytes += payload.size();
+        if (event.qos) qos1++;
+        lastSendUs = header.sentUs;
+    }
+    // collect the outstanding PUBACKs
+    for (uint64_t until = nowUs() + options.graceMs * 1000ull; nowUs() < until && mqtt.acknowledged() < qos1;) {
+        if (!mqtt.poll(50)) break;
+    }
+    sentTotal += header.sequence;
+    sentBytesTotal += sentBytes;
+    qos1Total += qos1;
+    ackedTotal += mqtt.acknowledged();
+}
+
+static StepResult runStep(const Options& options, uint32_t step, int gloves, const std::vector<Event>& schedule,
+                          uint64_t periodUs) {
+    StepResult result = {};
+    result.gloves = gloves;
+    sentTotal = sentBytesTotal = qos1Total = ackedTotal = 0;
+    disconnectTotal = 0;
+
+    // only ever touched by the thread polling the sink
+    std::vector<Received> received(gloves);
+    std::atomic<bool> sinkDone(false);
+    MqttSocket sink;
+    char sinkId[32];
+    snprintf(sinkId, sizeof(sinkId), "loadgen-sink-%u", step);
+    if (!sink.connect(options.host.c_str(), options.port, sinkId, options.user.c_str(), options.pass.c_str(),
+                      KEEP_ALIVE_S)) {
+        fprintf(stderr, "cannot connect to %s:%u\n", options.host.c_str(), options.port);
+        exit(1);
+    }
+    std::string filter = std::string(NAMESPACE_ROOT) + "+/esp32/#";
+    bool subscribed = sink.subscribe(filter.c_str(), 1, [&](const char*, size_t, const uint8_t* payload,
+                                                             size_t length) {
+        uint64_t arrivedUs = nowUs();
+        LoadHeader header;
+        if (length < sizeof(header)) return;
+        memcpy(&header, payload, sizeof(header));
+        if (header.magic != LOAD_MAGIC || header.step != step || header.glove >= (uint32_t)gloves) return;
+        Received& r = received[header.glove];
+        if (header.sequence >= r.seen.size()) r.seen.resize(header.sequence + 1024, 0);
+        if (r.seen[header.sequence]) {
+            r.duplicates++;
+            return;
+        }
+        r.seen[header.sequence] = 1;
+        r.unique++;
+        result.receivedBytes += length;
+        result.latencyUs.push_back((uint32_t)(arrivedUs - header.sentUs));
+    });
+    if (!subscribed) {
+        fprintf(stderr, "cannot subscribe to %s\n", filter.c_str());
+        exit(1);
+    }
+    std::thread sinkThread([&]() {
+        while (!sinkDone && sink.poll(50)) {
+        }
+    });
+
+    // connections first, so connecting is not counted against the rates
+    uint64_t startUs = nowUs() + 500000 + gloves * 2000ull;
+    uint64_t endUs = startUs + options.durationS * 1000000ull;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < gloves; i++) {
+        threads.emplace_back(runGlove, std::cref(options), step, (uint32_t)i, std::cref(schedule), periodUs,
+                             startUs, endUs);
+    }
+    for (std::thread& t : threads) t.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(options.graceMs));
+    sinkDone = true;
+    sinkThread.join();
+
+    result.seconds = options.durationS;
+    result.sent = sentTotal;
+    result.sentBytes = sentBytesTotal;
+    result.qos1Sent = qos1Total;
+    result.qos1Acked = ackedTotal;
+    result.disconnects = disconnectTotal;
+    for (const Received& r : received) {
+        result.received += r.unique;
+        result.duplicates += r.duplicates;
+    }
+    return result;
+}
+
+static double percentileMs(std::vector<uint32_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t i = std::min(sorted.size() - 1, (size_t)(p / 100 * sorted.size()));
+    return sorted[i] / 1000.0;
+}
+
+static void printResult(StepResult& r) {
+    std::sort(r.latencyUs.begin(), r.latencyUs.end());
+    double loss = r.sent ? 100.0 * (r.sent - std::min(r.sent, r.received)) / r.sent : 0;
+    printf("%6d %9.1f %9.1f %8.2f %8.2f %8.2f %8.2f %8.2f %7.2f %6llu %6llu %5u\n", r.gloves, r.sent / r.seconds,
+           r.received / r.seconds, r.receivedBytes / r.seconds / 1e6, percentileMs(r.latencyUs, 50),
+           percentileMs(r.latencyUs, 95), percentileMs(r.latencyUs, 99),
+           r.latencyUs.empty() ? 0.0 : r.latencyUs.back() / 1000.0, loss,
+           (unsigned long long)(r.qos1Sent - std::min(r.qos1Sent, r.qos1Acked)), (unsigned long long)r.duplicates,
+           r.disconnects);
+    fflush(stdout);
+}
+
+static std::vector<int> parseList(const char* s) {
+    std::vector<int> values;
+    for (const char* p = s; *p;) {
+        char* end;
+        long v = strtol(p, &end, 10);
+        if (end == p) break;
+        if (v > 0) values.push_back((int)v);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return values;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--gloves 1,2,4,8] [--duration S] [--host H] [--port P] [--user U] [--pass P]\n"
+            "       [--trace FILE] [--gesture-hz N] [--gesture-bytes N] [--voice-every S] [--voice-ms N]\n"
+            "       [--grace-ms N]\n",
+            program);
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) usage(argv[0]);
+        const char* value = argv[++i];
+        if (arg == "--gloves") {
+            options.gloves = parseList(value);
+        } else if (arg == "--duration") {
+            options.durationS = atoi(value);
+        } else if (arg == "--host") {
+            options.host = value;
+        } else if (arg == "--port") {
+            options.port = (uint16_t)atoi(value);
+        } else if (arg == "--user") {
+            options.user = value;
+        } else if (arg == "--pass") {
+            options.pass = value;
+        } else if (arg == "--trace") {
+            options.trace = value;
+        } else if (arg == "--gesture-hz") {
+            options.gestureHz = atof(value);
+        } else if (arg == "--gesture-bytes") {
+            options.gestureBytes = (size_t)atoi(value);
+        } else if (arg == "--voice-every") {
+            options.voiceEveryS = atof(value);
+        } else if (arg == "--voice-ms") {
+            options.voiceMs = atoi(value);
+        } else if (arg == "--grace-ms") {
+            options.graceMs = atoi(value);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (options.gloves.empty() || options.durationS <= 0 || options.voiceEveryS <= 0) usage(argv[0]);
+
+    std::vector<Event> schedule;
+    uint64_t periodUs = 0;
+    if (!options.trace.empty()) {
+        if (!loadTrace(options.trace, schedule, periodUs)) {
+            fprintf(stderr, "no publishes in %s\n", options.trace.c_str());
+            return 1;
+        }
+    } else {
+        schedule = syntheticSchedule(options, periodUs);
+    }
+    uint64_t periodBytes = 0;
+    for (const Event& e : schedule) periodBytes += e.bytes;
+    printf("%zu messages, %.1f kB every %.1f s per glove, %d s per step against %s:%u\n", schedule.size(),
+           periodBytes / 1e3, periodUs / 1e6, options.durationS, options.host.c_str(), options.port);
+    printf("%6s %9s %9s %8s %8s %8s %8s %8s %7s %6s %6s %5s\n", "gloves", "sent/s", "recv/s", "MB/s", "p50 ms",
+           "p95 ms", "p99 ms", "max ms", "loss %", "unack", "dups", "disc");
+    uint32_t step = (uint32_t)time(nullptr);
+    for (int gloves : options.gloves) {
+        StepResult result = runStep(options, step++, gloves, schedule, periodUs);
+        printResult(result);
+    }
+    return 0;
+}
@@ -1,23 +1,25 @@
 #include "CertificateManager.hpp"
+#include "Logger.hpp"
 #include "MQTTClient.hpp"
 #include "Setup.hpp"
+#include "TlsClient.hpp"
 #include <PubSubClient.h>
 #include <SPIFFS.h>
-#include <WiFiClientSecure.h>
 
-WiFiClientSecure wifiClient;
+TlsClient tlsClient;
 CertificateManager certificateManager;
-MQTTClient mqttClient(wifiClient, certificateManager);
+MQTTClient mqttClient(tlsClient, certificateManager);
 
 const char result[] = "esp32/voice_result";
 
-void customCallbackHandler(const String& payload) {
-    Serial.println("Custom handler received command: " + payload);
+void customCallbackHandler(const char* topic, const uint8_t* payload, size_t length) {
+    Serial.printf("Custom handler received command: %.*s\n", (int)length, (const char*)payload);
 }
 
 void setup() {
     // put your setup code here, to run once:
     Serial.begin(115200);
+    Logger::begin();
     setupWifi();
     setupTime();
     mqttClient.initialize();
@@ -0,0 +1,394 @@
+// Gesture frame latency over TCP against MQTT-SN datagrams when the link
+// loses packets. A discrete-event model rather than a capture: frames are
+// produced every --interval-ms and cross a link with a fixed one-way delay,
+// exponential jitter drawn independently per packet (so packets can
+// overtake each other) and random loss, optionally in bursts.
+//
+//   pio run -e native_transport_bench
+//   .pio/build/native_transport_bench/program [--loss 0,1,2,5,10] [--burst N]
+//       [--delay-ms N] [--jitter-ms N] [--interval-ms N] [--duration S]
+//       [--runs N] [--min-rto-ms N] [--deadline-ms N] [--seed N]
+//
+// TCP is one segment per frame (each publish is written at once), a
+// byte-counted congestion window, cumulative ACKs that can be lost too,
+// NewReno fast retransmit after three duplicate ACKs, and a retransmission
+// timeout of srtt + 4 rttvar, at least --min-rto-ms (lwIP counts it in
+// 500 ms ticks, hence the 1 s default) and doubled on every expiry. The
+// receiver hands frames up strictly in order, so one loss delays every
+// frame behind it. UDP frames are encoded and decoded with the glove's
+// MqttSn code and pass the gateway's SequenceFilter: a lost frame is gone,
+// a late one is dropped as stale, and nothing waits.
+//
+// "on time" counts frames delivered within --deadline-ms of being produced;
+// jitter is the mean difference in latency between consecutive deliveries
+// (RFC 3550).
+#include "MqttSn.hpp"
+#include <algorithm>
+#include <map>
+#include <math.h>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+struct Options {
+    std::vector<double> lossPercent = {0, 1, 2, 5, 10};
+    double burst = 1;         // mean length of a loss burst, in packets
+    double delayMs = 3;
+    double jitterMs = 2;
+    double intervalMs = 160;  // GESTURE_MIN_INTERVAL on the glove
+    double durationS = 120;
+    int runs = 10;
+    double minRtoMs = 1000;
+    double deadlineMs = 100;
+    unsigned seed = 1;
+    size_t frameBytes = 265;  // a full GESTURE_FRAME_SIZE batch
+};
+
+// lwIP as built for the ESP32: the window is counted in bytes, so many
+// small frames fit in one even right after a timeout
+static const double TCP_MSS = 1436;
+static const double TCP_INITIAL_CWND = 4380; // RFC 3390 for this MSS
+static const double MQTT_PUBLISH_BYTES = 22; // fixed header and "esp32/gesture_data"
+
+// Gilbert-Elliott: a bad state that loses everything, entered so that the
+// long-run loss is `loss` with bursts of `burst` packets on average.
+class LossyLink {
+public:
+    LossyLink(const Options& options, double loss, std::mt19937& random)
+        : random(random), jitter(1.0 / std::max(options.jitterMs, 1e-9)), delayMs(options.delayMs),
+          hasJitter(options.jitterMs > 0), bad(false) {
+        leaveBad = 1.0 / std::max(options.burst, 1.0);
+        enterBad = loss >= 1 ? 1 : loss * leaveBad / (1 - loss);
+    }
+
+    // Arrival time of a packet sent at `nowMs`, or a negative value if lost.
+    double send(double nowMs) {
+        bad = bad ? uniform(random) >= leaveBad : uniform(random) < enterBad;
+        if (bad) return -1;
+        return nowMs + delayMs + (hasJitter ? jitter(random) : 0);
+    }
+
+private:
+    std::mt19937& random;
+    std::uniform_real_distribution<double> uniform;
+    std::exponential_distribution<double> jitter;
+    double delayMs;
+    bool hasJitter;
+    bool bad;
+    double enterBad;
+    double leaveBad;
+};
+
+struct Result {
+    uint32_t frames = 0;
+    uint32_t stale = 0;
+    std::vector<double> latencyMs; // per delivered frame, in delivery order
+    uint32_t retransmits = 0;
+    uint32_t timeouts = 0;
+};
+
+static void runUdp(const Options& options, double loss, std::mt19937& random, Result& result) {
+    LossyLink link(options, loss, random);
+    std::vector<uint8_t> frame(options.frameBytes, 0x5a);
+    uint8_t packet[MQTTSN_MAX_PACKET];
+    // arrival time -> (sequence, produced at)
+    std::multimap<double, std::pair<uint16_t, double>> arrivals;
+    uint32_t frames = (uint32_t)(options.durationS * 1000 / options.intervalMs);
+    for (uint32_t i = 0; i < frames; i++) {
+        double sentMs = i * options.intervalMs;
+        size_t n = mqttSnEncodePublish(packet, sizeof(packet), 1, (uint16_t)i, frame.data(), frame.size());
+        double arrivalMs = n ? link.send(sentMs) : -1;
+        if (arrivalMs >= 0) arrivals.emplace(arrivalMs, std::make_pair((uint16_t)i, sentMs));
+    }
+    result.frames += frames;
+    SequenceFilter filter;
+    for (const auto& arrival : arrivals) {
+        // what the gateway would parse out of the datagram
+        size_t n = mqttSnEncodePublish(packet, sizeof(packet), 1, arrival.second.first, frame.data(), frame.size());
+        uint16_t topicId, sequence;
+        const uint8_t* payload;
+        size_t length;
+        if (!mqttSnDecodePublish(packet, n, topicId, sequence, payload, length)) continue;
+        if (!filter.accept(sequence, (uint32_t)arrival.first)) continue;
+        result.latencyMs.push_back(arrival.first - arrival.second.second);
+    }
+    result.stale += filter.stale();
+}
+
+enum EventType { FRAME, DATA, ACK, TIMEOUT };
+
+struct Event {
+    double atMs;
+    EventType type;
+    uint32_t value;    // segment, ACK number or timer generation
+    uint32_t echo;     // ACK: the segment that caused it, as a timestamp echo would
+    bool operator>(const Event& other) const { return atMs > other.atMs; }
+};
+
+// One TCP connection carrying one frame per segment, sequence numbers
+// counted in segments.
+class TcpModel {
+public:
+    TcpModel(const Options& options, double loss, std::mt19937& random, Result& result)
+        : options(options), forward(options, loss, random), reverse(options, loss, random), result(result),
+          segmentBytes(options.frameBytes + MQTT_PUBLISH_BYTES), produced(0), sndUna(0), sndNxt(0),
+          cwnd(TCP_INITIAL_CWND), ssthresh(65535), dupAcks(0), inRecovery(false), recover(0),
+          srtt(0), rttvar(0), rto(std::max(options.minRtoMs, 3000.0)), backoff(1), timerGeneration(0),
+          timerRunning(false), rcvNxt(0) {}
+
+    void run() {
+        uint32_t frames = (uint32_t)(options.durationS * 1000 / options.intervalMs);
+        sentMs.resize(frames);
+        firstSentMs.resize(frames);
+        retransmitted.assign(frames, false);
+        for (uint32_t i = 0; i < frames; i++) events.push({i * options.intervalMs, FRAME, i, 0});
+        while (!events.empty()) {
+            Event event = events.top();
+            events.pop();
+            now = event.atMs;
+            switch (event.type) {
+            case FRAME:
+                produced = event.value + 1;
+                firstSentMs[event.value] = now;
+                trySend();
+                break;
+            case DATA:
+                receive(event.value);
+                break;
+            case ACK:
+                acknowledge(event.value, event.echo);
+                break;
+            case TIMEOUT:
+                if (timerRunning && event.value == timerGeneration) expire();
+                break;
+            }
+            if (sndUna == frames) break;
+        }
+        result.frames += frames;
+    }
+
+private:
+    const Options& options;
+    LossyLink forward;
+    LossyLink reverse;
+    Result& result;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    double now;
+
+    // sender
+    double segmentBytes;
+    uint32_t produced;
+    uint32_t sndUna;
+    uint32_t sndNxt;
+    double cwnd;          // bytes
+    double ssthresh;
+    uint32_t dupAcks;
+    bool inRecovery;
+    uint32_t recover;
+    double srtt;
+    double rttvar;
+    double rto;
+    uint32_t backoff;
+    uint32_t timerGeneration;
+    bool timerRunning;
+    std::vector<double> sentMs;      // last transmission, for RTT samples
+    std::vector<double> firstSentMs; // when the frame was produced
+    std::vector<bool> retransmitted; // Karn: no RTT sample from these
+
+    // receiver
+    uint32_t rcvNxt;
+    std::set<uint32_t> outOfOrder;
+
+    void transmit(uint32_t segment) {
+        sentMs[segment] = now;
+        double arrival = forward.send(now);
+        if (arrival >= 0) events.push({arrival, DATA, segment, 0});
+        if (!timerRunning) startTimer();
+    }
+
+    void retransmit(uint32_t segment) {
+        retransmitted[segment] = true;
+        result.retransmits++;
+        transmit(segment);
+    }
+
+    void trySend() {
+        while (sndNxt < produced && flightBytes() + segmentBytes <= cwnd) transmit(sndNxt++);
+    }
+
+    double flightBytes() const {
+        return (sndNxt - sndUna) * segmentBytes;
+    }
+
+    void startTimer() {
+        timerRunning = true;
+        events.push({now + std::min(rto * backoff, 60000.0), TIMEOUT, ++timerGeneration, 0});
+    }
+
+    void receive(uint32_t segment) {
+        if (segment >= rcvNxt) outOfOrder.insert(segment);
+        while (!outOfOrder.empty() && *outOfOrder.begin() == rcvNxt) {
+            outOfOrder.erase(outOfOrder.begin());
+            result.latencyMs.push_back(now - firstSentMs[rcvNxt]);
+            rcvNxt++;
+        }
+        double arrival = reverse.send(now);
+        if (arrival >= 0) events.push({arrival, ACK, rcvNxt, segment});
+    }
+
+    void acknowledge(uint32_t ack, uint32_t echo) {
+        if (ack <= sndUna) {
+            if (ack == sndUna && sndNxt > sndUna && ++dupAcks == 3 && !inRecovery) {
+                // fast retransmit, then NewReno recovery until `recover` is acknowledged
+                ssthresh = std::max(flightBytes() / 2, 2 * TCP_MSS);
+                cwnd = ssthresh;
+                inRecovery = true;
+                recover = sndNxt;
+                retransmit(sndUna);
+            }
+            return;
+        }
+        // only the segment that was just received, not ones it released
+        // from the reassembly queue
+        if (echo == ack - 1 && !retransmitted[echo]) sampleRtt(now - sentMs[echo]);
+        sndUna = ack;
+        sndNxt = std::max(sndNxt, sndUna);
+        dupAcks = 0;
+        backoff = 1;
+        if (inRecovery) {
+            if (ack >= recover) {
+                inRecovery = false;
+            } else {
+                retransmit(sndUna); // partial ACK: the next hole
+            }
+        } else {
+            cwnd += cwnd < ssthresh ? TCP_MSS : TCP_MSS * TCP_MSS / cwnd;
+        }
+        timerRunning = false;
+        if (sndUna < sndNxt) startTimer();
+        trySend();
+    }
+
+    void sampleRtt(double rtt) {
+        if (srtt == 0) {
+            srtt = rtt;
+            rttvar = rtt / 2;
+        } else {
+            rttvar = 0.75 * rttvar + 0.25 * fabs(srtt - rtt);
+            srtt = 0.875 * srtt + 0.125 * rtt;
+        }
+        rto = std::max(options.minRtoMs, srtt + 4 * rttvar);
+    }
+
+    void expire() {
+        // go back to the oldest unacknowledged segment in slow start
+        result.timeouts++;
+        ssthresh = std::max(flightBytes() / 2, 2 * TCP_MSS);
+        cwnd = TCP_MSS;
+        dupAcks = 0;
+        inRecovery = false;
+        backoff = std::min(backoff * 2, 64u);
+        sndNxt = sndUna;
+        timerRunning = false;
+        retransmit(sndNxt++);
+    }
+};
+
+static double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = std::min(sorted.size() - 1, (size_t)(p / 100 * sorted.size()));
+    return sorted[index];
+}
+
+static void printResult(double loss, const char* transport, const Result& result, const Options& options) {
+    const std::vector<double>& latency = result.latencyMs;
+    uint32_t onTime = 0;
+    double jitter = 0;
+    for (size_t i = 0; i < latency.size(); i++) {
+        if (latency[i] <= options.deadlineMs) onTime++;
+        if (i) jitter += fabs(latency[i] - latency[i - 1]);
+    }
+    if (latency.size() > 1) jitter /= latency.size() - 1;
+    std::vector<double> sorted(latency);
+    std::sort(sorted.begin(), sorted.end());
+    printf("%6.1f %-5s %8.2f %9.2f %7.1f %7.1f %7.1f %8.1f %9.2f %6u %6u %6u\n", loss, transport,
+           100.0 * latency.size() / result.frames, 100.0 * onTime / result.frames, percentile(sorted, 50),
+           percentile(sorted, 95), percentile(sorted, 99), sorted.empty() ? 0 : sorted.back(), jitter,
+           result.stale, result.retransmits, result.timeouts);
+}
+
+static std::vector<double> parseList(const char* text) {
+    std::vector<double> values;
+    for (const char* p = text; *p;) {
+        char* end;
+        values.push_back(strtod(p, &end));
+        if (end == p) break;
+        p = *end == ',' ? end + 1 : end;
+    }
+    return values;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--loss 0,1,2,5,10] [--burst N] [--delay-ms N] [--jitter-ms N] [--interval-ms N]\n"
+            "       [--duration S] [--runs N] [--min-rto-ms N] [--deadline-ms N] [--seed N]\n",
+            program);
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) usage(argv[0]);
+        const char* value = argv[++i];
+        if (arg == "--loss") {
+            options.lossPercent = parseList(value);
+        } else if (arg == "--burst") {
+            options.burst = atof(value);
+        } else if (arg == "--delay-ms") {
+            options.delayMs = atof(value);
+        } else if (arg == "--jitter-ms") {
+            options.jitterMs = atof(value);
+        } else if (arg == "--interval-ms") {
+            options.intervalMs = atof(value);
+        } else if (arg == "--duration") {
+            options.durationS = atof(value);
+        } else if (arg == "--runs") {
+            options.runs = atoi(value);
+        } else if (arg == "--min-rto-ms") {
+            options.minRtoMs = atof(value);
+        } else if (arg == "--deadline-ms") {
+            options.deadlineMs = atof(value);
+        } else if (arg == "--seed") {
+            options.seed = (unsigned)atoi(value);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (options.lossPercent.empty() || options.intervalMs <= 0 || options.durationS <= 0 || options.runs <= 0) {
+        usage(argv[0]);
+    }
+
+    printf("frame every %.0f ms, %.0f s x %d runs, one-way %.1f ms + %.1f ms jitter, bursts of %.1f, "
+           "min RTO %.0f ms, deadline %.0f ms\n",
+           options.intervalMs, options.durationS, options.runs, options.delayMs, options.jitterMs, options.burst,
+           options.minRtoMs, options.deadlineMs);
+    printf("%6s %-5s %8s %9s %7s %7s %7s %8s %9s %6s %6s %6s\n", "loss %", "", "deliv %", "on time %", "p50 ms",
+           "p95 ms", "p99 ms", "max ms", "jitter ms", "stale", "rexmit", "rto");
+    for (double loss : options.lossPercent) {
+        Result tcp, udp;
+        std::mt19937 random(options.seed);
+        for (int run = 0; run < options.runs; run++) {
+            TcpModel(options, loss / 100, random, tcp).run();
+            runUdp(options, loss / 100, random, udp);
+        }
+        printResult(loss, "tcp", tcp, options);
+        printResult(loss, "udp", udp, options);
+    }
+    return 0;
+}
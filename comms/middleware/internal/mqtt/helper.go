@@ -3,6 +3,8 @@ package mqtt
 import (
 	"encoding/json"
 	"log"
+	"strings"
+	"sync"
 	"time"
 
 	"github.com/ParthGandhiNUS/CG4002/internal/debug"
@@ -13,6 +15,45 @@ import (
 
 var hub *websocket.Hub
 
+// A gesture frame older than one already forwarded is stale: it can arrive
+// late over UDP, and handlers run concurrently even over TCP. After
+// GESTURE_SEQUENCE_RESET without frames any sequence is accepted again, so
+// a rebooted glove is not ignored.
+//
+// Only namespaced topics (GLOVE_NAMESPACE_ROOT<id>/...) are filtered. The
+// frames carry no sender, and gloves built without GLOVE_ID all publish on
+// esp32/gesture_data, so there one glove's sequence would discard the
+// other's frames.
+const (
+	GESTURE_SEQUENCE_RESET = 2 * time.Second
+	GLOVE_NAMESPACE_ROOT   = "glove/"
+)
+
+type gestureCursor struct {
+	sequence uint16
+	at       time.Time
+}
+
+var (
+	gestureMu      sync.Mutex
+	gestureCursors = map[string]gestureCursor{} // by namespaced topic, one per glove
+)
+
+func isStaleGesture(topic string, sequence uint16) bool {
+	if !strings.HasPrefix(topic, GLOVE_NAMESPACE_ROOT) {
+		return false
+	}
+	gestureMu.Lock()
+	defer gestureMu.Unlock()
+	now := time.Now()
+	last, ok := gestureCursors[topic]
+	if ok && now.Sub(last.at) < GESTURE_SEQUENCE_RESET && int16(sequence-last.sequence) <= 0 {
+		return true
+	}
+	gestureCursors[topic] = gestureCursor{sequence: sequence, at: now}
+	return false
+}
+
 func SetHub(h *websocket.Hub) {
 	hub = h
 }
@@ -74,6 +115,37 @@ func HandleCommand(c mqtt.Client, m mqtt.Message) {
 	}()
 }
 
+// Reads binary frames from esp32/gesture_data and forward to WS
+func HandleGestureData(c mqtt.Client, m mqtt.Message) {
+	go func() {
+		frame, err := types.DecodeGestureFrame(m.Payload())
+		if err != nil {
+			log.Printf("Failed to decode gesture frame: %v", err)
+			return
+		}
+
+		if hub == nil || len(frame.Samples) == 0 {
+			return
+		}
+		if isStaleGesture(m.Topic(), frame.Sequence) {
+			return
+		}
+
+		// One event per sample, stamped relative to the newest one
+		now := time.Now().UnixMilli()
+		last := int64(frame.Samples[len(frame.Samples)-1].Offset)
+		for _, sample := range frame.Samples {
+			hub.Broadcast(types.WebsocketEvent{
+				EventType: frame.Type.ToEventType(),
+				UserID:    "*",
+				SessionID: "",
+				Timestamp: now - (last - int64(sample.Offset)),
+				Data:      sample.Axes,
+			})
+		}
+	}()
+}
+
 // HandleVoiceResult processes messages from ultra96/voice_result and forward to WS
 func HandleVoiceResult(c mqtt.Client, m mqtt.Message) {
 	go func() {
@@ -0,0 +1,93 @@
+package types
+
+import (
+	"encoding/binary"
+	"fmt"
+)
+
+// Binary gesture frames published by the glove on esp32/gesture_data.
+// Layout must match hardware/CG4002_Hardware/src/gesture.h.
+//
+// Version 1 carries a single sample, version 2 a batch of samples with
+// millisecond offsets from the first one.
+const (
+	GESTURE_V1_FRAME_SIZE  = 14
+	GESTURE_V2_HEADER_SIZE = 9
+	GESTURE_V2_SAMPLE_SIZE = 8
+	GESTURE_AXIS_SCALE     = 1000.0
+)
+
+var gestureTypes = map[uint8]CommandType{
+	1: MOVE,
+	2: ROTATE,
+}
+
+type GestureSample struct {
+	Offset uint16 // ms after the frame timestamp
+	Axes   []float64
+}
+
+type GestureFrame struct {
+	Version   uint8
+	Type      CommandType
+	Sequence  uint16
+	Timestamp uint32 // ms since the glove booted
+	Samples   []GestureSample
+}
+
+func decodeAxes(b []byte) []float64 {
+	axes := make([]float64, 3)
+	for i := range axes {
+		raw := int16(binary.LittleEndian.Uint16(b[2*i:]))
+		axes[i] = float64(raw) / GESTURE_AXIS_SCALE
+	}
+	return axes
+}
+
+// DecodeGestureFrame parses one little-endian gesture frame
+func DecodeGestureFrame(b []byte) (*GestureFrame, error) {
+	if len(b) < 2 {
+		return nil, fmt.Errorf("gesture frame too short: %d bytes", len(b))
+	}
+	gestureType, ok := gestureTypes[b[1]]
+	if !ok {
+		return nil, fmt.Errorf("unknown gesture type %d", b[1])
+	}
+
+	var samples []GestureSample
+	switch b[0] {
+	case 1:
+		if len(b) < GESTURE_V1_FRAME_SIZE {
+			return nil, fmt.Errorf("gesture frame too short: %d bytes", len(b))
+		}
+		samples = []GestureSample{{Offset: 0, Axes: decodeAxes(b[8:])}}
+
+	case 2:
+		if len(b) < GESTURE_V2_HEADER_SIZE {
+			return nil, fmt.Errorf("gesture frame too short: %d bytes", len(b))
+		}
+		count := int(b[8])
+		if len(b) < GESTURE_V2_HEADER_SIZE+count*GESTURE_V2_SAMPLE_SIZE {
+			return nil, fmt.Errorf("gesture frame truncated: %d bytes for %d samples", len(b), count)
+		}
+		samples = make([]GestureSample, count)
+		for i := range samples {
+			s := b[GESTURE_V2_HEADER_SIZE+i*GESTURE_V2_SAMPLE_SIZE:]
+			samples[i] = GestureSample{
+				Offset: binary.LittleEndian.Uint16(s),
+				Axes:   decodeAxes(s[2:]),
+			}
+		}
+
+	default:
+		return nil, fmt.Errorf("unsupported gesture schema version %d", b[0])
+	}
+
+	return &GestureFrame{
+		Version:   b[0],
+		Type:      gestureType,
+		Sequence:  binary.LittleEndian.Uint16(b[2:]),
+		Timestamp: binary.LittleEndian.Uint32(b[4:]),
+		Samples:   samples,
+	}, nil
+}
@@ -78,8 +78,10 @@ func main() {
 	mqttClient := mqtt.NewMQTTClient("GolangService", env.MQTTHost, env.MQTTPort, env.MQTTUser, env.MQTTPass, mqttTLSConf)
 
 	handlers := map[string]pahomqtt.MessageHandler{
-		"esp32/command":        mqtt.HandleCommand,
-		"ultra96/voice_result": mqtt.HandleVoiceResult,
+		"esp32/command":              mqtt.HandleCommand,
+		"esp32/gesture_data":         mqtt.HandleGestureData,
+		"glove/+/esp32/gesture_data": mqtt.HandleGestureData,
+		"ultra96/voice_result":       mqtt.HandleVoiceResult,
 	}
 
 	for topic, handler := range handlers {
@@ -182,6 +182,11 @@ openssl x509 -req -in client.csr -CA "$CA_CRT" -CAkey "$CA_KEY" -CAcreateserial
 
 rm -- *.csr *.srl
 
+echo "4. Exporting client credentials in DER form..."
+openssl x509 -in "$CA_CRT" -outform der -out "${DEVICE_PREFIX}-ca.der"
+openssl x509 -in "$CLIENT_CRT" -outform der -out "${DEVICE_PREFIX}-client.der"
+openssl pkey -in "$CLIENT_KEY" -outform der -out "${DEVICE_PREFIX}-client-key.der"
+
 echo ""
 echo "=== Certificate Generation Complete ==="
 echo "Generated files in $CERT_DIR/:"
@@ -197,4 +202,5 @@ else
     echo "    (CN only, no SAN extension)"
 fi
 echo "  - ${DEVICE_PREFIX}-client.crt, ${DEVICE_PREFIX}-client.key (Client certificate for $CLIENT_CN)"
+echo "  - ${DEVICE_PREFIX}-ca.der, ${DEVICE_PREFIX}-client.der, ${DEVICE_PREFIX}-client-key.der (DER copies for the ESP32)"
 echo "========================================"
\ No newline at end of file
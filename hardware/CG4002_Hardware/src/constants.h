@@ -5,9 +5,14 @@
 #define MAX_ADDR 0x36
 
 #define VOICE_DATA "esp32/voice_data"
+#define VOICE_FEATURES "esp32/voice_features"
 #define VOICE_RESULT "ultra96/voice_result"
+#define VOICE_LOCAL_RESULT "esp32/voice_result"
 #define COMMAND "esp32/command"
+#define GESTURE_DATA "esp32/gesture_data"
 #define DEBUG "debug/status"
+#define CLOCK_SYNC_REQUEST "esp32/clock_sync"
+#define CLOCK_SYNC_REPLY "ultra96/clock_sync"
 
 //MAX17043 constants
 // #ifdef __AVR__
@@ -27,6 +32,7 @@
 #define BUTTON_MOVE 13 //D7
 #define BUTTON_ROTATE 5 //D8
 #define BUZZER 2 //D9
+#define MPU_INT 4 //MPU6050 data-ready interrupt
 
 #define MIC_WS 25 //D2
 #define MIC_SCK 26 //D3
@@ -37,12 +43,76 @@
 #define CHANNELS 1
 #define RECORD_TIME 2 //seconds
 #define HEADER_SIZE 44
+#define VOICE_HEADER 3 //flag, number of samples in the utterance, trace id
+#define VOICE_CHUNK_SAMPLES 8000 //samples per voice_data publish
+#define I2S_DMA_BUFFERS 8
+#define I2S_DMA_LEN 128 //samples per DMA buffer
+
+//always-on capture (ALWAYS_ON_MIC builds)
+#define MIC_HISTORY_MS 400 //audio from before the press that starts the utterance
+#define MIC_HISTORY_SAMPLES (MIC_HISTORY_MS * SAMPLING_RATE / 1000)
+
+//on-glove keyword spotting (KWS_FALLBACK builds)
+#define VOICE_RESULT_TIMEOUT_MS 2000 //wait this long for ultra96/voice_result before answering locally
+#define KWS_MIN_CONFIDENCE 0.5f //local answers below this buzz as failed
+
+//voice activity detection
+#define VAD_FRAME_SAMPLES 128 //16ms at 8kHz
+#define VAD_ENERGY_FLOOR 2500 //minimum mean square that can count as speech
+#define VAD_ENERGY_RATIO 3 //speech is this many times above the noise floor
+#define VAD_ZCR_FRICATIVE 40 //zero crossings per frame for quiet unvoiced speech
+#define VAD_NOISE_SHIFT 4 //noise floor rises by 1/16 of the gap per frame
+#define VAD_SETTLE_SHIFT 7 //1/128 per frame until a quiet frame: a steady level stops counting as speech after ~0.8s
+#define VAD_ONSET_FRAMES 2 //ignore single-frame clicks (e.g. the button)
+#define VAD_PREROLL_MS 100 //audio kept before the detected onset
+#define VAD_HANGOVER_MS 300 //trailing silence that ends the recording
+#define VAD_TAIL_MS 60 //audio kept after the last speech frame
 
 #define DEBOUNCE 4000 //prevent multiple voice recordings to be sent at once
 #define BATTERY_DEBOUNCE 30000 // only need to check battery every 30s
-#define STREAMING_DEBOUNCE 30
+#define AXIS_LOCK_MS 150 //dominant axis must win this long before it is locked
 #define MESSAGE_DEBOUNCE 100
 
+//gesture publishing, axes in 1/1000 units
+#define GESTURE_MIN_INTERVAL 160 //ms between frames at full speed, when GESTURE_MAX_SAMPLES fill at IMU_SAMPLE_HZ
+#define GESTURE_MAX_INTERVAL 200 //ms between frames when barely moving
+#define GESTURE_FAST_MOTION 500 //change that counts as full speed
+#define GESTURE_DEADBAND 20 //changes below this are not sent
+
+//IMU sampling
+#define IMU_SAMPLE_HZ 200
+#define IMU_RING_SIZE 64 //must be a power of two
+#define IMU_TASK_PRIORITY 3 //above the UI and audio tasks so they cannot delay sampling
+#define AXIS_LOCK_SAMPLES (AXIS_LOCK_MS * IMU_SAMPLE_HZ / 1000)
+#define FUSION_CYCLE_BUDGET 24000 //100us at 240MHz, 2% of a 200Hz sample period
+
+//task layout
+#define NET_TASK_PRIORITY 2 //pinned to core 0 next to the WiFi stack
+#define AUDIO_TASK_PRIORITY 2 //mostly blocked in i2s_read
+#define UI_TASK_PRIORITY 1
+#define NET_POLL_MS 10 //longest NetTask waits before servicing keepalives and inbound messages
+#define UI_POLL_MS 10 //button and gesture polling period
+#define BUZZER_QUEUE_LEN 4
+#define TASK_STATS_INTERVAL 30000 //publish stack and loop latency stats every 30s
+#define LINK_STATS_INTERVAL 30000 //mqttClient publishes its link snapshot every 30s
+#define LINK_PROBE_INTERVAL 10000 //broker round-trip probe every 10s
+#define CLOCK_SYNC_INTERVAL 10000 //clock offset exchange with the Ultra96 every 10s
+#define CLOCK_SYNC_WINDOW 8 //offset from the fastest of the last 8 exchanges
+#ifndef GESTURE_TOPIC_ID
+#define GESTURE_TOPIC_ID 1 //predefined for GESTURE_DATA on the MQTT-SN gateway, distinct per namespaced glove
+#endif
+#ifndef GESTURE_GATEWAY_PORT
+#define GESTURE_GATEWAY_PORT 1885 //with -D GESTURE_GATEWAY, gesture frames go there as UDP
+#endif
+
+//power management
+#define IDLE_TIMEOUT_MS 5000 //no buttons for this long drops into light-sleep idle
+#define NET_IDLE_POLL_MS 1000 //NetTask polling while idle, well inside the MQTT keepalive
+#ifndef WAKE_PUBLISH_TARGET_MS
+#define WAKE_PUBLISH_TARGET_MS 300 //wake-to-first-publish budget, beyond it light sleep is turned off
+#endif
+#define WAKE_ANSWER_WINDOW_MS 2000 //a gesture or command later than this is not the wakeup's answer
+
 //buzzer constants
 #define NOTE_DURATION 100
 //Music notes
@@ -0,0 +1,156 @@
+#include "fusion.h"
+#include <math.h>
+
+static const int32_t ONE_Q30 = 1 << 30;
+static const int32_t GYRO_RAD_Q24 = 2235; // (pi / 180 / 131 LSB per °/s) in Q24
+static const int32_t KP_Q16 = 32768;      // proportional gain 0.5
+static const int32_t KI_Q16 = 655;        // integral gain 0.01
+static const int64_t US_TO_S_Q32 = 4295;  // 2^32 / 1e6
+// |a| must be within 0.8 g .. 1.2 g to be trusted as gravity
+static const uint32_t ACC_MIN = 13107;
+static const uint32_t ACC_MAX = 19661;
+static const int DEFAULT_CALIBRATION_SAMPLES = 200;
+static const uint32_t MAX_DT_US = 50000;
+
+static inline int32_t mul30(int32_t a, int32_t b) { return (int32_t)(((int64_t)a * b) >> 30); }
+
+static uint32_t isqrt64(uint64_t x) {
+    uint64_t r = 0, b = 1ULL << 62;
+    while (b > x) b >>= 2;
+    while (b) {
+        if (x >= r + b) {
+            x -= r + b;
+            r = (r >> 1) + b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+MahonyFusion::MahonyFusion() : calibrationTarget(DEFAULT_CALIBRATION_SAMPLES) { reset(); }
+
+void MahonyFusion::reset() {
+    q[0] = ONE_Q30;
+    q[1] = q[2] = q[3] = 0;
+    for (int i = 0; i < 3; i++) {
+        integral[i] = 0;
+        biasQ8[i] = 0;
+        gyroSum[i] = 0;
+        accSum[i] = 0;
+    }
+    calibrationCount = 0;
+}
+
+void MahonyFusion::calibrate(const int16_t acc[3], const int16_t gyro[3]) {
+    for (int i = 0; i < 3; i++) {
+        gyroSum[i] += gyro[i];
+        accSum[i] += acc[i];
+    }
+    if (++calibrationCount < calibrationTarget) return;
+
+    int32_t meanAcc[3];
+    for (int i = 0; i < 3; i++) {
+        biasQ8[i] = (int32_t)(gyroSum[i] * 256 / calibrationCount);
+        meanAcc[i] = accSum[i] / calibrationCount;
+    }
+    alignToGravity(meanAcc);
+}
+
+// Starts from the attitude that puts `acc` straight down, with zero yaw.
+void MahonyFusion::alignToGravity(const int32_t acc[3]) {
+    float roll = atan2f((float)acc[1], (float)acc[2]);
+    float pitch = atan2f(-(float)acc[0], sqrtf((float)acc[1] * acc[1] + (float)acc[2] * acc[2]));
+    float cr = cosf(roll / 2), sr = sinf(roll / 2);
+    float cp = cosf(pitch / 2), sp = sinf(pitch / 2);
+    q[0] = (int32_t)(cr * cp * ONE_Q30);
+    q[1] = (int32_t)(sr * cp * ONE_Q30);
+    q[2] = (int32_t)(cr * sp * ONE_Q30);
+    q[3] = (int32_t)(-sr * sp * ONE_Q30);
+}
+
+void MahonyFusion::realign(const int16_t acc[3]) {
+    if (!calibrated()) return;
+    const int32_t a[3] = {acc[0], acc[1], acc[2]};
+    alignToGravity(a);
+    for (int i = 0; i < 3; i++) integral[i] = 0;
+}
+
+void MahonyFusion::update(const int16_t acc[3], const int16_t gyro[3], uint32_t dtUs) {
+    if (!calibrated()) {
+        calibrate(acc, gyro);
+        return;
+    }
+    if (dtUs > MAX_DT_US) dtUs = MAX_DT_US; // after a stall, do not integrate the gap
+
+    int32_t rate[3]; // Q24 rad/s
+    for (int i = 0; i < 3; i++) {
+        rate[i] = (int32_t)((((int64_t)gyro[i] * 256) - biasQ8[i]) * GYRO_RAD_Q24 >> 8);
+    }
+
+    uint64_t accSq = (int64_t)acc[0] * acc[0] + (int64_t)acc[1] * acc[1] + (int64_t)acc[2] * acc[2];
+    uint32_t accNorm = isqrt64(accSq);
+    if (accNorm > ACC_MIN && accNorm < ACC_MAX) {
+        int64_t inv = (1LL << 46) / accNorm;
+        int32_t a[3];
+        for (int i = 0; i < 3; i++) a[i] = (int32_t)((acc[i] * inv) >> 16);
+
+        int32_t v[3];
+        estimateGravity(v);
+        int32_t e[3] = {
+            mul30(a[1], v[2]) - mul30(a[2], v[1]),
+            mul30(a[2], v[0]) - mul30(a[0], v[2]),
+            mul30(a[0], v[1]) - mul30(a[1], v[0]),
+        };
+        for (int i = 0; i < 3; i++) {
+            int64_t eQ24 = e[i] >> 6;
+            integral[i] += (int32_t)(((eQ24 * KI_Q16) >> 16) * dtUs * US_TO_S_Q32 >> 32);
+            rate[i] += (int32_t)((eQ24 * KP_Q16) >> 16) + integral[i];
+        }
+    }
+
+    // q += 0.5 * q * (0, rate) * dt
+    int32_t h[3];
+    for (int i = 0; i < 3; i++) {
+        h[i] = (int32_t)(((int64_t)rate[i] * dtUs * (US_TO_S_Q32 << 5)) >> 32);
+    }
+    int32_t qw = q[0], qx = q[1], qy = q[2], qz = q[3];
+    q[0] += -mul30(qx, h[0]) - mul30(qy, h[1]) - mul30(qz, h[2]);
+    q[1] += mul30(qw, h[0]) + mul30(qy, h[2]) - mul30(qz, h[1]);
+    q[2] += mul30(qw, h[1]) - mul30(qx, h[2]) + mul30(qz, h[0]);
+    q[3] += mul30(qw, h[2]) + mul30(qx, h[1]) - mul30(qy, h[0]);
+
+    uint64_t qSq = 0;
+    for (int i = 0; i < 4; i++) qSq += (int64_t)q[i] * q[i];
+    uint32_t qNorm = isqrt64(qSq); // Q30
+    if (qNorm == 0) {
+        reset();
+        return;
+    }
+    int64_t inv = (1LL << 60) / qNorm;
+    for (int i = 0; i < 4; i++) q[i] = (int32_t)(((int64_t)q[i] * inv) >> 30);
+}
+
+// Gravity direction predicted by the current attitude, Q30.
+void MahonyFusion::estimateGravity(int32_t v[3]) const {
+    v[0] = 2 * (mul30(q[1], q[3]) - mul30(q[0], q[2]));
+    v[1] = 2 * (mul30(q[0], q[1]) + mul30(q[2], q[3]));
+    v[2] = mul30(q[0], q[0]) - mul30(q[1], q[1]) - mul30(q[2], q[2]) + mul30(q[3], q[3]);
+}
+
+void MahonyFusion::gravity(int16_t out[3]) const {
+    int32_t v[3];
+    estimateGravity(v);
+    for (int i = 0; i < 3; i++) out[i] = (int16_t)(v[i] >> 16);
+}
+
+void MahonyFusion::euler(float &pitchDeg, float &rollDeg, float &yawDeg) const {
+    float w = (float)q[0] / ONE_Q30, x = (float)q[1] / ONE_Q30;
+    float y = (float)q[2] / ONE_Q30, z = (float)q[3] / ONE_Q30;
+    const float toDeg = 180.0f / (float)M_PI;
+    rollDeg = atan2f(2 * (w * x + y * z), 1 - 2 * (x * x + y * y)) * toDeg;
+    float s = 2 * (w * y - z * x);
+    pitchDeg = (s >= 1 ? 90.0f : s <= -1 ? -90.0f : asinf(s) * toDeg);
+    yawDeg = atan2f(2 * (w * z + x * y), 1 - 2 * (y * y + z * z)) * toDeg;
+}
@@ -0,0 +1,44 @@
+#ifndef FUSION_H
+#define FUSION_H
+
+#include <stdint.h>
+
+// Fixed-point Mahony filter fusing MPU6050 gyro and accelerometer readings.
+// Quaternion and unit vectors are Q30, angular rates Q24 rad/s. Raw readings
+// are expected at the MPU6050 defaults (±2 g, ±250 °/s). Arduino-free.
+class MahonyFusion {
+public:
+    MahonyFusion();
+
+    // Restarts gyro bias calibration; the glove must be still until done.
+    void reset();
+    bool calibrated() const { return calibrationCount >= calibrationTarget; }
+    void setCalibrationSamples(int samples) { calibrationTarget = samples; }
+
+    // Feeds one raw sample taken dtUs after the previous one.
+    void update(const int16_t acc[3], const int16_t gyro[3], uint32_t dtUs);
+
+    // Gravity direction in the sensor frame, 1 g = 16384 (accelerometer LSB).
+    void gravity(int16_t out[3]) const;
+    void euler(float &pitchDeg, float &rollDeg, float &yawDeg) const;
+    // Restarts the attitude from `acc` (e.g. after the sensor slept), keeping
+    // the gyro bias.
+    void realign(const int16_t acc[3]);
+    // Gyro bias in 1/256 LSB.
+    const int32_t *gyroBias() const { return biasQ8; }
+
+private:
+    int32_t q[4];        // Q30, w x y z
+    int32_t integral[3]; // Q24 rad/s
+    int32_t biasQ8[3];
+    int64_t gyroSum[3];
+    int32_t accSum[3];
+    int calibrationCount;
+    int calibrationTarget;
+
+    void calibrate(const int16_t acc[3], const int16_t gyro[3]);
+    void estimateGravity(int32_t v[3]) const;
+    void alignToGravity(const int32_t acc[3]);
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "gesture.h"
+#include "constants.h"
+
+static_assert(GESTURE_MIN_INTERVAL >= MESSAGE_DEBOUNCE, "frames must not outpace the updates they replaced");
+
+static uint8_t *putU16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xff;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static uint8_t *putU32(uint8_t *p, uint32_t v) {
+    p = putU16(p, v & 0xffff);
+    return putU16(p, v >> 16);
+}
+
+static int16_t toAxis(float v) {
+    float scaled = v * GESTURE_AXIS_SCALE;
+    if (scaled > 32767.0f) return 32767;
+    if (scaled < -32768.0f) return -32768;
+    return (int16_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+GesturePublisher::GesturePublisher()
+    : type(GESTURE_MOVE), count(0), seq(0), hasSent(false), motion(0),
+      lastSendMs(0), sent(0), suppressed(0) {}
+
+void GesturePublisher::begin(GestureType gestureType) {
+    type = gestureType;
+    count = 0;
+    hasSent = false;
+    motion = 0;
+}
+
+void GesturePublisher::add(uint32_t timestampMs, float x, float y, float z) {
+    if (count == GESTURE_MAX_SAMPLES) return; // poll() is overdue; keep the oldest
+    Sample &s = samples[count++];
+    s.timestamp = timestampMs;
+    s.axes[0] = toAxis(x);
+    s.axes[1] = toAxis(y);
+    s.axes[2] = toAxis(z);
+    for (int i = 0; i < 3; i++) {
+        int32_t d = hasSent ? s.axes[i] - lastSent[i] : s.axes[i];
+        if (d < 0) d = -d;
+        if (d > motion) motion = d;
+    }
+}
+
+size_t GesturePublisher::poll(uint32_t nowMs, uint8_t *buf) {
+    if (count == 0) return 0;
+
+    int32_t fast = motion < GESTURE_FAST_MOTION ? motion : GESTURE_FAST_MOTION;
+    uint32_t interval = GESTURE_MAX_INTERVAL -
+                        (GESTURE_MAX_INTERVAL - GESTURE_MIN_INTERVAL) * fast / GESTURE_FAST_MOTION;
+    if (count < GESTURE_MAX_SAMPLES && nowMs - lastSendMs < interval) return 0;
+
+    if (motion < GESTURE_DEADBAND) {
+        // held still: nothing the visualiser has not already seen
+        suppressed++;
+        count = 0;
+        lastSendMs = nowMs;
+        return 0;
+    }
+
+    size_t len = encode(buf);
+    for (int i = 0; i < 3; i++) lastSent[i] = samples[count - 1].axes[i];
+    hasSent = true;
+    count = 0;
+    motion = 0;
+    lastSendMs = nowMs;
+    sent++;
+    return len;
+}
+
+size_t GesturePublisher::encode(uint8_t *buf) {
+    uint8_t *p = buf;
+    *p++ = GESTURE_SCHEMA_VERSION;
+    *p++ = type;
+    p = putU16(p, seq++);
+    p = putU32(p, samples[0].timestamp);
+    *p++ = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t offset = samples[i].timestamp - samples[0].timestamp;
+        p = putU16(p, offset > 0xffff ? 0xffff : offset);
+        for (int a = 0; a < 3; a++) p = putU16(p, (uint16_t)samples[i].axes[a]);
+    }
+    return p - buf;
+}
@@ -0,0 +1,71 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary MOVE/ROTATE frames published on GESTURE_DATA.
+// Decoded by the middleware (internal/types/gesture.go); bump the version on
+// any layout change. All fields are little endian.
+//
+// Version 2 carries every sample since the previous frame:
+//   0  u8   version
+//   1  u8   type (GestureType)
+//   2  u16  sequence number
+//   4  u32  timestamp of the first sample, ms since boot
+//   8  u8   sample count
+//   9  count x { u16 offset from the first sample in ms,
+//                i16 x, y, z in 1/GESTURE_AXIS_SCALE units }
+#define GESTURE_SCHEMA_VERSION 2
+#define GESTURE_HEADER_SIZE 9
+#define GESTURE_SAMPLE_SIZE 8
+#define GESTURE_MAX_SAMPLES 32
+#define GESTURE_FRAME_SIZE (GESTURE_HEADER_SIZE + GESTURE_MAX_SAMPLES * GESTURE_SAMPLE_SIZE)
+#define GESTURE_AXIS_SCALE 1000
+
+enum GestureType : uint8_t {
+    GESTURE_MOVE = 1,
+    GESTURE_ROTATE = 2,
+};
+
+// Collects gesture samples and decides when a frame is worth sending:
+// nothing goes out while every axis stays within GESTURE_DEADBAND of the last
+// frame, and the send interval shrinks from GESTURE_MAX_INTERVAL to
+// GESTURE_MIN_INTERVAL as the motion grows. A full batch goes out at once,
+// so at IMU_SAMPLE_HZ moving frames leave as fast as the batch fills, never
+// faster than the MESSAGE_DEBOUNCE updates they replaced. Does not allocate.
+class GesturePublisher {
+public:
+    GesturePublisher();
+
+    // Starts a new press: drops queued samples and resets the deadband.
+    void begin(GestureType type);
+    void add(uint32_t timestampMs, float x, float y, float z);
+    // Writes a frame into `buf` (GESTURE_FRAME_SIZE bytes) when one is due and
+    // returns its length, otherwise returns 0.
+    size_t poll(uint32_t nowMs, uint8_t *buf);
+
+    uint32_t framesSent() const { return sent; }
+    uint32_t framesSuppressed() const { return suppressed; }
+
+private:
+    struct Sample {
+        uint32_t timestamp;
+        int16_t axes[3];
+    };
+
+    GestureType type;
+    Sample samples[GESTURE_MAX_SAMPLES];
+    uint8_t count;
+    uint16_t seq;
+    int16_t lastSent[3];
+    bool hasSent;
+    int32_t motion; // largest change from lastSent in the pending samples
+    uint32_t lastSendMs;
+    uint32_t sent;
+    uint32_t suppressed;
+
+    size_t encode(uint8_t *buf);
+};
+
+#endif
@@ -0,0 +1,405 @@
+#include "glove.h"
+#include "gesture.h"
+#include "hal.h"
+#include "imu.h"
+#include "kws.h"
+#include "melspec.h"
+#include "trace.h"
+#include "vad.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+static const float ACC_SCALE = 16384.0f; // LSB -> g at ±2g
+static const int totalSamples = SAMPLING_RATE * RECORD_TIME;
+
+volatile bool recording = false;
+
+static int16_t message[VOICE_HEADER + SAMPLING_RATE * RECORD_TIME];
+static VoiceActivityDetector vad;
+
+static float AccX, AccY, AccZ;
+static bool first = true;
+static bool lock = false;
+static int counterX = 0, counterY = 0, counterZ = 0;
+static uint8_t gestureFrame[GESTURE_FRAME_SIZE];
+static GesturePublisher gesturePublisher;
+
+#ifdef ALWAYS_ON_MIC
+static_assert(MIC_HISTORY_SAMPLES % VAD_FRAME_SAMPLES == 0, "history must hold whole frames");
+static int16_t history[MIC_HISTORY_SAMPLES];
+static uint32_t historyHead = 0; // samples captured into history so far
+static uint32_t historyRead = 0; // next history sample recordVoice consumes
+static ListenStats listenStats = {sizeof(history), 0, 0};
+
+void gloveListen() {
+    uint64_t cycles = halMicCycles();
+    halReadMic(&history[historyHead % MIC_HISTORY_SAMPLES], VAD_FRAME_SAMPLES);
+    historyHead += VAD_FRAME_SAMPLES;
+    listenStats.frames++;
+    listenStats.micCycles += halMicCycles() - cycles;
+}
+
+ListenStats gloveListenStats() { return listenStats; }
+
+// Replays the history captured before the press, then the live microphone.
+static void readFrame(int16_t *frame, int n) {
+    if (historyRead < historyHead) {
+        for (int i = 0; i < n; i++) {
+            frame[i] = history[historyRead++ % MIC_HISTORY_SAMPLES];
+        }
+    } else {
+        halReadMic(frame, n);
+    }
+}
+#else
+static void readFrame(int16_t *frame, int n) { halReadMic(frame, n); }
+#endif
+
+static bool publishJson(const char *topic, const char *json) {
+    return halPublish(topic, reinterpret_cast<const uint8_t *>(json), strlen(json));
+}
+
+// ---- Voice ----
+
+static VoiceCapture lastCapture = {0, 0, 0};
+
+VoiceCapture gloveLastCapture() { return lastCapture; }
+
+int recordVoice(int16_t flag) {
+    static const int prerollSamples = VAD_PREROLL_MS * SAMPLING_RATE / 1000;
+    static const int hangoverFrames =
+        VAD_HANGOVER_MS * SAMPLING_RATE / 1000 / VAD_FRAME_SAMPLES;
+    static const int tailSamples = VAD_TAIL_MS * SAMPLING_RATE / 1000;
+    int16_t *samples = &message[VOICE_HEADER];
+    int samplesWritten = 0; // samples kept in message
+    int samplesCaptured = 0; // samples read from the mic
+    int speechEnd = 0;
+    bool done = false;
+
+    uint16_t id = traceBegin();
+    vad.reset();
+#ifdef ALWAYS_ON_MIC
+    historyRead = historyHead > MIC_HISTORY_SAMPLES ? historyHead - MIC_HISTORY_SAMPLES : 0;
+#endif
+    recording = true;
+    halShowRecording(true);
+    while (!done) {
+        int n = totalSamples - samplesWritten;
+        if (n > VAD_FRAME_SAMPLES) n = VAD_FRAME_SAMPLES;
+        int16_t *frame = &samples[samplesWritten];
+        readFrame(frame, n);
+        bool speech = vad.process(frame, n);
+        samplesWritten += n;
+        samplesCaptured += n;
+
+        if (!vad.inSpeech()) {
+            // drop leading silence, keeping only the pre-roll window
+            if (samplesWritten > prerollSamples + VAD_FRAME_SAMPLES) {
+                memmove(samples, &samples[samplesWritten - prerollSamples],
+                        prerollSamples * sizeof(int16_t));
+                samplesWritten = prerollSamples;
+            }
+            done = samplesCaptured >= totalSamples; // nobody spoke
+        } else if (speech) {
+            speechEnd = samplesWritten;
+        } else {
+            done = vad.silentFrames() >= hangoverFrames;
+        }
+        done = done || samplesWritten >= totalSamples;
+    }
+    recording = false;
+    halShowRecording(false);
+#ifdef ALWAYS_ON_MIC
+    historyHead = 0; // the next utterance must not reach back into this one
+#endif
+
+    int length = 0;
+    if (vad.inSpeech()) {
+        length = speechEnd + tailSamples < samplesWritten ? speechEnd + tailSamples : samplesWritten;
+    }
+    traceMark(TRACE_CAPTURED);
+    lastCapture.captured = samplesCaptured;
+    lastCapture.offset = samplesCaptured - samplesWritten;
+    lastCapture.length = length;
+    message[0] = flag;
+    message[1] = length;
+    message[2] = (int16_t)id;
+    halLog("%d: %d samples (%d captured)\n", flag, length, samplesCaptured);
+    if (length == 0) halBuzz(NOTE_D2);
+    return length;
+}
+
+void sendVoice() {
+    int length = message[1];
+    for (int offset = 0; offset < length; offset += VOICE_CHUNK_SAMPLES) {
+        int n = length - offset < VOICE_CHUNK_SAMPLES ? length - offset : VOICE_CHUNK_SAMPLES;
+        // every chunk carries the header, streamed ahead of its samples
+        int16_t header[VOICE_HEADER] = {message[0], (int16_t)length, message[2]};
+        bool sent = halPublishPartsAndWait(VOICE_DATA, reinterpret_cast<uint8_t *>(header), sizeof(header),
+                                           reinterpret_cast<uint8_t *>(&message[VOICE_HEADER + offset]),
+                                           n * sizeof(int16_t));
+        if (sent) {
+            traceChunkSent(offset / VOICE_CHUNK_SAMPLES);
+            halBuzz(NOTE_D5);
+        } else {
+            halBuzz(NOTE_D2);
+            break;
+        }
+    }
+}
+
+#ifdef EDGE_FEATURES
+static LogMelExtractor melExtractor;
+static uint8_t features[VOICE_HEADER * sizeof(int16_t) + MEL_BINS * MEL_FRAMES];
+
+void featuresInit() { melExtractor.begin(); }
+
+#ifdef KWS_FALLBACK
+static KwsResult localResult;
+static int16_t localCommand = 0;
+// halMillis() after which the local result answers the utterance, 0 once answered
+static volatile uint32_t resultDeadline = 0;
+
+static void useLocalResult() {
+    resultDeadline = 0;
+    char json[160];
+    snprintf(json, sizeof(json),
+             "{\"status\": \"LOCAL\", \"info\": {\"command\": \"%s\", \"result\": \"%s\", "
+             "\"confidence\": %.2f, \"inferenceCycles\": %lu}}",
+             localCommand ? "DELETE" : "SELECT", KWS_LABELS[localResult.label], localResult.confidence,
+             (unsigned long)localResult.cycles);
+    publishJson(VOICE_LOCAL_RESULT, json);
+    halBuzz(localResult.confidence >= KWS_MIN_CONFIDENCE ? NOTE_E5 : NOTE_D2);
+}
+
+void gloveVoiceResult(bool failed) {
+    if (failed && resultDeadline) {
+        useLocalResult();
+        return;
+    }
+    resultDeadline = 0;
+    halBuzz(failed ? NOTE_D2 : NOTE_E5);
+}
+#endif
+
+void computeFeatures() {
+    uint32_t start = halMillis();
+    memcpy(features, message, VOICE_HEADER * sizeof(int16_t));
+    melExtractor.compute(&message[VOICE_HEADER], message[1],
+                         &features[VOICE_HEADER * sizeof(int16_t)]);
+    halLog("Log-mel features in %lu ms\n", (unsigned long)(halMillis() - start));
+#ifdef KWS_FALLBACK
+    kwsClassify(&features[VOICE_HEADER * sizeof(int16_t)], localResult);
+    localCommand = message[0];
+    halLog("Local keyword %s (%.2f) in %lu cycles\n", KWS_LABELS[localResult.label], localResult.confidence,
+           (unsigned long)localResult.cycles);
+#endif
+    traceMark(TRACE_FEATURES);
+}
+
+void sendFeatures() {
+    if (halPublishAndWait(VOICE_FEATURES, features, sizeof(features))) {
+        traceChunkSent(0);
+        halBuzz(NOTE_D5);
+#ifdef KWS_FALLBACK
+        resultDeadline = halMillis() + VOICE_RESULT_TIMEOUT_MS;
+#endif
+    } else {
+#ifdef KWS_FALLBACK
+        // the broker is unreachable, answer straight away
+        useLocalResult();
+#else
+        halBuzz(NOTE_D2);
+#endif
+    }
+}
+#endif
+
+bool gloveAudioStep(uint32_t events) {
+    int length = 0;
+    if (events & EVT_VOICE_SELECT) {
+        length = recordVoice(0);
+    } else if (events & EVT_VOICE_DELETE) {
+        length = recordVoice(1);
+    } else if (events & EVT_VOICE_RESEND) {
+#ifdef EDGE_FEATURES
+        sendFeatures();
+#else
+        sendVoice();
+#endif
+        return false;
+    }
+#ifdef EDGE_FEATURES
+    return length > 0;
+#else
+    if (length > 0) sendVoice();
+    return false;
+#endif
+}
+
+// ---- Gestures ----
+
+static void resetGesture() {
+    // samples taken while no gesture button is held are stale
+    imuSamples.flush();
+    first = true;
+    lock = false;
+    counterX = 0;
+    counterY = 0;
+    counterZ = 0;
+}
+
+static void publishDebug() {
+    struct timeval tv;
+    char json[320];
+    gettimeofday(&tv, NULL);
+    unsigned long long time_now = (unsigned long long) (tv.tv_sec) * 1000 + (unsigned long long) (tv.tv_usec) / 1000;
+    snprintf(json, sizeof(json),
+             "{\n\"type\": \"DEBUG\",\n\"timestamp\": %llu,\n\"fusionMaxCycles\": %lu,\n"
+             "\"fusionAvgCycles\": %lu,\n\"fusionOverBudget\": %lu,\n\"gestureFrames\": %lu,\n"
+             "\"gestureSuppressed\": %lu\n}",
+             time_now, (unsigned long)fusionStats.maxCycles,
+             (unsigned long)(fusionStats.updates ? fusionStats.totalCycles / fusionStats.updates : 0),
+             (unsigned long)fusionStats.overBudget, (unsigned long)gesturePublisher.framesSent(),
+             (unsigned long)gesturePublisher.framesSuppressed());
+    publishJson(COMMAND, json);
+}
+
+// Drains the IMU ring buffer while MOVE or ROTATE is held.
+static uint32_t gestureStep(uint32_t now, bool move, bool rotate) {
+    static uint32_t message_debounce = 0;
+    static int16_t x1, y1, z1;
+    ImuSample sample;
+    while (imuSamples.pop(sample)) {
+        if (first) {
+            x1 = sample.gravX;
+            y1 = sample.gravY;
+            z1 = sample.gravZ;
+            first = false;
+            gesturePublisher.begin(move ? GESTURE_MOVE : GESTURE_ROTATE);
+        }
+        float dx, dy, dz;
+        if (move) {
+            // acceleration with the fused gravity estimate removed
+            dx = sample.ax - sample.gravX;
+            dy = sample.ay - sample.gravY;
+            dz = sample.az - sample.gravZ;
+        } else {
+            // change in tilt since the button was pressed
+            dx = sample.gravX - x1;
+            dy = sample.gravY - y1;
+            dz = sample.gravZ - z1;
+        }
+
+        // Convert to physical units
+        AccX = -2 * dx / ACC_SCALE;
+        AccY = -3 * dz / ACC_SCALE;
+        AccZ = -4 * dy / ACC_SCALE;
+
+        if (!lock) {
+            counterX = (customMax(AccX, AccY, AccZ) == 0) ? counterX + 1
+                                                          : counterX;
+            counterY = (customMax(AccX, AccY, AccZ) == 1) ? counterY + 1
+                                                          : counterY;
+            counterZ = (customMax(AccX, AccY, AccZ) == 2) ? counterZ + 1
+                                                          : counterZ;
+        }
+
+        if (counterX >= AXIS_LOCK_SAMPLES) {
+            lock = true;
+            AccY = 0;
+            AccZ = 0;
+        } else if (counterY >= AXIS_LOCK_SAMPLES) {
+            lock = true;
+            AccX = 0;
+            AccZ = 0;
+        } else if (counterZ >= AXIS_LOCK_SAMPLES) {
+            lock = true;
+            AccX = 0;
+            AccY = 0;
+        }
+
+        if (lock && move != rotate) {
+            uint32_t sampleMs = now - (halMicros() - sample.timestamp) / 1000;
+            if (move) {
+                // scaling for better movement
+                gesturePublisher.add(sampleMs, AccX * 2.5, AccY * 1.5, AccZ * 3);
+            } else {
+                gesturePublisher.add(sampleMs, AccY, AccZ > 0 ? AccZ * 1.7 : AccZ, AccX);
+            }
+        }
+    } // end sample drain
+
+    size_t len = gesturePublisher.poll(now, gestureFrame);
+    if (len > 0) {
+        halPublish(GESTURE_DATA, gestureFrame, len);
+    }
+
+    if (now - message_debounce > MESSAGE_DEBOUNCE) {
+        message_debounce = now;
+        if (move && rotate) { //debug
+            publishDebug();
+            message_debounce += 2000; //prevent spamming of debug
+            return EVT_VOICE_RESEND;
+        }
+    }
+    return 0;
+}
+
+// ---- Buttons and battery ----
+
+uint32_t gloveUiStep(uint32_t now) {
+    static uint32_t button_debounce = 0, batt_debounce = 0;
+    uint32_t events = 0;
+
+    if (now - button_debounce > DEBOUNCE) {
+        if (halButtonPressed(BUTTON_SELECT)) {
+            button_debounce = now;
+            events |= EVT_VOICE_SELECT;
+        } else if (halButtonPressed(BUTTON_DELETE)) {
+            button_debounce = now;
+            events |= EVT_VOICE_DELETE;
+        } else if (halButtonPressed(BUTTON_SCREENSHOT)) {
+            button_debounce = now;
+            publishJson(COMMAND, "{\n\"type\": \"SCREENSHOT\"\n}");
+        }
+    }
+
+    bool move = halButtonPressed(BUTTON_MOVE);
+    bool rotate = halButtonPressed(BUTTON_ROTATE);
+    if (move || rotate) {
+        events |= gestureStep(now, move, rotate);
+    } else {
+        resetGesture();
+    }
+
+    if ((now - batt_debounce) > BATTERY_DEBOUNCE) {
+        // only need to update battery percentage once in a while
+        batt_debounce = now;
+        halShowBattery(halBatteryPercent());
+    }
+#ifdef KWS_FALLBACK
+    uint32_t deadline = resultDeadline;
+    if (deadline && (int32_t)(now - deadline) >= 0) useLocalResult();
+#endif
+    return events;
+}
+
+bool gloveIdle() {
+#ifdef KWS_FALLBACK
+    // UiTask has to stay awake to time out the voice result
+    if (resultDeadline) return false;
+#endif
+    return !recording && !halButtonPressed(BUTTON_SELECT) && !halButtonPressed(BUTTON_DELETE) &&
+           !halButtonPressed(BUTTON_MOVE) && !halButtonPressed(BUTTON_ROTATE) &&
+           !halButtonPressed(BUTTON_SCREENSHOT);
+}
+
+int customMax(float AccX, float AccY, float AccZ) {
+    if (fabsf(AccX) > fabsf(AccY) && fabsf(AccX) > fabsf(AccZ)) return 0;
+    if (fabsf(AccY) > fabsf(AccX) && fabsf(AccY) > fabsf(AccZ)) return 1;
+    if (fabsf(AccZ) > fabsf(AccX) && fabsf(AccZ) > fabsf(AccY)) return 2;
+    return -1;
+}
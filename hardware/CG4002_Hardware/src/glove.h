@@ -0,0 +1,63 @@
+#ifndef GLOVE_H
+#define GLOVE_H
+
+#include <stdint.h>
+#include "constants.h"
+
+// Glove behaviour shared by the firmware tasks (tasks.cpp) and the native
+// simulator (sim/). Only reaches the hardware through hal.h.
+
+// events returned by gloveUiStep for the audio side
+#define EVT_VOICE_SELECT (1 << 0)
+#define EVT_VOICE_DELETE (1 << 1)
+#define EVT_VOICE_RESEND (1 << 2) //debug: publish the last utterance again
+
+extern volatile bool recording;
+
+// One pass over the buttons, the gesture stream and the battery.
+// Returns the EVT_VOICE_* bits that were raised.
+uint32_t gloveUiStep(uint32_t now);
+// Records or resends an utterance for the raised EVT_VOICE_* bits. Returns
+// true when features still have to be computed and sent (EDGE_FEATURES).
+bool gloveAudioStep(uint32_t events);
+// True when no button is held and nothing is being recorded.
+bool gloveIdle();
+
+// Records an utterance into the voice buffer; returns its length in samples.
+int recordVoice(int16_t flag);
+// Where the last utterance came from, for the native VAD replay.
+struct VoiceCapture {
+    int captured; // samples read from the microphone
+    int offset;   // of the first kept sample among them
+    int length;   // samples kept, 0 if nobody spoke
+};
+VoiceCapture gloveLastCapture();
+void sendVoice();
+#ifdef EDGE_FEATURES
+void featuresInit();
+// Also classifies the utterance locally in KWS_FALLBACK builds.
+void computeFeatures();
+void sendFeatures();
+#endif
+#ifdef KWS_FALLBACK
+#ifndef EDGE_FEATURES
+#error "KWS_FALLBACK classifies the EDGE_FEATURES log-mel features"
+#endif
+// Handles ultra96/voice_result; a FAILED result falls back to the local one.
+void gloveVoiceResult(bool failed);
+#endif
+#ifdef ALWAYS_ON_MIC
+struct ListenStats {
+    uint32_t historyBytes;
+    uint32_t frames;     // frames captured while waiting for a press
+    uint64_t micCycles;  // spent copying those frames out of the DMA buffers
+};
+// Captures one VAD frame into the mic history. AudioTask calls it whenever
+// no EVT_VOICE_* bit is pending, so recordVoice can start from the audio
+// just before the press.
+void gloveListen();
+ListenStats gloveListenStats();
+#endif
+int customMax(float AccX, float AccY, float AccZ);
+
+#endif
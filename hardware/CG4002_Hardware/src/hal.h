@@ -0,0 +1,43 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Peripherals used by the glove logic (glove.cpp, imu.cpp). hal_esp32.cpp
+// backs them with the real hardware and FreeRTOS tasks; the native
+// environment (sim/) replays recorded traces against a fake clock.
+
+uint32_t halMillis();
+uint32_t halMicros();
+// CPU cycles on the ESP32, nanoseconds on the host.
+uint32_t halCycleCount();
+
+// Blocks until `count` microphone samples have been captured.
+size_t halReadMic(int16_t *samples, size_t count);
+// Cycles spent copying samples out of the microphone buffers so far.
+uint64_t halMicCycles();
+bool halButtonPressed(int pin);
+float halBatteryPercent();
+void halShowBattery(float percent);
+void halShowRecording(bool on);
+void halBuzz(uint16_t note);
+// printf-style, with a string literal format. On the ESP32 it is the
+// Logger's LOG_INFO, which keeps the format pointer and the raw arguments
+// and formats them on its own task.
+#ifdef ARDUINO
+#include "Logger.hpp"
+#define halLog(...) LOG_INFO(__VA_ARGS__)
+#else
+void halLog(const char *format, ...);
+#endif
+
+// Copies a small payload for the network task; false if it was dropped.
+bool halPublish(const char *topic, const uint8_t *data, size_t length);
+// Publishes `data` in place and returns once it has been sent.
+bool halPublishAndWait(const char *topic, const uint8_t *data, size_t length);
+// Publishes `header` followed by `data`, both in place, as one message.
+bool halPublishPartsAndWait(const char *topic, const uint8_t *header, size_t headerLength,
+                            const uint8_t *data, size_t length);
+
+#endif
@@ -0,0 +1,46 @@
+#include "hal.h"
+#include "helpers.h"
+#include "Logger.hpp"
+
+uint32_t halMillis() { return millis(); }
+uint32_t halMicros() { return micros(); }
+uint32_t halCycleCount() { return ESP.getCycleCount(); }
+
+static uint64_t micCycles = 0;
+
+size_t halReadMic(int16_t *samples, size_t count) {
+    int32_t data_buffer[VAD_FRAME_SAMPLES];
+    size_t captured = 0;
+    while (captured < count) {
+        size_t n = min(count - captured, (size_t)VAD_FRAME_SAMPLES);
+        size_t bytes_read = 0;
+        i2s_read(I2S_NUM_0, data_buffer, n * sizeof(int32_t), &bytes_read, portMAX_DELAY);
+        uint32_t start = ESP.getCycleCount();
+        for (size_t i = 0; i < bytes_read / sizeof(int32_t); i++) {
+            samples[captured++] = data_buffer[i] >> 14;
+        }
+        micCycles += ESP.getCycleCount() - start;
+    }
+    return captured;
+}
+
+uint64_t halMicCycles() { return micCycles; }
+
+bool halButtonPressed(int pin) { return digitalRead(pin) == LOW; }
+float halBatteryPercent() { return battMonitor.readPercentage(); }
+void halShowBattery(float percent) { checkBattery(percent); }
+void halShowRecording(bool on) { xTaskNotify(ledTask, on, eSetValueWithOverwrite); }
+void halBuzz(uint16_t note) { buzz(note); }
+
+bool halPublish(const char *topic, const uint8_t *data, size_t length) {
+    return enqueuePublish(topic, data, length);
+}
+
+bool halPublishAndWait(const char *topic, const uint8_t *data, size_t length) {
+    return publishAndWait(topic, data, length);
+}
+
+bool halPublishPartsAndWait(const char *topic, const uint8_t *header, size_t headerLength,
+                            const uint8_t *data, size_t length) {
+    return publishPartsAndWait(topic, header, headerLength, data, length);
+}
@@ -1,19 +1,11 @@
 #include "helpers.h"
 
-WiFiClientSecure wifiClient;
+TlsClient tlsClient;
 CertificateManager certificateManager;
-MQTTClient mqttClient(wifiClient, certificateManager);
+MQTTClient mqttClient(tlsClient, certificateManager);
 DFRobot_MAX17043 battMonitor;
 MPU6050 mpu;
-
-float pitch_deg = 0.0f, roll_deg = 0.0f, yaw_deg = 0.0f;
-float gyro_bias_x = 0.0f, gyro_bias_y = 0.0f, gyro_bias_z = 0.0f;
-
-float accx_lp = 0, accy_lp = 0, accz_lp = 1;
-unsigned long last_ms;
-
-float yaw_delta_accum = 0.0f;
-unsigned long last_gesture_ms = 0;
+TaskHandle_t ledTask = NULL;
 
 // ---- Helpers ----
 
@@ -35,16 +27,12 @@ void checkBattery(float perc) {
     }
 }
 
+// Sleeps until halShowRecording() says the recording LED should change.
 void LedTask(void *parameter) {
+    uint32_t on;
     while (1) {
-        if (recording && !ledOn) {
-            analogWrite(BLUE_PIN, 100);
-            ledOn = true;
-        } else if (!recording) {
-            analogWrite(BLUE_PIN, 255);
-            ledOn = false;
-        }
-        vTaskDelay(pdMS_TO_TICKS(100));
+        xTaskNotifyWait(0, 0, &on, portMAX_DELAY);
+        analogWrite(BLUE_PIN, on ? 100 : 255);
     }
 }
 
@@ -56,8 +44,8 @@ void i2sInit() {
         .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-        .dma_buf_count = 8,
-        .dma_buf_len = 128,
+        .dma_buf_count = I2S_DMA_BUFFERS,
+        .dma_buf_len = I2S_DMA_LEN,
         .use_apll = false,
         .tx_desc_auto_clear = false,
         .fixed_mclk = 0};
@@ -71,45 +59,3 @@ void i2sInit() {
     i2s_set_pin(I2S_NUM_0, &pin_config);
     i2s_zero_dma_buffer(I2S_NUM_0);
 }
-
-void recordVoice(int16_t flag) {
-    message[0] = flag;
-    int32_t data_buffer[512];
-    size_t bytes_read = 0;
-    int samplesWritten = 0;
-    while (samplesWritten < totalSamples) {
-        recording = true;
-        i2s_read(I2S_NUM_0, &data_buffer, sizeof(data_buffer), &bytes_read, portMAX_DELAY);
-        int samples = bytes_read / 4;
-        for (int i = 0; i < samples; i++) {
-            int16_t temp = data_buffer[i] >> 14;
-            message[samplesWritten+i+1] = temp;
-            if (samplesWritten + i >= totalSamples) break;
-        }
-        samplesWritten += samples;
-    }
-    Serial.println(message[0]);
-    recording = false;
-    delay(20);
-    sendVoice();
-}
-
-void sendVoice() {
-    for (int i = 0; i <= 2; i++) {
-        int16_t *temp = &message[4000*i];
-        message[4000*i] = message[0];
-        if (mqttClient.publishBinary(VOICE_DATA, reinterpret_cast<uint8_t *>(temp), 8001 * sizeof(int16_t))) {
-            tone(BUZZER, NOTE_D5, NOTE_DURATION);
-        } else {
-            tone(BUZZER, NOTE_D2, NOTE_DURATION);
-            break;
-        }
-    }
-}
-
-int customMax(float AccX, float AccY, float AccZ) {
-    if (abs(AccX) > abs(AccY) && abs(AccX) > abs(AccZ)) return 0;
-    if (abs(AccY) > abs(AccX) && abs(AccY) > abs(AccZ)) return 1;
-    if (abs(AccZ) > abs(AccX) && abs(AccZ) > abs(AccY)) return 2;
-    return -1;
-}
\ No newline at end of file
@@ -0,0 +1,246 @@
+// Replays IMU samples through MahonyFusion on the host and reports what an
+// update costs and how far the attitude drifts:
+//
+//   pio run -e native_fusion_replay
+//   .pio/build/native_fusion_replay/program [--imu imu.csv]
+//
+// Without a file a synthetic three minute trace is generated from a known
+// attitude: still, a minute of turning about all three axes with some linear
+// acceleration, then still again, with gyro bias and sensor noise on top.
+// Its pitch and roll are checked against the true attitude and its yaw
+// against the true heading, and the program fails past the DRIFT_* bounds.
+//
+// A recorded CSV (the native simulation format) has no ground truth. Pitch
+// and roll are compared with the accelerometer's tilt where the glove is
+// still: the last STILL_WINDOW samples read within STILL_ACC_G of 1 g and of
+// each other, with a bias-corrected rate under STILL_RATE_DPS. Yaw drift is
+// the heading change per minute over those samples alone.
+//
+// Times are host nanoseconds per update(), for comparing changes; on the
+// glove imuStep() counts cycles against FUSION_CYCLE_BUDGET.
+#include "../sim/sim.h"
+#include "../fusion.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const double DRIFT_TILT_RMS_DEG = 1.0;     // pitch and roll, whole trace
+static const double DRIFT_TILT_MAX_DEG = 3.0;
+static const double DRIFT_YAW_DEG_PER_MIN = 2.0; // still periods
+static const double STILL_ACC_G = 0.05;
+static const size_t STILL_WINDOW = 40; // 200 ms at IMU_SAMPLE_HZ
+static const double STILL_RATE_DPS = 2.0;
+static const double ACC_LSB = 16384.0;      // per g at ±2 g
+static const double GYRO_LSB = 131.0;       // per °/s at ±250 °/s
+static const int SYNTHETIC_HZ = 200;
+static const double TO_DEG = 180.0 / M_PI;
+
+struct Stats {
+    long updates;
+    double totalNs;
+    double maxNs;
+    long tiltSamples;
+    double tiltSq;
+    double tiltMax;
+    double stillMinutes;
+    double stillYaw; // heading change over the still samples, degrees
+};
+
+static double wrap(double deg) {
+    while (deg > 180.0) deg -= 360.0;
+    while (deg < -180.0) deg += 360.0;
+    return deg;
+}
+
+static void addTilt(Stats &s, double pitchError, double rollError) {
+    double error = std::max(fabs(pitchError), fabs(wrap(rollError)));
+    s.tiltSamples++;
+    s.tiltSq += error * error;
+    s.tiltMax = std::max(s.tiltMax, error);
+}
+
+static void timedUpdate(MahonyFusion &fusion, Stats &s, const int16_t acc[3], const int16_t gyro[3], uint32_t dtUs) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    fusion.update(acc, gyro, dtUs);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    s.updates++;
+    s.totalNs += elapsed.count();
+    s.maxNs = std::max(s.maxNs, elapsed.count());
+}
+
+static int16_t toRaw(double v) { return (int16_t)std::max(-32768.0, std::min(32767.0, floor(v + 0.5))); }
+
+static uint32_t seed = 1;
+
+static double gaussian() {
+    double u[2];
+    for (int i = 0; i < 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        u[i] = ((seed >> 8) + 0.5) / 16777216.0;
+    }
+    return sqrt(-2.0 * log(u[0])) * cos(2.0 * M_PI * u[1]);
+}
+
+// Body rates of the synthetic trace in °/s, and linear acceleration in g.
+static void syntheticMotion(double t, double rate[3], double linear[3]) {
+    for (int i = 0; i < 3; i++) rate[i] = linear[i] = 0.0;
+    if (t < 60.0 || t >= 120.0) return;
+    double m = t - 60.0;
+    rate[0] = 40.0 * sin(2.0 * M_PI * 0.3 * m);
+    rate[1] = 30.0 * sin(2.0 * M_PI * 0.2 * m + 1.0);
+    rate[2] = 50.0 * sin(2.0 * M_PI * 0.1 * m);
+    linear[0] = 0.1 * sin(2.0 * M_PI * 1.5 * m);
+}
+
+static void eulerOf(const double q[4], double &pitch, double &roll, double &yaw) {
+    double w = q[0], x = q[1], y = q[2], z = q[3];
+    roll = atan2(2 * (w * x + y * z), 1 - 2 * (x * x + y * y)) * TO_DEG;
+    pitch = asin(std::max(-1.0, std::min(1.0, 2 * (w * y - z * x)))) * TO_DEG;
+    yaw = atan2(2 * (w * z + x * y), 1 - 2 * (y * y + z * z)) * TO_DEG;
+}
+
+static bool replaySynthetic(Stats &s) {
+    MahonyFusion fusion;
+    const double bias[3] = {150.0, -80.0, 40.0}; // LSB, about 1.1, 0.6, 0.3 °/s
+    const double gyroNoise = 13.0, accNoise = 65.0; // LSB rms, 0.1 °/s and 4 mg
+    const uint32_t dtUs = 1000000 / SYNTHETIC_HZ;
+    // start tilted 10° in roll and -5° in pitch
+    double q[4] = {0.9952, 0.0870, -0.0434, 0.0038};
+    double yawZero = 0.0, yawError = 0.0, stillStartError = 0.0, stillStart = -1.0;
+    bool wasStill = false;
+
+    for (int n = 0; n < 180 * SYNTHETIC_HZ; n++) {
+        double t = (double)n / SYNTHETIC_HZ;
+        double rate[3], linear[3];
+        syntheticMotion(t, rate, linear);
+
+        // q += 0.5 * q * (0, rate) * dt, in double
+        double h[3];
+        for (int i = 0; i < 3; i++) h[i] = 0.5 * rate[i] / TO_DEG / SYNTHETIC_HZ;
+        double w = q[0], x = q[1], y = q[2], z = q[3];
+        q[0] += -x * h[0] - y * h[1] - z * h[2];
+        q[1] += w * h[0] + y * h[2] - z * h[1];
+        q[2] += w * h[1] - x * h[2] + z * h[0];
+        q[3] += w * h[2] + x * h[1] - y * h[0];
+        double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        for (int i = 0; i < 4; i++) q[i] /= norm;
+
+        double g[3] = {2 * (q[1] * q[3] - q[0] * q[2]), 2 * (q[0] * q[1] + q[2] * q[3]),
+                       q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3]};
+        int16_t acc[3], gyro[3];
+        for (int i = 0; i < 3; i++) {
+            acc[i] = toRaw((g[i] + linear[i]) * ACC_LSB + accNoise * gaussian());
+            gyro[i] = toRaw(rate[i] * GYRO_LSB + bias[i] + gyroNoise * gaussian());
+        }
+        bool wasCalibrated = fusion.calibrated();
+        timedUpdate(fusion, s, acc, gyro, dtUs);
+        if (!fusion.calibrated()) continue;
+
+        double pitch, roll, yaw;
+        eulerOf(q, pitch, roll, yaw);
+        float fp, fr, fy;
+        fusion.euler(fp, fr, fy);
+        // the filter starts at zero yaw; measure heading from there
+        if (!wasCalibrated) yawZero = yaw;
+        addTilt(s, fp - pitch, fr - roll);
+        yawError = wrap(fy - wrap(yaw - yawZero));
+
+        bool still = rate[0] == 0.0 && rate[1] == 0.0 && rate[2] == 0.0;
+        if (still && !wasStill) {
+            stillStart = t;
+            stillStartError = yawError;
+        } else if (!still && wasStill) {
+            s.stillMinutes += (t - stillStart) / 60.0;
+            s.stillYaw += yawError - stillStartError;
+        }
+        wasStill = still;
+    }
+    if (wasStill) {
+        s.stillMinutes += (180.0 - stillStart) / 60.0;
+        s.stillYaw += yawError - stillStartError;
+    }
+    printf("synthetic: 180 s at %d Hz, gyro bias %.0f %.0f %.0f LSB, final yaw error %.2f deg\n", SYNTHETIC_HZ,
+           bias[0], bias[1], bias[2], yawError);
+    return true;
+}
+
+static bool replayFile(const char *path, Stats &s) {
+    if (!simLoadImu(path) || simImu.size() < 2) return false;
+    MahonyFusion fusion;
+    float lastYaw = 0.0f;
+    bool lastStill = false;
+    size_t stillSince = 0; // first sample of the current still run
+    for (size_t n = 0; n < simImu.size(); n++) {
+        const SimImu &r = simImu[n];
+        uint32_t dtUs = n ? r.us - simImu[n - 1].us : 0;
+        const int16_t acc[3] = {r.ax, r.ay, r.az};
+        const int16_t gyro[3] = {r.gx, r.gy, r.gz};
+        timedUpdate(fusion, s, acc, gyro, dtUs);
+
+        double norm = sqrt((double)r.ax * r.ax + (double)r.ay * r.ay + (double)r.az * r.az) / ACC_LSB;
+        double rate = 0.0;
+        for (int i = 0; i < 3; i++) {
+            rate = std::max(rate, fabs((gyro[i] - fusion.gyroBias()[i] / 256.0) / GYRO_LSB));
+        }
+        bool steady = fabs(norm - 1.0) < STILL_ACC_G && rate < STILL_RATE_DPS;
+        for (size_t k = stillSince; steady && k < n; k++) {
+            const int16_t before[3] = {simImu[k].ax, simImu[k].ay, simImu[k].az};
+            for (int i = 0; i < 3; i++) steady = steady && abs(before[i] - acc[i]) < STILL_ACC_G * ACC_LSB;
+        }
+        if (!steady) stillSince = n + 1;
+        if (n + 1 - stillSince > STILL_WINDOW) stillSince++;
+        if (!fusion.calibrated()) continue;
+
+        float fp, fr, fy;
+        fusion.euler(fp, fr, fy);
+        bool still = n + 1 - stillSince == STILL_WINDOW;
+        if (still) {
+            double roll = atan2((double)r.ay, (double)r.az) * TO_DEG;
+            double pitch = atan2(-(double)r.ax, sqrt((double)r.ay * r.ay + (double)r.az * r.az)) * TO_DEG;
+            addTilt(s, fp - pitch, fr - roll);
+            if (lastStill) {
+                s.stillYaw += wrap(fy - lastYaw);
+                s.stillMinutes += dtUs / 60e6;
+            }
+        }
+        lastYaw = fy;
+        lastStill = still;
+    }
+    printf("%s: %zu samples over %.1f s\n", path, simImu.size(), (simImu.back().us - simImu[0].us) / 1e6);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    Stats s = {};
+    bool synthetic = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--imu") || i + 1 >= argc) {
+            fprintf(stderr, "usage: %s [--imu FILE]\n", argv[0]);
+            return 2;
+        }
+        synthetic = false;
+        if (!replayFile(argv[++i], s)) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (synthetic) replaySynthetic(s);
+
+    double tiltRms = s.tiltSamples ? sqrt(s.tiltSq / s.tiltSamples) : 0.0;
+    double yawRate = s.stillMinutes > 0.0 ? s.stillYaw / s.stillMinutes : 0.0;
+    printf("update: %ld calls, mean %.0f ns, max %.0f ns\n", s.updates, s.updates ? s.totalNs / s.updates : 0.0,
+           s.maxNs);
+    printf("pitch/roll error: %ld samples, rms %.2f deg, max %.2f deg\n", s.tiltSamples, tiltRms, s.tiltMax);
+    printf("yaw drift while still: %.2f deg/min over %.1f min\n", yawRate, s.stillMinutes);
+    if (!synthetic) return 0;
+
+    bool ok = tiltRms <= DRIFT_TILT_RMS_DEG && s.tiltMax <= DRIFT_TILT_MAX_DEG &&
+              fabs(yawRate) <= DRIFT_YAW_DEG_PER_MIN;
+    printf("%s (bounds: rms %.1f, max %.1f deg, yaw %.1f deg/min)\n", ok ? "ok" : "FAIL", DRIFT_TILT_RMS_DEG,
+           DRIFT_TILT_MAX_DEG, DRIFT_YAW_DEG_PER_MIN);
+    return ok ? 0 : 1;
+}
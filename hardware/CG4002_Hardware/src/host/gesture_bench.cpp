@@ -0,0 +1,282 @@
+// Compares the binary gesture frames of GesturePublisher with the JSON String
+// updates they replaced, on the same motion: bytes on the wire, messages,
+// and host CPU and heap allocations per message:
+//
+//   pio run -e native_gesture_bench
+//   .pio/build/native_gesture_bench/program [--imu imu.csv]
+//
+// The input is IMU_SAMPLE_HZ samples of MOVE axes, either a synthetic trace
+// (still, slow sweep, fast shake, still) or the accelerometer columns of a
+// native simulation CSV taken relative to its first row. As with the axis
+// lock, only the dominant axis moves. A sample is in motion when some axis
+// spans more than GESTURE_DEADBAND within MESSAGE_DEBOUNCE of it, and held
+// otherwise; message rates are also given for each on its own.
+//
+// The JSON side is the old loop(): every MESSAGE_DEBOUNCE the latest sample
+// went out on COMMAND, built with String += and String(float). LegacyString
+// models arduino-esp32's WString for this, with its 11-byte small-string
+// buffer and exact-size realloc on growth, so its allocation count is what
+// the glove did. Wire bytes add the MQTT PUBLISH header of a QoS 0 message.
+// Times are host nanoseconds, useful only as a ratio.
+#include "../sim/sim.h"
+#include "../constants.h"
+#include "../gesture.h"
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const int TIMING_RUNS = 200;
+static const float ACC_SCALE = 16384.0f; // LSB -> g at ±2g, as in glove.cpp
+
+struct Axes {
+    uint32_t ms;
+    float x, y, z;
+    bool moving;
+};
+
+static uint32_t allocations = 0;
+static volatile size_t sink; // keeps the timed work from being optimised out
+
+class LegacyString {
+public:
+    LegacyString(const char *s) : heap(NULL), length(0), capacity(SSO_CAPACITY) {
+        sso[0] = '\0';
+        concat(s);
+    }
+    explicit LegacyString(float value) : heap(NULL), length(0), capacity(SSO_CAPACITY) {
+        char buf[33];
+        snprintf(buf, sizeof(buf), "%4.2f", value); // dtostrf(value, 4, 2, buf)
+        sso[0] = '\0';
+        concat(buf);
+    }
+    ~LegacyString() { free(heap); }
+
+    LegacyString &operator+=(const char *s) {
+        concat(s);
+        return *this;
+    }
+    LegacyString &operator+=(const LegacyString &s) {
+        concat(s.c_str());
+        return *this;
+    }
+    const char *c_str() const { return heap ? heap : sso; }
+    size_t size() const { return length; }
+
+private:
+    static const size_t SSO_CAPACITY = 11;
+    char sso[SSO_CAPACITY + 1];
+    char *heap;
+    size_t length;
+    size_t capacity;
+
+    void concat(const char *s) {
+        size_t n = strlen(s);
+        if (length + n > capacity) {
+            char *grown = (char *)realloc(heap, length + n + 1);
+            if (!heap) memcpy(grown, sso, length + 1);
+            heap = grown;
+            capacity = length + n;
+            allocations++;
+        }
+        memcpy((heap ? heap : sso) + length, s, n + 1);
+        length += n;
+    }
+
+    LegacyString(const LegacyString &);
+    LegacyString &operator=(const LegacyString &);
+};
+
+// The MOVE branch of the old loop().
+static size_t legacyMessage(const Axes &a) {
+    LegacyString message("{\n");
+    message += "\"type\": \"MOVE\"";
+    message += ",\n";
+    LegacyString axes("[");
+    axes += LegacyString(a.x);
+    axes += ", ";
+    axes += LegacyString(a.y);
+    axes += ", ";
+    axes += LegacyString(a.z);
+    axes += "]";
+    message += "\"axes\": ";
+    message += axes;
+    message += "\n}";
+    return message.size();
+}
+
+static size_t wireBytes(const char *topic, size_t payload) {
+    size_t remaining = 2 + strlen(topic) + payload;
+    return 1 + (remaining < 128 ? 1 : 2) + remaining;
+}
+
+struct Result {
+    uint32_t messages;
+    uint64_t payload;
+    uint64_t wire;
+    uint32_t samples; // carried, not just sampled
+    uint32_t moving;  // messages sent during motion
+    double ns;        // all messages of one run
+    uint32_t allocations;
+};
+
+static Result runLegacy(const std::vector<Axes> &trace) {
+    Result r = {};
+    uint32_t debounce = trace.empty() ? 0 : trace[0].ms;
+    for (const Axes &a : trace) {
+        if (a.ms - debounce <= MESSAGE_DEBOUNCE) continue;
+        debounce = a.ms;
+        size_t length = legacyMessage(a);
+        r.messages++;
+        r.moving += a.moving;
+        r.samples++;
+        r.payload += length;
+        r.wire += wireBytes(COMMAND, length);
+    }
+    r.allocations = allocations;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        debounce = trace.empty() ? 0 : trace[0].ms;
+        for (const Axes &a : trace) {
+            if (a.ms - debounce <= MESSAGE_DEBOUNCE) continue;
+            debounce = a.ms;
+            sink += legacyMessage(a);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    r.ns = elapsed.count() / TIMING_RUNS;
+    return r;
+}
+
+static Result runFrames(const std::vector<Axes> &trace) {
+    static GesturePublisher publisher;
+    static uint8_t frame[GESTURE_FRAME_SIZE];
+    Result r = {};
+    publisher.begin(GESTURE_MOVE);
+    for (const Axes &a : trace) {
+        publisher.add(a.ms, a.x, a.y, a.z);
+        size_t length = publisher.poll(a.ms, frame);
+        if (length == 0) continue;
+        r.messages++;
+        r.moving += a.moving;
+        r.samples += frame[8];
+        r.payload += length;
+        r.wire += wireBytes(GESTURE_DATA, length);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        publisher.begin(GESTURE_MOVE);
+        for (const Axes &a : trace) {
+            publisher.add(a.ms, a.x, a.y, a.z);
+            sink += publisher.poll(a.ms, frame);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    r.ns = elapsed.count() / TIMING_RUNS;
+    return r;
+}
+
+static std::vector<Axes> synthetic() {
+    std::vector<Axes> trace;
+    uint32_t seed = 1;
+    for (int i = 0; i < 10 * IMU_SAMPLE_HZ; i++) {
+        double t = (double)i / IMU_SAMPLE_HZ;
+        seed = seed * 1664525u + 1013904223u;
+        double x = 0.005 * ((int32_t)(seed >> 16) - 32768) / 32768.0; // sensor noise
+        if (t >= 2.0 && t < 5.0) x += 0.3 * sin(2.0 * M_PI * 0.5 * (t - 2.0));
+        if (t >= 5.0 && t < 8.0) x += 2.0 * sin(2.0 * M_PI * 3.0 * (t - 5.0));
+        Axes a = {(uint32_t)(i * 1000 / IMU_SAMPLE_HZ), (float)x, 0.0f, 0.0f};
+        trace.push_back(a);
+    }
+    return trace;
+}
+
+// MOVE axes as glove.cpp derives them, relative to the first row.
+static std::vector<Axes> fromImu() {
+    std::vector<Axes> trace;
+    double energy[3] = {0.0, 0.0, 0.0};
+    for (const SimImu &s : simImu) {
+        float dx = s.ax - simImu[0].ax, dy = s.ay - simImu[0].ay, dz = s.az - simImu[0].az;
+        Axes a = {s.us / 1000, -2 * dx / ACC_SCALE * 2.5f, -3 * dz / ACC_SCALE * 1.5f, -4 * dy / ACC_SCALE * 3.0f};
+        energy[0] += a.x * a.x;
+        energy[1] += a.y * a.y;
+        energy[2] += a.z * a.z;
+        trace.push_back(a);
+    }
+    int axis = energy[0] >= energy[1] && energy[0] >= energy[2] ? 0 : energy[1] >= energy[2] ? 1 : 2;
+    for (Axes &a : trace) {
+        if (axis != 0) a.x = 0.0f;
+        if (axis != 1) a.y = 0.0f;
+        if (axis != 2) a.z = 0.0f;
+    }
+    return trace;
+}
+
+static void markMotion(std::vector<Axes> &trace) {
+    const float deadband = (float)GESTURE_DEADBAND / GESTURE_AXIS_SCALE;
+    for (size_t i = 0; i < trace.size(); i++) {
+        float lo[3] = {trace[i].x, trace[i].y, trace[i].z}, hi[3] = {lo[0], lo[1], lo[2]};
+        for (size_t j = i; j-- > 0 && trace[i].ms - trace[j].ms <= MESSAGE_DEBOUNCE;) {
+            const float v[3] = {trace[j].x, trace[j].y, trace[j].z};
+            for (int k = 0; k < 3; k++) lo[k] = std::min(lo[k], v[k]), hi[k] = std::max(hi[k], v[k]);
+        }
+        for (size_t j = i + 1; j < trace.size() && trace[j].ms - trace[i].ms <= MESSAGE_DEBOUNCE; j++) {
+            const float v[3] = {trace[j].x, trace[j].y, trace[j].z};
+            for (int k = 0; k < 3; k++) lo[k] = std::min(lo[k], v[k]), hi[k] = std::max(hi[k], v[k]);
+        }
+        trace[i].moving = hi[0] - lo[0] > deadband || hi[1] - lo[1] > deadband || hi[2] - lo[2] > deadband;
+    }
+}
+
+static double rate(uint32_t messages, double seconds) { return seconds > 0.0 ? messages / seconds : 0.0; }
+
+static void print(const char *name, const Result &r, double seconds, double movingSeconds) {
+    double messages = r.messages ? r.messages : 1;
+    printf("%-14s %8u %7.1f %8.1f %7.1f %9.1f %9.0f %8.1f %8.0f %9.1f %7.2f\n", name, r.messages,
+           r.messages / seconds, rate(r.moving, movingSeconds), rate(r.messages - r.moving, seconds - movingSeconds),
+           r.payload / messages, r.wire / seconds, r.samples / messages, r.ns / messages, r.ns / seconds / 1000.0,
+           r.allocations / messages);
+}
+
+int main(int argc, char **argv) {
+    std::vector<Axes> trace;
+    const char *source = "synthetic";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--imu") || i + 1 >= argc) {
+            fprintf(stderr, "usage: %s [--imu FILE]\n", argv[0]);
+            return 2;
+        }
+        source = argv[++i];
+        if (!simLoadImu(source) || simImu.size() < 2) {
+            fprintf(stderr, "cannot read %s\n", source);
+            return 1;
+        }
+        trace = fromImu();
+    }
+    if (trace.empty()) trace = synthetic();
+    markMotion(trace);
+    double seconds = (trace.back().ms - trace.front().ms) / 1000.0;
+    size_t moving = 0;
+    for (const Axes &a : trace) moving += a.moving;
+    double movingSeconds = seconds * moving / trace.size();
+
+    printf("%s: %zu samples over %.1f s, %.1f s in motion\n", source, trace.size(), seconds, movingSeconds);
+    printf("%-14s %8s %7s %8s %7s %9s %9s %8s %8s %9s %7s\n", "encoding", "messages", "msg/s", "motion/s", "held/s",
+           "payload", "wire B/s", "samples", "ns/msg", "us/s", "allocs");
+    Result legacy = runLegacy(trace);
+    Result frames = runFrames(trace);
+    print("JSON String", legacy, seconds, movingSeconds);
+    print("binary frame", frames, seconds, movingSeconds);
+    printf("binary frames carry %.1fx the samples in %.0f%% of the bytes and %.0f%% of the messages, "
+           "%.0f%% in motion\n",
+           (double)frames.samples / (legacy.samples ? legacy.samples : 1),
+           100.0 * frames.wire / (legacy.wire ? legacy.wire : 1),
+           100.0 * frames.messages / (legacy.messages ? legacy.messages : 1),
+           100.0 * frames.moving / (legacy.moving ? legacy.moving : 1));
+    return 0;
+}
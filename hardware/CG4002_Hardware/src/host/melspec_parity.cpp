@@ -0,0 +1,153 @@
+// Checks LogMelExtractor against a double precision port of the Ultra96
+// preprocessing (torchaudio MelSpectrogram(sample_rate=8000, n_mels=64),
+// n_fft 400, hop 200, periodic Hann, HTK filters, + AmplitudeToDB):
+//
+//   pio run -e native_melspec_parity
+//   .pio/build/native_melspec_parity/program [--audio speech.raw ...]
+//
+// Runs a voiced vowel, a low tone, a chirp and white noise, plus any 8 kHz
+// 16-bit raw files given. Only cells within PARITY_RANGE_DB of their
+// frame's loudest mel bin are compared: below that the Q15 arithmetic has
+// no bits left, and the network never sees those cells next to the peak.
+// Fails if the mean error exceeds PARITY_MEAN_DB or any cell is off by
+// more than PARITY_MAX_DB; the 0.5 dB quantisation alone accounts for up
+// to 0.25 dB.
+#include "../melspec.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const double PARITY_RANGE_DB = 40.0;
+static const double PARITY_MEAN_DB = 0.3;
+static const double PARITY_MAX_DB = 1.5;
+
+static double hzToMel(double f) { return 2595.0 * log10(1.0 + f / 700.0); }
+static double melToHz(double m) { return 700.0 * (pow(10.0, m / 2595.0) - 1.0); }
+
+// Reference dB, [MEL_BINS][MEL_FRAMES] like the extractor's output.
+static void reference(const std::vector<int16_t> &pcm, std::vector<double> &db) {
+    std::vector<double> x(MEL_TARGET_LEN, 0.0);
+    int length = pcm.size() < MEL_TARGET_LEN ? (int)pcm.size() : MEL_TARGET_LEN;
+    int padLeft = (MEL_TARGET_LEN - length) / 2;
+    for (int i = 0; i < length; i++) x[padLeft + i] = pcm[i] / 32768.0;
+
+    double fPts[MEL_BINS + 2];
+    for (int i = 0; i < MEL_BINS + 2; i++) {
+        fPts[i] = melToHz(hzToMel(MEL_SAMPLE_RATE / 2.0) * i / (MEL_BINS + 1));
+    }
+    db.assign(MEL_BINS * MEL_FRAMES, 0.0);
+    for (int t = 0; t < MEL_FRAMES; t++) {
+        double frame[MEL_WIN];
+        for (int i = 0; i < MEL_WIN; i++) {
+            int idx = t * MEL_HOP + i - MEL_WIN / 2;
+            if (idx < 0) idx = -idx;
+            if (idx >= MEL_TARGET_LEN) idx = 2 * (MEL_TARGET_LEN - 1) - idx;
+            frame[i] = x[idx] * (0.5 - 0.5 * cos(2.0 * M_PI * i / MEL_WIN));
+        }
+        double power[MEL_N_BINS];
+        for (int k = 0; k < MEL_N_BINS; k++) {
+            double re = 0.0, im = 0.0;
+            for (int i = 0; i < MEL_WIN; i++) {
+                double angle = 2.0 * M_PI * ((k * i) % MEL_WIN) / MEL_WIN;
+                re += frame[i] * cos(angle);
+                im -= frame[i] * sin(angle);
+            }
+            power[k] = re * re + im * im;
+        }
+        for (int m = 0; m < MEL_BINS; m++) {
+            double mel = 0.0;
+            for (int k = 0; k < MEL_N_BINS; k++) {
+                double f = (double)k * MEL_SAMPLE_RATE / MEL_WIN;
+                double up = (f - fPts[m]) / (fPts[m + 1] - fPts[m]);
+                double down = (fPts[m + 2] - f) / (fPts[m + 2] - fPts[m + 1]);
+                double w = fmin(up, down);
+                if (w > 0.0) mel += w * power[k];
+            }
+            db[m * MEL_FRAMES + t] = 10.0 * log10(fmax(mel, 1e-10));
+        }
+    }
+}
+
+static bool check(LogMelExtractor &mel, const char *name, const std::vector<int16_t> &pcm) {
+    static uint8_t codes[MEL_BINS * MEL_FRAMES];
+    mel.compute(pcm.data(), (int)pcm.size(), codes);
+    std::vector<double> db;
+    reference(pcm, db);
+
+    double sum = 0.0, worst = 0.0;
+    int cells = 0, worstBin = 0, worstFrame = 0;
+    for (int t = 0; t < MEL_FRAMES; t++) {
+        double peak = -100.0;
+        for (int m = 0; m < MEL_BINS; m++) peak = fmax(peak, db[m * MEL_FRAMES + t]);
+        for (int m = 0; m < MEL_BINS; m++) {
+            double want = db[m * MEL_FRAMES + t];
+            uint8_t q = codes[m * MEL_FRAMES + t];
+            // codes 0 and 1 are silence and the clamp at MEL_DB_MIN
+            if (want < peak - PARITY_RANGE_DB || want <= MEL_DB_MIN + 1 || q <= 1) continue;
+            double error = fabs(MEL_DB_MIN + q * MEL_DB_STEP_Q16 / 65536.0 - want);
+            sum += error;
+            cells++;
+            if (error > worst) {
+                worst = error;
+                worstBin = m;
+                worstFrame = t;
+            }
+        }
+    }
+    double mean = cells ? sum / cells : 0.0;
+    bool ok = cells > 0 && mean <= PARITY_MEAN_DB && worst <= PARITY_MAX_DB;
+    printf("%-16s %4d cells  mean %.2f dB  max %.2f dB (bin %d, frame %d)  %s\n", name, cells, mean, worst,
+           worstBin, worstFrame, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    static LogMelExtractor mel;
+    mel.begin();
+    bool ok = true;
+
+    // 1.2 s vowel at 140 Hz with falling harmonics, centre padded like a short command
+    std::vector<int16_t> pcm(9600);
+    for (size_t i = 0; i < pcm.size(); i++) {
+        double s = 0.0;
+        for (int h = 1; h * 140 < MEL_SAMPLE_RATE / 2; h++) s += sin(2.0 * M_PI * 140 * h * i / MEL_SAMPLE_RATE) / h;
+        pcm[i] = (int16_t)(6000.0 * s);
+    }
+    ok &= check(mel, "voiced", pcm);
+
+    pcm.assign(MEL_TARGET_LEN, 0);
+    for (size_t i = 0; i < pcm.size(); i++) pcm[i] = (int16_t)(8000.0 * sin(2.0 * M_PI * 230 * i / MEL_SAMPLE_RATE));
+    ok &= check(mel, "tone 230 Hz", pcm);
+
+    for (size_t i = 0; i < pcm.size(); i++) {
+        double t = (double)i / MEL_SAMPLE_RATE;
+        pcm[i] = (int16_t)(8000.0 * sin(2.0 * M_PI * (50.0 * t + 1925.0 * t * t / 2.0)));
+    }
+    ok &= check(mel, "chirp", pcm);
+
+    uint32_t seed = 1;
+    for (size_t i = 0; i < pcm.size(); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        pcm[i] = (int16_t)((int32_t)(seed >> 16) - 32768) / 8;
+    }
+    ok &= check(mel, "noise", pcm);
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--audio") || i + 1 >= argc) {
+            fprintf(stderr, "usage: %s [--audio FILE ...]\n", argv[0]);
+            return 2;
+        }
+        FILE *f = fopen(argv[++i], "rb");
+        if (!f) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+        pcm.assign(MEL_TARGET_LEN, 0);
+        pcm.resize(fread(pcm.data(), sizeof(int16_t), MEL_TARGET_LEN, f));
+        fclose(f);
+        ok &= check(mel, argv[i], pcm);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// Replays voice commands through recordVoice() and its VAD on the host and
+// reports how much of the fixed RECORD_TIME capture the endpointing saves
+// and how much speech it clips:
+//
+//   pio run -e native_vad_replay
+//   .pio/build/native_vad_replay/program [-v] [command.wav ...]
+//
+// Each file is one press, starting at the press: 8 kHz 16-bit mono WAV or
+// raw PCM. Without files a set of synthetic commands is replayed instead,
+// and the program fails if any of them is clipped.
+//
+// Speech is every VAD frame within REFERENCE_RANGE_DB of the loudest one
+// and REFERENCE_NOISE_RATIO above the quietest tenth, judged with the whole
+// recording in view. Speech frames outside the samples kept count as
+// clipped, and a recording with any is a clip. "saved" is RECORD_TIME less
+// the capture time, negative when a late start made capture run longer.
+#include "../sim/sim.h"
+#include "../constants.h"
+#include "../glove.h"
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static const double REFERENCE_RANGE_DB = 35.0;
+static const double REFERENCE_NOISE_RATIO = 4.0;
+static const int RECORD_SAMPLES = SAMPLING_RATE * RECORD_TIME;
+static const uint32_t SAMPLE_US = 1000000 / SAMPLING_RATE;
+
+struct Replay {
+    std::string name;
+    int speechStart; // reference, in samples from the press; -1 if silent
+    int speechEnd;
+    int captured;
+    int keptStart;
+    int keptEnd;
+    int clippedHead; // speech samples before the kept ones
+    int clippedTail;
+};
+
+static int ms(int samples) { return samples * 1000 / SAMPLING_RATE; }
+
+// Speech frames of `length` samples of `pcm`, with look-ahead.
+static std::vector<bool> referenceSpeech(const int16_t *pcm, size_t length) {
+    int frames = length / VAD_FRAME_SAMPLES;
+    std::vector<double> energy(frames);
+    for (int f = 0; f < frames; f++) {
+        double sum = 0.0;
+        for (int i = 0; i < VAD_FRAME_SAMPLES; i++) {
+            double s = pcm[f * VAD_FRAME_SAMPLES + i];
+            sum += s * s;
+        }
+        energy[f] = sum / VAD_FRAME_SAMPLES;
+    }
+    std::vector<double> sorted = energy;
+    std::sort(sorted.begin(), sorted.end());
+    double floor = sorted[frames / 10] * REFERENCE_NOISE_RATIO;
+    double range = sorted.back() * pow(10.0, -REFERENCE_RANGE_DB / 10.0);
+    std::vector<bool> speech(frames);
+    for (int f = 0; f < frames; f++) speech[f] = energy[f] > 0.0 && energy[f] > floor && energy[f] >= range;
+    return speech;
+}
+
+// Plays `pcm` as the microphone input of one press.
+static Replay replay(const std::string &name, const std::vector<int16_t> &pcm) {
+    size_t start = simAudio.size();
+    simAudio.insert(simAudio.end(), pcm.begin(), pcm.end());
+    // silence after a short file, rather than the next one
+    if (pcm.size() < (size_t)RECORD_SAMPLES) simAudio.resize(start + RECORD_SAMPLES, 0);
+    simNowUs = start * SAMPLE_US;
+    recordVoice(0);
+    VoiceCapture capture = gloveLastCapture();
+
+    Replay r;
+    r.name = name;
+    r.captured = capture.captured;
+    r.keptStart = capture.offset;
+    r.keptEnd = capture.offset + capture.length;
+    r.speechStart = r.speechEnd = -1;
+    r.clippedHead = r.clippedTail = 0;
+    std::vector<bool> speech = referenceSpeech(&simAudio[start], simAudio.size() - start);
+    for (size_t f = 0; f < speech.size(); f++) {
+        if (!speech[f]) continue;
+        int from = f * VAD_FRAME_SAMPLES;
+        int to = from + VAD_FRAME_SAMPLES;
+        if (r.speechStart < 0) r.speechStart = from;
+        r.speechEnd = to;
+        if (capture.length == 0) {
+            r.clippedTail += VAD_FRAME_SAMPLES;
+        } else if (from < r.keptStart) {
+            r.clippedHead += std::min(to, r.keptStart) - from;
+        } else if (to > r.keptEnd) {
+            r.clippedTail += to - std::max(from, r.keptEnd);
+        }
+    }
+    return r;
+}
+
+// Vowel-like: harmonics of `pitchHz` under a `rampMs` attack and release.
+static void addVowel(std::vector<int16_t> &pcm, int fromMs, int lengthMs, double pitchHz, double amplitude,
+                     int rampMs = 20) {
+    int from = fromMs * SAMPLING_RATE / 1000;
+    int n = lengthMs * SAMPLING_RATE / 1000;
+    int ramp = rampMs * SAMPLING_RATE / 1000;
+    for (int i = 0; i < n && from + i < (int)pcm.size(); i++) {
+        double envelope = ramp ? std::min(1.0, std::min(i, n - 1 - i) / (double)ramp) : 1.0;
+        double s = 0.0;
+        for (int h = 1; h * pitchHz < SAMPLING_RATE / 2; h++) s += sin(2.0 * M_PI * pitchHz * h * i / SAMPLING_RATE) / h;
+        pcm[from + i] = (int16_t)std::max(-32768.0, std::min(32767.0, pcm[from + i] + amplitude * envelope * s));
+    }
+}
+
+// Unvoiced: white noise differenced once, so most of it is high frequency.
+static void addFricative(std::vector<int16_t> &pcm, int fromMs, int lengthMs, double amplitude, uint32_t &seed) {
+    int from = fromMs * SAMPLING_RATE / 1000;
+    int n = lengthMs * SAMPLING_RATE / 1000;
+    double last = 0.0;
+    for (int i = 0; i < n && from + i < (int)pcm.size(); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        double white = ((int32_t)(seed >> 16) - 32768) / 32768.0;
+        pcm[from + i] = (int16_t)(pcm[from + i] + amplitude * (white - last) / 2.0);
+        last = white;
+    }
+}
+
+static std::vector<int16_t> background(double amplitude, uint32_t &seed) {
+    std::vector<int16_t> pcm(RECORD_SAMPLES);
+    for (int16_t &s : pcm) {
+        seed = seed * 1664525u + 1013904223u;
+        s = (int16_t)(amplitude * ((int32_t)(seed >> 16) - 32768) / 32768.0);
+    }
+    return pcm;
+}
+
+static void replaySynthetic(std::vector<Replay> &replays) {
+    uint32_t seed = 1;
+    std::vector<int16_t> pcm = background(30, seed);
+    addVowel(pcm, 150, 450, 140, 6000);
+    replays.push_back(replay("short vowel", pcm));
+
+    pcm = background(30, seed);
+    addVowel(pcm, 200, 400, 180, 6000);
+    addFricative(pcm, 600, 150, 400, seed);
+    replays.push_back(replay("fricative tail", pcm));
+
+    pcm = background(30, seed);
+    addVowel(pcm, 150, 300, 120, 5000);
+    addVowel(pcm, 600, 300, 120, 5000); // gap shorter than VAD_HANGOVER_MS
+    replays.push_back(replay("two words", pcm));
+
+    pcm = background(30, seed);
+    addVowel(pcm, 0, 600, 160, 6000, 0); // already talking at the press
+    replays.push_back(replay("speech from first frame", pcm));
+
+    pcm = background(30, seed);
+    addVowel(pcm, 800, 500, 200, 6000);
+    replays.push_back(replay("late start", pcm));
+
+    pcm = background(300, seed);
+    addVowel(pcm, 300, 600, 150, 5000);
+    replays.push_back(replay("noisy room", pcm));
+
+    pcm = background(30, seed);
+    addVowel(pcm, 100, 1800, 130, 6000);
+    replays.push_back(replay("long command", pcm));
+
+    replays.push_back(replay("silence", background(30, seed)));
+}
+
+int main(int argc, char **argv) {
+    std::vector<Replay> replays;
+    bool synthetic = true;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-v")) {
+            simVerbose = true;
+            continue;
+        }
+        synthetic = false;
+        // load alone first, so a bad file does not shift the others
+        std::vector<int16_t> keep;
+        keep.swap(simAudio);
+        bool ok = simLoadAudio(argv[i]);
+        std::vector<int16_t> pcm;
+        pcm.swap(simAudio);
+        simAudio.swap(keep);
+        if (!ok) {
+            fprintf(stderr, "cannot read %s (8 kHz 16-bit mono WAV or raw PCM)\n", argv[i]);
+            return 1;
+        }
+        replays.push_back(replay(argv[i], pcm));
+    }
+    if (synthetic) replaySynthetic(replays);
+
+    printf("%-24s %9s %9s %9s %9s %9s\n", "recording", "speech", "captured", "saved", "kept", "clipped");
+    int clips = 0, spoken = 0;
+    long capturedMs = 0;
+    for (const Replay &r : replays) {
+        char speech[32] = "-";
+        if (r.speechStart >= 0) snprintf(speech, sizeof(speech), "%d-%d", ms(r.speechStart), ms(r.speechEnd));
+        char kept[32] = "-";
+        if (r.keptEnd > r.keptStart) snprintf(kept, sizeof(kept), "%d-%d", ms(r.keptStart), ms(r.keptEnd));
+        printf("%-24s %9s %9d %9d %9s %4d+%-4d\n", r.name.c_str(), speech, ms(r.captured),
+               RECORD_TIME * 1000 - ms(r.captured), kept, ms(r.clippedHead), ms(r.clippedTail));
+        if (r.clippedHead + r.clippedTail > 0) clips++;
+        if (r.speechStart >= 0) spoken++;
+        capturedMs += ms(r.captured);
+    }
+    printf("%zu recordings, %d with speech: mean capture %ld ms, saving %ld ms of %d; %d clipped\n", replays.size(),
+           spoken, capturedMs / (long)replays.size(), RECORD_TIME * 1000 - capturedMs / (long)replays.size(),
+           RECORD_TIME * 1000, clips);
+    return synthetic && clips > 0 ? 1 : 0;
+}
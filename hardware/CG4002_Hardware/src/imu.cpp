@@ -0,0 +1,33 @@
+#include "imu.h"
+#include "hal.h"
+
+RingBuffer<ImuSample, IMU_RING_SIZE> imuSamples;
+MahonyFusion fusion;
+FusionStats fusionStats = {0, 0, 0, 0};
+
+void imuProcess(ImuSample &s, uint32_t dtUs) {
+    const int16_t acc[3] = {s.ax, s.ay, s.az};
+    const int16_t gyro[3] = {s.gx, s.gy, s.gz};
+    bool wasCalibrated = fusion.calibrated();
+
+    uint32_t start = halCycleCount();
+    fusion.update(acc, gyro, dtUs);
+    uint32_t cycles = halCycleCount() - start;
+
+    fusionStats.updates++;
+    fusionStats.totalCycles += cycles;
+    if (cycles > fusionStats.maxCycles) fusionStats.maxCycles = cycles;
+    if (cycles > FUSION_CYCLE_BUDGET) fusionStats.overBudget++;
+    if (!wasCalibrated && fusion.calibrated()) {
+        const int32_t *bias = fusion.gyroBias();
+        halLog("Gyro bias: %.2f %.2f %.2f LSB\n", bias[0] / 256.0f,
+               bias[1] / 256.0f, bias[2] / 256.0f);
+    }
+
+    int16_t g[3];
+    fusion.gravity(g);
+    s.gravX = g[0];
+    s.gravY = g[1];
+    s.gravZ = g[2];
+    imuSamples.push(s);
+}
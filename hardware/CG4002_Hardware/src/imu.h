@@ -0,0 +1,39 @@
+#ifndef IMU_H
+#define IMU_H
+
+#include <stdint.h>
+#include "constants.h"
+#include "fusion.h"
+#include "ring_buffer.h"
+
+struct ImuSample {
+    uint32_t timestamp; // micros() when the MPU6050 latched the sample
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+    int16_t gravX, gravY, gravZ; // fused gravity direction, 1 g = 16384
+};
+
+struct FusionStats {
+    uint32_t updates;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t overBudget; // updates slower than FUSION_CYCLE_BUDGET
+};
+
+// Filled by ImuTask from the MPU6050 FIFO, drained by the gesture logic.
+extern RingBuffer<ImuSample, IMU_RING_SIZE> imuSamples;
+extern MahonyFusion fusion;
+extern FusionStats fusionStats;
+
+// Runs the filter on one raw sample taken dtUs after the previous one,
+// records how many CPU cycles it took and queues it for the gesture logic.
+void imuProcess(ImuSample &s, uint32_t dtUs);
+
+// Configures the MPU6050 FIFO and data-ready interrupt and starts ImuTask.
+void imuInit();
+void ImuTask(void *parameter);
+// Puts the MPU6050 to sleep while the glove idles, and wakes it again.
+void imuSuspend();
+void imuResume();
+
+#endif
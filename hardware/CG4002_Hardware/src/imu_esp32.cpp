@@ -0,0 +1,99 @@
+#include "imu.h"
+#include "Arduino.h"
+#include "MPU6050.h"
+#include "tasks.h"
+
+extern MPU6050 mpu;
+
+static TaskHandle_t imuTask = NULL;
+static volatile uint32_t lastInterruptUs = 0;
+static volatile bool suspended = false;
+
+static const uint8_t FIFO_SAMPLE_BYTES = 12; // accel xyz + gyro xyz
+static const uint8_t FIFO_BURST_SAMPLES = 21; // getFIFOBytes reads at most 255 bytes
+static const uint16_t FIFO_SIZE = 1024;
+static const uint32_t SAMPLE_PERIOD_US = 1000000UL / IMU_SAMPLE_HZ;
+
+static void IRAM_ATTR imuDataReady() {
+    lastInterruptUs = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(imuTask, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+static int16_t be16(const uint8_t *p) { return (int16_t)((p[0] << 8) | p[1]); }
+
+void imuInit() {
+    mpu.setDLPFMode(MPU6050_DLPF_BW_42);
+    mpu.setRate(1000 / IMU_SAMPLE_HZ - 1); // 1 kHz gyro output rate with the DLPF on
+    mpu.setAccelFIFOEnabled(true);
+    mpu.setXGyroFIFOEnabled(true);
+    mpu.setYGyroFIFOEnabled(true);
+    mpu.setZGyroFIFOEnabled(true);
+    mpu.setFIFOEnabled(true);
+    mpu.resetFIFO();
+    mpu.setInterruptMode(false); // active high
+    mpu.setInterruptLatchClear(true); // cleared by any register read
+    mpu.setIntDataReadyEnabled(true);
+
+    xTaskCreatePinnedToCore(ImuTask, "ImuTask", 3072, NULL, IMU_TASK_PRIORITY, &imuTask, 1);
+    registerTask(TASK_IMU, "imu", imuTask);
+    pinMode(MPU_INT, INPUT);
+    attachInterrupt(digitalPinToInterrupt(MPU_INT), imuDataReady, RISING);
+}
+
+void imuSuspend() { suspended = true; }
+
+void imuResume() {
+    suspended = false;
+    xTaskNotifyGive(imuTask);
+}
+
+void ImuTask(void *parameter) {
+    uint8_t burst[FIFO_BURST_SAMPLES * FIFO_SAMPLE_BYTES];
+    uint32_t lastStamp = 0;
+    bool realign = false;
+    while (1) {
+        // time out so a missed edge cannot stall sampling
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(4 * SAMPLE_PERIOD_US / 1000 + 1));
+        if (suspended) {
+            mpu.setSleepEnabled(true);
+            while (suspended) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            mpu.setSleepEnabled(false);
+            mpu.resetFIFO();
+            lastStamp = 0;
+            realign = true; // the attitude is stale after sleeping
+            resumeLoop(TASK_IMU);
+            continue;
+        }
+        markLoop(TASK_IMU);
+        mpu.getIntStatus(); // clears the latched interrupt
+
+        uint16_t count = mpu.getFIFOCount();
+        if (count >= FIFO_SIZE - FIFO_SAMPLE_BYTES) {
+            mpu.resetFIFO(); // overflowed, frame alignment is lost
+            continue;
+        }
+        uint16_t samples = count / FIFO_SAMPLE_BYTES;
+        // the newest sample in the FIFO is the one that raised the interrupt
+        uint32_t stamp = lastInterruptUs - (samples - 1) * SAMPLE_PERIOD_US;
+        while (samples > 0) {
+            uint8_t n = samples < FIFO_BURST_SAMPLES ? samples : FIFO_BURST_SAMPLES;
+            mpu.getFIFOBytes(burst, n * FIFO_SAMPLE_BYTES);
+            for (uint8_t i = 0; i < n; i++) {
+                const uint8_t *p = &burst[i * FIFO_SAMPLE_BYTES];
+                ImuSample s = {stamp, be16(p), be16(p + 2), be16(p + 4),
+                               be16(p + 6), be16(p + 8), be16(p + 10)};
+                if (realign) {
+                    const int16_t acc[3] = {s.ax, s.ay, s.az};
+                    fusion.realign(acc);
+                    realign = false;
+                }
+                imuProcess(s, lastStamp ? stamp - lastStamp : SAMPLE_PERIOD_US);
+                lastStamp = stamp;
+                stamp += SAMPLE_PERIOD_US;
+            }
+            samples -= n;
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include "kws.h"
+#include "hal.h"
+#include "melspec.h"
+#include <math.h>
+#include "kws_weights.h"
+
+// Same network and template shapes as cnn_accel, with int8 weights and
+// uint8 activations (every layer ends in a ReLU). The log-mel input stays
+// int16 so its 0.5 dB steps are kept exactly.
+#define IN_H  MEL_BINS
+#define IN_W  MEL_FRAMES
+#define IN_C   1
+#define C1_OUT 16
+#define C2_OUT 32
+#define C3_OUT 64
+#define K 3
+#define PADDING 1
+#define STRIDE 2
+
+#define H1 (IN_H / STRIDE)
+#define W1 (IN_W / STRIDE + 1)
+#define H2 (IN_H / (STRIDE * 2))
+#define W2 (IN_W / (STRIDE * 2) + 1)
+#define H3 (IN_H / (STRIDE * 4))
+#define W3 (IN_W / (STRIDE * 4) + 1)
+
+// labels_dict of AI/Hardware/Ultra96/cnn_inference.py
+const char *const KWS_LABELS[KWS_CLASSES] = {"chair", "table", "lamp", "TV", "bed", "plant",
+                                             "sofa", "ODM", "ODM", "up", "down"};
+
+// Layers ping-pong between two buffers sized for the largest feature map;
+// the input shares the second one with conv2's output.
+#define FM_BYTES (H1 * W1 * C1_OUT)
+static_assert(IN_H * IN_W * IN_C * sizeof(int16_t) <= FM_BYTES, "input must fit a feature map buffer");
+alignas(4) static uint8_t fmA[FM_BYTES];
+alignas(4) static uint8_t fmB[FM_BYTES];
+
+// -----------------------------
+// Convolution + ReLU block, requantised per output channel
+// -----------------------------
+template <int H_in, int W_in, int H_out, int W_out, int IN_CH, int OUT_CH, int STR, typename IN_T>
+static void conv_bn_relu(const IN_T *in_fm, uint8_t *out_fm, const int8_t w[OUT_CH][K][K][IN_CH],
+                         const int32_t b[OUT_CH], const int32_t m[OUT_CH], const uint8_t s[OUT_CH]) {
+    for (int oh = 0; oh < H_out; oh++) {
+        for (int ow = 0; ow < W_out; ow++) {
+            for (int oc = 0; oc < OUT_CH; oc++) {
+                int32_t acc = b[oc];
+                for (int kh = 0; kh < K; kh++) {
+                    int h_in = oh * STR + kh - PADDING;
+                    if (h_in < 0 || h_in >= H_in) continue;
+                    for (int kw = 0; kw < K; kw++) {
+                        int w_in = ow * STR + kw - PADDING;
+                        if (w_in < 0 || w_in >= W_in) continue;
+                        // channels are innermost in both, so this is a plain dot product
+                        const IN_T *x = &in_fm[(h_in * W_in + w_in) * IN_CH];
+                        const int8_t *wk = w[oc][kh][kw];
+                        for (int ic = 0; ic < IN_CH; ic++) {
+                            acc += x[ic] * wk[ic];
+                        }
+                    }
+                }
+                int32_t v = (int32_t)(((int64_t)acc * m[oc] + (1LL << (s[oc] - 1))) >> s[oc]);
+                out_fm[(oh * W_out + ow) * OUT_CH + oc] = v < 0 ? 0 : (v > 255 ? 255 : v);
+            }
+        }
+    }
+}
+
+// -----------------------------
+// Adaptive Average Pooling to 1x1; the 1 / (H * W) is folded into
+// linear1_scale so small activations are not rounded away
+// -----------------------------
+template <int H, int W, int C>
+static void adaptive_avg_pool(const uint8_t *in_fm, int32_t out_fm[C]) {
+    for (int c = 0; c < C; c++) {
+        int32_t sum = 0;
+        for (int i = 0; i < H * W; i++) {
+            sum += in_fm[i * C + c];
+        }
+        out_fm[c] = sum;
+    }
+}
+
+// -----------------------------
+// Fully Connected layer
+// -----------------------------
+template <int IN_DIM, int OUT_DIM>
+static void linear(const int32_t in_vec[IN_DIM], float out_vec[OUT_DIM], const int8_t w[OUT_DIM][IN_DIM],
+                   const int32_t b[OUT_DIM], const float scale[OUT_DIM]) {
+    for (int o = 0; o < OUT_DIM; o++) {
+        int32_t acc = b[o];
+        for (int i = 0; i < IN_DIM; i++) {
+            acc += in_vec[i] * w[o][i];
+        }
+        out_vec[o] = acc * scale[o];
+    }
+}
+
+void kwsClassify(const uint8_t *features, KwsResult &result) {
+    uint32_t start = halCycleCount();
+
+    // codes are 0.5 dB steps from MEL_DB_MIN; code 0 is the -100 dB floor
+    int16_t *fm_in = reinterpret_cast<int16_t *>(fmB);
+    for (int i = 0; i < IN_H * IN_W; i++) {
+        fm_in[i] = features[i] ? features[i] + 2 * MEL_DB_MIN : -200;
+    }
+
+    // 1st conv block
+    conv_bn_relu<IN_H, IN_W, H1, W1, IN_C, C1_OUT, STRIDE>(fm_in, fmA, conv1_w, conv1_b, conv1_m, conv1_s);
+    conv_bn_relu<H1, W1, H1, W1, C1_OUT, C1_OUT, 1>(fmA, fmB, conv2_w, conv2_b, conv2_m, conv2_s);
+
+    // 2nd conv block
+    conv_bn_relu<H1, W1, H2, W2, C1_OUT, C2_OUT, STRIDE>(fmB, fmA, conv3_w, conv3_b, conv3_m, conv3_s);
+    conv_bn_relu<H2, W2, H2, W2, C2_OUT, C2_OUT, 1>(fmA, fmB, conv4_w, conv4_b, conv4_m, conv4_s);
+
+    // 3rd conv block
+    conv_bn_relu<H2, W2, H3, W3, C2_OUT, C3_OUT, STRIDE>(fmB, fmA, conv5_w, conv5_b, conv5_m, conv5_s);
+    conv_bn_relu<H3, W3, H3, W3, C3_OUT, C3_OUT, 1>(fmA, fmB, conv6_w, conv6_b, conv6_m, conv6_s);
+
+    // GAP
+    int32_t pooled[C3_OUT];
+    adaptive_avg_pool<H3, W3, C3_OUT>(fmB, pooled);
+
+    // Classifier
+    float out[KWS_CLASSES];
+    linear<C3_OUT, KWS_CLASSES>(pooled, out, linear1_w, linear1_b, linear1_scale);
+
+    int best = 0;
+    for (int i = 1; i < KWS_CLASSES; i++) {
+        if (out[i] > out[best]) best = i;
+    }
+    float sum = 0;
+    for (int i = 0; i < KWS_CLASSES; i++) {
+        sum += expf(out[i] - out[best]);
+    }
+    result.label = best;
+    result.confidence = 1.0f / sum;
+    result.cycles = halCycleCount() - start;
+}
@@ -0,0 +1,24 @@
+#ifndef KWS_H
+#define KWS_H
+
+#include <stdint.h>
+
+// int8 port of the Ultra96 CNN (AI/Hardware/CNN.cpp) used as an on-glove
+// fallback when no voice result comes back (KWS_FALLBACK). Weights come
+// from AI/Soft/export_int8.py. Only depends on <stdint.h>/<math.h> so it
+// also builds on the host.
+#define KWS_CLASSES 11
+
+struct KwsResult {
+    int label;         // index into KWS_LABELS
+    float confidence;  // softmax probability of that label
+    uint32_t cycles;   // halCycleCount() ticks the inference took
+};
+
+extern const char *const KWS_LABELS[KWS_CLASSES];
+
+// Classifies MEL_BINS x MEL_FRAMES quantised log-mel codes (melspec.h).
+// Uses static activation buffers, so only one task may call it.
+void kwsClassify(const uint8_t *features, KwsResult &result);
+
+#endif
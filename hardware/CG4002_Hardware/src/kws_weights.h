@@ -0,0 +1,38 @@
+#pragma once
+// Generated by AI/Soft/export_int8.py; do not edit.
+// int8 CNN weights, activation scales calibrated on 64 feature maps.
+// Weights are [out][kh][kw][in]; out = clamp((acc * m + round) >> s, 0, 255).
+// conv1: input scale 0.5, output scale 0.402019
+static const int8_t conv1_w[16][3][3][1] = { -8, 127, 67, -10, 59, 60, -107, -108, -59, -80, 54, 40, -75, 127, -22, 54, -20, -36, 127, 108, 119, -77, -93, -22, -28, -73, -71, -101, -25, -107, -30, 0, -19, 110, 47, 127, 59, -28, 11, 127, 8, -60, 95, -59, -14, 127, -18, -14, -83, 9, 98, 62, -116, -113, -127, -48, -2, 104, 88, -6, 19, 36, 2, 122, -101, -26, 112, -127, 42, 36, 28, -76, -36, -78, -32, 39, 127, 54, 17, -74, 9, -74, -49, 127, 4, -22, -101, -24, -64, 86, 127, 11, -68, 76, 41, -115, 85, -57, -123, 80, 58, -66, -5, 127, -33, -67, 83, -14, 21, -4, -6, -68, -110, -68, 66, 127, 65, -50, 1, 105, -127, -66, 118, -58, -13, 108, 125, -82, 49, -5, -127, -13, 59, -96, 75, 42, -31, -21, 60, 47, -127, 86, 60, -83 };
+static const int32_t conv1_b[16] = { 608, -150, 790, 935, -311, -1313, 354, -358, 803, -1564, -32, 28, 494, 939, -969, -233 };
+static const int32_t conv1_m[16] = { 1119922663, 1463691994, 1903849321, 1842680124, 1668145545, 1449014018, 1185974196, 2051125673, 1074294102, 1608422645, 2061329658, 1812729384, 1137674863, 2081543644, 1737493846, 1175347826 };
+static const uint8_t conv1_s[16] = { 38, 38, 39, 39, 39, 39, 38, 39, 38, 39, 39, 39, 38, 39, 39, 38 };
+// conv2: input scale 0.402019, output scale 0.404893
+static const int8_t conv2_w[16][3][3][16] = { -36, -32, 8, -20, -23, 21, -29, -18, -1, 19, -56, -31, -20, 20, 51, -80, -48, -4, -47, 11, 6, -11, -2, -72, 52, 12, -68, -2, 14, 68, 17, -60, 8, 50, -8, -21, 9, -14, 5, -19, 5, -42, 4, 9, 18, 35, -35, -10, -43, 4, -74, 57, -23, 3, -18, -13, 4, -2, -72, -13, 32, 45, 2, -8, 29, 38, -14, 16, 3, -43, 27, -15, 26, -41, 13, 24, -1, 23, -68, 22, 32, 4, 47, -83, 26, -2, 28, 9, 13, -5, 16, 17, -95, -121, -2, 1, -19, 40, -44, 7, -5, -36, 10, 28, 6, -59, 42, 15, -46, -13, -33, 47, 13, -11, 39, -127, 8, -3, -21, 37, -1, -26, 54, 1, -64, -39, 4, 9, -36, -46, 37, -13, -10, 33, -43, -5, -11, 28, 9, -14, 77, -48, 18, -18, -1, -12, 41, 0, -33, -29, -14, -3, -13, -7, -21, 33, 32, 13, 13, -64, -39, -14, 35, 12, 3, -39, 4, -13, 5, -15, -43, -18, 69, 1, -18, -61, -15, -54, 52, -5, -22, 14, 8, -70, 37, -90, -3, -4, 24, -41, -38, -15, 19, 32, -8, 24, 12, -13, 49, 9, 57, -38, 57, -16, -106, 3, -20, 15, -31, 14, 16, -40, 22, -54, 16, 4, 15, -62, 51, -1, -62, -30, -3, -14, -49, -31, 46, -20, -17, -30, -41, -19, 34, -50, 24, -25, 1, -26, -7, 31, 10, -63, 17, -58, -30, -10, -127, 24, -3, -2, -59, 8, 9, 44, -7, -67, 59, 8, 37, 24, 22, -86, 2, 29, 40, -20, -85, -12, 66, 25, -74, -46, -1, -15, 4, 55, -3, -60, 29, -5, 94, -92, 0, 6, 25, -27, -84, 14, 4, -32, -33, -23, -11, 0, 19, -40, 7, -4, -49, 7, -1, 72, 0, -62, 87, 47, 19, -57, 79, -53, 32, 17, -17, -65, -1, 84, -59, 12, -71, -1, 46, -2, 18, -43, 48, -50, 30, 46, -54, -127, 38, 47, -32, -76, -52, 42, -6, 17, 9, -32, -9, -11, 37, 12, -18, -10, -7, -4, 52, 28, 3, 4, 47, 21, 52, -113, 28, -13, -24, 34, -13, 6, 36, 36, -36, 37, -3, 7, 52, -18, 46, -34, -1, -15, -7, 2, -38, -17, 7, 20, -63, 22, -4, -1, -63, -6, 7, -11, 18, -1, -5, 45, 12, 6, 69, 7, 5, -54, 3, 12, -11, -94, 33, -101, -55, 52, -89, -11, -8, 21, 12, -54, -37, -15, 11, -52, 20, -29, 15, -91, -89, 24, -63, -32, -35, 33, -14, -29, -71, 49, 25, -68, 5, 12, 1, 30, 50, -25, 21, -32, 39, -22, 5, 109, 10, 29, -9, 59, -44, 83, -40, 20, 63, 34, -32, 81, -9, -1, 10, 33, -44, -10, -2, 57, -17, -19, 12, -20, 39, 69, -112, 15, 68, 43, 23, -52, -64, 20, 23, -29, -53, 18, -31, 56, 32, -42, 41, 27, 26, -21, 4, 79, 23, -39, -36, 59, -3, 41, -32, 24, -4, 34, -41, 53, -37, -11, 33, 26, -46, -58, -17, 74, -98, -69, 36, -66, -77, 28, -84, -14, 38, 57, 78, -127, -46, 6, 48, -8, 2, -14, -39, 43, 64, -84, 20, -11, 16, -57, 15, 41, 41, -84, -89, 96, -105, -12, -27, 30, 8, -7, -38, 32, -16, -28, 39, -31, -49, -29, -32, 62, -98, -79, 56, -44, -45, 9, -100, -45, -35, 28, 77, -95, -3, 34, 57, -11, -16, -3, -22, -8, 2, -21, 7, 29, -23, -53, 17, 28, -25, -40, -31, 43, -64, 2, -4, 8, 18, -10, -10, 31, -14, -10, 12, 7, 26, -127, 21, 33, -37, -48, 13, -2, -20, 27, -41, -15, 1, 26, -4, -27, -16, -92, 22, -7, 46, 7, 33, -64, -8, 22, -13, 4, -4, -16, -21, 18, -61, 40, -1, -22, 32, 26, -9, 19, 20, -44, 26, 27, 6, -32, 5, 11, 19, -43, 8, 33, -57, -26, -27, 24, -6, -21, -36, 1, -3, -17, 3, -35, 37, -59, 30, 26, 9, -34, 39, -52, -5, 44, -28, 4, -3, 30, -70, -11, 8, 42, 22, -46, 68, 37, 24, -31, 27, -14, 2, -16, 3, 9, -38, 17, -21, 93, -21, -33, -30, -19, -46, 53, 17, -33, 16, 21, 36, -34, -10, -8, 30, -25, -7, 12, -48, -33, -25, -7, -36, 47, 35, 48, -14, 16, 80, -12, -65, -45, 8, 1, -4, -69, -16, 46, -36, 32, 9, -22, 27, 31, 6, -54, 3, 4, 6, -42, -28, -30, 23, 45, -45, 48, -37, -18, 25, 55, 9, -62, -7, -13, 2, -57, 1, 46, 2, -10, -13, 20, 1, 21, 21, 38, 54, 24, 10, 47, 59, 31, -11, 57, -24, 75, 42, 36, 29, 37, 39, 21, 28, -17, 47, 28, 33, 65, -41, -30, -13, 58, 16, 24, -27, 19, 58, 14, 31, 4, 35, 18, 15, -3, 27, 60, 37, 7, -29, -83, 29, -29, -16, -75, -86, 10, -49, 67, -23, -55, 35, 102, -22, 26, 77, -126, 37, 11, -24, -127, -58, 77, -12, -1, -60, 54, -53, 8, -43, 40, 25, -118, -20, 44, -14, -112, 5, -11, 25, -11, -39, 55, -15, -43, -12, 30, -27, 16, 7, -51, 10, 5, -95, -52, -4, 4, -5, -91, -31, -46, -33, -9, -38, 11, 14, -79, 25, -24, -23, -20, 30, -1, -23, -71, -2, -10, 7, -38, -16, -24, -27, -63, -38, -22, -6, -29, -12, -59, -51, -35, -43, 16, -6, -1, 55, -24, 20, 10, 15, -21, -25, 26, 46, 61, 74, 56, -55, 42, -8, -10, 47, 11, 28, -3, 31, -23, -3, 20, 46, 2, -8, 18, 9, -25, 9, -37, 15, 3, -20, -13, 45, -28, 0, -26, 6, -19, -9, -20, 27, 63, 2, 76, 30, -79, 39, 40, 62, -39, -45, 85, 39, 55, 2, 68, -11, 42, 39, 85, 56, -13, 61, 32, 29, -68, 63, 40, 74, -127, -12, 26, -12, -32, 93, 5, 2, 16, -39, 32, 18, 11, 59, -47, -22, -97, 22, 7, 10, 27, -46, 25, 16, -19, 13, -52, 6, -39, -22, 41, 47, 28, -64, 0, 9, -7, 44, -12, 24, -23, 21, -2, -19, -43, -13, 22, 36, -6, -5, -51, 49, -57, 40, 25, 1, -9, -46, 2, -32, -10, 13, -32, 58, -77, -36, -9, 11, 18, -5, 62, 32, -57, 52, -14, 14, -75, -6, 35, 41, -43, -19, 54, 5, 4, 32, 23, 28, -14, 8, -4, 16, -1, 0, -14, 7, -37, 5, -4, 27, -43, 70, 6, -45, 1, -54, -8, 27, 21, 18, -48, 8, -48, 14, -6, -28, -34, 6, 45, 50, -17, 40, 43, 15, -44, 43, 53, 54, -127, -31, 56, -26, -76, 49, 2, -12, 42, -16, 13, 43, -7, 42, -42, 36, -52, 19, -31, 6, -67, 51, -16, -64, 54, -54, -61, 14, 55, 54, -34, 31, -39, 18, -15, 20, 12, 12, -26, 19, -2, -4, -20, -6, 21, -4, 19, -23, 2, 20, -35, 16, 5, 14, 8, 32, 1, -20, 29, -12, 4, -13, 19, 9, -23, 25, -11, -49, -47, -6, 37, -4, -14, -14, -58, 28, 8, -12, 8, 45, -18, -24, -45, 23, -27, 32, 8, -20, 25, -26, -23, 21, 8, -42, -8, 13, 31, 6, -86, 57, 9, -7, 21, 7, 4, 6, 5, 14, -21, -32, -9, 21, -7, -33, -22, -12, -41, -1, 37, 20, -3, 14, -58, 63, -12, -24, 5, -2, -35, -43, -74, 13, -25, 42, -29, -4, 21, -32, -127, -20, 22, -64, -5, 5, 21, 18, -118, 24, -2, 28, 13, 16, -24, -15, -21, -7, -12, -50, 7, 64, -2, -2, -26, 38, -53, 58, 42, 21, -11, 19, -101, 7, -9, -44, 19, 26, -4, -53, -93, 62, -28, 27, 0, -78, -45, -40, -15, -95, -71, -24, -74, -55, -34, -38, -24, -48, 1, 3, -3, -45, 21, -32, -10, -42, -29, 9, -10, -93, -98, 70, -55, -39, 16, -48, 32, 2, -5, 6, 9, -36, 3, -60, -17, 21, -43, -16, -8, -26, -57, 11, -14, -34, 22, -54, -9, -14, -6, 12, -46, -54, 53, -37, 21, -8, 6, 29, -1, -24, 49, -47, 33, 5, 18, 27, -2, -42, 76, 76, -5, 42, 93, -18, 65, 89, -22, 73, 56, 38, -39, -38, 77, 47, 43, -16, 69, -101, -23, -20, 39, -34, -43, -40, 18, -15, -28, 5, -73, -2, 62, -2, 12, -40, 54, -32, -26, -16, 12, -36, 39, -20, -18, 19, -2, -5, 98, 19, 45, 127, 93, 25, -7, 42, -44, 34, 66, -45, -96, -5, 78, 33, 47, -31, 49, -1, -8, 2, 25, -6, 4, 19, 9, 10, 0, 13, -7, 8, -7, 3, -20, 12, 4, 6, 1, -32, 3, -36, -6, 9, 6, 0, 0, 15, 4, -5, -19, 22, 23, -2, -27, -64, 4, -50, -2, -10, 0, -4, -1, -19, 2, -6, -26, -11, -55, 14, 7, -17, 5, -20, 2, 5, 8, 10, -62, 6, -3, -5, -22, -15, -2, 10, 5, -33, -6, 15, -41, 13, 13, -7, -31, 4, -11, 3, -43, 2, -10, 2, -21, -51, -1, 0, -16, 3, 13, -21, -127, -5, -5, -2, -20, 26, -27, 35, -8, 1, 7, -39, 2, 3, 3, 5, -63, -11, -14, 5, -15, 13, 9, 18, -28, -49, -1, -28, -41, -2, 5, 7, 12, -11, -9, 0, -37, 1, -35, 5, -16, -42, -5, -58, -8, -10, 6, -10, -36, -19, -6, -11, -26, -47, -39, -8, -11, -29, 29, -9, 32, -36, -34, 14, -15, -3, -75, 10, -5, -26, -20, -16, 33, 11, 29, -2, 1, 30, 17, 16, -1, 57, 6, -2, -29, -69, -3, -44, 29, -65, 38, -65, -33, 11, 31, -10, -31, 56, 30, 42, -27, 24, 5, 29, 13, -41, 1, 7, -1, 2, -25, 7, -25, -37, 30, 21, -7, -91, -15, -56, 39, -5, -39, 10, 27, 53, -1, 22, 14, 35, 18, -19, 17, -93, 6, -55, 91, -43, -12, 13, 9, 72, -36, -5, -51, 19, 34, -28, -7, 65, -49, 51, -45, -50, 16, -43, -27, 27, 36, -80, -14, -33, 82, -14, -60, 24, 50, -25, 32, 54, -61, 8, -16, 33, -32, -100, 81, 55, 39, -127, -2, -6, 23, -23, 41, 74, -57, 19, 63, 60, -34, 19, 5, 33, -17, -64, 59, 5, 27, 39, 14, -25, -8, -36, -12, -16, 7, -6, -15, 22, -31, -8, 14, -5, 2, 2, -5, 24, 5, -28, 7, 28, 13, -18, 41, -7, 38, 1, 28, 41, 110, -4, -21, 90, 21, 69, 97, 24, -7, -32, 70, 6, 87, 1, 53, -14, -59, 6, 3, -66, 19, -79, -47, -15, 10, -9, -112, -11, -6, -6, -84, -14, -38, 14, 6, -31, 8, -33, -56, 22, 32, -2, -6, -36, 22, -6, -38, 21, 47, -12, 66, 76, 1, 31, 52, 46, -21, -46, 74, 9, 36, 16, -47, -17, -18, 25, -7, -65, -4, -59, -74, 23, 4, 2, -92, 11, 9, 23, -64, -35, 34, -15, 10, 8, -15, -42, -92, 32, -25, -40, -19, -18, 17, -15, -127, 25, 69, 25, 64, 46, -33, -15, 5, 27, -24, -34, 81, 65, -36, 3, -70, -59, -90, -49, -11, -4, -4, -46, -69, -16, -38, 9, -49, 13, 13, -53, -20, -68, -75, -38, -22, -79, -1, -18, -28, -40, 3, 5, -101, -62, -35, 4, -3, -37, -24, 37, -13, -9, -24, -91, -87, -27, -41, -38, -24, 0, -87, -54, -60, -37, -114, -30, -89, -21, 2, -32, -61, -17, -17, -53, -67, -34, -55, -43, -96, -34, -45, -26, -45, -39, 2, -90, -18, -26, 13, 2, -29, -117, -22, 15, -39, -2, -127, 40, -123, 2, -32, -78, -64, -47, -8, -5, -86, -42, -65, -26, -86, -44, -102, -52, -28, -91, 1, -13, -93, 29, 15, -27, -47, 3, -80, -18, -74, 12, -10, -28, -65, -79, -51, -9, -87, 0, -42, -61, -90, -69, -15, -70, -44, -18, -93, -63, -79, -5, -82, -77, -116, -71, -84, -64, -43, -36, -25, -62, -116, 34, -55, 27, 7, -33, -3, -7, 39, -20, 22, 3, -19, -12, 0, 25, 6, 18, -25, -1, -1, 4, -25, -4, -94, -30, -6, -84, -18, -21, -19, -41, -56, 6, -50, 0, 16, 2, -16, 22, -26, -27, -7, -19, -7, 31, 16, -35, -44, 30, -88, 39, -28, -16, 27, -60, 28, 2, 29, 1, -66, -10, 15, 37, -34, 17, -20, -3, -34, -18, 20, -38, -27, -9, 16, -101, -27, -11, 57, -39, -39, -19, -34, -11, 49, 24, 17, 79, -44, 16, -11, -90, -6, 22, 16, -78, -59, 41, -17, 50, -27, -24, 37, 19, 12, -9, 19, -4, -6, -21, 54, 59, -33, 40, 12, -9, -15, 1, -16, 12, -94, -26, -9, -127, 50, 9, 57, -17, -34, 10, -4, -13, 37, 66, -10, 72, -69, 16, -23, -75, 46, 11, 18, -65, -64, 14, -52, 32, 4, -38, 26, -39, -114, -29, 10, -8, -31, -66, -24, 36, -119, 44, 33, -52, -24, -22, -15, 12, 30, -62, 8, -11, 14, -55, 48, -11, 78, -27, -12, -54, -15, -4, 1, -8, 24, -6, 6, -13, -44, -28, -31, -11, 12, -3, -57, 6, -26, -21, 8, -13, -121, -2, 22, -15, -26, -21, 55, 20, -127, 50, 70, -28, -49, 33, -11, 53, 53, 27, 8, -45, 45, -20, 89, -5, 69, 6, 31, -24, -3, 88, -4, 16, 42, 12, 7, -2, 12, 10, 54, 16, 8, -22, 4, -2, -29, -27, 25, -20, -82, 2, 18, 0, -26, 10, 81, 18, -89, 17, 121, -35, -7, 52, -33, 30, 67, -39, -18, -49, 76, -7, 2, -19, 90, 11, 26, 47, -14, 83, 6, 20, 35, 19, -27, -3, 39, -52, -11, 12, -14 };
+static const int32_t conv2_b[16] = { 121, 473, 239, 127, 290, 699, 695, 36, 476, 240, 60, 1063, 671, -9, 575, 360 };
+static const int32_t conv2_m[16] = { 1746113841, 1403030471, 1083757863, 1469702606, 1654973831, 1897096506, 2109543983, 2064461496, 1517282118, 2126541278, 1344890286, 2074677088, 2005575945, 1738120389, 1087760866, 2087825731 };
+static const uint8_t conv2_s[16] = { 38, 38, 38, 39, 38, 39, 39, 39, 38, 39, 37, 39, 39, 40, 38, 39 };
+// conv3: input scale 0.404893, output scale 0.637094
+static const int8_t conv3_w[32][3][3][16] = { 92, 39, 33, -63, 80, 34, 42, -46, 42, 34, -26, 24, 0, -3, 34, 70, -8, -90, 34, -3, -20, 0, 4, 0, -25, -18, -22, -33, -25, 9, -56, -62, -119, -69, -35, -33, -13, -18, -55, -28, -58, -11, 5, 36, -17, 4, -23, -42, 90, 24, 41, -81, 47, 31, 62, -25, 54, 24, -8, 46, -23, 14, 28, 49, 31, -27, 6, 3, -92, -92, -6, 3, -54, 12, 4, -67, 0, -20, -98, -94, -31, 30, -36, -68, -6, -43, -7, 7, -28, 10, 17, -2, 17, 5, 26, 6, 80, 24, 11, -48, 41, 55, 89, -29, 21, -39, -7, -15, -35, -17, 6, 38, -94, -115, -9, -1, -93, -6, -62, -8, -99, -12, 22, -127, 11, -19, -77, -100, -53, 65, 10, -76, 56, 27, -42, -42, -45, -7, 0, 27, 41, -22, 28, 82, -19, 16, 7, 2, -40, -47, -21, -2, -22, -30, 23, 12, 11, -1, 23, -26, -26, -16, 21, 5, -32, -68, -26, 3, -3, 31, 21, -30, 28, -13, 16, 20, -1, 42, 69, 11, 34, 31, -5, 16, 28, 33, 2, -12, 20, 2, 20, 34, -31, 11, -22, 2, -69, -58, -50, 6, -47, -83, 11, -46, -14, -11, -15, -90, -58, 25, 7, 8, -20, -73, -73, 14, -53, -7, 31, -100, -3, -6, -34, -15, 32, -33, 28, 20, -28, -20, -27, -4, 25, 13, 8, -52, 2, -20, 17, 17, -65, -51, -19, 13, -68, 24, -1, -3, -53, 14, -5, -10, -49, -6, -40, -88, -37, -29, 6, 11, -81, 7, -18, -5, -127, -18, 9, -40, -9, 14, -63, -49, 15, -40, 28, 21, -26, -2, -15, -5, -40, -6, -3, -93, 14, 0, -19, -4, 78, 22, -123, -52, 34, -3, 0, 47, -51, -5, -58, -16, -34, -11, -22, -3, 50, 7, -79, -44, 18, -2, 36, 57, 12, 16, -8, 4, -70, -4, -32, -19, 18, 6, -118, -16, -88, -26, 17, 35, -13, -105, 47, -41, -70, 23, -115, -89, 49, 47, -60, -127, -19, 7, 4, 9, -33, 32, -23, -30, -24, 3, -6, 30, 40, 93, -104, -57, 18, 19, 25, 19, 16, -23, 12, -6, -25, -25, -20, 26, -9, 64, -111, -19, 8, -11, 3, 27, -37, -33, 77, -28, -38, -6, -5, -3, 41, 15, -29, -104, -55, 0, -19, -52, -11, 41, -61, -25, 20, -11, -26, 0, 72, 42, -48, -50, -25, 16, -9, -41, 0, 15, -67, 18, -25, 7, -17, 25, 89, 74, -92, -11, 28, 2, 6, 12, 21, -22, 21, 45, 0, 23, -64, 10, -13, 34, -79, -16, 4, 25, 44, 13, -6, -23, -13, 16, -59, 3, 10, 29, -57, 83, -16, -35, -94, 13, 35, 27, -52, -82, 9, 20, -42, 8, -7, -43, -24, 58, -82, -8, -127, 12, 33, -12, 11, -12, -18, 49, -18, 22, 33, -25, -21, -13, -96, -48, 36, 53, 39, -24, 17, -17, -2, 8, -51, -6, -26, 45, -17, -39, -63, -55, -16, 20, 24, -6, -9, -98, 27, 0, -58, -7, -44, 8, 45, 3, -52, -55, -54, 37, 22, -25, 19, -50, -3, 40, -5, -20, 16, 24, -8, -22, 29, -91, 26, 8, 36, -20, 21, -31, -11, 7, -58, 15, -32, 20, 13, -29, 23, -55, -9, -4, 17, 2, -26, -121, 24, -5, -24, 28, -60, -16, 34, 1, 12, -43, 6, -13, 9, -15, 11, -103, 10, -7, -18, 17, -37, 12, -59, -89, -94, -63, -43, -102, -121, -104, -92, -81, -23, -100, -91, -6, -88, -127, -69, -76, -108, -24, -30, -67, -105, -61, -58, -32, -15, -59, -60, -4, -59, -97, -98, -60, -88, -76, -25, -44, -70, -76, -39, -19, -22, 3, -15, 4, -18, -44, 16, 9, 5, -27, 24, 7, 21, 8, -22, 36, -1, 4, -15, 1, 4, 23, 14, 1, 33, -6, 48, -1, 29, 32, -6, 46, 9, 15, -11, 4, 5, 23, 24, -3, 31, -16, 33, 11, 16, 16, 10, 44, 6, 17, 13, 9, 13, 13, 3, 39, 6, -6, 20, 5, 22, 4, 2, 12, -4, 2, 10, -4, 16, -19, 37, 55, 10, 14, 11, 13, 20, 16, 19, 25, 2, 6, 20, 3, 18, 5, 6, 27, 5, -4, -5, 24, 15, 31, 8, 33, -3, 22, 34, -7, 23, 8, -10, 21, -44, 5, 31, 26, 10, 14, 12, 10, 20, 27, 21, 2, -31, -65, 4, 47, -74, -6, 47, 19, 19, 21, 27, -27, 17, 46, 31, 2, -38, -78, -47, 24, -49, -11, 22, 5, 14, -19, -18, -6, 22, 3, 25, 15, -56, -29, -9, 31, 9, -16, -13, -15, -5, 23, 31, -26, 23, 27, 23, 4, -37, -88, -44, 27, 27, -2, -2, -9, 13, 26, 3, -54, 23, 37, 7, 0, -25, -79, -53, 23, 3, -31, 10, -49, 4, 9, -12, 6, 35, -8, 24, -3, -51, -47, -30, -21, 36, -8, -27, -4, -47, 14, -25, -58, 14, -6, 31, 0, -60, -127, -21, -11, 29, -20, -17, 17, -61, 4, 9, -56, 20, 2, 2, 13, -94, -115, -29, 16, 11, -38, -3, -9, -69, -16, -3, 5, 37, -54, 17, 18, -13, -48, -24, 0, -66, 3, 79, 40, 26, 4, -12, -5, 2, 26, -19, -2, -23, 5, -43, 45, -101, -52, 24, 7, 30, 12, 3, -34, -6, 9, 5, 10, -9, -20, -6, 75, -58, -111, -126, 26, 17, -24, 25, -11, 0, 34, 19, 18, 25, 1, -76, 9, 20, 0, 2, 29, 0, -5, -6, 47, 18, 2, -3, 18, -17, 10, -45, -2, -45, -83, -9, 5, 29, -29, 27, -16, 5, -13, 2, -6, 15, 20, -49, 56, -43, -127, -60, 8, 37, -2, 24, 37, 15, 34, 18, 8, 25, -25, -48, 59, -1, -3, 34, 19, 3, -49, -8, 31, 26, -15, 3, -9, 13, 28, -20, 75, 2, -72, -6, 54, 42, -54, 36, -39, 6, 2, 20, -4, 1, 3, -20, 27, 29, -110, -58, 9, 39, 0, 46, -11, -2, 28, 29, -8, 22, -12, 13, -5, 13, 2, -8, 26, 20, 9, 2, -71, 22, -5, 5, -6, 45, 19, -28, -108, -6, 17, -74, -29, 2, 9, -29, -15, -1, -60, 6, 1, -71, -61, -41, -97, -11, -3, -5, 0, -25, 1, -88, 22, 19, 20, 18, 0, -12, 27, -8, -12, -18, 16, 32, 18, 29, 21, -13, -117, 30, 4, -29, -8, 39, 13, -82, -127, -29, 27, -84, -1, -18, 10, -89, -86, 17, -38, -5, 1, -95, -79, -43, -28, -51, 9, -36, 9, -52, -17, -103, 11, 24, -21, 10, -7, -39, 29, -56, 16, -2, 35, 15, 16, 11, 20, 1, -45, 12, -9, -37, 10, 15, 20, -80, -40, -39, 4, -59, 14, -3, 9, -81, -92, 12, -40, -4, 18, -80, -77, -13, 27, -35, 20, -12, -1, -36, 15, -125, 15, -5, -64, 21, -11, -26, 29, -8, -57, 32, 12, -127, -21, -21, 17, 25, 26, -17, 14, 18, 10, 21, 12, 9, 1, 30, -2, 52, -12, -37, 0, 27, 29, 4, 6, 10, -2, 34, 32, 7, 30, 25, 13, 41, 40, 7, -35, 23, 17, 18, 24, 34, 7, 41, 22, -12, -93, -17, -10, -49, -17, -20, -1, 8, -43, -7, 39, 18, -13, -1, -5, -24, -46, 18, -21, 31, -74, -83, -60, -7, 18, 45, -27, 13, 3, 14, 5, -32, 25, -1, -28, 69, 9, -35, -54, -7, 11, 12, 20, 22, -19, 23, 8, -51, -40, -22, -20, -11, -50, -23, 19, -8, -39, 14, 5, -6, -10, -8, -36, -30, -16, 5, -53, 14, -31, -59, -11, -12, -12, 54, -48, 1, 8, 0, -20, -39, 9, -18, -55, 25, -12, -44, -20, -12, 22, 3, -2, 23, 16, 28, -11, -94, -50, 15, -54, 28, 11, -6, -18, 15, 6, 11, -40, -6, 15, -26, -26, -70, -41, -18, -61, -37, 10, -23, -30, 29, 10, 13, -7, 6, 24, 21, -13, -23, -39, -31, -33, -3, 31, 4, -7, 8, 6, 3, 26, 4, 5, -1, 19, -36, -8, 23, -72, -28, 22, -6, -3, 32, 4, 10, -6, 2, 16, 39, -19, -39, 46, 4, -113, -127, 29, -23, -17, 47, 67, -24, 60, 9, -22, 26, 16, 39, 61, -41, -36, -33, 63, 41, 10, 32, 25, 1, 48, 11, -1, 11, 33, 13, -5, 4, -76, 57, 33, 20, -38, 19, 36, -28, 6, -7, -5, 32, 12, 8, 13, -38, -83, -60, 47, 5, -11, 33, 40, -34, 59, 6, 6, 6, 4, 85, -15, 30, 27, -51, 48, 38, 48, -31, 32, 14, 22, -31, -13, -13, -5, -8, 21, 10, 0, -6, -44, -12, -18, 21, 12, 1, -42, 10, 5, 18, 14, -26, -19, 34, -57, -2, -41, -30, -43, 31, 49, 8, -27, 4, 6, 8, 5, -29, -6, -16, -40, 35, 4, -36, -37, 13, 1, -45, 28, -35, 3, -16, -17, -25, 10, 24, -6, 52, -4, 37, 30, 26, 6, 18, -63, 20, -3, 6, 19, -41, -31, 49, -59, 11, -96, -52, 4, 4, 39, -2, -127, -9, -7, 22, 19, -56, -3, 56, -33, 20, -76, -83, 12, -11, 15, -16, -58, -10, 5, -7, 12, -42, -19, 4, 32, -27, 70, 71, -37, 36, -23, 6, 24, 14, 4, 13, 10, -88, -22, 1, -8, -30, 56, 1, -50, -21, 8, -12, -25, 12, -3, 22, 18, -103, -57, -14, 11, -30, 14, -49, -39, -47, 12, -41, -65, 2, 2, 14, 14, 23, -11, -14, -35, 5, -15, -37, -32, -12, -13, 12, -15, 7, -3, 2, 0, 11, 13, 7, -93, -11, -15, 2, -77, 15, -9, -6, -1, 2, -5, 10, -3, 17, 22, 13, 10, -7, -3, 8, 30, 12, -12, -3, 3, 7, 1, -3, -7, 19, 14, 8, -53, 14, -33, -43, -49, -5, 4, 13, -7, 4, -5, -2, 11, 5, 27, 6, -121, 17, -16, 4, -93, 24, 9, 7, 6, 7, 4, 29, -1, 24, 55, -5, 15, -11, 5, 9, 0, 37, -2, 4, 19, 3, -3, 35, 11, 13, -22, 0, -36, -16, -7, -59, -79, -4, -12, 18, -25, -8, -21, 4, 1, 0, 15, -1, -109, 2, -3, -4, -127, 6, 9, 4, 2, 16, -11, 20, 2, 17, 30, 11, -5, -12, 7, -5, -3, 33, -9, 7, 9, 2, 3, 14, 5, 6, 28, 17, 20, 20, 45, 48, 14, 19, -40, 20, 23, 14, -4, 16, -7, -85, -84, -38, 12, 12, 25, -34, -35, -37, -12, 16, 10, 26, 25, 19, 6, -31, -110, -5, 6, -37, -19, -74, -40, -45, -18, 34, -18, 7, 16, -12, 16, -38, 5, 13, 2, 2, -11, 9, 3, 38, -41, 32, 13, 25, -3, 6, -11, -89, -85, -42, -17, -74, -29, -30, -74, -27, -25, 39, -7, 44, 20, 18, 9, -62, -127, -68, -31, -64, -27, -41, -58, -59, -48, 23, -34, -3, -7, -4, 6, 24, -10, 28, 5, 2, 36, 33, 17, 36, -6, 15, 33, 23, 17, 14, -21, -67, -68, -10, -35, -70, 56, -12, -57, 11, -5, 19, 22, 46, -5, 28, 5, -30, -61, -55, -22, -107, 39, 13, -41, -8, -6, 11, 34, 2, -5, 1, 0, 9, -3, -52, 25, 0, 38, 6, -12, 22, -14, -54, 8, 5, -3, 19, 14, 5, -31, -4, -12, 0, -8, 8, -3, -2, -4, -29, -24, -38, -24, -12, -4, -13, -77, 21, -3, -5, -24, -4, 0, -6, 6, -41, -70, -10, -13, -62, -21, 2, 1, -68, 2, 33, 30, 18, 7, -12, 10, 1, 37, 20, -3, 0, 16, -31, -38, -71, 20, 30, 41, 41, 18, -23, 3, -47, 17, -53, 2, -44, -6, -50, -80, -37, 22, -13, -20, -9, 11, -127, 24, -7, -63, -30, 0, -63, -14, 10, 22, 19, 7, 36, 0, -8, -21, 4, 11, -56, 40, 15, -24, 8, 20, -21, 44, -14, 0, 58, 45, 4, 5, -7, -20, -61, 50, -62, -34, 27, 16, -30, -17, -36, 10, 13, 12, -23, -4, -88, -11, -57, 11, -102, -4, -74, 5, 50, -56, 31, 43, 24, 28, 54, 39, -31, -59, -6, -61, -110, -27, -22, 17, -52, -86, 28, 8, -32, -21, -50, 7, -52, -13, 25, -38, -2, 0, -19, -83, -81, -23, -5, -100, 56, 48, 3, -43, -1, 58, 6, 51, 47, 16, 11, -12, 106, -90, 43, 55, 62, 13, 16, 41, -71, -4, -29, -52, -101, -28, -59, 7, -79, -100, -31, 27, -43, 14, -56, -2, -119, 55, -15, -21, 6, -3, -7, -43, 7, -1, -1, -127, 28, 55, 17, -53, 14, 52, -13, 24, 38, 9, 17, 34, -14, -35, 48, 20, 44, -4, 8, 42, -63, 14, -13, -29, -61, 2, -36, -17, -15, -47, -24, -1, 34, 17, -65, -10, -69, 70, -2, -58, 25, -20, 39, 43, 29, 35, 13, -109, 52, 33, 4, -47, -11, 39, -34, 23, 26, 11, 56, 39, 12, -78, -13, -7, 59, 6, 35, 16, -53, 52, 42, 7, -18, -1, -7, -7, -31, 22, 16, 29, 43, 45, 35, 26, 16, 23, -23, 67, -73, -6, -21, 27, -11, 1, 7, 4, 44, 2, -7, 0, -46, -27, 13, 0, -59, 1, -49, -14, -34, 37, -30, -75, 70, -23, -21, -14, -13, -29, 39, -31, -23, 17, -6, -17, 1, 82, 0, 19, 127, 87, 26, -39, 10, -18, -11, 30, -15, -18, -10, 46, -59, -6, -14, 16, 6, 48, -21, -38, -6, -22, -15, 24, -57, -7, 9, -2, -33, -3, 25, -123, 58, -30, -70, -82, 19, 78, 28, 5, 26, -17, 29, 11, -43, 52, 29, -27, 85, 49, -11, -94, 55, -4, -31, 58, 18, 29, 37, 33, -54, -44, 13, -15, -27, 18, -54, -54, 52, 22, -78, 27, -12, -2, 64, 22, -78, -3, -76, -60, -40, 3, -10, -21, 3, 11, 18, -9, 40, 19, 33, -6, 52, 36, -101, -15, 8, 46, 49, -54, 38, 28, -2, 50, 52, -9, 32, 32, -17, 27, -44, 12, 1, 2, -5, -13, -2, 47, 20, 18, 9, 4, 9, 37, -2, 8, -104, -58, -64, 0, -20, -54, -14, 14, -31, 10, 1, -11, -7, 9, 127, 41, -44, 1, 17, 37, 39, -2, 4, -14, -3, 36, 24, -2, 5, 20, 67, 50, -17, -4, -3, -54, -2, 21, -2, -53, -4, -45, -31, 5, -63, -25, 33, -28, -20, -49, -58, 28, 24, -8, 4, -5, -16, -23, -29, 7, -8, -4, 94, 34, 12, 29, 7, 8, 30, 15, -6, -10, -23, -46, -19, 4, -27, 1, -12, 31, 8, 15, 70, -23, -18, 16, -80, -60, -18, -52, -44, -1, -30, -26, 22, 2, -29, -25, 5, 18, 1, -34, -13, -19, -15, 43, -2, 2, 38, 20, 83, -30, -1, -1, -59, -4, 13, -5, -39, 67, -56, -21, -2, 22, 23, 21, 61, -76, 68, 6, -31, -50, -12, 18, -5, 13, -12, -42, 9, -8, 27, 14, 73, -12, -44, 3, 4, -21, 14, -39, -41, 30, -15, 1, -7, -5, 10, 22, 91, -70, 2, 6, -32, -38, 14, 10, -80, 13, -27, -95, -73, 12, 3, 11, 25, -93, 28, 3, -25, -72, -38, 10, -79, 12, 9, -127, 4, -11, 2, -35, 68, 18, 4, 10, -16, 5, 13, -31, -31, -42, -19, -24, -16, 11, -2, -5, 64, -3, 10, 12, -15, -22, -17, 22, -69, 2, -27, -57, -102, -7, -41, -8, -109, -67, 28, -10, -31, -12, -57, 1, -59, 23, 5, 2, 2, -13, -8, -20, 46, 37, 11, 5, 58, 12, 43, 46, -47, 25, -79, 24, -24, -1, -58, 18, 82, -58, 63, 33, 49, 0, 39, 31, -60, -2, -43, -60, -75, 2, -45, -17, -12, -39, 32, 17, 49, -1, -30, 16, 6, 12, -15, -5, -37, 1, -38, 5, 67, -49, 34, 28, 8, -1, 49, 49, -111, 43, -23, -41, -113, 17, -120, -20, 43, -67, 36, 21, 14, -31, 30, 18, -96, -38, 5, -101, -90, 1, -39, -70, -15, -9, -3, 0, 39, 14, -49, -6, -8, 14, -24, -18, -8, 2, -39, 2, 81, -6, -7, 30, 33, -24, 8, 26, -76, -72, -17, -36, -86, 22, -127, -60, -54, -20, -13, -8, 24, 9, -3, -9, -5, -12, 14, -37, -14, 1, 7, -52, -3, 61, -65, -22, 29, -29, -23, -28, 32, 13, -17, -11, 1, 5, 11, 13, 23, -46, -18, -30, 8, 35, -8, -35, 15, -5, -53, 14, 13, -26, -5, -9, 59, -10, -54, -10, 7, 32, 21, -38, 8, 37, -70, 43, 17, 29, 29, -3, 30, 34, -32, -3, 1, 16, 29, 18, -17, 37, -55, 28, 6, -1, 4, 16, 52, 7, 44, -46, -20, 14, -5, -60, -25, -1, -56, 9, 29, -3, -7, -1, 11, 39, -2, -16, 29, 18, -17, -69, 5, 23, -81, 20, 20, 0, -7, 21, 4, -39, -10, 0, 36, 24, -5, -21, -17, -16, -92, -13, 31, -8, 4, -4, -11, -22, 2, -37, -25, 26, -19, -46, 6, -9, -17, 11, 20, -16, -16, 17, 10, -12, 23, -5, -54, -17, -5, -52, -12, 7, -58, -22, 4, -6, 16, 3, -11, 14, 24, -3, -10, 12, -15, 4, -27, 29, -127, -2, 31, -5, 10, 10, 42, 9, -43, -13, -53, 4, 8, -19, 37, 22, -23, 26, 28, -21, 9, 4, 57, 34, -44, -3, -42, -14, 9, -14, 2, 21, -18, 0, 14, -18, -6, -22, 89, 28, 10, 33, 18, 8, 26, 18, -37, 55, -25, -83, -29, -4, -114, 45, 45, -41, -32, -17, 0, -11, 29, 4, 7, -6, -27, -10, -24, 13, -24, -36, 78, -51, 28, 6, -51, -38, 21, 10, -41, -18, -35, -50, -59, -3, 4, -57, 43, -66, 32, 36, 51, -36, 9, 19, -102, 23, -29, -127, -54, -4, -120, 24, 9, -56, 31, 16, -69, -29, 6, 12, -5, -44, 0, -69, -51, 17, 10, -69, 47, 28, 23, -3, -58, -42, -6, 28, -47, -62, 12, -103, -84, 15, 6, -75, 74, 14, -4, 11, 12, 4, -15, -10, -52, 32, 2, -77, -34, 2, -122, 19, 3, -77, 2, 10, -35, -45, -68, 0, -20, 19, 12, 2, -14, -5, -18, 0, 55, -82, -19, 18, 28, -37, -43, -88, -48, 66, 34, -62, 63, 35, 2, 19, 29, -13, 68, 18, 87, 5, 46, 8, 61, 56, -2, 5, 59, -2, 50, 65, -49, -99, -57, 9, -111, -32, -75, -33, -43, 20, 35, 9, 1, -6, -3, -1, 91, -9, -51, 5, -80, -16, -41, -118, -38, 15, -8, 3, 62, -27, -16, 4, 79, 7, 27, 18, 7, -2, 24, -1, 40, 32, -59, 7, 64, -4, 10, 53, 21, -91, -66, 35, -38, -16, -37, -12, -22, 91, -37, -9, 6, 6, 10, 41, 53, -40, -63, -9, 36, 11, -1, -127, -3, -11, -19, 33, 23, 10, 6, 15, -1, -33, -2, 36, 13, 37, 14, -1, 33, 23, -47, 31, 22, 17, -17, 34, 19, -37, -7, -24, -73, -75, -37, -79, -4, -11, 57, -62, 10, -25, -5, 21, -7, 5, -14, -1, 75, 17, 43, -84, 17, 64, -30, 2, 24, -5, 13, 69, -29, -34, -34, -5, 17, 44, 62, -6, -10, 13, -17, -4, 4, -5, -29, 10, -33, -62, -4, -21, 21, 15, -2, -12, -43, 90, -3, -32, 19, -8, 0, 49, 45, -63, 53, -10, 88, 22, 13, -25, 7, 76, -53, -13, 46, -23, -7, 52, 31, -45, 74, -16, 76, 41, 51, 17, 22, 41, -112, -15, -40, -13, -23, 7, 58, -30, -33, -34, -1, 10, -12, 10, -17, -30, 23, -25, -3, -27, -19, -2, 69, -51, 66, -30, 42, -45, -29, 6, -13, -53, 0, -127, 22, 13, -51, 8, 14, -2, 71, -18, 46, -63, -48, 24, 19, -10, -72, -51, 21, 4, -22, 4, -86, -127, -16, 109, -9, -4, -49, 56, -93, -20, -52, -61, -26, -7, -123, -41, -79, -66, -46, 53, 57, 43, -17, 44, 1, 41, 42, 16, 39, -36, -52, 1, -13, -20, -4, -48, 48, 69, 25, 3, -37, -21, 4, 56, -5, 1, -71, -20, -113, -46, -19, 112, -24, 28, 2, 23, -52, 6, 0, -8, -19, -33, -103, -87, -38, -21, 2, 70, 36, 71, -23, 74, -41, 8, -21, 33, 1, -20, -125, -43, 41, 5, 68, 2, -37, -15, 53, 51, -29, 8, 5, 62, -8, -15, -117, -74, -101, -60, -74, 39, 22, 70, 0, -38, -20, -3, -66, 43, -26, -4, -72, -50, 60, 24, 51, 32, 83, 127, 23, -14, -19, 77, -21, 52, -39, 44, -110, 4, 2, -8, 92, 26, -19, 83, 63, 51, -56, 60, -41, 58, -10, -20, -83, -55, 45, -30, 22, 13, -22, 50, 34, 5, 8, 30, -20, -16, 21, -20, 29, 29, 57, 30, 26, 3, -17, 25, 17, 12, 29, -42, -15, -40, -36, -16, 15, 34, 24, -48, 13, -3, -44, -36, -39, 2, -11, -22, -31, -70, -16, 2, -35, -59, 29, -26, 24, 11, -26, -13, 17, 17, -13, -27, 6, -79, -6, -4, 15, 11, 27, 28, 1, -10, -24, -49, 5, 9, 33, -61, 13, -60, -35, -7, 31, 10, -58, -59, -27, -22, -90, -127, -121, -21, -53, 56, -6, -108, -5, -20, 1, -31, 49, -23, 16, -14, -43, -45, -17, -1, 4, -44, -2, -82, 4, -8, 15, -5, -79, 38, 7, -15, -26, -65, -30, -11, 22, -67, 0, -49, -27, 5, 25, -7, -125, 11, -31, -19, -67, -55, -92, -28, -19, 73, -16, -19, 9, 0, 21, -22, 13, 43, 18, 6, 47, 13, 36, 12, 30, 11, -19, 21, 19, -10, 25, 10, 51, 13, 5, 6, 47, 19, 22, 29, -15, -9, -19, -1, -31, -2, -56, -20, 16, 15, 5, 11, 28, 8, 10, -1, 47, -18, 18, -7, -8, -17, -21, -22, 9, 47, -18, -1, 35, 17, 50, 3, 12, -14, -18, 21, 17, -5, -20, 4, -2, 27, -19, 8, 30, -6, 21, 18, -56, -85, -29, -19, -80, -21, -127, -38, -24, 10, -8, -3, -19, -5, -1, 1, -31, -32, 6, -45, -33, 5, -91, -38, -2, 43, 8, -10, 59, 27, 14, -17, 3, -21, 4, 34, 12, 0, -1, 13, 11, 46, 2, 19, 38, 14, 25, 16, -44, -66, -24, -19, -123, -14, -80, -35, 6, 46, -6, 5, -17, 7, 20, 16, -75, 6, 4, -30, -42, -6, -46, -11, -13, 7, -5, -21, -14, -1, -11, -34, 18, -34, 8, -5, -5, 9, 1, 6, -50, -10, 12, -14, -4, -35, -52, -45, 8, -29, 10, -11, 1, -1, 6, -7, -10, 2, 11, -18, 0, -21, -36, -59, -5, 29, 4, -5, 32, -1, 4, 10, -20, 1, 5, -42, 22, 4, 8, -27, 31, -11, 21, 25, 7, -5, 13, 2, -72, -4, 1, -40, 18, -28, -21, -37, 11, -16, 31, 6, 3, -4, 20, -8, -32, -13, -8, -46, -26, -19, -26, -106, -11, 25, 19, -4, 21, -12, 20, 13, -29, 9, 29, -43, 35, 28, 3, -37, 23, 7, 17, 19, 11, -15, 21, 21, -57, -3, -18, -58, 16, 7, -19, -64, 10, 0, 25, 11, 0, -6, 18, 12, -38, 2, -38, -46, -19, 0, -2, -127, -16, 39, -3, 12, 29, -12, 32, 20, 75, 32, -33, -23, 8, 30, 20, -38, 6, 40, -3, 27, 33, -13, 10, 24, 122, -28, 24, -5, -7, 41, 47, -15, 0, 67, -11, -45, 6, -16, 71, 26, 32, -40, 37, 8, 18, 20, 3, -2, -38, -4, 0, -48, -30, -36, -94, 16, 124, -40, 52, -14, -43, 29, 12, 2, 20, -15, -1, 24, 39, 4, 8, 15, 116, -9, 58, -8, -20, 16, 43, 38, 8, -42, -2, -2, 2, -22, -14, -11, 48, 6, 35, 19, -13, -29, -37, 32, -6, -81, 16, -33, -67, -10, -127, -17, 70, 21, 41, 12, -31, -4, 2, 28, 29, -66, -8, -24, 19, 19, -24, -32, 12, 18, 56, -14, 27, -99, 0, 53, 2, -38, 15, -75, -23, -28, 3, -52, -18, 13, 20, 6, -10, -52, -65, 0, 8, -104, 26, -81, -37, -40, -76, -53, -7, 0, -34, 17, -13, 27, -20, -39, -20, 65, -5, -65, 9, 14, 14, 28, 33, -10, -50, 22, 51, 40, 26, 10, 18, 20, -15, -8, 6, -5, -8, 42, -31, -9, -80, 4, -68, -61, -49, -4, -15, -21, 28, -112, -33, 19, -36, -25, -7, 8, -64, 16, -37, 13, -20, -25, -9, 54, -3, -26, 8, 16, 9, 43, -21, -43, -53, 34, 24, 12, 21, 3, 31, -7, -19, -26, -41, -21, 8, 54, -90, -33, -78, -6, -103, -75, -28, 4, -47, -19, -8, -127, -28, 6, -25, -21, -28, 22, -70, 7, -16, 23, -6, -40, -17, 57, -2, -15, 7, -9, 13, 49, -14, -19, -52, 29, 36, 27, 36, 12, 25, 2, -47, 1, -37, 2, 7, 52, -127, -36, -111, -6, -111, -63, -58, 4, -31, 39, -13, -33, 8, -13, -4, -30, 62, 35, 25, -97, 20, 15, 32, 11, 17, 2, 2, 13, 8, 1, 1, -6, 63, 57, 27, -127, 20, -1, 11, 44, 9, -34, 12, -7, 3, -1, -6, 2, 58, 43, 22, -36, 10, -2, 12, 53, 29, -73, 11, -15, -16, 2, -6, -24, 37, 60, -4, -79, 36, -17, -6, -8, 17, -30, 12, -15, 24, 12, -4, 2, 28, 52, 12, -112, -2, -25, -7, 4, 27, -50, 8, -26, 26, -7, -7, -30, 29, 59, 10, -38, -4, -5, -19, 27, 30, -26, 22, -16, -10, 3, -30, -42, 7, 20, 10, -75, 36, 3, -4, -34, 13, -16, -7, 7, 7, -21, 16, 6, -3, 15, -6, -92, -15, 15, -8, 1, 14, -27, 5, 9, 18, -14, 11, -10, 32, 33, -13, -29, 3, 8, -12, 20, 8, -45, -4, -5, 18, -20, 1, -8, 25, 17, 41, -39, 10, -10, 22, 23, 3, 33, -1, -22, 33, 3, 15, 13, 22, 52, 35, 7, 78, 1, -13, 16, 34, -3, -12, -16, 3, -11, 14, 8, -20, 55, -8, 4, 78, 21, 16, -5, 31, 20, -50, 27, -11, -8, 4, 3, 3, -56, 21, -38, -15, -90, 33, 42, 26, 12, 21, -127, 4, 21, -9, 2, 13, 22, 77, 8, 40, -84, -55, 5, 42, -9, 20, -64, 18, 10, -6, 4, 7, 43, 52, -3, 70, 6, -47, -9, 26, 14, 1, 23, 7, -5, 6, 6, -28, 24, 15, -15, -100, -49, 38, 24, -7, -1, 0, -90, -21, -5, -3, -16, -57, -7, 16, 0, 8, -52, -44, 15, -15, -17, 28, -81, 15, -17, -9, -3, -30, -21, 36, -3, 19, -48, -44, -4, 7, 19, 26, -39, 6, -26, 21, 13, -84, 7, -27, -52, 80, 21, 2, -18, -1, -7, -20, 6, -20, 9, -8, -17, -113, 7, -80, -13, 59, 29, 2, -26, -33, -45, -36, 8, -49, -22, -30, -24, -48, -57, -54, 21, -30, 24, -10, -12, -35, -59, -6, -20, -69, -13, -61, -35, -14, 34, 55, -127, 77, -5, -23, 16, 16, 24, 18, 11, 4, 9, 21, 21, 1, 34, 0, -62, 95, 14, -21, -9, 20, 18, 10, 38, -27, 2, 5, 2, 17, 16, -12, -1, 36, 21, 37, 21, 1, -40, 21, 30, -57, -3, -25, -1, -7, -33, 37, -103, 30, -61, -46, 10, -5, -8, 46, -40, 22, -3, 13, 8, -40, 33, 35, -59, 95, -39, -49, -44, 41, 32, 14, 0, 29, -27, 25, 17, -48, 80, -5, 0, 89, 15, -9, 5, 17, -13, 1, 21, -3, 14, 15, 12 };
+static const int32_t conv3_b[32] = { -26, 166, 293, 426, 179, 314, 579, 187, 300, 686, -248, 199, 439, 150, 7, 1190, 397, 3, 178, 283, 162, 148, -176, 713, -232, 187, 154, 13, -777, 217, 87, 191 };
+static const int32_t conv3_m[32] = { 1402435035, 1227674321, 1576936664, 1670295544, 1609712897, 1090284888, 1442853747, 2111596914, 2061494043, 1367437323, 1083368745, 1439796886, 2112973010, 1865894957, 1326921454, 2136903662, 1549454924, 1920848599, 1750824528, 1840586405, 1653581687, 1170380973, 1441355653, 1653174696, 2068460281, 1958026468, 1470103296, 1415760305, 1953118142, 2126749709, 1720672749, 1880830974 };
+static const uint8_t conv3_s[32] = { 39, 38, 39, 39, 38, 38, 39, 39, 39, 39, 38, 38, 39, 39, 39, 40, 39, 39, 39, 39, 39, 39, 39, 40, 39, 39, 38, 39, 39, 39, 39, 39 };
+// conv4: input scale 0.637094, output scale 1.17754
+static const int8_t conv4_w[32][3][3][32] = { -35, -7, -62, -3, -16, -22, -75, -38, -66, -102, -38, 24, 26, 28, -13, -92, -62, -31, -41, -93, 6, -70, -12, -53, -23, -68, 3, -61, -62, -58, 36, -26, 52, -52, -6, 36, -44, -1, -80, -57, -19, 15, -83, -31, -38, 36, -71, -45, -35, -27, 46, -88, 0, -55, 26, -118, -45, -6, -35, -87, -74, 27, -29, -47, 52, 16, -17, -14, 4, -76, -9, -99, -50, 39, -40, -27, -29, -53, -22, -10, -24, -76, -3, -21, -23, -97, -66, -29, 49, 46, 41, 80, 37, -13, -58, -42, 19, 7, -50, -29, -41, 4, -84, -66, -81, -47, -86, -85, -83, -67, 13, -39, 1, -74, -25, -22, 3, -8, -51, 18, 57, -46, -28, -38, 2, -75, -28, -33, 19, -82, -35, 26, -76, -22, -36, 32, -51, -25, -14, 17, -64, 37, -78, 14, -89, -41, 0, -103, -95, -21, -50, -90, 14, -40, 13, 32, -21, -29, -8, 2, -74, -39, -9, -47, -70, 2, 46, -46, 37, 40, -1, 57, 14, -42, -35, -23, 5, 9, -95, -70, -34, 31, -49, 14, -51, 8, -29, -83, 7, 41, -77, 17, -43, -11, -4, 1, -1, 21, -72, -48, 28, -60, 25, -43, -6, -44, -71, -81, -49, -11, 39, -34, 20, -17, -46, -24, -58, 0, 18, -55, 15, -3, -85, 10, 7, -24, -52, -40, 8, -71, -49, -80, -31, -29, -102, 7, 14, -7, -63, 22, -6, -18, -10, -85, -127, -20, -61, -7, -35, 10, -35, -73, -8, -8, 10, -14, 34, -20, 14, 0, 22, -90, -14, -117, 21, -1, -21, -25, -54, -25, -75, -30, 33, -14, -30, -59, -43, -51, -69, 4, -90, -86, -70, -41, -90, 25, -120, -62, 42, -9, -20, -38, -101, 17, -64, 44, -2, -33, -38, -41, 24, 33, 30, -10, 22, 17, 15, 10, -3, 31, 17, 8, -2, 34, -28, 11, -55, -54, 3, -24, 6, 50, 34, -51, -67, -22, -5, 1, 38, 20, -8, 36, 14, 67, 50, 36, 15, -20, -27, 43, -27, 50, 27, -35, 41, -9, -46, 33, 17, 75, 53, 6, -42, -46, 23, -2, -68, -21, -4, 13, 32, 29, -20, 46, -37, 0, 54, 19, 29, 1, 40, 29, 1, 10, -8, 35, 43, 57, -32, 44, -6, 55, 29, -34, 55, 36, -25, -79, 22, 101, 30, 25, -14, 46, 51, 22, 34, 39, 16, 71, 42, 25, 39, 7, -22, -8, 16, 48, -59, 40, -4, 7, -60, -51, 4, 53, 95, 39, -1, -20, 34, 64, 26, -14, 0, 30, 47, 31, 39, -24, 18, 73, 39, -18, -49, 13, -15, 1, 8, 25, -7, -72, 17, 19, 42, 72, 29, 74, -2, -23, 29, -45, 24, 44, 33, -36, -24, 59, 34, 50, 36, 11, 13, 58, -12, -26, 8, -13, 12, 17, -32, 39, 64, 30, 49, 12, 5, 48, 25, 8, -54, -68, -7, -50, -61, -36, -41, -21, -122, -74, -109, -127, -96, 6, -25, -99, -54, -22, 0, -109, 15, -112, -108, -18, -11, 11, -126, -50, -80, -115, -78, -13, -90, 9, -7, -73, 82, -38, -15, -89, -34, -70, -29, -44, -43, 27, -44, -67, -79, -40, -3, -107, 13, -74, -80, -78, -71, -87, -47, -37, -60, -20, -16, 26, -84, -91, -96, -65, 32, -23, -74, -25, -90, -82, -58, -41, -63, -53, -24, -89, -106, 1, -24, -109, 18, -126, -63, -44, 24, -11, -43, -43, -24, -54, -30, -44, -13, 4, -27, 22, 25, -21, 2, -52, -36, -7, 31, -33, 22, -53, -25, -36, 5, -41, -63, -7, 34, -34, -14, -19, -21, -29, -31, 2, -48, 1, 7, -17, 29, 5, -4, 5, 32, -41, 20, -81, -29, 16, 32, -15, -2, -32, -56, -17, 17, -30, -38, 6, 19, -56, 12, -43, -21, -38, -46, -14, -101, 54, 9, 16, 2, -38, -30, -14, 32, -66, -8, -38, -48, 9, 17, -42, -39, -18, -67, 2, -5, 6, -35, -3, 26, -62, 17, -35, -14, -2, -37, 4, -99, 12, 12, 20, -42, -39, -3, 3, 9, -23, -22, 2, 4, -13, 20, -7, 7, 18, -22, -9, -2, -19, 3, -14, -5, -25, -66, 21, -46, -1, -44, -23, -58, -14, -32, 27, -1, -19, 8, -16, 13, -41, 18, -55, -15, 16, 10, -2, 4, 13, -31, 12, 9, 21, 33, -3, 13, -47, -71, -18, -10, -2, -12, 12, -117, 9, 20, 32, -36, -11, 13, 0, 24, -49, 13, -35, -25, 16, -6, -4, -29, -15, -1, 8, -11, 28, 26, -18, 11, -53, -35, -17, 14, 10, -2, 41, -120, -21, 49, 41, -93, -19, 11, -37, 4, -37, 6, 45, 2, 5, -28, 2, -51, 32, 1, -11, -3, -2, 27, 4, 20, -19, -26, 31, -46, 48, -60, 3, -93, -17, 3, -20, -38, 49, 50, -33, 22, -31, -1, 31, 18, 12, -12, -6, -47, 33, 21, 4, 19, 63, 44, -25, 34, -13, 27, 31, -26, 24, -69, 37, -71, -9, 39, 33, -25, 55, 31, -9, 3, 6, 18, 37, 50, -11, 10, 30, -3, -32, 21, 15, 5, 47, 37, 13, 2, -30, 12, -5, 17, 0, -43, 48, -127, 19, 54, 51, 3, 28, 25, 8, -71, 6, -9, 10, 3, -39, -16, -6, 19, -2, -30, -27, -43, -21, -60, -18, -16, -13, 16, -33, 6, 1, -2, -35, 72, -2, -25, -40, -2, 38, -12, 10, -57, -23, 19, -12, 27, -22, -20, 25, -1, -56, -2, -16, -25, 25, 23, -20, 23, 4, 5, -19, 7, -39, 14, 10, 22, 30, 40, -67, -37, -5, -54, 31, -59, -60, 20, -33, 12, 20, 28, 37, 26, -88, -21, -8, -1, 33, 32, -24, 4, -2, -22, -27, 3, -42, 49, 16, -54, 27, -3, -97, 27, -66, 0, 16, -127, 44, -45, 0, 8, -16, -17, -24, 11, 67, 9, -36, -9, -15, -21, -9, -43, -13, -40, -4, 18, 37, -3, -80, 7, -41, -39, -20, 1, -13, 12, -7, -65, 82, -14, 22, 16, -14, -64, 19, -33, 36, 59, -12, 23, 24, -6, -19, -2, 22, -39, 19, -61, 23, 8, -11, 49, 29, -75, -57, -24, 1, -19, -23, -124, 59, -45, -26, -44, -10, -88, -43, 0, 16, -20, -32, 25, 12, 35, -70, -9, -7, 3, -16, 7, 8, -50, 33, 11, 23, 11, -60, 31, -9, 7, -20, -28, -32, -2, -36, 66, 5, 70, 18, 11, -29, 1, 27, -3, 19, -53, 35, 16, 9, 70, -63, 31, -25, -9, -23, -48, -18, 48, 72, -13, -21, 29, -50, -7, -64, 1, 5, 35, 12, 1, 39, -39, 6, 31, 40, 53, 45, -4, 66, 33, 11, 111, 46, 49, 73, -68, 33, -32, -3, 20, 8, -24, 21, 51, -18, -2, -41, -37, 26, -61, 23, 9, -20, -10, 40, -7, 24, 40, 28, 0, -22, 56, -48, 34, 62, -16, 96, -100, 61, -51, -29, -18, 21, 8, -4, 13, 12, 20, 9, 31, 14, -4, 12, 4, 4, 31, 5, 7, 44, 38, -4, 7, -1, -19, 26, 56, 5, 21, 12, -19, 6, 3, -2, -6, 7, 20, 5, 40, 25, 20, -14, 23, 4, 12, 30, 27, 23, 0, 2, 17, 46, 16, -24, -11, 18, -11, 27, 34, 10, 27, 4, 13, -3, 24, 4, 26, -3, 41, 16, 44, 31, -18, -3, 31, 20, -5, 18, -17, -1, -10, 28, -3, 27, 31, -9, -10, 20, 45, -2, 8, 29, -1, -8, -5, -40, 25, 14, -4, -4, 40, 0, 25, 17, 8, 35, 4, 16, -33, -19, 5, -106, 16, 19, -8, 17, 12, -19, 13, -37, -32, -1, 8, 19, 10, 0, -44, 24, 12, -11, 3, -34, 20, 6, -12, -4, 58, 12, -37, -5, -7, -4, 29, -60, 22, -31, -23, -11, 0, 1, -51, -45, -37, 12, 21, 12, 23, -21, -4, 0, 30, -18, -2, -73, 15, 23, 50, -15, -19, 29, 0, 21, 5, 4, 27, -15, -7, 0, 4, 5, -27, -23, -19, -14, 15, 8, 28, 18, -10, -42, 13, -64, 15, -27, 34, 22, 40, 15, 17, 43, -45, 26, -17, 12, -10, -66, 13, -127, 8, -45, -19, -14, 30, -51, -21, -26, -115, -57, -50, -2, 25, -55, -58, -4, -6, -26, -23, -42, 1, 21, 2, 47, -7, 26, -41, -8, 18, -50, 10, -84, 24, -59, -56, -30, 1, 10, -85, -25, -33, -18, -8, -20, 20, -69, -20, -25, 30, -26, -16, -19, 16, 13, 9, 56, -61, 37, 9, 12, 39, -16, -20, -12, 30, -22, -5, 4, -46, -15, -13, -8, 27, 16, -4, 9, -1, -48, 38, -113, 11, -79, -17, -24, -20, 12, 14, -5, 36, -20, -12, -30, 7, -2, -10, 5, -11, 10, -2, -24, 11, 19, -33, -7, -9, 18, -21, -47, 28, -6, 11, 9, -20, 2, 0, -19, 6, -17, 19, -6, 41, -8, -7, -52, 21, 14, -2, 24, -87, -1, 9, 0, 18, -27, -29, -6, -63, 23, -14, -52, 17, 21, 7, 20, -28, 42, 17, -12, 19, -17, 28, -17, 43, -14, 14, -26, -58, 8, -41, 26, -101, -23, -83, 5, 9, -28, -23, 2, 2, -31, -64, -27, -19, -16, -48, -14, 13, 41, 2, -4, 14, -15, 16, -14, 2, 7, 1, -34, 3, -9, -10, -21, 8, 16, 3, -6, -3, 13, -22, 10, -3, -10, -18, -30, 21, 12, 9, 3, 26, 1, -1, 3, -5, -6, 11, -12, 2, 29, 0, -46, 16, 1, -10, 16, -26, 9, 22, -7, -9, 9, 11, -18, 23, 6, -30, -48, -30, 22, 6, -6, 29, -1, -14, -12, 22, -30, 6, 13, -10, 13, -11, -11, -12, -5, -17, -2, -41, -4, -91, -13, -12, -31, -33, -33, 24, 10, -62, -15, -46, -2, 9, -61, 36, 26, -17, -39, -7, -29, 18, 25, -25, -15, 26, -11, 7, 19, -37, 11, -4, 12, 24, 19, 9, -14, -64, 13, -29, 7, 12, -2, -38, 3, 9, -33, -39, -5, -28, 27, -21, -37, 33, 22, -36, -9, 25, -25, -16, 19, -80, 9, -10, 12, 3, 13, 21, -108, -53, 7, -44, 17, 24, 9, -103, 18, -20, -25, -21, 4, -62, 7, -18, -78, 30, 40, -35, -29, 11, -41, -127, 30, -89, -24, -15, -6, -44, -1, 31, -29, -51, -30, 45, 16, 23, 19, -92, 9, -70, -16, 14, -2, -79, 11, -13, -5, 49, -11, -1, -13, 20, -24, 23, 18, -48, 7, -30, 20, 2, 6, 10, 9, -44, 23, -22, 23, -9, -71, -31, 15, -11, 9, 3, 30, -6, 6, -22, -54, 18, 50, -12, 22, 21, -68, -3, 5, -40, 9, -107, -18, -49, 15, 18, 7, 1, 16, 25, -47, 2, -49, -9, 2, -52, 15, -12, 22, 11, -4, -6, -23, 9, 47, -7, -11, 25, -17, -127, 12, -93, -46, -50, -6, -50, -9, -9, 16, 22, -5, 36, -38, -28, -14, 36, -9, -40, -15, 29, -2, -17, -15, -12, -1, 10, -22, -6, -36, -6, 11, 13, 1, 0, 11, -12, 9, 12, 6, -16, -15, -18, 3, -41, 11, 6, -27, -43, 11, 0, -20, -18, -8, -5, 7, -62, -31, 4, 13, 7, 25, 12, -58, 18, 5, -35, 23, -50, -13, -38, -8, -11, -71, -24, -4, -29, -1, 5, -9, -95, 3, 3, -41, -36, 0, -42, -10, -18, -59, -2, -11, -6, -5, 15, 3, -69, -7, -58, -31, -6, 9, -62, -16, 7, -4, -4, -15, 35, -18, 0, -4, -10, 8, 23, -7, 23, -5, -41, -44, 16, 6, -5, 30, -1, -4, -7, -8, 10, 0, 11, -6, 10, 17, 4, -17, 18, 35, -30, -7, 0, 8, 12, 23, -24, 40, 15, 18, -34, -6, 8, -10, -38, -25, -10, 2, -61, -19, 18, -64, 28, 15, 10, 26, -43, -36, -54, 5, 3, 15, 28, 4, 75, 25, 6, 16, -24, 12, 7, 29, -71, -5, 24, 8, -32, -15, -9, 2, -32, -36, 20, -16, -38, 10, -18, 21, -55, -19, -16, 4, 22, 18, 30, 8, 69, -20, -8, 6, 46, 5, 50, 51, -29, -18, 7, -11, -50, 49, 12, 2, -24, 47, -64, 41, -41, -101, -42, -104, -16, 19, 8, -19, -66, 4, 72, -56, -25, -74, 33, 54, -11, 49, -69, 24, 31, -13, 39, -40, -12, 3, -31, 50, 21, 42, -31, 63, -44, -71, -34, -64, 3, -28, 12, -64, -70, 28, 8, -79, 2, -61, -91, 51, -43, 8, -27, -54, 40, -49, -29, -26, -1, 22, 8, 61, 33, 59, -17, 29, -31, -10, 0, -33, 53, -18, -8, -26, -11, 30, -8, -50, 56, 4, -46, 34, -54, -49, 17, -1, 15, -24, -31, -26, -19, 52, -42, 37, -51, 2, -32, 11, 0, -14, -48, -60, -7, -36, 9, 15, -18, 13, 29, -15, -57, -32, -35, -43, -19, -22, -4, 36, -17, 25, 40, -14, -7, -30, -20, 1, -14, 17, -12, 11, 1, 5, -80, -2, -9, -52, 22, 13, -17, 11, 2, 17, 32, 0, -71, -38, -52, -15, -6, -8, -24, -38, -26, -26, -26, -42, -12, 7, 21, -14, 17, 10, -64, 49, -90, -4, -15, -11, -10, 3, -11, 20, 44, 11, 47, 28, -61, 4, 28, -32, 24, 19, 26, -24, -79, -36, 64, 24, -40, -26, 6, 10, 42, -35, 27, 72, -1, 101, 25, 5, 55, 112, -15, -21, -66, 31, -110, 29, -89, -69, 14, -57, 56, -6, -46, 76, 64, 82, -12, -56, -41, 0, -9, -32, 82, -62, 15, 76, -99, 68, 12, -6, 29, 90, 6, -74, -106, 34, 28, 42, 1, -24, -20, -45, 43, -127, -87, 17, -36, -28, -31, -100, 15, -19, 36, -67, 60, -16, -67, 74, -103, 49, -5, 47, 46, 62, 66, 48, 26, 58, 31, 20, -31, 58, -34, 25, 19, -18, 27, 22, -20, -40, 4, -6, 13, -8, 44, -18, 0, -4, -4, 14, -14, -1, 13, -10, 3, 20, 8, 19, -127, 2, -40, 7, -10, -75, -14, -1, 12, 24, -30, 7, -6, 38, -11, 6, 40, 31, 15, -17, 9, -90, -8, 0, -7, 3, -53, 6, -59, 6, -13, -70, -48, 11, -42, -5, -6, -15, -28, 22, -12, 15, -13, -14, 15, 24, 12, -51, 28, 19, 43, -1, 4, 20, -89, -22, -2, -36, -57, 18, -36, 12, 0, 8, -29, -28, -7, -67, -25, 16, -28, 6, -38, 0, 30, 21, 12, 39, 0, -11, 5, -20, 5, -7, 14, 2, -6, -5, -2, 22, 18, -21, -11, 10, -10, -19, -45, -1, -33, -2, -10, -40, -25, -8, 16, 2, -35, 34, 3, -11, -21, 11, 8, -14, -1, 1, -2, -33, 4, -11, -1, 3, -26, -79, -25, 5, -30, -84, -36, -12, -47, -7, -12, -31, -28, -62, -15, -23, -66, 19, 13, 3, -22, -37, -2, -15, -11, -15, 8, 2, 8, -14, -4, 16, -32, 0, 6, 14, -16, 8, -22, 23, 14, -7, 5, -6, -53, -13, 3, -17, 3, 2, -9, 7, 20, 25, -55, -9, -46, -13, -19, -4, 1, 16, 35, 23, 8, 15, -14, 14, 0, 50, -33, -22, -8, -25, -15, -1, 59, -17, 1, 18, -24, 18, 21, -3, 0, 23, -50, -28, -2, 9, -15, -39, 9, 0, 38, 20, 13, -68, 2, -26, -23, -19, -45, -33, 15, -13, -37, 11, 19, -53, 9, 23, -60, 15, 44, 2, -20, -1, -40, -23, -49, 0, 7, -8, 8, 15, 25, 28, -7, 0, 23, 5, -13, 51, -27, 15, 49, 36, 17, 19, 6, -18, 36, 17, 12, -23, 46, 21, 47, -72, -5, -29, 18, 72, -37, -25, 27, -9, -50, -35, -50, -61, -26, -61, -74, -39, -19, 23, -32, -40, -72, -26, -71, -52, 0, -62, -61, 14, 9, -32, 2, 12, -21, -86, -80, -8, -70, -5, -2, -5, -3, 21, -36, -106, -56, -41, 12, -38, -47, 22, -39, 7, -65, 9, -45, -82, -54, -106, 8, -31, 37, -80, 21, 4, -51, -64, -53, 17, -4, -85, -8, 1, -72, -33, -44, -87, -62, 0, -28, -9, -71, -43, -76, -66, -29, -78, -97, -11, -47, -9, 5, 1, 19, -29, -10, -68, -75, -23, 38, -27, -12, -46, -56, -36, -42, -82, 19, -49, -72, 4, -107, -44, -50, -31, -65, -61, 38, -85, -25, -31, -50, 38, -55, -29, -34, -49, -47, -78, -23, -73, 28, -75, -84, -59, -55, -18, -37, -19, -45, -106, -85, -36, -32, -28, 2, -8, 0, -28, -26, -37, -82, -18, 27, -54, 18, -62, -44, -23, -53, -25, -98, -39, 30, -1, -50, -67, 22, -110, -53, -4, -11, -87, -53, -72, 14, -61, -79, -14, -81, -55, -79, -97, -86, -48, 35, -7, -17, -124, -58, -65, -102, 18, -65, -8, -90, -49, -9, -24, -8, -36, -56, -13, -16, -46, 6, -8, -89, -69, -26, -62, -45, -64, -106, -63, -47, -30, 35, -90, -95, -75, -97, -76, -19, -109, -70, -62, -22, -65, -4, -127, -42, -44, -37, -52, 5, -64, -85, -69, -26, -56, -39, -12, -58, -62, -35, -16, -79, -100, 34, -83, -54, -57, -66, -56, 16, -21, -80, -20, 35, -59, -88, -34, -4, -34, -22, -55, 4, -70, -53, -47, -86, 26, -43, -31, 8, -71, -80, -45, 39, -19, 43, -65, -47, -103, -37, -7, 11, -19, -13, -31, -89, 1, 19, -11, 25, 23, 1, 27, 26, -28, 4, 25, 13, 31, 14, 11, 9, 16, 27, -39, 22, -55, 11, 27, 4, 11, -4, 18, 21, 18, 12, -3, -58, -28, 28, -53, 27, 30, 1, 35, -23, -21, 15, 2, 16, 16, -18, 18, 37, 42, 19, -82, 26, -32, 11, 3, -47, 26, 10, 8, 24, -22, 32, 22, -127, -64, 17, -7, 11, 25, 33, 19, -92, 58, -11, 31, 12, 5, 10, 15, -28, 6, 16, 32, -3, 55, -6, 11, 37, 40, 45, -14, 38, -30, 9, 2, -2, -4, -8, -2, -13, 21, -10, 22, 21, -29, -8, -1, 21, -1, -40, 12, 31, 39, 33, -2, 4, -17, 14, -3, -31, -19, -45, -17, -21, -15, 4, 9, -2, -18, 25, -36, -6, 20, -4, 26, -1, -41, -51, -1, 0, -14, -5, -12, 67, 11, 11, -30, -33, -38, 4, 15, -32, 6, 16, 18, -27, 39, 19, 8, -24, -64, -26, -25, -2, 4, 16, -2, 2, -1, -45, 20, 22, -1, -38, 0, 5, 5, 14, 26, -9, -1, 16, 27, 12, 24, 44, 22, 16, -16, 10, -9, 28, -14, -29, -43, -34, -34, -26, -43, -29, 30, -8, -34, -6, 22, 43, -12, 24, -3, -41, 9, 34, 37, -38, 16, -9, -11, -24, -63, 1, 17, -23, -27, 18, 28, -7, -11, -15, -65, -20, -48, -27, -59, -44, -103, 6, -4, 17, -87, 41, -50, -55, -2, 28, -25, -41, 10, -25, 11, 26, -101, -34, 84, -20, -41, 19, 47, -2, -27, 52, -40, -14, 5, 1, -75, -16, -30, -56, -28, -17, -25, -5, -18, -57, -21, 23, -61, 32, -41, -2, 3, 77, 49, 54, -3, 47, -41, 42, 41, -1, -70, -32, 18, -32, -38, -56, -58, 14, -77, -73, 40, -40, 20, 6, 21, -93, -21, -52, -33, 50, 8, -3, 20, -52, -70, 19, -29, 40, -23, 13, -71, 48, -33, -45, -50, -43, 21, 32, -64, -17, -80, 5, -48, 37, 11, -112, -47, -72, -27, -70, -6, -44, -12, -18, -51, -117, -65, -21, -93, 35, -30, -36, -46, -26, -14, -75, 28, -42, -38, -27, -59, -121, -43, -24, 39, 3, -16, -7, -127, -5, -83, 35, -34, 4, -47, -18, -51, -89, 29, 28, -18, 45, -73, -58, -67, 47, 3, 44, -63, 12, 5, -21, -13, -78, -30, 0, 13, 5, -13, -64, -91, -96, -63, 5, -2, -4, -52, 50, 9, -35, -33, -67, -30, -69, -42, -64, -9, -39, -26, -19, -28, -59, -60, 10, -14, -41, -119, -38, -26, 14, -41, -14, -95, -111, -49, 36, 2, -55, -63, -28, 11, -6, 1, 11, -38, 46, 30, -64, -30, -36, -57, -38, -49, -7, -75, -1, -50, -78, 20, -46, -60, -26, -72, -6, -16, 46, -6, -57, -49, -50, -85, 36, -44, -55, -14, -15, -44, 28, 37, -45, -52, -37, -9, 38, 3, -33, -1, -58, -22, -20, -76, 28, 27, -3, -67, 3, -18, -32, 11, 24, -50, 6, -60, -38, -12, -33, 19, -22, -36, -29, -65, 3, 26, -77, 32, -4, 18, 11, -20, -2, 13, 7, -17, -37, 20, 3, 39, -82, 13, -47, -57, -23, -62, -4, 31, -13, -65, -19, -43, -62, -57, -68, 3, 10, -2, -15, -41, 28, 15, -24, -36, 18, 9, 0, -65, -29, 12, 40, -9, -53, -52, -67, 15, -6, -1, 0, 14, -39, 30, 12, -38, 36, 6, -38, 0, 51, 13, -51, -96, 19, -19, -7, 7, -34, -76, -28, -29, -39, -23, -78, 5, 36, -28, -9, -5, -83, 47, -13, -55, -68, -13, -101, 47, 43, 25, 40, 21, -30, -89, -19, -82, -58, -55, 1, -33, 1, -77, -87, -2, -68, -81, -99, -81, -55, -43, 39, -15, -56, -21, -68, -1, -58, -127, -56, -65, -26, 4, -22, -25, -9, -50, -29, -37, -66, -15, -37, -17, -79, 47, -24, -14, -61, 7, -112, -15, -83, -29, -10, -113, -11, -4, 16, -52, 32, -56, -116, -62, 42, 12, -89, 5, 17, 51, -75, -1, -30, -44, -12, -28, -69, -76, -5, -44, -64, 26, -42, -37, -108, -11, 30, -10, -96, 0, -33, -58, 49, 36, -33, -36, -88, -49, -41, 28, -117, -72, 37, -27, 46, -58, 2, 20, -65, -1, -6, -51, -89, -6, 4, 36, -14, -109, -64, -73, -101, -47, -39, -15, -28, -56, 40, -38, -68, -26, -71, -17, -53, -118, -68, -45, -67, -75, -51, 19, -42, 32, -16, 28, -2, -24, -33, 8, -27, -18, -70, -56, -7, -43, 58, -89, -50, -13, -25, -72, 34, -20, -78, 36, -63, -37, 12, -78, -36, 47, -11, -54, -27, 11, 27, -84, -10, -2, -38, 5, -56, -51, -59, -120, -59, -80, -26, -15, 77, 19, -11, -50, -56, -1, -50, -73, 57, 2, 14, -26, 16, -72, 14, 56, -26, 18, -79, -50, 37, -18, -75, 13, 4, -47, -5, -32, -82, -49, -55, -29, -80, 7, -29, -42, -78, 7, -47, -25, -49, -87, -6, -83, 25, -36, 9, -60, -79, -108, -63, 40, 59, -30, -21, -60, 56, -5, -18, -53, -58, -101, -24, 2, -71, -54, -104, -47, -48, -43, -68, 15, 32, -5, -8, -48, 0, -80, 6, 3, -6, -34, -78, 23, -9, -8, 44, -38, -48, -32, -6, 19, -16, -28, -20, -31, -16, 36, -68, -15, -52, -22, 10, -55, -77, -94, -1, 10, -60, 23, -42, -68, -86, 1, -32, -8, 7, -38, -47, 21, -32, -73, -45, -2, -59, 6, -10, -46, -62, -65, -49, 28, -6, -82, -40, 37, -53, 4, -16, -77, -10, 7, -50, -3, -85, -54, -37, -26, -9, -13, -45, 2, -35, -41, 6, -57, -27, 48, -15, 13, 23, 11, -38, -35, -35, 14, -2, -21, 45, -81, -16, -34, -40, -88, -50, -44, 15, -42, -44, -61, -14, -60, -18, -16, -56, -65, -33, -11, -67, 88, -72, -24, -61, 29, -46, -65, 38, -62, -11, 15, -50, -46, -45, -35, -39, -8, -73, -90, -27, -28, 36, -75, 5, 31, -2, -8, -9, 17, -63, -15, -64, -28, 4, 15, -30, -65, -58, -44, 37, -57, -27, -34, -55, 0, -27, -88, 7, -77, 13, 19, 34, -45, -51, -9, -18, -10, 7, 20, -127, -64, -30, -65, 1, -50, 4, -97, 6, -87, -21, -85, -1, 21, 27, -41, -17, -62, 27, -6, -40, -62, -3, 16, 26, -25, -84, -14, 33, -69, -55, 45, -5, -83, 29, -42, -34, 32, -20, 42, 53, -73, -67, -57, -59, -44, -7, -18, -25, -110, 19, -66, -83, -60, -44, -35, 2, 31, -15, -74, 1, -16, -37, -39, -67, -17, -6, -57, 5, -14, -8, -41, -11, -46, -33, -88, 52, -42, -26, 7, -7, -6, -38, -67, -57, 5, -69, -52, 17, -54, -37, -30, 45, -83, -20, -32, -20, -74, 53, 16, -41, -22, -44, 62, 3, -42, 16, -46, -29, -43, -44, 24, -16, 39, -36, -74, -40, -51, -37, -40, -47, -30, -38, -63, -15, -6, -45, -52, 33, -2, -18, -24, -72, -48, -35, -14, 20, -3, -13, -23, -38, -51, -7, -36, 59, 40, -53, 3, -34, -28, 1, -58, -15, 47, 37, -6, -22, 16, 7, -13, -38, 2, 10, 31, -37, 10, -38, 1, 23, -28, 2, 34, 25, -62, 1, -2, 55, 27, -127, 10, -71, -60, 42, -61, -3, 54, 30, -13, -19, -1, 35, -35, 20, -57, -23, 38, 13, 36, -42, 6, 28, -55, -11, 60, -4, 51, -54, -75, 90, -16, 14, -22, 13, -4, 15, -6, -14, -28, 14, -20, -27, 22, 10, -17, 36, -11, 29, 4, -22, -44, -24, 5, 56, -7, 81, 44, 49, -40, -11, -22, 86, 10, -26, -8, -17, 7, 2, -28, 8, 35, 39, 1, 5, 44, 23, -22, 17, -1, 49, 9, 11, -12, -46, 17, 20, -14, 40, 38, 28, -30, 38, 1, 81, -9, -78, 15, -11, 0, 25, 1, 6, 31, 45, -12, 4, 10, 23, -3, -19, -22, 94, -1, 19, 25, -22, 0, 14, -45, 21, 15, -38, 73, -31, -91, 10, 24, -24, 24, 14, -41, 9, -35, 30, -23, 43, -56, -50, 25, 64, -23, 40, 27, -20, 4, 32, -42, -2, -5, 60, -45, 8, -115, 72, 30, 23, -19, 37, -4, -30, -7, -16, -22, 1, -32, 53, -4, 95, 8, 22, 24, 18, 11, -18, 14, 22, 28, 7, -48, -14, -21, 54, -21, 8, -59, 35, 21, 40, 25, -4, -19, -54, 6, -10, -7, 54, -34, 33, 4, 48, -7, -32, 7, 5, -5, -48, 13, 49, -1, 30, -13, 8, -17, 39, -88, -7, -39, -1, -31, 1, -67, -127, -29, -50, 12, -44, -36, -12, -10, -32, 27, 46, 30, -22, -34, 53, -63, -33, -60, -42, 39, -5, 58, 6, -10, -50, -69, 29, 51, 10, -7, -15, -33, -70, 14, -22, 12, -1, -11, 29, -88, 2, -59, 2, -36, -30, -18, -12, -59, 29, 15, -6, -1, 20, -35, -1, -27, -20, -56, -18, -97, 14, 8, 5, 0, -59, 14, 7, -6, 17, 3, -38, -1, 5, -52, 37, 26, 13, 16, -46, -11, -25, 39, -15, -25, 41, -49, 2, -23, 16, -13, -5, -20, 4, -49, -5, -27, -14, 9, -42, 24, -16, -25, 9, -5, -6, 31, 43, 18, -3, -70, 16, 28, -37, 15, 16, 25, -14, 29, 6, -2, -54, -52, -7, 1, 25, 22, 8, 8, 10, 14, -36, 20, -28, -54, -1, -61, 1, 22, -20, -16, -22, -28, -11, -23, 0, 7, -13, 17, -23, 25, -33, -22, -1, -60, -4, -4, 36, 37, 2, 57, -2, 70, 13, 12, 23, 3, -2, -4, 16, -57, 30, 23, 27, 0, -39, 2, -11, 11, 44, -18, 19, -42, -16, 18, 35, 15, 46, 65, -22, -52, -9, -22, -23, -4, -18, -29, 20, 10, -4, -14, -2, 48, 10, 31, 7, -87, -18, 24, -81, 42, 7, 10, 7, 24, 54, 11, -63, -34, 42, 20, 18, -17, 39, -55, -24, -22, -16, 8, -51, 6, -73, -24, 6, 51, -15, 57, 21, -21, -15, 29, -27, 9, 9, 38, -70, 30, -58, -17, 6, -40, -48, 38, 64, 31, 33, -6, 44, 36, -46, 45, -4, -4, -32, -14, 4, 35, 27, -9, 5, 14, -15, -30, 3, 15, -5, 31, -22, 25, -21, -5, -4, 28, 13, -35, -30, -3, 7, -68, 30, -33, 13, -20, 19, 21, 26, 36, -24, 31, -27, 18, -12, 11, -103, 17, -61, 32, 12, -79, -53, -86, 11, -20, -35, 10, 6, 26, -39, 20, 51, -33, -13, -63, 20, -34, 38, 1, -11, 2, -30, 26, -17, 30, 9, -30, -20, 55, -77, 22, 21, -57, -19, 5, -12, 14, -42, 27, 10, 38, -16, 42, 53, 23, -11, -51, 44, -66, 49, 16, -30, 17, -60, -13, -90, 29, 10, -65, -46, 38, 27, -26, 27, -71, -26, -19, -72, 4, 12, 33, 41, 13, 21, -5, 11, 16, -35, 12, -1, 6, 13, -1, 7, 4, 24, 17, -22, -11, 3, 3, -74, -3, -48, 16, -23, -20, -74, -22, 27, -52, -22, 11, -9, -10, -32, -7, 19, 18, -64, 3, 7, 0, 25, -2, -1, 10, -9, -10, 0, 11, 11, -30, 26, 18, -25, 11, 9, -27, -94, -1, 9, -43, -35, -2, -29, 13, -4, -5, 27, 53, -56, 7, 20, -71, 5, 23, -3, 35, -1, -45, -37, 22, -4, -65, -34, 8, 62, 3, -4, -67, -51, -31, -2, -16, -5, 12, -9, -30, 39, 0, 14, 2, -47, 6, -35, -13, 20, -12, 6, 4, 21, 12, -3, -17, -1, 52, -61, -2, 38, -3, -4, -29, 32, -27, 36, -33, 32, -26, -22, -42, -36, -29, -41, -8, -18, -35, -29, -24, 23, -18, -8, 30, -17, -38, 7, -2, -19, 56, 29, -9, 15, -8, 26, -18, -4, -13, 26, 5, -48, -33, 17, 34, 8, -14, -34, -21, -35, -50, 4, -127, -15, 14, -66, 49, -60, -35, 17, 2, 8, -29, -28, 18, 64, 25, 17, -72, 24, -31, 10, 47, -62, 11, 36, 12, -17, -18, -30, 12, 7, 49, 6, 5, -5, -2, -46, -6, 35, 15, 2, 2, -46, -13, 22, -61, -47, -17, -63, 7, -12, -7, 19, -53, 47, 23, -16, 25, 12, 1, 11, -20, -27, -5, 24, 20, -23, 10, -71, 31, -2, 5, -43, 7, 33, -2, -1, -1, 4, -33, -42, -9, 18, 0, 31, 8, -58, -33, -41, 9, 0, 25, -35, -20, -34, -12, -7, 20, 26, -9, -45, 41, -21, 13, 1, -31, 5, 18, -6, -2, -20, 17, -4, 4, 18, 2, -31, 14, -73, -48, 7, -43, 4, -1, 18, -32, 49, 11, 18, -20, 21, 24, 1, 19, 27, -41, 28, 19, -19, -19, 46, -19, -106, 0, -25, -20, 14, -38, 27, -37, 31, -2, -4, 20, 15, -27, 5, -25, 23, -13, 21, 36, -38, 21, -57, 48, -12, 37, 1, 14, 22, 27, 21, 20, -18, -40, -18, 0, -23, 12, 29, 10, -54, -16, -59, 9, 39, 53, -16, -44, 15, 0, -32, 22, 21, -45, 7, -38, -58, 19, 19, -32, -23, 24, 7, 1, -20, -7, 35, 17, 6, -8, -71, 12, -55, -46, 24, -13, -25, -18, 5, 13, 82, 24, 27, -25, 23, 26, 14, 34, 53, -70, -2, 29, -4, 9, -18, -3, 21, 10, -1, -18, 36, -73, 28, -33, -11, 2, -30, -14, 8, -76, -3, -35, 7, -69, -25, 37, -27, 33, 46, 48, -13, 21, -4, 20, 28, 17, 15, 4, -10, -42, 4, 8, 24, 25, 0, 26, -40, -2, -13, -21, 43, 38, -24, -33, 7, -18, -59, 41, -48, -77, 3, -54, -63, 3, 20, -49, -3, -3, -4, -40, -21, -29, 12, 20, -18, 17, -127, 10, -63, -37, -25, -59, -25, -8, -15, 8, 27, -11, 8, -21, 14, 8, -25, 41, -36, -30, 16, -5, 20, -18, -13, 3, -6, -5, 9, -14, 7, 16, 11, 18, -46, 8, -3, -6, 53, -17, -44, -42, -24, 2, -56, 31, -4, -52, -18, -46, 9, -8, -8, -28, -51, 6, 19, -55, -47, -58, -47, 26, 11, 4, -5, -3, -15, -50, -17, 6, -20, 34, 37, -20, -2, -63, 8, 5, 21, 13, -9, -18, -28, 5, 46, 20, -2, -24, -70, -6, -18, 10, 3, -46, -1, -47, -43, -18, -8, 4, 0, 25, -60, 22, -16, -22, -8, 20, 0, -19, 6, 5, 13, 11, -4, 2, -26, -8, 32, -46, -29, -20, 9, -25, 20, -7, 29, 15, -7, 30, -24, 18, 13, -13, 75, -25, -102, -19, -27, 20, -42, 33, 5, -12, 26, -11, 9, -31, 14, -50, -51, -21, 20, -6, -59, -3, -40, 6, 63, 20, 11, -5, -26, -57, -8, -12, 74, -1, 43, 26, -17, -59, 14, 27, 15, 8, -55, 17, -32, 31, 78, 36, 20, -13, -39, 7, -39, 26, 13, -68, -42, 24, -10, 1, 21, 22, -7, 50, -52, 33, -36, -30, -38, 24, -25, -12, -2, -6, 25, -11, 19, -1, -34, -8, 30, -13, -25, -12, 23, -53, -29, -33, 19, 26, 26, 38, -44, 21, 21, 11, 62, -9, -72, -95, -27, 42, -29, 11, 6, -2, -12, 7, 9, -23, 47, -39, -22, -44, 21, 25, -13, 53, 41, -8, 37, 10, 20, -20, -42, -62, -1, -22, 127, -31, 42, -10, -18, -82, 46, -9, -23, 24, -65, 33, -15, 58, 79, 36, -5, 33, -25, 12, -14, 41, 16, -72, -12, 56, -19, 9, 15, 34, -31, -20, -14, -9, -22, -18, 0, -6, 15, -19, -16, 6, -3, 10, -5, -19, 16, 5, 16, -36, 40, -10, 14, -2, 16, 26, -59, 52, 12, 49, -37, -4, 2, 7, -2, -42, 6, -12, -56, 6, -20, -11, -76, -40, -25, -44, -4, 25, -28, 1, -23, -14, 57, -32, -21, -39, -26, 55, -52, 50, -27, -6, 21, 45, -41, -21, 1, 49, 9, 32, -16, 27, -26, 17, -38, -38, 31, -101, 43, -29, -6, -3, -59, -50, 4, -53, 0, -68, -27, 52, -67, -11, -67, -19, 33, 25, 10, 16, 22, 3, -19, -3, -57, 25, -8, -29, 5, 9, 13, 10, -28, -42, -6, -26, 7, 17, 32, -24, 24, 0, 20, -18, 16, 7, 0, 26, -44, -4, 52, -8, -9, -62, 6, -56, -80, -92, 5, -19, 58, 3, 4, 25, -50, 51, -1, 34, 12, 20, 15, 13, -53, -7, 16, -2, -9, 12, -36, -68, -7, -5, 29, 42, -15, -37, -7, 13, -28, -13, 19, 17, -86, 4, -49, 15, -12, 8, -7, 12, 22, -1, -1, -29, 70, -58, 0, 15, -14, 38, -32, -32, 9, 23, -91, 34, 8, -5, -51, -85, -24, 61, -38, -21, 17, -37, 19, -36, 51, -25, -2, -54, 12, 82, 94, -58, 124, -32, -49, -1, 48, -16, 17, 8, 4, -89, 24, -24, 39, 37, 17, -107, -50, -76, -23, -101, 70, -9, 28, 11, 80, -24, 12, 0, -17, 41, -39, 9, -8, 42, 9, -127, -17, -107, 26, -32, -56, -27, 41, 72, -38, -64, 4, -12, -37, -85, 57, -53, 14, 26, -17, 65, 11, 26, 34, 52, 21, 0, -19, 46, -7, 11, -1, -36, -5, -2, -10, 6, -32, 18, -9, 8, 3, 15, 14, 32, -93, 21, 49, -68, 43, 26, 11, 24, 32, -4, -55, 14, 35, -6, -17, 32, 29, 37, -2, -77, -36, -6, 33, 11, -15, 44, -13, 11, -24, -30, -16, -5, -127, -16, 29, -9, 7, 27, -3, 28, -42, 1, -31, 19, 31, 22, 61, -6, 24, 9, -11, -5, 30, 12, 45, 19, -35, 6, 4, -41, -8, -15, -35, -15, -67, -15, -24, 6, -18, -2, -60, 12, -53, 6, 23, -4, 1, 7, 23, -26, 21, -40, 9, 38, 9, 38, -18, 0, -10, -17, -4, -2, 24, -29, -22, -9, -31, -19, 30, -51, -22, 28, -1, 34, 11, -42, -50, -13, 6, -14, -13, -4, 44, 37, 4, -24, 48, -4, 2, 43, -29, 20, 2, -25, -9, 1, -9, -1, -64, -15, 1, 11, -30, -17, -29, -14, -19, -21, -5, -20, 37, 15, 42, 8, 4, -55, 17, 4, 44, 21, -14, 44, -65, -5, 4, -64, -30, 31, 3, -19, -26, -3, -98, 8, 3, -66, 16, -14, 44, 2, -15, -42, 7, 32, 8, -33, 39, -56, 1, 24, -17, 24, -1, 32, -34, -18, -4, -1, -8, -31, -34, -23, 5, -44, -65, 16, -12, -45, 0, -12, -48, 15, 6, -45, 1, -33, 53, -3, -19, -24, -16, 18, 14, 41, -11, 17, -18, -3, 5, -87, 0, -7, -16, -39, 55, 31, -53, 28, -16, -54, 24, -31, -5, -69, -36, -45, -70, -33, 18, -75, -11, -83, -87, 17, 15, -5, -30, 3, -62, -13, -10, -55, -62, 32, 41, 13, 94, 33, -55, 10, 6, -23, 62, -19, 71, -28, -47, -16, -45, -29, -22, -41, -36, -40, -33, 0, -41, -7, 4, -49, 5, -16, -33, 1, -13, 31, -22, 20, 114, 7, -26, -6, 9, -48, -6, -22, -28, -25, -59, -26, -76, -33, -53, -75, 2, -22, -22, -10, 1, -76, -22, 48, 24, 42, 38, 53, -9, 22, -7, -30, 111, 25, -28, -82, 10, -9, 8, -8, -46, 28, -98, 0, -62, -34, -49, -65, -9, -37, -84, -40, -22, -102, 6, -29, -15, 41, 18, 32, -42, -71, -38, -1, 117, -42, 20, -51, -22, 27, 5, 44, -82, -11, -53, 15, -47, -8, -16, -50, -49, -5, -20, -57, -24, -100, 41, -68, -20, -13, -25, 2, 23, 16, 26, -34, 2, -47, 2, -49, 25, 28, 19, 13, -10, -11, 8, 1, 14, -34, -34, 8, 32, -4, -21, -26, -31, -15, 14, -27, -6, 24, 4, -13, 36, -55, 16, -23, 17, -15, 19, -80, -9, 38, -65, 9, -8, -19, 48, 22, 36, 42, 0, 18, 96, 4, 32, -46, -5, -6, 8, 25, 42, -21, -57, -17, 61, -68, 8, 8, -6, -27, 28, -35, -54, 19, -127, -3, -18, 0, 38, -5, 35, 82, 92, 13, 87, 15, 15, -28, 107, 4, -6, 51, 20, -8, 0, -33, 52, 20, 48, -24, 32, -8, -26, -29, -22, 15, -4, -12, 13, 23, -2, 10, 40, -42, -25, 36, 29, 40, 26, 20, 56, 3, -4, 54, -9, -2, 1, -33, 75, -16, 10, -19, 43, -37, -24, -44, -3, -9, 13, -9, 6, -22, 27, 9, 49, -32, -12, 35, 53, 21, 39, 19, 112, 18, -9, 48, 40, -15, 22, -56, 81, -25, -11, -26, 36, -62, -24, 15, 2, -45, -8, 10, 30, -36, 7, 22, -9, -13, -36, 27, 50, -36, -43, 6, 66, -9, -12, 19, 38, 11, 4, -48, -11, -105, 12, -9, 30, -17, 19, -57, -17, 55, 31, 23, 81, 42, 30, 46, 8, 39, 16, 26, 17, -2, 5, -5, -35, -6, -19, -48, -48, 1, -20, 10, 13, -25, 26, -3, 24, 14, 51, -64, -43, 48, -37, -26, -59, 45, 19, 30, -2, 44, -7, 0, 28, -30, 13, -13, 36, 3, -79, -4, -49, 33, 4, -11, 56, -3, -13, 33, 57, 36, 44, -70, -19, 32, -10, -44, -25, 19, -5, 9, 49, 20, -10, -11, 41, -32, 13, -21, -18, -20, -87, 8, -126, -15, 35, 19, -10, -64, -6, 13, 24, 18, 3, -5, -94, -17, 0, -43, 48, 23, 64, 5, 50, 32, 58, 36, 28, -39, 26, 16, 13, 67, -36, 48, -22, -51, 2, 9, 33, 3, 12, -17, 14, -21, -4, -40, 4, -19, -18, -81, 21, -25, 36, 21, -2, 27, 17, -17, 11, -63, -59, -4, 20, 55, 4, 25, -127, -33, 5, 6, 17, 29, -25, 15, -17, 10, 22, -14, -7, -17, -4, -89, 53, -50, -35, 16, -20, -10, -9, -22, -20, -24, 16, -28, -21, -2, -30, 7, -90, 34, 42, 9, -4, -18, 17, 26, 38, -41, -66, 81, 12, -67, -5, -66, 17, 77, 61, -6, 9, -47, 94, 6, -51, -57, -35, 66, -76, 78, -3, -39, -19, -69, -33, -41, 30, 6, -46, 2, -49, 13, -45, 1, -10, -75, 54, -104, 28, 13, -18, -29, -50, -57, -5, -32, -41, -13, -69, 23, -103, 41, 36, -2, -64, -40, -16, -100, 8, 4, -69, -58, 46, 76, 22, -44, -37, -11, -16, -109, 34, -28, -60, -13, -23, -66, -21, -63, -48, 5, -44, 2, -29, -33, -33, 2, -38, 1, 10, -72, 27, -7, 30, 17, 9, -32, 24, -11, 1, 20, 9, 12, -9, -11, 24, 12, 30, 4, -33, 25, -9, 18, 26, -32, 29, 6, 2, 22, 0, 17, -10, -11, 15, -2, 16, 27, -12, 13, 2, -47, -34, 4, -3, -13, -30, 7, -106, 1, 9, -45, -17, 5, -12, -36, -12, -8, 39, 6, -11, 21, 23, 6, 7, -19, -29, 8, -3, 23, -18, 18, 3, -35, -55, -5, -31, -45, -31, -28, -112, -13, 20, -16, -46, 18, 27, -69, 7, -9, -9, -11, -78, 14, -42, 22, 8, -31, 26, 6, 3, -7, 7, -3, -3, 28, -6, 9, -6, 3, 4, -24, 4, 3, 0, 14, -9, -4, 2, 14, 29, -17, 11, -12, 4, 2, -5, -4, 0, -3, 12, -3, -9, 4, -11, -3, -23, -20, -17, -11, 6, -1, -5, -36, -98, -1, 2, -36, -26, -21, -19, -15, -4, -10, 26, -5, 4, 12, 19, -2, 4, -16, -43, 10, -22, -15, -25, 19, -22, -28, -25, -30, -2, -24, 12, -28, -127, -6, -36, -36, -57, -22, 22, -52, -35, -17, -35, -29, -13, 8, -65, 3, 8, -1, 44, 13, -5, 38, 18, 6, 5, 22, -4, 8, -6, 2, 20, 1, 5, 15, 22, 42, 4, -13, -23, -6, 8, 26, 10, 7, 3, 1, 11, 10, -6, 6, 11, 1, -16, 2, 16, 8, 7, -30, 4, -2, 28, 20, 16, -5, -75, 8, -24, -18, -20, -25, -23, -16, -32, -5, 24, 2, 39, 10, 9, 14, 29, 0, 17, 13, -10, -35, 38, 7, 6, -34, 11, 7, 20, 4, 11, 2, -64, -4, -27, -44, -46, 7, -8, -28, -46, -17, -4, -20, 16, -5, -94, 1, 34, 3, -17, -23, -19, 24, -89, 25, 0, 21, 3, -17, 0, -11, -2, 4, 25, 5, -26, -17, 16, -11, -45, -1, 3, 17, -26, 27, -5, -42, 1, -41, -4, -17, -35, 2, -8, -23, -75, 34, 3, 4, 14, -3, -12, 6, 21, -15, -3, 6, 19, 34, 36, -5, 27, 3, 11, 14, -27, -8, 14, -53, 15, -15, -5, -17, -42, 18, -6, -10, -89, 10, 24, 2, 32, 19, 18, 33, 10, -16, 14, 8, 28, 13, -32, 16, -9, 44, 2, -3, -33, -6, 25, 0, 8, 46, -3, 0, 10, 16, -46, 6, -48, 16, -5, 11, -2, 5, 0, -19, 23, -6, 20, 8, -16, -7, 13, -7, -50, 9, -7, 24, -7, 26, 9, -36, -12, -33, -19, -40, 14, -19, -21, 2, -30, -27, 12, 3, -22, 12, 20, 10, 35, -10, 5, -5, 4, -12, 25, -1, -22, 13, 7, 23, -31, -23, 25, -29, 14, 2, -43, -64, -4, -39, 6, 20, -44, 13, 40, -12, -17, 23, 10, 11, 19, -5, 16, 0, 24, 13, -2, 10, -16, 17, -5, 10, -40, -18, 35, 18, 15, 20, -22, -42, -7, -39, -3, 12, 23, -47, 28, -83, -16, 44, -12, 2, -9, 23, -14, 18, 21, -2, -3, 28, -29, 12, -8, -11, -11, 17, 9, -1, -46, -21, -61, -36, 1, -118, -11, -19, 17, -94, 12, -127, -51, 27, -41, 1, -22, 15, -39, 5, 5, 28, 8, 11, 28, -13, -29, -2, 14, 44, 2, 10, -19, -20, -79, -48, -15, -37, -7, -35, 43, -37, -6, -24, -76, 15, -52, -42, -80, 14, 3, -20, 10, 18, 43, 10, 6, -17, -14, 27, 4, 15, -68, 37, -8, 10, 8, -29, -63, 10, 26, 8, 26, 19, 26, 43, 1, 14, -21, -3, -28, 33, -47, 11, -3, -19, 43, -27, -5, -101, -38, 20, -35, 30, 50, 6, -82, 7, 32, 27, -22, 0, 8, -67, 15, -3, -38, 25, -25, 5, -1, -52, -31, 2, 34, -18, 4, -3, 46, -25, -3, -75, -8, 18, 18, 20, 65, -1, -95, -46, 11, 12, 12, -4, -51, 21, 43, 24, -112, -7, 22, -36, -17, -65, 13, -16, -2, -49, -83, -13, 1, -93, 29, 15, -19, 16, 14, -31, -23, -19, 4, -27, 5, -4, -13, -65, 26, 11, 68, -7, -27, 43, -19, -4, -6, -5, -37, 22, -21, -10, 19, -45, 9, 0, -17, -54, 5, 21, -78, 38, -51, 9, -44, -4, 1, -22, 16, 0, 26, -36, 43, -1, -44, 33, -82, -71, -13, -63, 10, 45, 4, 9, -10, 0, 9, -16, -19, -41, -10, 3, -35, 28, 30, 18, -127, -24, -15, -12, -45, 16, -32, 20, 40, 37, -67, 4, -7, -44, 82, -47, 22, -6, -30, -19, -91, -85, -23, -79, -20, 42, 5, 6, -7, -7, 24, -45, 5, 63, 2, 35, -17, -27, 38, 10, -6, -6, -10, -48, 69, -6, -16, -20, -69, -10, -64, 21, -9, -57, -79, 25, -59, -63, 12, -28, -54, -2, -14, -10, -14, 28, 26, 12, -6, -38, 30, -76, -40, -52, -89, 26, -56, -47, -20, -6, -99, 61, -28, 29, -46, -50, -5, 48, -50, -79, 55, -1, -55, 32, -7, -9, -122, -20, -3, 46, -38, 23, -61, -29, 52, -4, -101, 17, -27, -70, 37, -31, -18, 13, -42, -59, -80, -80, -4, -48, 12, 15, 10, 23, -38, 31, 8, -9, -33, -16, -7, -50, -21, -2, 19, -5, -74, 13, -15, -2, -11, -20, -29, 10, 6, 16, -20, 20, 52, 23, 14, 12, -15, -38, 15, -1, 22, 29, -1, 14, -21, -34, -1, -28, 45, 13, -19, -38, -72, -3, -18, -12, 2, -12, 3, -17, 1, -2, -5, -2, -23, 5, -22, -12, -63, 7, 8, 1, 27, -87, -5, -38, 9, -14, 9, 11, 40, -8, -1, 16, -45, -25, 12, 0, -2, 19, -13, 6, -48, -18, 3, 5, 14, 21, -4, 12, -4, 27, 18, -28, 12, 15, -13, 22, -1, 9, 17, 1, 4, 11, -33, -37, -28, 18, -36, -4, 9, -45, 27, -25, 13, 15, 8, -33, 2, 12, 13, -30, 10, -44, -27, -5, 54, 33, 18, 26, -15, -47, -1, -33, 35, 6, 42, -62, -5, 23, -9, 13, 4, -5, -11, -6, 3, 5, 14, 9, 14, -16, -1, 3, -66, 4, 4, -1, -6, -59, -11, -57, 9, -26, -10, 35, 40, -39, 5, 48, -12, -8, 6, -7, -24, 1, -40, 3, -55, 10, -9, 7, 16, 22, -11, -1, -2, 15, 22, -17, 6, 26, -21, 37, 10, -1, -13, 7, -8, 15, -23, -50, -17, 31, -32, 8, 19, -39, 5, -22, 8, 7, 21, -39, -2, 0, 18, -45, 23, 10, -42, -18, 14, 42, 43, 12, -30, -29, 13, -12, 43, -4, 74, -127, 10, 22, -2, 26, -4, 9, -9, 3, 6, 30, 36, 26, 30, 0, 18, 15, -37, 22, 33, -8, 0, -35, -2, -18, 15, 11, -9, 19, 44, -54, 31, -1, 1, -56, 10, 8, -59, 9, -39, 5, -20, 1, 0, 8, 0, 9, 18, -2, -7, -1, 5, -6, -2, 26, -57, 35, 6, 27, -1, -14, 20, 12, -64, 37, -37, 34, -14, 21, 12, -22, 18, 12, 19, -19, -29, 17, -53, 22, -64, -14, -4, -12, -12, 12, -11, -19, 5, 3, 22, 4, 24, 10, 12, -51, -89, -48, -70, -19, -18, -52, 4, -6, 34, -25, 52, -30, 15, -7, -42, 38, -77, -12, -87, -6, -20, -23, -25, -91, 36, -42, -15, -56, -51, -16, -16, 7, -106, -46, -78, -41, -32, -16, 55, -2, 54, 15, 23, -57, 44, -18, -17, 1, -76, 34, -41, 59, 22, -23, -6, -82, 56, -45, 19, -60, -4, -17, 64, 35, -51, 2, 15, 16, 7, 0, 17, 8, 41, -2, 12, 43, 18, 26, 11, 1, -62, 0, -1, -1, -31, -30, 97, 9, 25, 43, 19, -2, 41, -7, 60, -54, -56, 42, 26, -10, 27, -79, 19, 25, 4, 18, 8, 17, 38, 16, 9, 4, -3, -4, -121, 6, -51, -66, 20, -17, 29, 17, 21, -64, -36, -42, -22, -72, -34, 40, 18, -25, -3, -127, -21, 23, -27, 8, 6, -25, 8, -37, -9, -40, -106, 21, -51, 43, -48, -50, -28, -101, 43, -25, -4, -90, -74, -38, 28, 66, 6, 36, -7, 26, 14, 29, 10, 29, 10, 22, -9, 13, 18, 33, 15, -46, -100, 17, 2, 10, 39, -31, 13, 14, -7, 7, -15, 60, 43, 62, 22, -25, -4, 15, 29, -45, 44, -111, 19, 41, -40, 38, 18, 4, 21, 59, 22, -37, -15, 18, -1, 4, 34, -47, -26, 17, 3, 32, -59, 26, 5, 20, -4, -73, -54, -14, 43, -59, 15, -117, -30, 20, -48, 5, -39, -18, -32, 9, 23, -5, -44, 21, 26, -15, -10, 7, -37, -29, 1, 8, 12, 12, -18, 18, -13, 28, 27, 20, -122, 15, -13, 1, -26, -39, -36, -15, 5, 9, 2, -3, -16, -27, 33, -16, -18, -48, 11, 4, -33, 23, -25, -31, 16, 14, -5, -3, -7, 12, 18, 39, -118, 33, 23, 23, -58, -51, -50, -44, 30, -41, 4, -25, -51, 13, -12, -54, 37, -62, -49, -1, -41, 11, 19, -35, -19, 15, 10, -31, -78, 13, 0, 43, -127, 42, 37, 2, 29, -13, 31, -4, 20, -47, 6, -37, -13, -23, -2, -9, -13, 42, 2, -14, -8, -43, 14, -16, 15, 21, 22, -81, 14, 1, 24, -16, -35, -16, -14, 3, 22, 0, -51, -10, -6, 36, 5, 19, -8, -8, -18, 15, -22, 11, 18, -4, -49, 44, 15, -11, 5, 5, -37, 39, -18, -37, -1, 8, -13, -14, 2, 8, -43, -21, -45, -23, -9, 30, -25, 0, -34, 6, -14, -33, 0, -37, -51, -3, -75, 9, 11, -65, 22, -18, -25, 28, -25, 13, -47, -25, 31, -4, -20, 6, 6, -22, 47, -58, -2, -28, 3, -48, -10, -10, -18, 8, -5, 16, 24, -6, -9, -18, -26, 7, 38, 8, 21, -18, -2, 37, 49, 66, -101, -47, 34, -65, 85, 24, 56, 31, 21, 43, 10, 58, -9, 40, -9, 24, -41, -4, 21, -32, 1, 28, 51, -38, -81, 2, 33, 93, -66, -124, 11, 4, -117, -49, 37, -15, 27, 46, -31, 64, 20, 38, -8, 63, 17, -10, -64, 47, -61, -16, 9, 2, -61, 24, 52, -61, -25, 11, -45, 80, 0, -27, -28, -2, -22, 6, -13, 17, -45, 23, 1, -89, -9, 10, 18, -19, 4, 27, -13, -35, -1, -3, -18, 20, -23, 17, -59, -5, 27, -27, -32, -66, 12, -10, -7, -48, -127, 12, 14, -31, 26, 24, -3, 23, 27, -20, 15, 20, 19, -1, -19, 17, 0, 13, 16, -49, -12, -20, 20, 7, -3, 9, -5, 16, 25, -40, 1, -30, -70, -27, 21, -31, 9, 36, -39, 25, -11, 7, 13, 13, 39, 23, 15, 30, 10, 42, 30, -38, 12, -4, 13, -4, 1, 1, -9, 14, 32, -41, 13, 29, -103, -68, 24, -6, -1, 12, -8, 14, -82, 39, 22, 22, 23, 30, 18, -7, -9, 2, 13, -3, 11, 15, -23, 4, 27, 31, 26, -19, 7, 6, 23, -39, -16, -15, -6, -3, -24, 18, -29, 9, 8, 28, 20, 0, 31, 39, -1, -7, 48, 15, 15, -15, 32, 25, 2, 33, -21, -21, -30, 5, -6, -6, 7, -40, -36, -12, 0, -1, -5, -3, -32, -3, -17, 2, -11, 1, 29, 13, -1, 6, 15, 14, 32, -13, 6, 15, 0, 11, -25, -13, 25, -8, -10, 27, -3, -10, -41, -29, -14, -17, 9, -8, 18, 3, -28, -16, -14, 11, -1, 28, -26, -6, -8, 8, 20, 0, -19, -6, -18, 16, -23, 24, 47, 28, -20, -24, -3, 10, -43, 7, -21, -9, -46, -41, -33, -36, -14, 0, 42, -12, 16, 6, 50, 11, 20, -15, -25, -12, 28, 41, -37, 37, -12, -17, -13, -16, 17, 30, -4, -10, -61, 37, -55, 16, -17, -68, -28, -52, 5, -33, 13, -55, -1, 17, 23, -42, 22, -44, -10, -13, 18, 3, -31, 24, -14, -27, 18, -62, -41, 68, -54, -6, -18, 33, -29, 6, 47, -39, 7, -7, 40, -50, -7, -22, -57, 15, -3, -37, 0, -14, -29, -17, 12, -36, 15, -38, 23, -16, 61, 53, 14, -29, -23, -32, -109, -29, -36, -3, -64, -7, 39, -9, -20, -31, -7, -9, -90, -24, 24, -33, 29, -6, -52, 17, 32, -17, -21, -1, 18, 7, 41, -41, -38, 24, -19, -45, -93, -34, -33, 23, -72, 11, 3, -63, 3, 3, -40, -20, -71, -27, -1, -55, -79, -1, -56, 33, -10, -20, -27, -113, -28, -38, -30, -80, -45, -11, -20, 20, -114, -26, -36, 18, -50, -1, 15, -60, 60, 16, 0, -31, 15, -26, 10, -10, -32, -4, 28, 21, -15, -16, -3, -102, 3, -127, -118, -101, 50, -55, -13, 25, 81, 48, 8, -32, -91, 45, -18, 4, -8, -7, 17, 4, 0, -10, -30, 6, 18, -1, 29, 2, -41, -24, -45, 26, -8, -18, 27, 29, -22, -81, -17, 2, 103, 56, -8, -28, -41, 27, 13, -41, -27, -8, -69, -20, 15, 37, 6, 10, 51, -23, 43, -28, 57, -7, 14, 35, -33, -11, 32, 9, 38, -11, 5, 7, 91, -12, -39, 16, -30, 21, 28, -9, 20, 0, -1, -38, -3, 42, 34, -8, 59, 10, 62, -6, -5, 22, 18, 44, -10, -28, -4, 21, 46, -5, -15, 16, 27, 60, -1, -27, 5, -4, -2, -30, -30, 8, 9, 8, 30, 2, 0, 23, 34, -34, 14, -19, 54, 17, -46, 49, -14, 21, 49, 2, -8, 18, -49, -20, 80, 10, -8, -27, 30, -15, -14, 6, 8, -40, -26, -13, 9, 15, 21, -22, 46, -28, -37, 4, 38, 6, 18, 38, -91, -7, 30, -4, -47, -14, -3, -14, 51, 4, 10, 13, 21, 22, 13, 13, 37, -21, -25, -5, -1, 12, -12, 2, 50, -9, -19, -8, 40, -14, 25, -14, -33, -29, -13, 30, 56, 46, -14, 1, -1, -67, 7, -59, 32, 26, 13, 12, -27, 9, -16, -9, 12, -50, -40, 28, 2, -12, -28, -63, -8, -6, 7, 12, 43, 3, 17, 8, 25, 30, -15, 3, -2, -28, -12, 14, -69, 0, 13, -17, -51, -3, 22, 8, 21, 16, 49, 19, 18, -78, -26, 1, -9, 20, -76, 8, -41, -16, -1, 13, 16, 12, -26, 31, 11, -4, 6, -8, -13, -63, -10, -78, -34, -43, 37, -50, -9, 18, 35, -46, 9, 16, -17, 6, 17, -25, -40, -19, 31, -20, -2, -1, 4, -4, 38, 65, 17, -49, -2, -22, 24, 25, -5, 10, -20, 50, 35, 7, 7, -52, -110, 12, -6, 17, -5, -9, -27, 32, -16, -12, -4, -27, -30, 3, -30, -112, 15, 19, 13, -48, -41, 29, -71, 2, 29, -41, 31, 41, 52, -19, 7, -6, 14, -27, -26, -19, -1, 25, 2, 32, -73, -21, -3, -31, -41, -7, 14, 20, -11, -28, 0, -8, -52, 2, -10, -59, 29, -42, -38, 28, 22, -50, -43, -13, 4, -95, -11, 33, -15, 16, 33, -17, -63, -22, 27, 1, 6, -24, -4, 49, 24, 45, -16, -48, 9, -78, 51, -14, 60, -3, -25, -21, -62, 26, -9, -51, -70, 26, -34, -4, 9, -54, -30, -30, -62, 0, -63, 50, 53, 45, -70, -42, 38, 24, -63, -24, -5, -5, 57, -30, 80, -8, -89, -8, -38, 30, 17, -56, -8, 57, -60, -103, 30, -16, 5, -1, -127, 29, -70, 28, 15, 19, -31, 22, 59, 25, -1, -6, 37, -9, -17, -9, -27, -41, -36, -8, 22, 38, -6, -8, 12, -41, 7, -9, -2, -8, -13, 4, -18, 11, -15, -8, -14, 27 };
+static const int32_t conv4_b[32] = { -67, 101, 110, 215, 145, 34, 49, 290, 65, -199, -22, 4, 41, 40, -284, 268, 82, 109, 2, 107, 51, 192, 217, 102, 253, 82, 44, 139, 128, -65, 81, -9 };
+static const int32_t conv4_m[32] = { 1096348281, 1367775074, 1831218080, 1317201690, 1836370735, 1166512461, 2037623856, 1161562081, 1893174042, 1335980103, 1482846755, 1094944496, 1984876113, 1136776961, 1270310868, 1584653256, 1465065621, 1651704080, 1751908709, 1432884665, 1594244110, 1320318606, 1175295189, 1186446316, 1767199716, 1487586762, 1135528896, 1361118403, 1485121065, 1751047816, 1552855075, 1500655948 };
+static const uint8_t conv4_s[32] = { 41, 39, 39, 39, 39, 38, 39, 39, 39, 41, 39, 41, 42, 41, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 39, 39, 38, 39, 39, 39, 39, 39 };
+// conv5: input scale 1.17754, output scale 1.36987
+static const int8_t conv5_w[64][3][3][32] = { -5, -22, 25, -63, 1, -58, -59, -94, 6, 5, 24, 3, 2, -2, -17, 36, -4, -33, 15, 1, -39, -2, -7, -65, -11, -78, -3, -49, -3, 23, -63, -127, 1, 29, 42, -12, 8, -59, 4, -64, 2, -3, 18, -5, 4, -1, 3, 3, 12, 11, -17, 31, -27, 12, -44, 2, -20, -38, 22, -22, 62, 35, -11, 5, 6, -4, -35, -10, -59, -31, -4, -16, 13, 3, -15, -4, 4, 0, 10, 28, 9, 0, -25, 21, -12, -14, 14, 29, -30, 17, -8, 4, 40, 8, -37, 19, 9, -10, -27, -47, 20, -44, -38, -72, -21, 0, 21, 2, -3, -6, -38, 35, -6, -11, -1, -85, -81, -17, -39, -84, -25, -23, -10, -73, 15, 23, -25, -38, 0, 15, 12, -59, 30, -47, 24, -114, 18, 12, 34, 3, -3, -7, -19, -2, 10, -44, -9, 34, -68, -41, -46, -29, -68, 3, 4, -70, 35, 40, -64, -49, 3, -20, -39, -4, 1, -1, 8, -28, 22, 3, 2, -5, -7, 8, 25, 13, 6, -17, 14, 48, 0, -3, 33, 5, -84, 18, -11, -10, 45, 8, -39, 17, 8, -33, 17, -94, 5, -46, -35, -100, -45, 6, 14, 0, 2, -8, 28, -6, -37, -31, -6, 5, -39, -106, -12, -39, -75, -47, -30, -37, -21, 33, -3, -14, -1, -14, 37, -33, 17, 17, 6, -26, 10, 1, 11, 1, 6, -8, 8, 3, 7, -88, 4, 23, -98, -63, -20, -14, -45, -29, 14, -20, -52, 8, -21, -32, 3, -15, 9, 2, -21, 23, 0, 5, -15, 6, -20, 9, 1, 3, 16, 31, 9, 9, 30, 33, -69, 29, -33, -17, 22, 1, 22, 21, 53, -16, -44, 13, -2, 10, -6, 15, -16, 22, 10, 20, -1, -5, 19, 1, 2, 0, -30, 5, 28, 13, -29, -24, -3, 1, -2, 8, 23, -11, 5, 5, 33, 14, -9, 8, -8, 0, 2, 13, -5, 17, 18, -34, -2, -3, 20, 1, -4, -5, -24, 0, 22, 7, -29, -44, 25, 4, 9, 26, 11, -11, -39, 17, -6, 7, 21, -4, 1, 29, 11, 25, -21, 15, 12, -51, -2, -2, 5, 0, -11, 5, -12, -8, -38, 3, -11, -30, 19, 12, 12, 9, 8, 20, -18, -6, -27, 3, 15, 16, -2, 0, -7, 10, 0, 10, 17, -17, 26, -11, 19, 1, 7, -8, -45, -30, 16, -18, -63, -18, 6, -13, -17, 11, -6, -15, -19, -6, 10, 6, -13, 19, -8, -12, 14, 7, 6, -39, 16, -108, 4, 2, 5, -4, 9, -9, -42, -32, 5, -18, -10, -44, 15, -9, 17, 14, -15, -6, -33, -14, -35, -1, -4, 8, 3, 2, 8, -4, 14, -91, -4, -50, -8, 3, -11, -2, 4, -8, -5, -16, -71, -8, -7, -30, 29, 10, 22, -6, -45, 22, -40, -95, -61, 7, 8, -4, -1, -6, -19, -27, -11, -9, -8, -61, 18, -5, 8, 4, -9, 0, 0, 9, -15, -11, -77, -36, 4, -29, 11, 17, -24, 14, -21, -15, -13, -1, -14, 8, -7, -2, 29, -20, -4, -20, -7, -39, -3, -4, -8, -3, -1, 4, 4, -15, -24, -25, -37, -14, 7, -28, 31, 23, 4, 1, -61, -52, -49, -6, 25, 1, -6, 19, 17, 22, 18, -62, 6, -5, -42, -7, -30, 7, 3, -9, 9, 9, -127, -3, -8, -15, 12, 15, 13, -12, 18, 14, -45, -65, -28, -3, 36, -8, 5, -6, -27, -3, 0, -7, 19, 16, 21, -6, -32, 8, 4, 3, -9, -3, -7, -7, 4, 27, -30, -8, 2, 23, -30, -1, 34, -58, 32, -31, -76, -3, 11, -50, 32, 46, -7, 10, 43, 7, 3, 2, -30, 2, 5, -4, -6, -8, 0, -2, -1, 12, -33, 2, -4, 26, -38, 29, -3, -53, 62, -13, 5, 1, -6, -22, 43, 20, -49, 23, 25, 19, -12, 0, -38, -8, -3, -8, -10, -56, 10, -13, -19, 6, 14, 3, 24, 15, -14, -26, 14, 4, 5, -26, 33, 4, 6, -14, -42, -97, 16, -51, 16, -53, 17, 4, -6, -10, 12, -5, -55, -19, 2, -65, 10, -7, -61, -38, -127, 17, -39, -39, -10, -83, -24, -19, -66, -42, 4, -4, 7, -42, 26, -47, 33, -23, 16, -8, 5, -1, 1, -6, -2, 28, 3, -7, 2, 26, -12, -9, -94, 10, -71, 40, -13, -71, 30, 15, -70, 5, 5, 21, -46, -37, 33, -20, 9, -22, 22, 1, 18, -8, 0, -10, -36, 1, 19, -11, -28, 25, 26, -29, 10, 25, -56, 38, -4, -68, 12, 11, -27, -4, 0, -28, -55, -47, -3, 9, -16, 2, -6, 5, -15, -4, 1, -2, -27, -40, 0, -12, 22, 16, -92, -58, -89, -14, 38, -64, -13, 31, -45, -37, 29, -88, 3, 6, -15, -30, -10, 12, 1, -5, -14, 7, 5, 0, -4, 2, 7, 8, 33, -21, 19, 8, -21, -20, -82, 5, 43, -37, 13, 23, -26, -36, -53, -107, -1, 34, -43, -28, -2, 31, 21, -3, -9, -1, 15, 0, -3, -1, -38, -9, 30, -13, -7, -46, 19, -35, -2, 42, 41, -15, 12, 42, -25, 10, -40, -32, 2, 4, 39, 4, -60, 30, 2, -14, 10, -4, -30, 8, 6, -6, -17, -12, -22, -6, -16, 2, 20, -5, -30, -24, 8, 30, -86, -22, 3, -19, 29, 19, -7, 23, 26, 18, -38, -36, -49, -47, -56, 9, -59, 8, -4, -8, -16, -16, -105, -2, 15, -14, 3, 9, 7, -39, -2, 24, 23, -21, -2, -6, 0, 9, 0, 23, 5, -2, -10, -42, -50, -46, -18, 3, 11, 5, 8, 7, 20, 4, -21, -8, 12, -11, -13, -4, 16, 39, 22, -10, 7, -11, -26, 15, -86, 2, 8, -17, -1, 15, -71, 14, 6, -10, 3, 4, -32, 2, -9, -2, 14, 19, -12, -2, -22, 3, -4, 6, -26, -23, 18, 21, -46, -15, 25, -31, 8, 25, 8, 27, -17, 14, -61, -32, -41, 1, -63, 4, -127, -3, -6, 3, -15, 32, -70, 30, -2, -16, 2, -25, -2, -104, 10, 30, 37, -62, 22, -9, -6, 16, -3, 14, -10, -22, -26, -90, -72, -39, -29, 3, -17, 8, -7, 3, -6, 32, -60, -9, 28, -8, -15, -23, 36, -23, -2, 10, 26, -51, 17, 7, -9, 27, 7, -22, -9, 4, -57, 14, -7, -21, 10, 0, 25, -2, -7, 5, 8, 1, 0, -17, -14, -10, 22, 4, -28, -6, -47, 29, -57, -9, -9, 27, 19, 20, -7, -20, -30, 6, -22, -26, -19, -50, -49, -2, -42, -7, 12, 2, 17, -2, -96, 15, 3, 6, 14, -2, 10, -95, -20, 2, 24, -85, -14, -19, 29, 25, 8, 32, -1, -1, -26, -55, -12, -66, -50, 11, -27, -1, -3, 3, -7, -11, -43, -24, 10, -8, -26, 15, 19, -45, -9, -17, 38, -42, -69, 2, -4, 7, -2, -9, 18, -7, -1, -28, -37, 2, -6, 9, -32, -5, -1, -4, 13, -31, 3, 1, -10, 22, -65, 24, -2, 16, -30, 9, 30, 21, -6, -43, -66, 18, -1, -1, 20, 11, 9, -21, -58, -2, 18, -1, -6, -6, 4, 0, 15, 14, -24, 24, -1, -16, 5, -2, 27, 40, -14, 19, 33, 19, 9, -26, 6, 5, 4, -11, 14, -27, 7, 2, -88, -19, 34, 7, -57, -4, 4, 4, 8, 25, -7, 42, 1, -48, -7, 13, 28, 40, -26, 9, 5, -1, 11, -34, 5, 3, 2, 0, -17, -26, 2, -72, -53, -28, -32, 3, -5, -4, -3, 3, 30, -39, -50, 6, 8, 0, -14, -16, 22, 28, -21, -30, 13, 10, -31, 3, -6, -10, 5, -7, 13, 20, 18, -77, -90, -48, -39, 0, -44, 6, 8, 4, 30, 13, -27, 26, 15, -7, -15, 9, 21, 27, -11, 9, 20, 6, -28, -25, 11, -14, -8, 5, -13, -14, 17, -94, -127, -57, -20, 11, -29, 0, 5, -7, 24, 18, -29, 19, 0, -31, -18, -32, -8, 36, -36, 3, 0, -8, 4, -45, 19, -19, 2, -1, -22, -9, 4, -38, -42, -47, -31, 3, -21, -6, 0, -4, 33, -39, -51, 19, 17, -8, -12, 5, -10, 26, -30, -51, 36, 33, -40, -2, -72, -8, -2, -19, 23, 9, 12, -74, -57, -38, -20, -10, -28, -1, 1, -2, 26, -4, -51, 25, 26, -5, -9, -3, -4, 17, 0, -19, 32, 16, -23, -2, 2, -26, -4, -6, -8, -10, 22, -72, -84, -24, -14, 2, -19, -7, 2, -7, -2, 3, -13, 30, 12, -28, 11, -6, -1, 18, -20, -11, 1, -5, -3, -21, 5, -17, -7, -23, -2, -4, 20, -7, 7, -2, 3, -4, 16, 2, -1, -4, -54, -15, 0, -1, -35, -2, 4, -9, -36, 11, 1, 15, -32, -3, -4, 4, 8, 16, -4, 18, 0, -5, -23, -14, 8, -6, -7, 8, -12, -1, -4, -2, -8, 11, -11, -1, -32, 1, 13, -10, -8, 9, 11, 14, -31, 12, 9, 3, 29, 16, -2, -12, 9, 21, -15, -20, 6, 13, -30, -1, 14, 2, -1, 0, -2, 10, -21, 6, -7, -4, 16, 5, 3, -48, 8, 9, -28, -15, 19, 7, 9, -16, 2, -21, -5, -2, 1, -8, 17, 0, 20, -9, 8, 3, -2, 1, -21, -5, 17, -2, -65, 1, 2, -10, -38, 6, -5, -5, -40, -7, 11, -2, -9, 14, -5, -31, -16, 10, -27, -10, 2, 14, 16, 7, 4, 1, -4, 2, -25, 21, -10, 8, -45, -1, 0, -36, -31, -4, -3, 22, -68, 7, 16, -12, -2, 13, 1, -22, -6, 15, -8, -23, -3, 27, -8, 9, -23, -5, -2, 4, -11, 11, -8, 6, -16, 18, 18, -43, 16, -22, 1, 17, -30, -49, 5, 2, -12, 6, -6, 8, 0, -25, 9, -18, -2, -16, 21, -9, 13, -1, 4, -2, -51, -30, 6, -6, -81, 14, 14, -12, -31, 2, 4, -11, -64, -17, 10, 12, 5, -9, 2, 10, -24, -20, -1, -51, -5, 2, 8, 2, 24, -4, -1, -8, 3, -33, -3, 8, -76, 17, 13, -40, -36, 0, -12, -7, -127, -28, -17, 12, -18, -10, 5, 9, 3, 2, -7, -37, -5, 21, -15, 10, 2, 5, -2, -4, 2, -6, -35, 2, -9, 14, 34, -60, 21, -38, -20, 14, -56, -33, -5, 6, 2, -9, 1, 24, 27, 7, 0, -23, -17, -22, 25, -10, 19, -1, 2, 0, 11, 56, 15, 7, -24, 14, -9, 44, 6, 30, 33, -57, -19, -6, 30, 11, 18, -42, -4, 2, -38, -11, 8, -44, -8, -1, 17, -7, 10, 4, 3, -9, 11, 25, 5, -34, 14, 10, -16, 7, -27, -2, 14, -16, 11, -12, -41, -3, -27, -48, -4, -9, -39, 50, -7, 19, 3, -2, 0, -8, -19, -7, -1, 7, 5, -3, 2, 3, 45, -3, -55, -1, -1, -32, 21, -33, 42, -12, 6, -2, -37, -53, -6, 10, -30, 36, 7, -51, -36, -21, 17, 4, 12, 5, 2, 4, -33, 25, -36, 22, -16, -7, -10, -35, 4, -16, -2, -57, -12, -29, 0, 20, -45, -106, -7, -28, -22, -10, -11, -25, -42, -35, 12, 1, -36, 1, 3, -2, -43, 12, -1, -5, 44, 45, -16, 35, -59, -59, 10, -34, 42, 15, -91, -23, -76, -41, -9, 20, -95, 60, -21, 15, -5, -29, -41, 8, -20, -4, -7, 6, 0, 3, 7, 31, 73, 9, -19, 40, -40, -46, 10, -45, 55, 39, -33, -2, -22, 3, 7, 9, 1, -31, 24, -31, -51, -38, -23, -9, 3, -9, 10, -2, -22, -5, -57, 9, -3, -10, -8, -69, -16, 0, -7, -15, -52, -3, -12, 0, 14, -44, 1, -16, -76, -44, 3, -4, -49, -49, -37, 3, 8, 5, -3, 2, -14, 6, -12, -45, 29, -10, -25, -1, -45, -79, -5, -11, 18, -27, -65, -5, -40, -24, -9, 24, -127, 29, -14, -10, 4, -7, -23, -8, 2, 6, -5, -5, -2, 24, -3, 9, 48, 6, -2, 9, -44, 7, -11, 8, 43, -6, -9, 14, -45, 9, -6, 9, -32, -12, 4, -37, -48, 27, -20, -2, -16, -2, 7, 1, 3, 31, -114, 6, 5, 34, 22, -65, 10, -26, 18, 28, 8, -12, -9, -5, 30, -11, 2, -50, -45, -5, 0, -85, -58, 32, -93, -4, -106, 1, -2, 0, -18, 24, -120, 5, -23, 33, -32, -127, -1, -18, 28, 22, -19, -4, 16, -72, 4, -26, 6, -24, -14, 18, 17, -42, -38, 37, -93, 2, -28, 4, -5, 0, -48, 14, -56, 1, -27, 4, 1, -70, -9, -10, 29, -13, -45, 13, 1, -20, -4, -54, -4, 14, 5, -8, 2, -9, -42, 13, -1, 0, -2, -3, 3, -3, -11, 14, -46, 16, 2, 19, 5, 38, 4, -11, 18, 7, -10, 0, 10, -11, -3, 8, 4, -33, 2, 10, -4, 1, -29, 27, -35, -7, -19, 1, -3, 1, -16, 24, -79, 3, -55, 7, -61, 14, -13, 29, 24, 17, -22, 3, 17, -14, 0, -10, -4, -4, 2, 14, 4, -30, -31, 14, 6, -2, 7, 5, -1, 0, -16, 21, -75, 23, -72, -50, 26, 0, -24, -2, 15, 29, -40, -16, 9, 6, 6, 10, 3, 14, 28, -9, -16, -4, -7, 14, 5, 4, -6, 7, -6, 0, -28, 3, -18, 25, 2, 13, -31, -2, 8, 0, 12, -22, 5, 11, 21, -18, 24, -2, 4, 13, 11, -2, -24, -13, -19, 14, -31, -5, -4, 1, 1, -6, -16, 0, -40, -7, -81, 0, -13, 0, -3, 33, 18, -14, -40, 12, 13, -12, 16, -11, 1, -3, 7, 10, -7, -51, -47, -1, -60, -6, 19, 2, 6, -4, -23, -8, -89, 28, -38, -12, 23, -20, -4, -24, 12, 5, -42, 2, -15, -2, 37, 4, 2, -87, 17, 15, -76, 20, 21, 16, -9, -5, -44, -7, -1, -9, -19, -24, 11, 29, 10, -5, -15, 9, -1, -21, 26, -23, -22, 26, 3, -13, 23, 22, -11, -15, 14, 49, -29, -10, 16, 5, -48, -8, -57, -9, -4, -5, -31, -16, -111, 44, 42, -48, -19, 31, 3, -118, 15, 10, 37, -27, 18, 32, 22, 33, -2, 27, 21, 23, -13, 16, -6, 0, -17, 4, -19, -1, -1, 2, 8, 20, -70, 58, 43, 25, -15, 19, 8, -23, 25, 4, 14, -63, -6, 19, -18, 10, -10, 1, -21, -10, -25, -43, 0, 1, 31, 0, 7, -1, 0, 0, -20, -44, -4, 14, -10, -7, 18, -5, -5, 17, -23, 0, -48, 1, -18, -2, -12, -4, -2, 73, -28, -14, -49, -60, -25, -15, -17, 6, -28, -3, -6, 9, 0, -8, -72, 40, 23, -23, 24, -29, 32, -98, -38, 11, 19, -60, -48, 14, 26, 12, 8, 78, -29, -53, 5, -58, -41, -26, -78, -5, -22, 10, 7, 12, -4, -2, -44, 21, 43, -55, 18, -38, 36, -74, -7, -4, 30, -17, -20, 41, -1, 37, -5, -6, -63, -4, -42, 33, 19, -25, 24, 1, 3, 6, -8, 2, -71, -34, 20, 6, 5, -38, 4, -29, -34, 34, 4, 21, -21, -9, 2, -32, -54, -1, 3, 2, -77, 16, -90, 5, 4, -29, 1, -5, -42, 0, 6, 10, -63, 2, -59, 22, 12, -40, -2, -127, -3, -72, 15, 49, 15, -42, -3, -51, -11, 23, 10, 18, -53, 23, -8, -28, -19, -9, -113, 4, -38, -1, 2, -2, -39, 22, -47, 36, 19, -63, 14, -80, 39, -74, 24, 25, 26, -29, 43, -20, -65, 43, 0, 16, -25, -5, -16, -21, -7, -44, 9, -9, -3, -5, -2, 4, 1, 7, 2, -14, -1, -51, -65, 25, -53, -18, 7, -74, 18, 3, -2, -2, -54, 26, 2, 29, -41, 5, -15, -8, 11, -15, 14, -14, 34, 1, 1, -11, 16, 3, 8, 21, 3, -11, 2, 10, -17, 25, -37, 36, 14, -40, -40, 19, -37, 36, -7, 39, -38, 8, -28, 1, -7, -5, 4, -11, 21, -5, -7, 3, 16, -69, -12, 31, 4, 19, 30, -3, 2, 5, -125, -9, 17, -55, -33, 21, -28, 4, -12, 40, -30, -71, 9, -37, -1, -34, 16, -5, 22, -6, 1, -7, -33, -2, 8, -72, 10, 3, -41, -35, -46, 11, 6, -92, -8, -1, -51, 15, -41, -22, 4, 15, -30, -41, 3, 18, -6, 0, 34, -9, 18, -4, 4, -2, -19, -29, 7, -12, 18, 5, -2, -22, -47, 15, -31, -52, 0, -30, -10, 17, -67, -44, -7, 2, -53, 1, -26, 9, 16, 16, 22, -11, 17, -8, -1, 3, 5, -44, -9, 16, 28, 13, -2, -16, -27, 4, -26, -42, 9, -41, 8, -10, -34, -12, 0, 17, -27, -15, -12, -36, -13, -10, 25, -4, -9, 7, -8, 3, -13, -33, -5, -97, 22, 26, -32, -36, -106, 16, -5, -70, 3, 14, -77, -22, -17, -83, 0, -1, -32, 28, -9, 11, 11, 46, 14, -9, -32, 0, 2, 6, -4, -9, -6, 10, 36, 16, -55, 13, -127, -12, 22, -57, 12, 31, 21, -55, -36, -22, -4, -8, -11, 11, -50, -3, 1, 33, -14, -2, -36, -6, 2, -9, 12, -20, -7, 26, 39, 6, -33, 1, -87, -16, 33, -38, 39, 30, 16, -57, -20, 22, -7, 95, -5, 44, 80, 32, 38, 4, -19, 21, 2, -8, -12, -5, -46, 54, -29, 32, -2, 61, 46, -4, 7, 0, 43, -13, -47, -21, 43, -6, -10, 79, 1, -42, -10, -35, 32, -4, 30, -19, -78, 10, -39, 8, -1, -5, -36, 0, -3, -29, 8, 92, -10, 6, -16, 15, -35, 9, 29, 5, 8, -35, -9, 13, -5, -62, -3, -26, 3, -64, -35, 54, -106, 8, -23, 13, 6, 12, -41, 37, -67, -59, -35, -2, -76, -26, 2, 25, -25, 39, -106, -111, -29, -24, 45, -47, -10, -17, 55, 10, 48, -24, 21, -4, -91, 19, -55, -2, 12, -14, -18, -10, -46, 62, 22, -3, 29, -5, 113, 2, 30, 17, -36, 28, 15, -13, 1, 43, -7, -79, 1, -23, 34, -62, 1, -30, -60, 13, -73, 14, -2, -14, -16, -31, 56, -84, -25, 23, 37, -15, 104, 13, -59, -9, -7, 50, -71, -18, 14, -30, 13, -29, -41, -71, 14, -75, -16, -5, -111, 28, -99, -12, 9, -10, -14, 14, -127, -120, -127, -24, 3, -91, 68, -51, -89, -31, -25, -110, -74, -81, 26, -17, 5, 5, 13, 23, 72, 12, -7, -43, -50, 29, -82, 1, -6, 0, -58, 13, -50, 39, -34, -21, 7, 13, 48, 7, 46, 32, 6, 22, 3, -19, 5, 63, 6, 12, 21, -43, 34, -34, -30, -82, -39, 30, -88, 1, 10, 7, -25, 0, 1, -105, -11, -87, 1, -12, 50, -17, 82, 43, -6, 78, 0, 6, 11, 30, -1, -4, 1, -85, 11, -96, -83, -42, 0, 22, -80, -5, -11, 12, -41, -36, -121, -103, -103, -35, 15, -56, 22, 4, 5, 5, -33, -40, -99, -29, 46, -78, 5, 25, -12, -9, 19, 30, 9, 12, 5, -7, 10, -7, 6, 4, -45, -77, 16, -49, 6, -21, -94, -20, -90, 3, -3, -120, 24, -39, -39, -4, -27, -75, 7, 33, -11, 32, -5, 44, 22, -8, 22, -14, 25, -6, -2, -7, -43, -19, 33, -47, 51, 19, -45, -18, -61, -7, -13, 1, -1, -37, 24, -2, -14, -27, -3, 49, -25, 0, -1, 42, 26, 7, 40, -15, 1, 3, -7, -6, -6, -1, 21, -14, -29, 38, 6, -26, -6, 13, -47, 62, 9, -79, 44, -6, -35, 31, 9, -40, -37, -50, 18, -1, 22, -18, -27, -13, -46, -3, 4, 8, -62, -39, -2, -49, 22, -7, -45, -15, -93, -39, 33, -73, 2, -10, -71, -76, -98, -72, 2, 12, -64, -3, 5, 63, 21, 42, -38, -8, -31, 6, 0, 7, -32, -71, 7, -1, 30, -47, 10, -35, -41, -17, 35, -7, 12, 7, -25, -35, -106, -66, 0, 8, -53, -7, 37, 46, 36, -25, -6, -1, -13, -5, -13, -9, -20, -5, 15, -3, -88, -8, -30, -39, 31, -16, 33, 43, -17, -49, 18, -14, -74, 17, 9, -79, -21, 23, -6, 28, 20, 25, -28, -21, -69, 8, -10, 1, -5, -48, 4, -24, 17, -58, -1, 21, -127, -40, 27, -86, 23, 11, -10, -46, -25, -64, -1, -42, -15, 14, -54, 43, 5, 49, -13, 3, -30, -9, -4, 5, -4, -87, 6, 3, 30, -69, -20, 7, 23, 4, 30, 8, 16, 29, -27, -78, -35, -13, 6, -107, -84, 2, -73, 37, 27, -8, -25, -6, -43, -3, 7, 10, 20, -26, 17, 6, -65, -98, 7, -36, 14, -8, 20, 17, -1, 8, -1, -69, 36, 21, 4, -42, -5, -5, -17, 2, 2, 11, 3, 5, -96, -3, -3, 4, 14, -16, 3, 22, 13, 5, -40, 10, 3, -1, -52, 13, -5, -9, 13, -97, -38, 0, -2, -37, -2, -9, -7, 9, -2, 21, 13, 2, -125, -1, 1, -1, 1, -23, 4, 11, 4, -24, -55, 14, 9, 8, -53, 13, -17, -1, -1, -127, -38, -9, 1, -27, 10, -21, -10, 6, -9, 6, 11, 5, -84, 3, -4, 3, 10, -26, 2, 12, -16, -55, -83, 6, 19, 24, -23, 12, -32, 15, -6, -98, -63, -13, 4, -14, -31, 15, 3, 18, 2, -8, -26, -2, -22, -2, 4, -5, -16, -3, 3, 2, 10, 3, -2, -9, 16, -5, 6, 17, 10, -2, 15, -6, -43, 1, 3, 3, 7, 5, 6, 15, 5, -5, -26, 5, -30, 3, -1, -5, -16, -8, -5, 10, 5, -16, 4, -11, 10, 4, 3, -15, 20, -3, 15, -19, -53, 0, -1, 8, -5, 0, -25, 0, 3, 0, -23, 6, -25, 3, -3, -1, -8, -1, 7, 13, -3, -18, 6, -5, 21, 13, 10, -1, 14, -6, 1, -11, -28, -15, 1, -61, -21, 8, -15, 11, 9, -7, -5, -4, -12, -1, 1, -2, -5, 17, 2, -4, 5, -2, -11, -7, -20, 5, 8, 39, 13, 3, 21, -19, 5, 22, -4, -28, -1, 17, -10, 16, 7, -10, -9, -5, -21, -3, 0, -4, 1, 19, 7, 4, 1, 1, -7, -4, -10, -4, 14, 1, 16, -1, 17, -14, 22, 28, 0, -41, -2, 11, -35, 22, -1, 1, -13, -4, -13, 4, 2, 3, 11, 19, 4, 13, -3, -4, 9, 11, 20, -3, 4, -5, 22, 5, 3, -3, 10, 9, -6, 21, 30, -4, -1, -3, -83, -7, -55, 13, 8, 5, -7, 12, -38, 11, -18, 23, 30, -19, 30, -43, 22, -63, -14, -28, 51, -16, -2, 36, -35, 7, -17, 36, 5, 4, -21, 29, -3, -35, -34, 10, 18, 6, 12, 13, -21, -35, 4, 10, 53, 44, -10, -15, -6, 2, -45, -25, 67, -42, 2, 27, -38, -16, -16, 43, 6, 25, -101, 26, 51, 6, -3, 2, 7, 11, -16, 3, -8, -49, -49, 22, -102, 26, 23, -10, -24, 16, 16, -7, 6, -25, 5, -15, 39, -1, 2, 42, 28, -26, -9, -58, -81, -57, -61, 4, -1, -9, 6, -9, -14, 8, -54, 3, 50, 7, -20, -42, 8, -76, -75, 2, 70, -91, 0, 32, -18, 24, -21, 83, -14, 13, -31, 1, 30, -74, -32, 3, -6, -8, -6, -10, 3, -41, -7, 28, 28, 21, -25, -84, -16, -20, -98, 4, 41, -97, 27, 4, -43, 38, -13, 26, -1, 54, -45, 29, 52, -45, -12, -11, -21, -11, -1, -9, -32, -10, -40, 19, -78, -12, 46, -33, -2, 18, -52, 40, 12, -95, 27, -21, 6, 49, 8, 30, 21, -9, 2, -81, -72, -18, -29, 14, 18, 8, 16, 10, 15, 29, -46, 7, 2, 33, -7, -127, -19, -87, -41, 13, 27, -87, 16, 42, -11, 36, 3, 42, 65, 22, 11, -49, 38, -81, -13, 17, 7, 12, -4, -23, 34, 23, -38, 15, 19, 33, 4, -34, -35, -12, -95, -17, 31, -102, 30, 24, -42, 40, -7, 18, 55, 6, 6, -60, 3, -41, -6, 5, 17, 3, -6, 1, 15, 13, -73, 16, -118, -22, 47, -9, -23, 40, -106, 54, -24, -109, -3, -34, 93, 17, -1, -17, -4, -63, 12, -16, -54, 1, 26, -11, -6, 4, 1, 10, -29, -54, -15, 16, -6, -28, -16, 0, -77, -11, -36, -82, -24, 12, -8, -28, 38, 7, -12, 41, 6, 31, -4, 10, -13, 2, 17, -16, -1, -3, -5, -4, 0, -45, 4, -38, 20, -2, 35, 14, -121, -52, 44, -35, 0, 0, -45, -26, -30, -30, -6, 51, 24, 8, -1, 19, 25, 35, 27, -3, 25, -8, 9, 10, 34, 6, 17, -10, 24, 3, 15, 9, -67, -54, 26, -38, 8, 5, -72, 31, -40, -9, -1, -45, -71, -19, -28, -10, -60, -12, 9, -8, -54, 9, -13, -13, -60, 4, 0, 12, 12, -62, -82, 41, -81, -66, 28, -45, -13, 15, -11, -111, -121, -43, -5, -28, -33, 15, -63, 19, -37, 20, 5, -23, -28, 8, 13, -11, -49, -56, 9, -2, 1, -107, -13, 60, -57, -33, 51, -31, 0, 29, -45, -34, -83, -65, 5, 4, -10, 17, -48, 9, 9, -15, -19, -4, 32, 2, -11, -10, 27, 14, 19, -42, 27, -87, 28, 69, 36, -25, 60, -87, 34, -18, -83, 13, -40, -20, -10, -75, -29, -5, -22, -21, -40, -12, -19, -13, -7, -12, -10, 10, -27, -6, 22, 7, 0, -127, -109, 17, -97, 4, 4, -76, 33, 21, 5, 5, -8, 8, -9, -66, -48, 9, -86, -29, 4, 29, 3, -3, 27, -2, 1, 4, 2, -38, -13, 37, -19, -74, -65, 70, -92, 17, 17, -16, -1, -7, -16, 33, -53, 13, 3, -11, -28, 27, -27, -26, -7, -112, -26, -15, 24, 0, 9, -4, 23, 1, -13, 10, -34, -92, 9, 68, 36, 4, -14, -24, -11, -38, -104, 29, 11, -20, 5, 4, 15, 7, -34, 30, 20, -96, 37, -18, 21, 6, -3, 2, -24, -39, 27, -53, -13, -10, 25, 7, -8, 16, -41, -35, -21, -8, -14, -7, -16, 12, -3, 29, 37, -20, -1, -37, 32, -94, -20, 6, 30, 5, -5, 5, 2, -85, -54, 10, 28, -39, 27, 34, 5, 11, -52, 14, -71, -14, -87, 6, 2, 44, 0, 22, 7, -12, 18, -125, -116, 8, -52, -14, -26, 0, 1, 5, 0, 8, -62, 15, 46, 32, 24, -8, 17, -56, 1, 4, 55, 5, -23, -11, 4, 61, 9, 11, 14, 12, -26, -43, 23, 2, 43, 6, 24, -1, 9, -13, -35, -46, 3, -64, -45, -16, 23, -34, 50, 47, 17, -55, -41, -17, 2, 10, -31, -44, 7, -51, 30, -61, -12, -37, 29, 21, 78, 7, 0, 9, 5, 8, 35, -62, -85, -26, -24, -10, 21, -12, 8, 7, -84, -43, -72, -9, -87, 5, -7, -23, -2, -39, -17, -122, 20, -53, -57, 5, -20, 3, -49, -9, 9, -3, 9, 5, -124, -93, 52, 38, 22, -26, -11, -33, -31, -13, 39, -2, -75, -42, -22, 7, 6, 70, 26, -35, -21, -40, -63, -42, -29, -15, -9, 6, 4, -3, 12, -23, -6, -11, -40, -13, 15, -10, 57, 18, -32, 17, -61, -35, -66, 9, -17, -34, -9, 60, 72, -74, -20, 44, -47, -9, -36, -1, -18, -1, 6, -4, 5, -30, -105, -42, -47, 20, 12, -12, 2, -14, -36, -39, -47, -4, -71, -1, -53, -34, -6, 51, 10, -34, 36, -58, -122, 23, -127, -7, -63, -6, -5, -4, 5, 29, -57, -15, 57, 9, -11, -54, -45, -53, -14, 18, 35, 9, -24, -22, -32, -36, 2, 24, -37, -39, 7, -75, -12, -11, -50, 5, 3, 6, 4, -3, -2, 4, -12, -17, -4, -6, 27, -127, 6, 9, -11, 9, 14, -4, -22, 11, -11, 0, 3, -1, -38, -18, 1, -7, -19, -1, -19, 4, -7, 4, -3, 4, 8, 8, 7, -14, -10, -8, -14, -105, -18, -16, -7, -3, 18, -9, 11, -6, 3, -22, 5, 24, -37, 6, 12, 24, 14, -3, 4, -1, 7, 0, 5, -5, 4, -5, 16, -14, 11, -45, -7, -46, -46, 6, 10, -21, 4, -6, -2, 4, 6, -29, 1, -29, 0, -16, 7, -1, -44, 9, -36, -6, -24, 3, -3, 0, -12, -7, -17, -22, -6, -4, 15, -28, -22, -16, 7, -14, 6, -3, -15, 14, -5, -11, -3, -15, -4, -3, -15, 5, -16, 7, -30, -10, -45, -2, 1, -2, -6, -1, -14, -13, -5, 1, -41, -14, -28, -16, 2, -14, -6, 5, -8, -37, 4, -26, -5, 9, 0, 22, -27, 25, -11, 7, -26, -4, -19, -3, 5, -1, 12, 1, -4, -19, 0, -15, -17, 7, -32, -11, 12, -9, 0, 6, 11, -17, -5, -9, 2, -48, 16, 15, -6, 6, -27, 20, -16, 5, -7, 5, 2, -4, 16, 5, -5, 15, 7, 13, -15, -5, -1, -40, 11, 5, 19, 19, 9, -5, -19, -3, 2, -19, 25, 10, -18, 11, -5, 27, 0, -4, 16, 5, 0, -6, 5, 22, -11, 10, 0, 36, -56, 11, 18, 4, 13, 8, -13, 25, 36, 15, -1, 12, 4, 2, 26, 19, -52, 7, 2, 21, 0, -3, 15, 5, -2, 2, 18, 21, -11, 12, -13, 20, -17, 10, 7, -2, 6, 19, -7, 16, 29, 7, -14, 15, -12, -88, -5, -18, -19, 4, 11, -15, 9, 3, -20, -3, 2, 7, 26, 27, 9, -19, 13, 27, -32, 7, 1, -23, -16, 13, -42, -26, 19, -26, -5, 10, 2, -78, 16, 0, -100, 2, 22, -23, 10, -18, -17, -6, 19, 0, 5, 10, 13, -42, -22, 36, -49, -1, 26, -13, 19, 32, -39, -18, 26, -28, 20, 21, 2, -31, 22, 9, -67, -13, 33, 1, 13, -4, -8, 9, 7, -9, -7, 19, 1, -30, -30, 30, -29, 13, 4, -1, 57, 22, -36, 1, 37, -14, 66, 6, 7, -14, 7, -22, -1, 1, 1, -78, 4, -4, 40, 3, 0, -4, 29, -59, 7, -39, -78, 5, 35, 1, 49, 7, 27, -39, -47, -56, -6, 36, -9, -14, -7, 8, 14, -25, 0, 6, 3, -57, 2, -19, 43, 8, -6, -4, 20, -58, -10, -92, -100, 13, 18, 4, 38, 21, 11, -13, -127, -91, -59, 41, 18, -44, 6, 5, 22, -34, -3, 7, -4, -5, -3, -9, 38, -4, 6, 2, -8, -12, -8, -84, -74, 9, 23, 18, 19, 35, -38, -20, -71, -72, -62, 40, 16, -32, 7, -55, -6, 4, -49, 7, -22, -5, -44, -1, -60, -4, -4, 3, -26, 12, -20, -28, -53, -35, 0, -25, 9, -7, 11, 20, -21, 55, 11, -31, -42, 30, 3, -37, 15, 22, -43, 34, -20, -3, -20, 0, -37, -8, -8, -1, -10, 17, -22, -47, -94, -53, 8, -60, 13, 11, -10, 9, -70, -2, 25, -21, -47, 33, -3, -32, 25, 5, -14, 13, -45, 61, -3, -11, -27, -6, 6, -3, 7, 13, -15, -39, -72, -13, 17, -51, 22, 28, -38, 21, -45, -54, 44, -17, -105, 4, -12, 5, -25, -4, -23, -28, -5, 12, -51, 0, -33, -8, 14, 12, -22, 40, -64, 5, 36, 30, 25, -113, 30, -24, 37, 6, 32, 6, -6, 11, 24, 49, 7, 6, -52, -8, -28, -68, -80, 24, -101, -8, -81, -2, 6, 2, -48, 31, -44, 4, 28, 14, -51, -125, 1, -42, 35, -11, 45, 35, -6, -32, 23, -45, -7, 26, -30, 30, -21, -38, -37, -1, -110, -8, -32, 8, -3, 0, -45, -1, -36, 39, -9, 1, 25, -74, -4, -28, 26, 21, 50, 56, 24, 23, 111, -32, 6, -11, -35, -5, 12, -31, -40, 15, -78, 9, -41, -3, 4, 4, -15, 27, -53, 44, 42, -4, 3, 35, 27, -51, -2, 4, 29, -38, 5, -5, 7, 28, -4, 9, -50, -23, -9, -38, -56, -9, -83, -13, -81, 8, -8, -11, -53, 4, -21, 19, 44, 22, -61, 8, 33, -103, -37, -37, 51, -14, -26, 8, -31, -30, -7, -11, -94, 31, -6, -16, -21, -18, -86, -6, -118, 5, 5, 2, -24, 2, -31, 4, 4, 29, -5, 44, 1, -67, -1, 12, 43, -1, -25, -58, -35, -33, 0, -62, -12, -6, -1, -38, -9, 36, -31, 6, -59, 9, 11, 9, 16, 28, -49, 62, 54, 37, -3, -25, -28, -45, -16, -9, 15, 2, 26, -11, 1, 39, -1, -11, -39, 17, 9, -34, -21, 30, -127, -4, 3, -6, 3, 9, -5, 28, -45, 42, 72, 58, -34, -13, 4, -78, -12, -29, 68, -38, 10, 41, -53, 9, -7, 14, -43, 23, 10, -1, -24, 15, -61, 12, -26, -2, -6, -1, 15, -22, -28, 37, 15, 52, 27, 3, -12, 18, -33, -8, 57, 27, 25, -12, 5, -7, -1, 9, -16, 19, 39, -23, 11, -48, 9, -15, 23, -10, -1, -3, 11, -27, -4, -65, 0, 29, -81, -13, -95, -12, 14, -67, -3, -2, -75, -12, -3, -63, 2, 33, 37, 28, -23, 21, -27, 8, -31, -20, 40, -1, 2, 7, -23, -80, 19, 18, -14, 8, 48, 8, -125, -6, 15, -29, 46, 7, -37, 33, 24, -12, 9, -19, -6, -2, -36, -1, 2, 2, -11, 6, 9, 2, 0, -9, 8, -47, -6, 30, 26, -3, 37, 12, -6, 63, -9, -1, 18, -3, 6, 19, 47, 25, -3, -52, 30, 16, 14, 15, -57, -3, -38, -12, -81, -3, -7, -9, -53, -58, -2, -19, 26, -3, -46, -10, -42, -72, 5, -37, 14, 3, -84, -74, -90, -98, -9, -10, -12, 36, -60, 54, -12, -1, -68, 5, -11, -2, 1, -9, -105, -127, 12, 38, 21, -8, 44, 9, -18, -14, -31, -32, 56, -7, -40, 10, -63, -6, 2, -38, -78, -30, -19, 16, -12, -29, -58, -1, -7, 4, -6, -15, -47, -69, -2, 12, -35, -110, 10, -5, 62, 59, -22, 2, -2, -2, 30, 5, -10, 11, 12, -87, 35, 20, 11, -30, 14, -57, 2, -13, -4, -6, 3, -7, -1, -14, 20, -7, -13, -7, -2, -6, -109, -56, -58, -5, -5, 2, -45, -20, -12, -63, 10, -73, 11, 31, -120, -5, 18, 4, 20, 5, 31, -2, -3, 5, -89, -4, 22, 7, -21, 58, 22, -43, -17, 35, -68, 62, 27, -33, 25, 12, -38, 65, -11, -31, -41, 19, -39, 32, 15, -12, -8, -12, 13, 10, -19, -21, -11, 31, -9, 9, -67, 35, -4, -34, -20, 25, -54, 27, -20, 0, 64, -13, -11, 81, 4, 25, -50, -13, -7, -30, -14, -77, -22, -7, 5, 1, 1, 6, -19, 11, 5, -22, -18, -23, -9, -46, -8, -9, -71, -5, -13, -47, -50, -22, -4, -54, -1, -6, -36, -37, -19, -60, -24, -25, -12, 3, 6, -5, 1, 7, -10, 14, -13, -61, -40, -21, -30, -46, 11, -41, -64, -36, -31, -73, -58, 20, -12, -12, -8, -49, -66, -69, 7, -10, -8, 2, -4, 2, -20, -5, -5, -2, -3, -47, -27, 7, -13, -8, -26, -1, -1, 15, -47, -43, -19, -31, -25, -8, -72, -11, -8, -23, 16, 5, -12, 17, 17, 10, 15, 0, -34, -1, -8, 1, 17, -19, 12, 10, 19, 16, 5, 43, -21, -14, -35, -8, -8, 16, 1, -39, 8, -8, -7, -31, 34, -13, -4, 19, 1, 37, -1, 0, -18, 9, 0, -7, 18, -8, -11, 33, 16, 22, -21, 48, 35, -21, -32, 11, 3, 22, 21, -40, 27, 3, 0, -29, 14, -39, -19, 6, 2, 17, -19, -2, -38, -8, 0, -1, 11, -22, -2, 37, -1, 22, -45, 14, -17, 12, -11, -4, -17, 9, 7, -47, 21, 6, -2, 114, 9, 9, 13, 4, 23, 16, 22, 20, 3, 5, -4, 0, 8, -18, 12, 12, 5, 6, 2, 17, 9, -21, 41, -11, -16, 2, -12, -15, -23, -16, -2, 127, 33, -9, 7, -4, -1, 18, 3, 5, 3, 4, -11, -1, -2, -15, 24, 29, 4, -22, -1, 12, 11, -17, 69, 55, -11, -32, -20, -13, 2, 18, -4, 102, 1, -38, 18, -12, -14, 16, 7, 9, 32, 0, 9, -4, -15, -18, -4, 11, 20, 3, 14, 7, 22, -6, 21, 10, -8, 2, -49, 15, 5, -18, 8, -11, -70, 6, 32, 7, 14, -23, 2, 8, -23, 7, -7, -4, -105, 14, 7, 16, -5, -63, -29, -67, -23, 30, -9, 17, -3, -11, 13, -40, -93, -1, 2, 53, -36, 41, 20, -10, 40, -50, -24, -3, -19, 8, 17, -1, -49, -8, 38, 17, 10, -71, -80, -25, -127, 21, 41, -42, 11, 31, -8, -31, -5, -44, -4, 30, 1, 28, -31, -9, 33, -40, -3, -15, 5, -1, -6, -11, -23, -70, 20, 8, -47, -56, 0, -49, -36, 24, 29, 7, 19, -19, -43, 9, -3, -16, -5, -2, -35, 45, -18, 13, 9, 15, -17, -10, -24, -5, -1, -5, -111, 16, -13, 15, 12, -38, -62, 29, -53, -47, 6, 14, 32, 0, 23, -54, -19, 23, 7, 8, -1, 42, -53, -22, 7, -12, -14, 3, 9, -3, 7, -2, -25, -23, 8, 18, 12, -102, 48, 46, -42, -41, 38, -24, 37, 8, -30, 13, -13, -10, -6, -23, -18, -15, -25, -5, -7, -61, -18, -3, 22, 0, 9, -2, -21, -47, -35, 12, -22, -26, 36, 39, 43, 11, -18, -2, 14, -81, -49, 25, -8, -3, -5, 13, 20, 9, -39, -20, 0, 9, -72, 1, -1, 7, -10, 3, -52, 33, -40, 31, -17, -73, 21, 9, -31, -27, 49, 12, 15, -10, 18, 10, -13, -5, -8, 11, 36, 12, -51, -40, -18, -51, -42, 2, 2, -11, 10, 13, 4, -12, 3, 34, -30, 32, 38, 22, 5, 20, -10, 6, 5, -55, -32, 30, 1, 5, -5, -3, 6, -40, 10, 2, 3, -77, 0, -11, 22, 1, 3, -5, -11, -35, -28, -1, -52, 33, 43, -77, 19, 23, -100, 20, -12, -73, 15, 24, -43, -19, 8, -25, 0, -2, -47, 0, -13, -11, 14, -7, -5, 3, -4, -3, -32, -58, 6, -25, -14, -17, -3, 14, -32, 13, -41, -66, -14, 10, -19, -23, -31, 3, 1, 8, -3, -41, -46, -15, -10, -15, 25, 6, 10, -4, -5, -6, -3, -69, 6, -35, -9, 23, -46, 4, -10, -29, -7, -32, -17, -9, -52, -14, -93, -15, 5, 44, 1, -9, -22, -12, -10, -6, 17, 3, 11, 4, -4, 3, -1, -13, -6, -31, 0, 17, -31, -15, -9, -35, -58, -18, -18, -56, -14, -35, -88, -28, -4, 17, 19, 32, 18, 3, -5, 22, 6, -8, 13, -3, -1, 6, -39, -42, -3, 2, -3, 13, -23, -5, -2, -11, 26, -15, -11, 13, 21, 20, 1, 25, 1, -14, 37, 17, 12, -1, -13, 27, 17, 0, -13, -1, -1, 7, -33, -36, -9, 7, 27, 24, -34, -31, -28, -17, -3, -10, 7, 38, 22, -3, -4, 2, 8, -88, 16, 25, -7, 9, 5, 18, 7, -7, -57, 4, -2, -5, -16, -13, -16, 9, 12, 29, -127, 0, -58, -25, 11, -14, 13, 6, 7, -56, 7, -10, 5, 7, 24, -7, 20, -14, -6, -33, 3, 12, 13, 4, 3, 4, -29, -81, -7, 11, -11, -4, 5, -8, 16, 20, -29, 19, -43, -32, 12, 11, 10, 13, 3, -5, 14, -38, 4, -41, -21, -1, 7, -9, 10, 8, -4, 1, -5, -54, -12, 27, 1, 43, -7, -7, 20, -3, -59, 24, -1, -26, -20, 23, 10, 12, -2, -33, 21, 14, -24, -13, 14, 2, 19, -1, 20, 7, 8, 2, 16, -28, -8, -3, -13, 37, -17, -14, 0, 4, -68, -13, 7, -17, -13, 25, 9, -8, 13, -28, 6, -26, -6, -35, 11, -23, -14, 5, -6, 7, 6, -5, -52, -4, 26, -45, -14, 16, -16, -16, -18, -3, -22, 26, -59, -2, -11, -16, -83, -81, -9, -13, 21, -72, -32, -53, -15, 9, 17, -2, -22, 10, 7, -9, -32, -36, 8, 4, -42, 11, -4, 12, -8, -3, 27, -6, -32, -13, 18, -29, -64, -5, -1, -4, 1, -19, -31, -59, 0, -3, 10, 6, -35, -1, 10, -1, -8, -3, 14, 31, -4, -14, 4, 23, 2, -3, 12, 12, -12, -6, 33, -38, -32, -13, -1, -10, -22, -13, -24, -12, 0, -19, -8, 12, 7, 3, 8, -11, -20, 0, 30, -49, -70, -64, -10, -22, 4, 22, 26, 7, -60, 26, 12, -7, -20, -44, -7, 6, 3, -16, 9, -22, -5, -39, 13, 8, -6, 4, 11, 5, 3, 16, 5, -83, -34, 0, -6, -83, 20, 18, 22, -40, -52, 18, -12, 10, -65, -62, 10, -5, 5, -50, 29, 6, 6, -6, 3, 3, 10, -2, -8, -5, -28, -12, 18, -4, -19, 21, 17, -71, 21, -30, -37, -7, 3, -32, -48, 3, -74, -39, 8, 101, 47, -15, 9, -55, -18, -29, -10, -3, 17, 5, -6, 6, -49, -49, -10, -49, -21, -11, 14, -88, -7, -11, 43, 34, -81, 6, -33, 23, -8, 5, -2, 127, 84, 2, -6, 0, -59, -36, 18, 0, 11, 7, -10, 7, -1, -26, -22, 9, -22, 3, 42, -91, -13, -5, 75, 33, -50, -5, -38, 16, -25, -10, 11, 86, 89, 14, 11, -49, -12, -6, 3, 7, 30, -7, 0, -8, 26, -14, -5, -1, -17, 27, 46, -42, 6, -35, 93, -9, -12, -20, -65, 30, 2, 0, -6, 26, -108, -2, 19, -47, -65, 9, -69, -11, -17, -8, -12, -13, -72, -7, -6, 68, 3, -74, 11, -39, -4, -64, 62, -44, 16, 29, 7, -12, -27, -3, -11, 60, -30, -47, 27, -39, -88, -27, 2, -1, 27, 10, 5, -5, -34, 14, 3, 22, 44, -56, 27, -56, 18, -30, 59, -46, 39, 47, 23, 41, -70, -57, -3, 79, -37, -7, 44, 50, 10, -64, 27, 5, 56, 0, 7, -12, 14, 24, 24, -5, 20, 12, 38, -56, -16, 47, -8, -73, 30, -25, 3, 68, -26, 15, 7, -24, -67, 27, -16, 2, -13, -29, -17, 10, -78, -10, 10, -7, -40, -13, 16, 50, 14, -25, 4, -60, 29, -61, 39, -8, 33, 3, -6, -68, -3, 20, 9, 11, -14, 5, -11, -31, -127, -46, -8, -4, 12, 3, 4, 7, -56, -14, -18, 29, -1, 4, -13, -52, 4, -74, 39, -44, -6, 39, 9, 15, -77, -71, -3, 28, 22, -12, 7, -13, -32, -68, 37, -13, 32, 8, 10, -4, 14, 11, 25, -45, 7, 54, -3, -55, 1, -22, 18, -40, 13, -32, 6, 39, -44, -15, 0, -50, -8, -32, -7, -22, 11, -10, -32, 2, -50, -5, -9, -7, -14, 1, 20, 13, -22, -19, 37, -68, 37, 19, -35, 5, 21, 3, -13, -52, -51, -21, 5, -86, -75, -10, -6, -67, -11, -15, -25, 1, -46, 2, 2, 0, -29, -18, -45, 39, 0, 65, -15, -67, 45, -90, -18, -66, -11, 9, -10, -34, -45, -15, 4, -24, 10, 9, 0, -15, -63, 4, 28, 5, -5, 3, -9, 5, 39, 25, -4, -35, 1, 60, -104, -72, -43, -45, 11, 4, -5, 22, 8, 18, -56, -35, -6, -58, -21, 20, -11, 24, 16, 13, 15, -16, -67, -7, -5, 10, -25, -40, 3, 18, 9, 3, -26, 20, 8, -84, 10, -15, -16, 3, -13, -56, 37, -2, 1, -39, -16, -16, -13, 30, -17, 27, 14, 2, -3, 4, -5, -4, -55, -69, -11, 8, 32, -19, -2, 18, 28, -81, -5, 33, -31, -4, -29, 10, 5, 16, -7, -21, -3, -32, -49, 11, -14, 25, -16, -12, -1, 1, -3, 8, 38, -59, -8, 36, 6, 39, -23, 11, 18, -39, -42, 35, -8, -11, -55, -3, -7, -31, -7, -32, -32, 12, -16, -19, 20, -44, -10, -4, -29, 2, -1, -5, -65, -24, 10, 31, 0, 16, 2, 8, -32, -32, 0, -13, 16, 8, -30, -11, -5, 11, -5, -56, -30, 13, -61, -8, 36, -77, -6, -4, -19, -2, 9, 13, -127, -4, 39, -3, 47, -12, -26, -30, -49, 2, -7, 36, 24, 3, -38, -12, -16, 56, 5, -48, -24, 21, -54, -6, 42, -7, 1, 5, -25, 6, -10, -4, -33, -34, 29, -3, -18, -25, -4, -3, -2, 14, -29, 1, 5, -46, -10, 1, -51, 45, -3, 21, 46, -28, -47, -21, 30, -72, 5, -14, 5, -6, 11, -7, 5, 23, 11, -22, 15, -14, 43, -9, -12, -7, -4, -40, -3, -20, 4, 4, -1, 16, -2, -9, -12, -112, -33, -71, 8, -109, 16, -21, 22, -4, -1, -10, -13, 8, 14, -12, 12, -21, 10, -45, -11, 1, 5, 11, 27, -36, -84, 24, -24, 5, 5, 14, 29, -90, -40, -57, -12, -62, 22, -2, 37, 3, 15, -11, 26, -56, 1, -41, -3, -6, 10, -42, -16, 41, -31, -23, -17, -108, -124, 19, -5, -25, 12, -37, -35, 10, 4, -52, -63, -15, 8, 4, -28, 8, 7, 8, -76, -43, 0, -1, -68, -83, -127, 15, -34, -10, -25, -107, -28, -26, -7, -39, -84, -59, 8, -52, 23, 42, 27, 9, -44, 17, 9, -4, -63, -9, 5, 7, 27, 6, -29, -33, -7, -52, -82, -3, 19, 0, 45, -49, 10, 4, 1, -27, -7, -106, -7, -51, 19, -21, 37, 7, -84, 73, -22, -23, 16, -7, -9, 1, 26, -16, -52, 6, 16, 14, 35, -7, 7, -12, 37, -52, -27, 15, -1, -4, 16, -50, -2, 6, -53, -35, 31, -21, -121, 2, -8, 7, -7, 2, 2, 5, -41, -37, -47, -2, -34, -9, -95, -1, -76, -43, -4, -85, -1, -70, 15, -7, -19, -80, -10, 0, -18, 52, 43, 17, -68, 31, -8, -11, -45, 7, 4, 8, -12, 6, -25, 1, 16, 20, -11, 1, 9, -27, 10, -88, 19, -13, -15, -20, -34, -99, 2, -70, 6, -4, 33, -21, -19, 55, -12, -3, -29, 1, 2, 1, -8, 8, -20, -23, 28, 36, 23, -21, 14, -35, 12, -39, -5, 39, 13, -42, -30, 9, -1, -7, -37, -51, 34, -56, -70, -86, -8, -10, -9, 3, -11, 7, -38, -45, -22, -23, -13, -28, -74, -30, -68, 12, -52, -117, -31, -33, -89, 13, -4, -68, -2, -37, 31, 34, 42, -13, -18, 25, 18, -4, -20, 0, 9, -3, 25, 9, 24, -32, 37, 5, -18, -39, -25, 9, -33, -49, 36, -20, -40, 13, 45, -76, 10, -25, -18, 40, 10, -13, 3, 82, 25, -8, -17, -5, 5, 10, 16, 12, -2, 4, 87, 81, -3, -32, 25, 27, 22, -17, 41, 57, 61, -35, 18, -1, 8, 41, -48, 11, -8, 34, 43, -8, 22, 6, 20, 4, -2, 6, -71, -7, 9, 7, -50, 0, 5, 6, 15, 29, -7, -15, -2, -32, 27, 13, -44, 23, -5, 28, 3, 36, -33, 35, 35, -35, 23, 11, 24, 1, 3, -3, -38, -16, -2, -2, -11, 23, 24, -1, 25, 19, -43, -31, -84, -83, -5, 22, -52, 14, -4, 25, 22, 58, -20, 7, 46, 10, 14, -1, 26, -5, 0, 0, 6, -41, -3, -34, -28, 9, 30, 0, 9, 11, -40, -2, -40, -50, 15, 34, -64, 17, -3, -23, -34, 44, -60, -8, 2, -8, 8, 16, -15, 0, -2, 1, -39, 45, 15, -26, -52, 18, -20, -55, -20, 11, -8, -5, -12, -7, 44, -7, -40, 33, -1, -31, 10, 43, -74, -4, 7, 28, -18, -3, -45, -11, 9, 7, -31, 35, -2, -18, -16, 43, -29, -53, 30, -12, 1, 15, -31, 15, 32, -54, -88, 10, -9, -25, -6, 34, -55, 20, -22, 29, -44, 0, -47, 5, 4, 0, -33, -4, -27, -15, -44, -14, 20, -14, 35, 2, 8, -4, -18, 9, 6, -47, -68, 6, -10, -73, -63, -15, -18, -26, -15, -14, 17, 8, -8, 3, -2, -5, 23, 27, -10, -6, 7, 20, -36, -65, -51, 6, -33, -18, 2, -4, 10, 8, 13, -6, -7, -35, -50, 5, -127, -8, 0, 27, -17, 1, -27, -2, -7, -6, 9, 32, -29, -1, 2, 41, -111, -84, -91, -29, -24, 13, 21, 19, 21, -41, -14, 20, 4, -31, -34, 7, -71, 8, 3, 32, -52, -6, -25, -9, 2, -9, -53, 29, -19, -14, -22, 22, -35, -14, -42, 24, 10, -25, -3, 18, 27, -83, -16, 32, 4, 31, 35, 25, -20, 3, 22, -17, -4, 5, 13, 7, 4, -2, 2, -4, 20, 5, -12, -6, -30, 20, 3, -58, 12, -4, 27, -2, -12, 27, 16, -20, -5, -4, 47, -2, -1, 15, 8, -38, -45, 9, 33, 2, -1, 3, 0, -14, -40, 36, -6, 8, 11, 27, 15, -67, -12, 23, -48, 13, -18, 31, 11, -2, 2, 14, -28, -57, 4, -56, -61, 4, -26, 0, 16, 8, 5, 3, 26, 9, -98, 12, -10, 25, 20, 17, 41, -44, -61, 39, -32, -12, -8, 16, -10, 7, 8, -2, 31, 13, -9, -55, 32, -91, -21, 8, 12, -2, 9, 9, 12, -27, -58, 25, -18, 14, 15, 33, 16, -54, 9, 11, 3, -24, -65, 22, 5, 2, -4, -21, 0, -35, 26, -43, 8, 3, -98, 3, 18, 1, -2, 6, -5, -1, -105, 3, -1, -2, 24, -31, 26, -74, -39, 0, 14, 6, -68, 26, -38, -24, -2, 10, -124, -46, 16, -21, -47, 19, -71, 1, -64, -10, 8, 8, -22, 25, -26, -24, -11, -5, 22, -127, 0, -33, -33, 36, -6, -64, -39, -28, -63, 10, -2, 14, -9, -56, 9, -36, -25, -21, -89, -12, 11, 4, 5, 9, 20, 0, -78, -33, -13, 28, 28, 0, 41, -43, -56, 16, -29, -67, -47, 40, 12, -43, -3, -4, -69, -65, 33, -39, -3, 12, -117, -6, -8, 7, -3, 0, -1, 31, -87, -67, -10, 14, 11, -71, 21, -40, 25, 25, 13, 20, -41, 3, -5, -20, -8, 7, -26, -62, 2, -73, -45, 37, -72, 1, -113, -3, 4, -3, -37, 11, -23, -19, 21, -4, -33, -50, -6, -21, 32, 21, 15, 2, -67, -101, 11, -34, -6, 57, -19, -15, 17, -127, -7, -2, -37, 18, -8, 7, 9, -1, -16, 32, -77, 32, 15, 69, 3, -70, 21, 1, 6, 64, 20, -18, 9, 13, 7, -1, 0, 54, -60, -2, -77, -72, -48, 27, -45, 15, -44, 0, -2, -12, -53, 28, -60, -19, -19, 17, 23, -117, 21, -103, 11, 36, -29, 0, -18, -15, 17, 9, 3, 29, -102, -9, -115, 31, -90, 56, -61, 24, -34, 3, -3, 8, -36, -5, 8, -34, 22, 7, 3, -92, -43, -85, 25, 36, -5, 51, 5, -28, -10, -13, 5, 38, 27, 9, 29, -16, 9, -23, -26, 1, 42, -2, -1, 14, -44, -11, -27, -19, -28, -11, 4, -4, 17, -34, -20, 17, -9, -60, -36, 29, -62, -33, -11, 3, 4, -56, -40, -34, -12, 11, -43, -1, -4, 2, 7, -6, -43, -17, -42, -91, -40, 26, 11, 37, 2, -76, 53, 8, -21, 11, -76, 32, -11, -38, -2, 11, -22, -15, -73, 31, -58, 21, -7, 0, 13, 10, 6, -3, 5, -28, -1, -41, -37, 37, 23, 26, 7, -70, 87, -21, -32, 48, -34, 25, -19, -96, -6, -16, 62, 62, 1, -8, 53, -60, -71, 0, 31, 7, -8, -12, 23, -30, -91, -4, 11, 26, 40, 8, 6, -48, 8, -57, 0, -25, 10, 77, 84, 13, -8, 11, 58, 15, -52, -43, 45, -47, -24, 13, 75, 8, 5, 0, -25, -56, -24, -91, -73, 57, 50, 25, 5, -39, -6, -91, -29, -2, -124, 86, 67, -26, 1, -22, 24, -68, 19, -34, 5, -34, 60, 26, 51, 6, -2, -11, -5, -62, -13, -5, -31, 28, 15, -2, -6, -14, -49, -105, -26, 28, -70, 63, 26, -51, -17, -24, 26, -21, -21, -18, -16, -26, 28, -9, 24, -11, -6, -4, -22, -51, 6, -3, 36, 56, 53, 13, 14, -3, 20, 27, -18, -45, -52, 44, 6, 22, -11, 13, -38, -31, -19, -50, -51, 14, -37, -12, -17, 2, 8, -11, 16, 5, -103, 25, -1, 16, 12, -28, 29, -19, 8, 17, 32, 14, 11, 3, -66, 27, 9, 25, -69, -51, 1, 15, -7, 16, -52, 6, 4, -6, -9, -6, 6, 45, -57, -2, -5, -56, -31, -1, -7, -13, 47, -26, -27, 10, -1, -11, -22, -6, -10, -4, -24, 48, -79, 8, -4, 10, -14, -4, -19, -12, -6, 0, -60, -11, -51, 4, 28, -35, 30, 3, 12, -23, 15, 21, -17, -15, -11, -4, -14, 40, 6, 31, -94, -40, -33, -127, -63, -12, -112, -10, -34, -7, 3, 9, -54, 16, -102, 0, 17, -64, 25, -29, 15, -45, 6, 11, 25, -15, -12, -9, 6, 24, 2, 23, -38, -30, -1, -24, -44, -4, -34, 14, 11, -9, -16, 6, -16, 22, -42, -64, 12, -38, -74, -9, 3, -22, 37, -24, 18, -29, 16, 5, -37, -22, 9, 4, -20, 37, -69, -23, 26, -16, -21, -13, -1, -1, 1, 8, -58, 25, -52, 23, 35, -34, 48, -16, 20, 1, 34, 42, -2, 6, 19, 10, 24, 10, 4, 38, 12, 10, 7, -8, 15, -13, -63, -4, -11, -7, -1, -7, -47, 33, -111, 11, 7, -29, 35, -26, 32, -75, 45, 3, 20, -9, 24, 5, 41, 7, -11, 11, -6, -59, 14, -19, -52, -16, -30, 0, 30, 3, -7, 5, 12, 13, -83, -37, 2, -12, -33, -56, 21, -27, -1, -61, 8, -53, -4, 41, -19, -58, -3, -62, -9, 5, -70, -93, -5, -15, -102, 11, -84, 3, -3, 1, -34, 39, -62, 3, 11, 4, -27, -94, -20, -66, 2, 4, -34, 11, 22, -69, 4, 7, -1, 32, -17, 8, -25, -57, -45, 0, -127, 12, 3, -6, 16, -3, -2, 11, -33, -11, 13, -7, 10, -67, -15, -13, 9, -29, -12, 23, 17, 4, 15, 2, 5, 6, -21, 13, -43, 20, -12, 18, -46, 1, 6, 4, 12, 3, -2, -2, -8, -53, -20, -39, 20, -38, -62, 6, 46, -100, 27, 49, -33, -3, 34, -48, 7, -20, -1, 7, -47, -76, -39, 13, -55, -10, -32, -11, -12, -9, -41, 41, -55, 39, -44, 28, -72, -20, -6, -30, -14, -12, -43, 0, 12, -24, -18, 10, 3, 24, 30, 9, -59, -11, -39, 4, -62, 3, 19, -1, -5, 1, -15, 27, -31, 43, -16, 5, -11, -8, 62, -49, 1, 25, -12, -13, 32, 45, -8, 35, -14, 50, 46, -1, 3, 15, -40, -41, 2, -14, 35, -9, 4, -10, 10, -17, -20, -49, -7, 10, -7, 23, 9, 60, -12, -31, -4, -30, -19, 42, -12, 6, 2, -15, -12, 17, -117, -12, 12, 17, 5, -12, 10, -11, -6, 3, -14, 33, -46, 55, -12, 3, -6, -19, -51, -65, 9, -33, -4, -28, -21, 8, -16, 27, -8, -9, 70, 45, -57, -47, -2, -35, -47, 8, -5, 8, 4, -2, -20, 12, -67, 72, -19, -18, -10, 22, 19, -74, 25, 10, -26, -18, 38, 42, -9, 36, 0, 44, 64, -52, 22, -49, -34, -111, 10, 4, 34, -6, 4, -10, 25, 5, -49, -2, -10, 51, 15, 29, 15, 30, -28, -9, 7, -114, -51, 58, 29, 7, 5, 13, 12, -14, 16, 8, 17, -18, 10, -3, 23, -6, 7, 2, -36, -60, 18, 11, -5, 4, 20, 3, -10, 21, -43, -31, -8, -14, -13, 13, 2, 26, 5, -3, 28, -13, -11, 11, 1, -46, 7, 6, 13, 5, 2, 5, -15, -30, -17, 12, -13, 1, 34, -3, -7, 9, -76, 18, -28, -59, -43, 1, 12, 1, -3, -28, 7, 5, 12, -63, -3, -12, -22, -1, -31, 6, -3, 3, 4, 22, -72, 17, 32, 22, 32, -19, 7, -20, -22, 28, -3, -78, -21, -22, 13, 3, -3, -4, -9, 4, -12, 14, 9, 6, 6, -8, 10, -3, -2, 5, -15, -25, 22, 3, 2, -36, 5, -21, -27, 12, 0, -23, 2, 7, 5, -5, -23, -6, -3, -4, -50, -3, -12, -2, -16, -9, 7, -7, -18, -8, 1, 5, -17, -1, 0, 17, -10, -25, 20, 3, -16, 7, 0, 5, -35, -7, -1, -33, 8, 7, 6, -10, -72, -24, 7, -68, -35, -16, -41, -3, -46, -4, -5, -1, 0, 29, -111, 25, 0, 6, 23, -127, 1, -45, -5, 18, 14, -50, 11, -47, -14, 7, -3, -33, 17, 23, -37, 24, 17, 26, -10, 1, -20, -2, -6, -5, -38, -48, 1, 12, 16, -3, -19, -11, -114, -9, 10, -17, 14, 23, 12, -31, 31, -5, 1, -60, -32, 19, -55, 25, 11, 13, -6, 2, -25, 0, 6, 0, -55, -12, 6, 24, 9, -63, 1, -24, -67, 1, -2, 2, -23, 3, -3, -31, 29, 9, 4, -40, -60, 12, -12, -42, -12, -17, -5, -3, -16, -5, -9, -6, -43, 15, -60, 47, 7, -48, -6, -70, -8, -4, 2, 26, 6, -29, 1, -43, 10, 7, 6, 31, 6, 26, -71, 9, 25, 1, 49, 6, 5, 2, -2, 1, -46, 7, 26, -8, -62, -34, -6, 5, -3, -4, 24, -30, 16, 13, 1, -10, -25, 2, -4, -11, 3, 23, -77, 20, 51, -20, 28, -15, 15, -4, -1, -2, -1, -52, 31, 15, 42, 9, 37, 21, -44, -6, 12, -21, -17, 13, -20, 23, 17, 7, -6, -41, -10, -21, 0, 2, -14, 7, -44, -2, 17, 2, -5, -12, 9, -20, -61, 38, 7, 18, 33, 12, -9, -53, -37, -3, 44, -67, -64, 33, 3, 6, 7, -8, 40, 34, -43, 0, 32, 0, 18, -14, 40, 4, 11, -7, -22, -46, -11, -9, -2, -6, -7, 46, -12, 5, 70, -27, 12, -9, 10, 11, 16, -11, 8, -8, 27, 1, -31, -107, 27, -83, -23, -2, 38, 1, 21, 6, -3, -101, -41, -2, 7, 51, 27, 60, 13, -25, 34, -61, -22, -19, -117, 43, 2, -51, 9, -35, -6, -101, -3, -60, -26, 6, -65, -4, 8, -5, -6, 3, 19, -5, -65, -55, -14, 0, 3, -36, 13, -62, -69, -35, -14, -70, -111, 16, -19, -63, -3, -61, 61, 21, -30, -44, 6, -36, -50, -15, -7, 8, -7, -12, 9, 13, -40, 18, -18, -22, -4, 29, 25, 30, 8, 52, -10, -41, -19, 2, 31, 13, -3, -47, 16, -64, 6, 4, -31, -20, -101, -5, -7, 2, 6, 6, 11, -21, -124, 17, -11, 8, 23, -74, 42, -27, -88, -1, -5, 15, -1, 40, -1, -25, 8, -101, -39, -92, 4, 2, -76, 10, -105, -15, -22, -1, 1, -2, -14, 28, -127, -12, -21, -8, 9, -88, 3, -20, -71, -7, -12, -68, -22, -18, -110, -67, 7, -11, -72, -10, -20, -126, -85, 47, -98, -11, -79, 4, -8, 8, -45, 11, -27, -62, -1, -11, -32, -66, -10, 11, -9, 43, 32, 21, -114, -32, -42, -112, -8, -85, -48, 36, -39, -73, -60, 36, -124, -7, -83, -7, 5, -3, -24, -59, -31, 3, 13, -12, -5, -22, -12, -64, 42, -31, 29, 50, -18, -50, 27, -91, 2, -39, -5, 30, -5, -40, -40, 25, -11, -13, 49, 1, -3, -4, -29, -26, 12, 2, -23, 38, 24, 2, 25, -36, 49, -14, -7, 34, -7, 35, 22, -31, 2, -18, -70, 25, 20, -37, -80, -2, -86, -15, 16, -6, -1, 9, -49, 20, -1, -67, 17, -21, -23, 43, 45, -80, -96, 43, 35, 2, -127, 40, -49, -74, -4, -6, -54, 25, -19, -65, -61, 28, -34, -13, -11, 9, -10, 0, -27, -31, -23, 42, 11, -45, 14, 41, -21, -4, -18, -32, 19, 31, -16, 3, -44, -29, 10, -67, -57, 1, -16, -22, -50, 32, -3, -14, 14, 11, -9, -4, -32, -25, 16, 13, -50, -20, 11, 15, 31, -10, 26, -23, -39, 13, -7, 22, 20, -4, 11, -21, -48, 17, 69, -59, 10, -10, -60, -6, 9, -7, -9, 4, 45, 39, -2, -44, 33, 11, -2, -21, 0, -44, -57, -6, 38, -62, -71, 27, -29, -66, 3, -10, -39, 30, -7, -9, -28, 47, -13, -4, -10, -8, -1, -1, -30, 7, -5, 18, 18, 7, -15, -27, -69, 41, -3, -30, 20, -7, 11, 5, -49, -9, 3, -42, -1, -3, -27, -23, -18, 40, 4, -13, 24, 3, 8, -4, -38, -41, 7, 18, -55, 18, -33, 27, -21, 40, 37, 0, -26, 3, 5, 4, 36, -2, -3, -26, -52, 25, -11, 20, -2, -18, -25, -3, -18, 5, 2, 6, 6, 2, 20, 19, 4, -32, 28, 3, -53, -16, 9, 11, 14, 4, -36, -13, 3, 20, -3, -3, -17, 43, 1, 0, 21, -59, -17, -14, -9, -1, -5, -1, -19, 12, 7, 21, 4, -52, 46, 1, -19, -10, 1, -21, 28, -2, -64, 2, -25, 7, -10, -49, -32, 12, -11, -21, 14, -67, -8, -6, 9, 6, -6, 5, -33, 3, 8, 20, 11, -13, 23, -15, 23, 20, 16, 5, 30, -3, -31, 27, 10, 9, -2, -9, -58, -26, -3, -12, -2, -66, -57, 3, -19, -3, 3, 2, 10, 19, 4, 0, 9, -66, -29, -44, -92, -8, 31, 3, 24, 5, -48, -39, -5, 9, -5, 11, -49, -15, 3, -1, 11, -78, -15, -7, -7, 2, 6, 7, -25, 1, 17, 23, 8, -58, 2, -8, -66, -15, 6, -11, 14, -3, -107, 7, -37, -11, -10, -21, -43, -14, -23, -33, 9, -59, -15, 3, 12, 5, -3, -11, 15, -2, 4, 9, -2, -23, 8, 17, 40, -10, 14, -18, 22, -25, -89, 20, -30, 22, -9, 25, -72, 8, 5, 18, -37, -28, -30, 4, -22, 5, -2, -4, -11, -9, 13, -1, 26, -57, -12, -7, -90, -127, 18, 56, 23, 23, -31, -48, 24, -29, -8, 19, -40, 28, -6, 9, -11, 7, -47, -9, -31, 0, -3, -5, -22, 2, 8, 9, 33, -76, 7, 15, -24, -2, 23, 13, 37, 25, -4, -29, -34, 27, -7, -22, -49, 42, -35, 9, -8, 3, -26, -15, -4, 0, -2, -1, 0, -28, 16, 41, 25, -63, 7, 21, 63, -5, 22, -10, 41, -8, 17, 5, 15, 1, 12, 45, 36, 48, 6, 41, -20, 0, -29, 11, -36, 0, -2, 6, -105, 31, 7, -26, -53, -39, -125, -47, 19, 21, 35, 20, -22, -8, 35, -79, 59, 13, -7, -38, -24, 20, -2, 18, -12, 29, 6, 18, 6, 2, -9, 4, -63, 44, -35, -79, -51, -76, -75, -38, -31, 46, 26, 14, -68, 7, 10, -80, -13, -5, -10, -127, -6, -14, 9, -9, -31, 30, 24, 12, -6, 3, 9, 6, 15, 42, -19, -43, 3, -91, -27, -41, -64, -2, 23, 33, -46, 37, 38, -24, -55, 38, -9, -52, -4, 11, 23, -1, -6, -58, -9, 10, -16, 3, -3, -2, -24, 30, -13, -37, -57, -2, 1, 1, 78, 15, 2, 23, 5, -4, -57, -16, 24, -7, 10, -2, -28, -7, 15, -38, -14, -12, 15, 0, -26, 9, 5, -9, -16, 2, -20, -61, -70, -30, -62, 11, -5, -33, -2, 23, -79, 33, -36, -62, 31, -3, 12, -65, 9, -8, 74, -63, -20, 0, -16, 5, -6, -7, 6, 5, -41, -6, -23, -57, -5, -52, -60, 29, -45, -31, -15, -7, -46, 40, -21, -30, 9, 23, 9, 10, 23, -8, 28, -59, 12, 11, 47, 10, 30, -9, 1, -7, -11, 25, 1, -35, -33, 64, 54, -11, 35, 45, 54, -1, 37, -14, -59, 25, 39, -78, 8, 1, -16, -74, -4, -59, -40, 1, 31, 10, 41, -4, -8, 7, -26, -12, -34, -78, -66, -24, 42, -19, -30, 17, 34, 21, -75, 32, -55, 14, 44, -75, 8, 10, 14, -98, 52, -54, -92, 29, 31, 10, 17, -8, -12, -10, -1, -12, 15, -124, -2, 23, 28, -22, -3, -28, 18, -33, -43, 26, -74, 24, 58, -35, 4, -5, 2, 17, -8, 9, 17, 0, -18, -9, 14, 0, 5, 1, -43, 1, -3, -11, -24, 1, -6, -100, 10, 12, 13, 13, 3, -17, 21, -5, 10, 8, -1, -3, -7, 7, -11, -40, 20, 0, -46, -8, -28, -7, 6, -8, -4, 13, -52, -10, -8, -3, 10, -127, -18, 10, 3, 4, -24, -12, 30, -18, 10, 10, 0, -21, -35, -29, -3, -59, -25, -13, -65, -2, -30, 3, 2, -3, -20, -5, -6, -37, 23, -29, 10, -115, -18, -27, -2, -10, 3, 5, 11, -13, -9, -16, 4, -14, 1, 5, 12, -5, -10, -9, 31, 1, -3, 4, 0, -3, 0, -9, -13, -7, 13, 22, -30, -39, -39, 7, -8, -4, 19, -10, -8, -4, -15, 14, -4, -37, -7, 8, -14, -4, -13, 7, 1, -1, -23, -1, -3, -3, 2, 17, -29, 17, 14, 31, -59, -15, -29, -15, 5, 10, 16, -2, 18, -48, -9, 15, -4, -40, -29, -6, -10, -19, -35, -4, -14, 2, -35, -4, -3, -5, 2, 6, -2, -5, 1, -3, -30, 12, -9, -13, 2, 17, 6, 9, 14, -14, 4, 21, -2, -24, -19, -6, 10, -7, 6, 1, 16, -8, 9, 5, -3, -4, 11, -38, -5, -10, 28, 0, -9, -17, -21, -1, -24, -25, 2, -4, -36, -4, 7, -13, 4, -11, -7, 17, -42, 15, -3, 14, -6, -4, -33, 0, -3, 3, 16, -17, -17, 26, 31, 22, -15, -12, -23, -14, 16, 7, 12, 22, 23, -22, 5, -5, -8, -38, 0, 17, -50, -3, 1, 22, -9, 6, -41, -2, 5, 3, -9, 8, -16, 25, 10, 25, -20, 16, 13, -36, 20, 3, 13, 20, 5, 7, -1, 3, -3, -19, -15, -53, 14, -16, -50, 8, -4, -7, -14, -4, 3, 8, 11, -63, 8, -75, -13, -30, 2, -9, 42, -7, -4, 21, 3, 1, -35, -29, -7, -50, 1, -55, 19, -30, -7, 13, -3, 39, 20, -4, -55, 3, -10, 10, 6, -11, 10, -14, -21, -77, -32, 23, 20, -1, 25, -10, 8, 6, -10, -72, -20, -90, -3, -36, 5, 21, -36, -3, 0, 37, 22, -16, -76, 1, 2, -1, 47, -17, 3, 23, 4, -45, -44, 39, 7, -40, 51, 61, -4, -15, -8, -111, -6, 0, -10, -1, -76, -78, -1, -31, -21, 22, -60, 4, -17, 1, 11, -4, -42, -11, 1, -58, -9, -21, -24, -19, -16, -37, -1, 27, -8, 2, -63, -44, -95, -75, -8, 4, -98, 11, -9, -1, 18, 27, -11, 5, -46, 10, -10, -3, -4, -33, 6, 9, -20, -98, -20, 44, 1, -22, 36, -22, -5, 45, -39, -93, -60, -108, -6, -21, -40, 9, -47, 10, -7, 37, -33, 9, -40, 7, 6, 12, 33, 6, -4, 15, 6, -81, 11, -5, -5, 10, 27, 31, 10, 16, -22, -53, -25, -13, 3, -82, -65, -24, 13, -25, -59, 39, -36, -13, -68, 5, -8, 4, -39, 2, 21, -51, 5, -41, 4, -36, -13, -36, 17, 14, 40, 7, -55, -71, 20, -25, -3, -77, -24, 17, 10, 8, -20, 31, -53, 2, -85, 11, 2, 6, 16, -10, 22, 49, 4, -92, -36, -14, -2, 17, 58, -5, 41, 36, -62, -127, -7, -89, -1, -114, -76, -11, -46, 3, -19, 0, -13, -11, -55, 5, -9, 7, 40, -36, 6, 17, 26, -61, 39, 29, 52, 0, 48, -24, 37, -32, -67, -65, 12, -16, -6, 57, -75, -6, -16, -4, 24, -43, 10, 8, 17, 1, 11, -10, 30, 7, 19, 19, 41, 14, 54, -14, 46, 36, -7, -40, 57, -31, -3, 35, -110, 24, 11, 74, -18, -32, 27, 17, 31, 16, 1, 15, 24, -8, 4, -20, -30, -51, -1, -40, -61, 11, 61, -24, 31, 9, -6, 1, 19, -77, -33, 37, -43, 21, -14, 87, -1, -15, -5, 4, 12, -1, 6, 11, 18, -8, 8, 4, 28, -29, 0, -37, -65, 33, 10, -11, -2, -13, -7, 8, -125, -65, -1, 23, -3, 6, -7, 50, -70, -4, -31, -11, 11, -89, 14, -1, -3, 2, 14, -2, -21, 37, 32, -12, 13, -56, 0, -26, 7, 10, -6, -77, 40, -49, -83, 33, -62, -18, -9, 13, 20, -11, -6, -15, 14, -127, 6, 6, 25, 7, 1, -15, -50, 23, 16, -83, -18, -35, 2, -8, 10, 1, -8, -58, -16, -42, -126, 16, -39, -41, -6, -17, 37, -23, -12, -17, -6, -88, 27, -5, 20, -2, -8, -3, -21, 1, 8, -97, -51, -5, -4, -33, -8, 14, -26, -27, -119, -126, -103, 25, 11, -6, -12, -32, -6, 4, -45, 69, 26, -34, -3, 9, 4, -5, -15, -17, 6, 54, 5, -18, -61, -105, 6, -28, 26, -2, -17, -22, 11, -36, -20, 27, 30, -18, 9, -5, 54, 18, -20, 47, 40, -72, -12, 14, -8, -7, -16, 4, -22, 53, 7, -87, -59, -95, 6, -52, 30, -18, -17, -73, -59, -38, -24, 6, 16, -10, -1, -49, 76, 37, -28, 46, 30, -85, 30, 12, -3, -10, -11, -14, -5, -17, 7, -44, -76, -57, -2, -31, 19, 25, 13, -33, -87, -36, -44, -12, 4, 0, -5, -67, -9, -5, -49, 9, 34, -20, 27, 8, 48, 2, 5, -1, -2, -35, -14, 22, -2, -16, 49, -55, 46, 28, 12, 20, -56, -45, 2, 57, 6, 42, 7, -104, -29, -37, -38, -111, -33, 22, -17, 16, 23, -4, -9, -3, 0, -4, -80, -55, 27, 63, 12, -85, 3, 28, -14, 37, -2, -81, -1, 24, 5, 30, 3, -10, -4, -7, 7, -80, -62, 51, -30, 11, -29, 0, 2, -11, 5, 57, -87, -7, -7, 73, -36, -71, -3, 6, 19, 13, -21, -25, 30, -60, -18, -18, -6, -27, 10, 5, -5, -17, -4, -69, 30, 17, 14, 7, -10, -13, 20, -115, -31, -16, 52, 2, 37, -32, -1, 10, -40, -26, -58, -127, -97, 27, 25, -7, 3, -59, -7, -68, -16, -10, -54, 52, 4, 19, 22, 1, 5, -2, -14, -38, -87, -90, 31, 56, 3, -13, -7, -9, 1, -42, 14, -28, -49, 3, 7, -19, 12, -9, 39, -12, 4, -21, -67, 66, 15, -1, -19, -5, -14, 5, -3, 27, -83, 16, 45, 99, -48, 6, 13, -34, -8, -27, 25, 0, 29, -12, -14, -37, 1, -44, 45, -14, 13, 24, -7, 10, 12, 1, 8, -5, -12, -1, 22, -50, -29, -28, 39, 7, 26, 8, 9, 20, -63, -24, 19, -5, -23, 12, 51, 7, -10, -21, -11, -35, 13, -2, -55, 38, -11, 23, -17, 2, -12, -6, -17, -11, -14, -99, 32, 50, 5, -7, 1, -49, -49, -101, 40, 9, 7, 23, 4, -27, 6, 2, -35, -24, -5, -4, -32, 43, 7, 3, -23, -4, -2, 8, -12, -8, -4, 46, 16, 46, -111, -1, 0, 8, -17, -74, 13, 25, 56, -33, -21, 2, 1, 13, 53, 9, -8, 28, 14, -19, -24, -2, -9, 6, -2, -8, -48, 8, -11, 15, -21, -56, -28, -13, -30, -4, 52, -22, -18, -1, 24, -22, -13, 5, 8, -2, 13, 24, -8, 14, 0, -8, -17, 21, 1, -6, -1, -2, -22, 18, -51, -30, 38, -6, 18, -14, -11, 10, 32, -44, 22, -8, 1, -23, -49, 25, 1, 3, 7, 39, 28, -30, 15, -17, -27, 13, 9, -7, 3, 9, 13, 36, 7, -3, 37, 21, 10, 2, -23, 0, 54, -25, 10, 20, -20, 24, -58, 13, 8, 26, 45, 9, -32, 40, 1, 12, -12, 3, -14, 10, -6, 2, -12, -10, -15, -4, -47, -4, -65, -58, -22, -3, 38, -1, -50, 10, -11, -59, -1, -8, -7, -1, 19, 16, -40, -2, -1, -6, -9, 8, -36, -14, 11, -3, -9, 9, -69, -6, -34, -61, -15, -24, 11, -7, 29, -17, -31, -4, -12, -52, -20, 0, 6, 25, 27, -24, 7, -70, -5, -35, -34, 8, -7, 1, 0, 6, -6, 7, -31, -31, 23, -39, 27, 9, -1, -24, 7, -35, -6, 18, -49, 3, -13, 4, 5, 2, -28, -1, -26, 15, 5, 52, 24, 3, -36, 8, -6, -8, -41, -14, 3, 10, -46, 18, -41, 1, -71, 13, -11, -8, -39, 1, 37, -55, -27, 3, -2, -17, -11, 36, -19, 38, -31, 59, -22, 13, -126, -3, 3, -3, -1, 38, -61, 17, -22, -2, -82, -11, -27, 6, 20, 26, -42, -22, 55, -127, -17, 6, 0, 0, 31, 18, -14, 12, -57, 19, -61, 8, -40, -1, 4, 5, 3, 31, -49, 14, 28, -72, -17, -2, 30, -14, 26, 9, -7, -16, 8, -46, -49, 26, -3, -28, -14, -7, -23, 27, 1, 23, 1, 3, -18, 9, 5, 5, -6, -31, -6, 8, 23, 13, -83, 1, 8, -5, -97, 6, 10, -20, -7, 15, -47, 6, 0, -55, 4, 13, -29, 24, -12, 33, -13, -5, -61, 4, -2, 8, 30, -3, -17, 9, -80, 32, -127, -3, 19, 6, -73, 15, -16, -16, 2, -42, -39, 22, 2, -34, 18, -7, -25, 20, 1, 29, -3, -9, -63, 4, 1, 7, 5, -3, -39, -34, -41, 19, -99, -7, 32, 26, -31, 17, -39, -1, -7, -82, -9, 13, 7, 3, 4, -12, -7, -12, 24, -31, 21, 9, -12, 4, -5, 4, 0, -4, 12, -3, -21, 21, -87, -49, -19, -4, -58, 0, -12, -22, 15, 1, -39, 31, -5, -19, -16, 32, -10, 0, 28, -7, 6, -4, -34, 9, -4, -7, 19, -2, 20, 0, -74, 23, -106, -31, -30, -13, -20, 1, -42, -29, 38, -50, -12, 50, -3, -7, -19, 6, -64, 34, 5, 23, -12, 3, -86, -6, -4, -6, -9, -1, -33, -39, -41, -38, -25, -37, -52, -11, -1, -25, -27, -20, 8, -104, -20, 15, 11, -16, 13, -5, 42, -21, 20, -58, 6, 12, 10, 0, 6, 0, -12, -25, 15, -3, -27, 15, 1, -15, 37, 8, -18, 36, -19, -19, 10, 22, 7, -11, -3, -13, -2, -13, 9, -15, 20, -16, 8, 4, 9, 4, -6, 5, 38, -12, 33, 0, -50, 18, -2, -1, 9, 1, -15, -4, -35, -21, -8, 26, 47, -20, 9, -45, -7, -5, -64, -5, 32, -3, 6, 0, -6, 7, -5, 1, 17, -37, 27, -21, -27, -37, 25, -4, 9, 15, 13, -33, -19, -17, -22, -15, 33, -28, -7, -24, -77, -18, -11, -19, -14, 28, -41, 0, -50, 7, -5, 0, 11, 35, -40, 9, 16, 19, -41, -127, 1, -51, 36, 8, 12, 7, 14, -39, 6, -8, -6, -14, -46, 11, -4, -29, -16, 25, -53, -8, -21, -3, 2, 6, 2, 32, -17, -3, 6, -13, -60, -41, -51, -87, 48, -26, -5, 15, 19, -24, -19, -20, 5, 3, -6, 22, 1, 6, -9, 10, -24, -6, 8, 5, 7, 3, -3, 39, 1, 17, 24, -10, 10, 3, -50, -49, 23, -17, 19, -4, 37, 14, 6, -15, 5, -37, -54, -18, -22, -27, -6, 35, 10, -3, -87, -1, -5, -4, -15, 23, 22, 6, -8, 0, -43, -18, -5, 0, 15, -4, -17, 19, 26, -72, -53, 0, -7, -11, -47, 16, -66, 5, -30, 31, 11, -6, -54, 9, -6, -3, -21, 23, -15, 8, -17, -4, -66, -14, -7, -10, 39, -23, -18, 17, 21, -33, -51, -33, -6, 20, -14, 11, -26, -15, -15, 26, -1, -8, -2, 7, 4, -8, 15, 6, 4, 17, 8, 37, 16, -19, -8, -11, 37, 7, -7, -1, -8, 18, -60, -20, 1, 31, -42, -39, -29, 2, 9, 16, 17, 0, -1, -7, -1, 3, -22, -31, 19, -1, -32, -3, -23, 0, -26, -1, -1, -38, -13, 4, 13, 8, -64, -9, -1, 14, 24, 13, -83, -6, 17, 24, 35, 0, 10, 6, 5, 2, 7, 6, 7, 28, -33, 3, 8, -4, -61, 6, 12, -25, -36, -10, 18, 7, -21, -19, 1, 13, 42, 18, -54, -21, 14, -7, 16, 7, 7, 4, 0, -3, 11, 17, 4, 24, 2, 10, 40, -2, -8, -6, 19, -4, 1, 0, 7, 19, 8, -19, 11, -2, -23, -5, 17, -29, -19, -13, 1, -2, 20, 2, 4, 2, -51, -25, 18, -23, 10, -40, 25, -90, -33, 30, 39, -23, -7, 16, 4, 15, -13, 2, 5, -15, -7, -5, -3, -28, 28, -44, 29, -5, 28, -8, 2, 2, 0, 13, 18, -12, -24, 29, 18, -127, -49, 40, -17, -28, 12, -50, -3, 22, -46, 26, 4, -1, 24, 59, -22, -6, 36, 36, 10, -11, 3, -11, 8, -1, 5, 50, 17, 3, -37, 53, 8, -104, -60, 15, -10, 87, -2, -59, 61, 1, -26, 27, -6, -37, -13, 18, -14, -19, -36, -46, 10, -8, -3, -3, -9, 3, -65, -13, 10, 28, -2, -49, 5, -38, 20, 6, 17, 7, -6, 33, 3, -16, -68, 0, -4, 6, 13, -64, 12, -50, -15, -111, 36, -1, 28, -3, 5, 5, -3, -17, 16, -33, -1, 37, -3, -112, 22, 2, -26, -121, -32, -43, -72, 20, -81, -62, 11, 19, 23, -11, 5, -25, -12, 3, 6, -5, 15, -3, 8, 1, 3, 16, 2, 2, -44, 40, 15, -52, -44, -6, -53, 34, -31, -44, 32, 24, -56, -21, -9, -58, -3, 18, -24, 0, -41, -4, 1, 4, -32, 2, -2, 0, -71, 1, 5, 29, 1, -14, 11, -11, 22, -17, 14, 35, 24, 27, 16, -41, -6, 21, 0, -7, 20, 10, -3, -17, -42, -67, 19, 3, -7, 7, -6, -6, -25, -2, 22, 21, 30, 25, -18, -41, 24, -46, 21, -26, 4, 32, -12, 6, -58, -22, -5, 18, 15, -5, 10, -2, 4, -58, 3, -7, 7, -1, 5, -3, 3, -35, 16, -40, -31, 13, -6, -12, 4, -13, -5, -46, -9, -20, -48, 2, -35, -30, 1, 52, 14, 51, 0, -24, 14, -30, -46, 4, 15, 10, -2, -3, 2, 11, 16, -20, 7, 22, 26, -27, 11, 15, 38, 3, 35, -16, -8, 13, 11, 39, -6, 0, 0, 54, 11, -26, 14, 36, -44, 1, 15, -6, 9, -18, 27, 5, 45, -7, -34, -11, 54, -26, 18, 62, 21, 35, 17, 35, -54, 25, 7, 28, 0, 6, 45, 37, 1, -6, 7, 49, -10, 20, 30, 2, -18, -2, 35, 14, 21, -12, 1, -20, 55, -12, -11, 40, 28, 21, -61, 41, -64, 11, -2, -20, 11, 49, -31, 27, 20, -102, -57, 6, -7, -1, 30, 7, -13, 8, 10, 29, -44, -10, -22, 14, 12, -34, 13, 3, 6, -2, -4, -17, -21, 30, -23, -33, 3, 9, -3, -6, 38, -25, -45, 28, -29, 1, 18, 2, 5, 1, 32, 13, -25, -54, -39, 24, 46, -29, 16, 45, -30, 13, -58, 42, -44, 4, -1, -53, -4, 14, 21, -42, 3, -33, -73, 16, -32, 30, 5, 1, -5, 4, 21, 23, -37, -56, -31, -27, 49, -56, -3, 13, -8, -19, -72, 6, -52, -18, 6, -86, -3, 22, -62, -55, 32, -22, -18, -66, -34, 22, -35, -1, -10, 6, 4, 30, -57, -4, -75, -4, -25, -99, 0, 3, -23, 7, -52, -49, -30, -24, -51, -26, -16, 12, -97, -31, 48, 9, -33, -62, -19, 19, -22, 11, -6, 4, 19, 21, 3, -46, -83, 7, 6, -67, 20, 9, -53, 43, -110, -9, -120, -44, -30, -65, -5, 13, -112, -46, 28, 27, -46, -18, 22, 4, -28, -4, -9, -9, -6, -7, -16, -127, -71, -32, -32, -38, -6, 18, -24, 30, -88, -44, -29, -90, -40, -26, -8, 54, 82, -1, -3, 22, -21, 20, 4, 0, 34, 6, -9, -8, 2, -33, -30, -28, -53, 29, 44, 15, 57, 17, -8, -32, -20, 6, -20, 38, 4, 15, -8, 40, 68, -5, 11, 32, -45, 16, 8, -8, 28, -6, -5, -2, 21, -37, -54, -76, -41, 23, 41, 29, 41, -6, 0, -36, 15, -18, -83, 35, -13, -33, 4, 44, 50, -35, -17, 12, -42, 18, 22, 0, 15, 4, -9, 11, -18, -68, -28, -48, -17, 34, 18, 19, 50, 9, -6, 6, -20, -41, -13, -5, -4, 14, 12, 21, 25, -1, -11, -40, -45, 24, 5, 1, -2, -3, -3, 4, -32, 17, -104, 16, -14, 112, 8, 24, 73, -19, 13, -3, 24, 15, -57, -3, -23, -46, 2, 19, 27, -24, -29, -59, -64, 12, -25, -10, 7, 8, 2, -3, -27, 24, -127, -53, -19, 11, -8, 43, 33, -27, 21, -60, 11, -1, -36, -3, -24, -80, 8, 22, 7, -8, -51, -21, -95, 3, -9, 2, 12, -10, 1, -1, -18, 0, -95, -17, -20, 4, -1, 48, 25, 19, 62, -66, 5, 21, -9, -6, -28, -44, 5, 45, 15, -48, -3, -91, -58, -7, -11, -2, 0, 4, 6, 10, -16, -8, -91, -6, -19, 38, 21, 3, 73, -24, 12, -46, 25, 26, -54, 38, 22, -39, 3, 28, -20, -81, -4, -65, -34, -5, 40, -5, 3, -3, 8, -9, -42, -1, -71, -29, -10, 0, -5, -6, 28, -12, -19, -70, 25, -26, -80, 28, -22, -65, 3, 17, -7, -36, -1, -42, -5, -11, 1, 3, 26, -1, 1, 9, -39, -62, -40, 10, -16, -4, -6, -31, 21, 6, 18, -120, 13, 8, -57, 22, -70, -23, -4, 12, -41, 31, 32, -4, 44, -59, -1, 11, 25, 0, 10, -4, 33, -30, 39, 19, 8, -11, 2, -8, 55, 53, -46, 43, 25, 30, 27, 7, 18, 39, 4, 12, -54, -26, 11, -44, 1, -64, 15, 9, 9, 8, -10, -11, -16, -10, 20, 33, 17, 48, -31, -9, 40, 38, -49, 23, 32, 27, 4, -18, -25, 22, 9, -50, -10, -37, -3, -39, -3, -93, 14, 2, 20, 10, -5, 1, -52, -65, 12, -98, -69, -4, -47, 14, -5, 20, -36, -108, -8, 28, -31, -24, -2, -36, -3, -1, 4, -4, -4, -4, -1, -21, 33, 21, -3, 3, 3, 0, 28, 14, 35, 38, -27, -9, -23, -12, 18, 45, -13, 38, 4, 43, 3, -16, 28, -23, -4, -39, -49, -48, 6, -21, -4, -40, 37, 25, -6, 2, -5, 5, 26, -36, 10, 13, 4, 19, -20, 28, 43, 47, -40, 23, 3, 12, -17, -27, -29, -6, 6, -56, -62, -83, -8, -31, -22, -114, 20, 26, -12, -7, 4, 2, -83, -127, -4, -78, -86, -43, -34, -5, -18, 24, -69, -121, -48, -2, -51, -39, -58, -39, 11, 41, 30, 9, 12, 19, 18, 6, -22, 6, 3, 4, 8, 6, 35, 36, 40, 18, 0, -22, -23, 19, 22, 28, 41, 18, 10, 28, 17, -25, -40, 1, 4, 56, 19, -36, 15, 30, -17, -5, -36, 1, -38, 2, 0, -2, 20, -36, -1, 38, 16, -5, -36, -1, 0, 26, 13, 3, 23, 30, 43, -91, -6, 14, -3, 35, -57, -37, -19, 35, -48, -29, -34, 1, -49, -4, 3, 2, -34, -61, -10, -57, -80, -120, -46, -115, -56, 30, 17, -38, -60, 16, 37, -76, -49, -5, 6, -31, 20, -22, 17, 2, -7, 13, 15, 11, -58, 6, 1, -2, 3, -30, 3, 17, 2, -15, -54, 19, -19, 2, -52, -26, -15, -37, -29, -80, -34, 15, 7, -71, 17, -16, 15, -8, 7, 4, 18, -1, -68, 0, 2, 1, 12, -6, 1, 8, -10, -23, -88, 16, -7, -8, -39, 32, -86, -6, -41, -88, -75, 18, -3, -11, 8, -16, 16, 5, -3, 7, 7, 8, -1, -2, 2, -2, -10, -8, -3, 3, 14, -17, -119, 0, 0, -31, -13, 37, -1, 12, -12, -26, -76, 34, 13, -1, -24, -30, 10, -13, 3, -4, 2, 4, 20, 8, -7, 7, -5, -12, 0, -3, -15, -11, -7, 39, 17, 7, -14, -41, -18, -14, 5, 10, -7, -7, 7, -1, -37, -55, 4, -10, -8, 19, 14, 8, 17, -6, -3, -8, 9, -13, -8, -8, -22, 0, 10, 4, 4, 19, -3, -23, -24, -13, -3, 10, -16, -28, 1, 2, -26, -35, -9, 5, -5, 17, 34, 11, 5, -3, 6, -2, 25, -4, -13, -8, -7, -5, -6, -30, 2, -6, -2, -9, -23, 16, 19, -5, -12, -46, 9, 4, -47, 12, 19, 17, 28, 29, 16, -2, -17, 1, -8, 7, -46, 1, 11, 12, 32, 27, -64, -11, -16, 20, -5, 12, -2, 6, 43, -16, -44, 13, -2, 18, -48, 4, -10, 31, 3, 65, 3, 3, -62, 6, 6, -1, 3, 2, 14, 0, 12, -8, -75, -17, -11, 21, 34, -13, 0, 36, 52, -127, -40, 9, 0, 25, -3, -10, -38, 20, 14, 51, -1, 6, -56, -4, 2, 5, -13, -3, 14, 13, -15, -44, -25, -10, -30, -23, 40, -51, -10, 29, 17, -62, -35, -33, -2, -14, -25, -4, -11, 10, 4, -12, -9, -6, 21, 3, -5, -5, -28, 1, 10, 7, -5, 6, 5, 6, 5, -3, 2, -35, 6, -30, -39, 8, 8, -21, 6, 10, -15, -9, 4, 0, -3, -10, 13, -3, 14, 8, 1, -1, -17, -9, 17, -14, -76, -34, 12, -2, 16, 16, -24, -12, -3, -46, -24, 15, 27, -32, -8, 10, -2, -37, 16, -1, -1, 1, 23, 3, 8, 0, -1, 4, -6, -1, 4, -4, -100, -12, 18, -1, 10, 14, -60, 5, -64, -88, -55, 11, 21, -37, -4, 20, -41, -13, -7, -3, -20, 39, -18, -3, -7, 4, -1, 1, -9, 0, -17, 13, -4, 2, 14, 16, 44, -5, 37, -51, 8, 22, 15, 15, -13, -3, 3, 20, -13, -2, -4, 6, -11, 19, -13, -6, 12, -4, 5, 4, 11, 13, -17, 3, -32, -2, 2, 25, 10, 21, 25, -35, -23, 17, 17, 8, 4, -39, 4, 21, 14, -8, -3, -1, 25, 17, -10, 11, -22, 7, -7, -2, 23, 22, -29, 6, -74, -40, 4, 16, -1, 6, -6, 6, -46, 6, 6, -12, 15, -20, 3, -50, -30, 4, -42, -8, -7, 10, -16, -2, -48, 5, -1, 1, -30, -3, -13, 43, -6, -13, -48, -7, -38, 0, -1, -22, 3, 28, 37, -68, -48, 2, 6, -93, -25, 7, -110, -2, -7, 2, -6, -11, -95, 2, -4, 6, 7, -2, -18, 12, -36, -40, -73, -8, -53, 12, -9, -20, -6, 22, 8, -127, -2, 17, -4, -48, -23, 0, -69, 4, 17, 19, 18, -11, -43, 3, -6, 4, -5, 3, -21, 0, -71, -88, -35, -5, -1, 7, 8, -7, -20, 6, -8, -33, 17, 13, 1, 15, 24, -13, 0, 0, -27, -4, 17, -2, 8, 6, -4, -7, 1, -127, -26, 24, -73, -30, 1, 6, 18, 15, -22, 7, -101, -22, -22, 3, -63, 43, 1, 7, 24, -72, 3, -1, -13, 22, 6, -13, -22, 1, 5, 9, 13, -52, -24, -23, 4, 17, -4, 3, 22, 33, -13, 1, 14, -2, -26, -9, -83, 1, 6, 74, 32, -28, 20, 22, -17, 23, 11, -15, 12, 3, -17, 0, 13, -81, 10, -46, 30, 37, -3, 1, 1, 1, -34, -16, -5, -29, -21, 6, -38, -27, 8, 23, -6, -16, -15, -35, -1, -50, 5, 2, -14, 2, 0, -5, -52, -52, -35, 17, -26, -41, -3, -43, 33, 2, 0, 3, -57, -55, 4, -12, -44, 12, 3, -5, -26, -49, -41, -9, -37, -4, -9, -5, -47, -7, 0, -2, -68, 15, -11, 20, 8, -19, -16, -6, -7, 13, -1, 40, 26, 3, -45, -67, -43, -11, -1, -15, -25, 19, -28, 42, 16, 8, -7, -4, -38, 1, -8, 7, -24, 27, 22, -36, 35, -17, -70, -43, -22, -3, 15, 27, 22, -11, -38, -34, -47, -17, 3, -73, 32, 2, -4, 29, -8, -42, -43, -3, -27, 6, -2, -2, -108, -1, -40, -8, -3, -96, -24, 0, -1, -14, 39, -4, 3, -36, 23, -10, 51, -11, 4, -60, 12, -13, -29, 31, -17, -18, -21, -5, -33, 6, 6, 0, -89, 12, 8, 15, 18, -39, -24, -10, 29, 2, 25, 3, 21, -14, -7, -20, 1, -13, 1, -8, 15, 27, -59, 42, 39, -8, -1, -3, 4, 2, -6, 4, -63, 40, 22, -24, 23, 18, -55, 21, 22, 39, 21, -21, 28, 8, 0, 14, -7, -50, -3, -26, 16, -19, -16, 8, 16, -19, 6, 2, -27, -2, 1, 2, -44, -72, 3, -1, -47, 21, -33, 5, 4, -11, -65, -14, -22, 8, 12, -41, 28, 31, 6, -37, 17, -9, -54, 9, 3, -4, 3, -3, -57, 6, -1, 2, -37, -22, 7, -22, -127, -21, -31, 10, 16, -7, -51, 15, -40, -16, 1, -41, -24, 21, 2, -5, 1, 0, -68, 0, -13, 9, 5, -7, -33, -1, 4, -4, 12, -2, -2, -46, -63, -29, -13, 2, 6, -14, -30, 17, -51, -14, 0, -23, -17, 8, 4, 0, 9, -15, -21, -42, 14, -60, 2, 5, 22, -5, -5, 0, -28, -13, 4, -75, -76, 21, 19, -25, 19, 22, -22, -14, -36, -32, -26, 7, -37, -9, -2, -15, 0, -17, -34, -21, 7, 3, 11, -1, 20, 5, -5, 0, -20, -44, 20, -52, -60, 11, 12, -53, 25, 15, -32, -12, -116, -19, 10, 3, -50, -14, -7, -24, 14, -16, -60, 11, 6, 19, -11, 2, -10, 1, 4, -3, -1, -47, -2, -54, -20, 11, 9, -43, 0, 10, -5, -17, -72, -11, 4, -13, -34, -43, 8, 2, 24, 15, -18, 4, 15, -8, 5, 3, -11, -7, -3, 2, 34, 2, -8, -3, 10, 16, 4, -2, -10, 16, 18, 16, -15, 0, -23, -16, 8, -24, -4, -27, 62, 21, -56, 14, 20, 14, -5, -2, -8, -3, 1, -5, 27, -36, 18, 31, 21, 27, -2, 32, 14, -6, 14, -10, 8, 18, -2, -10, 36, -57, 1, -20, 48, 2, -69, 4, 23, 9, 13, -1, 4, -5, 0, -7, 35, -44, 3, 20, 34, 24, 5, 27, 6, 1, 1, -34, -7, 20, -2, 16, 34, -44, -5, 25, -76, 1, -21, 40, 11, 10, 17, 1, -10, 7, -1, -4, -76, -57, 17, -11, -12, -59, -8, 10, 0, 4, -5, -48, -2, -25, 25, -9, 7, -6, -1, 12, -25, -36, -47, 44, 26, 8, 15, -8, -1, -6, 2, 3, -65, -111, 16, -9, -34, -36, 32, 0, 1, 53, -40, -54, -40, -28, -9, -15, -6, -35, -7, 50, -36, -39, -57, 28, 47, -33, 32, -5, -24, -12, 1, 5, 24, -38, 24, -38, -101, -58, 46, 3, 4, 12, -25, -24, -73, -33, -9, -29, -22, -31, 1, -26, -43, 33, -23, 6, 23, -30, 4, 7, -2, 3, -7, -1, -127, -21, 15, -19, -12, 26, -71, 13, -20, 12, 29, -85, -12, 11, 49, -20, -56, 53, 0, -14, -16, 27, -37, -7, 22, 17, -5, -3, 3, 1, -7, 5, -89, -17, 13, -52, -41, 7, -36, 57, 29, 37, 18, -10, -47, 3, 52, 3, -62, 3, 9, -8, 9, 38, -72, 14, 6, 49, -5, 3, -5, -5, -4, 2, -2, -30, -11, -31, -14, 17, -22, 6, -31, 31, 0, -15, -32, 23, 15, -6, -14, 4, -4, 6, -24, -32, 15, -46, 9, -80, 21, -1, -3, -3, 4, -3, -42, 26, 8, 19, -28, 34, -46, -25, -34, -15, -46, -35, -29, -34, 17, 12, -26, 42, -10, 21, -6, 30, 53, -57, -1, -91, 8, 3, -17, -13, -7, 6, -18, -65, -2, 38, 11, 36, -37, -6, -45, -15, -75, -46, 12, -23, -5, 1, -20, 17, 14, -30, 29, 12, -95, -59, 5, -69, -12, 7, -21, 5, -2, 11, 28, -39, -18, 61, 70, 46, 4, 35, 4, 5, -40, 0, 61, 8, -6, -20, 42, -2, 11, -12, 3, 8, -12, -25, -4, 1, -5, 2, 14, 3, -1, 2, -19, 11, 4, 6, 3, -44, 12, -6, 1, -4, 45, -55, -1, 49, -7, 0, 10, -12, 1, -36, 11, -12, -51, -6, 6, -17, -5, 6, 18, 3, 22, 7, -40, -72, 10, 4, -72, -46, 19, -2, -9, -5, 38, -17, -26, 42, -58, 0, -15, -10, -7, -58, -3, 20, -91, -2, 30, -13, -16, -3, 31, 8, 0, 4, -5, 2, 0, -1, -102, -57, 28, -4, -13, -5, 15, 11, -45, 15, -18, 24, 5, 17, 2, -1, -57, -6, 9, -39, 16, -127, 25, -8, 13, -6, -10, -4, -44, -21, 5, -17, -25, -28, 30, 42, 3, 27, -43, 5, -2, 9, -62, 20, -20, 36, -5, -41, 15, -29, -16, -68, 10, -48, 34, 13, 20, 8, 5, 8, -30, -54, 2, -43, -95, 27, -23, -8, -7, 36, -56, 22, -78, -40, -32, 16, -48, 1, 11, 3, 14, -8, -57, -36, 20, 8, 39, 4, -8, -7, -3, -11, 9, -14, 25, -4, -53, 34, -3, -24, -3, 7, -71, 14, -86, -58, -6, -8, -87, -5, 9, 9, 54, -32, 21, -49, -10, -81, 31, -2, 22, 3, 0, -6, 9, -8, -13, -5, -24, 74, -7, 16, -31, 31, -83, 4, -36, -61, -6, 40, 43, -29, -7, -49, 43, -2, 34, -26, 14, -1, 50, -3, -2, 5, 9, 1, 50, -25, 23, 6, -11, 74, -57, -24, -69, 11, -52, -16, -22, -35, 13, 2, 24, -33, 2, -52, 12, 30, -50, 29, 13, 5, -3, 6, -41, -4, -2, 11, 26, -26, 33, 29, 43, 39, -75, 34, -62, -24, 2, 19, 19, -20, 35, -32, 22, 10, 7, -33, -24, 9, -12, -33, -127, -10, -84, -6, 13, 4, 2, 6, -83, 18, 14, 19, 7, -45, -48, -38, -57, -31, 24, -56, -12, 24, 8, 10, 11, -20, 4, -16, -30, -19, 3, -25, -17, -52, -18, -4, 15, 3, -1, -8, 5, 14, 20, -24, 6, -26, -15, -52, -34, -27, 26, -99, -2, 16, -14, 21, -35, -43, 6, 23, -21, 2, 19, -7, 15, -34, 5, 4, 39, 8, -3, -9, 9, -3, 25, -17, -11, -1, 13, -39, -1, 21, 15, -24, 31, -15, -10, 41, -50, -27, 7, -18, -21, -2, 6, 16, -67, 15, -59, 1, 4, -8, 1, 2, -25, -32, 2, -17, 7, -13, -49, -57, -30, 26, 33, -44, -16, 33, -7, -4, -40, -7, 7, -30, -40, 8, -2, 36, -4, 2, 27, -2, -3, 1, -8, 2, -22, 26, 32, -65, -16, 11, -81, -18, -51, -32, 22, -43, -4, 3, -9, -5, -70, -39, 1, -3, -6, 12, 12, 10, 25, 5, 28, 11, 27, 1, 8, 9, 21, 20, 36, -15, 18, 9, -43, 10, -59, -1, 26, -11, 2, 7, 3, 19, -37, 6, -9, 9, -2, -12, 12, 10, -43, -18, -8, 2, 22, -6, -6, -7, -16, -23, -16, -34, -32, -1, -9, -20, -29, 32, 11, -55, -48, 4, 7, 7, -28, 19, 5, 4, -37, -27, 12, -54, -52, -12, 21, 14, 32, -2, -5, -14, -17, -8, -5, -53, -25, 44, -27, -35, -14, -42, -19, -58, -51, 5, -20, 12, -22, -8, 5, 11, -65, -6, 30, -18, -9, 41, 24, 4, 14, 7, 7, -3, 0, 18, 16, -1, 18, 22, -8, 14, -15, -14, -15, -55, -2, 34, 25, 18, -9, -14, -5, -16, 0, 12, 4, 3, 22, -37, -7, -4, 21, -2, 3, 3, -8, 7, 8, -8, 9, -1, 28, -4, -5, 20, -7, -28, 6, -1, 10, 30, 34, -1, 1, -12, -4, -51, 2, 0, 16, -21, 7, -5, 17, 1, -6, -8, -25, -55, 13, -38, -64, 8, 26, -23, -9, 24, -18, -58, -60, -56, -21, 17, 41, -68, -3, 12, -38, -53, 5, 9, 3, 10, 0, -6, 1, -1, 1, 1, -6, -13, 2, -23, -110, -2, 11, -39, -34, 33, 4, 4, -87, -75, -31, -14, 17, -18, 6, -17, -10, 12, -20, 20, 3, -21, -16, 2, -9, 3, -5, 3, -32, -2, 7, -50, 21, -40, 15, 1, 23, 9, 7, -6, 7, 2, -1, -2, -31, 22, -9, -34, -7, 22, -17, 10, 6, -35, 6, 1, -4, 6, 6, 4, -28, -30, 12, -43, -76, 1, -8, 31, -3, -5, 29, -6, -38, 10, -3, 1, -32, -65, 6, -42, 4, 12, -22, 17, 24, -18, 0, 4, -17, 4, 0, -6, -18, -9, 1, -56, -75, 11, -9, 27, -17, 6, 34, 14, -41, -23, -59, -30, -7, -49, -1, 11, -18, 22, -67, -17, 7, 14, -35, -7, 3, 0, -7, 5, -50, 20, -5, 1, 6, -54, 6, 9, -26, 8, 15, 46, 8, -2, 31, -4, 4, 28, 0, 12, 0, 0, -64, -10, 4, -32, -35, -7, 23, -8, -2, 5, -68, 12, -34, -8, -127, -80, 17, 31, -4, -21, 24, 12, -50, -41, 4, 28, 38, -32, 5, -14, 10, -5, -4, -18, -7, -25, -22, -8, 30, -2, -7, -8, -27, 13, -61, -38, -66, -17, 25, 22, 8, -5, 18, 11, -73, -58, -12, 29, 61, -79, -4, 13, -10, -5, -19, -36, 22, -19, 13, -1, 0, 10, 3, 1, -20, -17, 11, 1, 15, 9, 2, -11, -17, 24, -9, -33, -1, 36, -18, -10, 17, -5, 0, -8, 5, -1, -33, -17, -12, -23, -28, 1, 23, 2, -8, 1, -20, -104, 7, 42, -4, 8, 12, -16, 2, -3, -33, -5, 15, 11, -2, 13, -6, 22, -2, -17, -5, -20, 11, -82, -9, -99, 3, -1, 27, 7, -8, -7, 16, -39, -14, 29, -11, 48, 3, -20, 18, 5, -46, -18, 8, -33, -22, 20, -12, 26, -5, -33, 31, -11, -21, 37, 6, 6, 2, -25, -27, -2, -8, -5, -36, -23, 14, 8, -34, -45, -55, -54, -67, -8, 32, -65, -32, 9, -20, -33, -42, -41, 11, -29, 9, 18, -44, -24, 14, 4, 9, -11, -13, -5, 6, 5, -24, -70, 21, 41, 12, -29, -12, -70, -45, -1, -3, -3, 1, -35, -2, 1, -66, -3, -3, -11, 43, 6, 36, -43, 5, -41, 12, -14, -3, -5, 5, -11, -9, -26, -19, 39, 23, 15, -15, -46, -11, 15, -32, -26, 25, -103, -20, 10, -68, 11, -1, -4, 47, 42, -58, -52, 10, 19, 13, -27, 36, -8, 4, -14, 42, 1, 16, 4, -39, -25, 63, -7, -51, 6, 24, -61, -35, 45, -9, 17, 34, 21, -17, -24, 5, 23, -42, -93, 15, -45, -5, -26, 57, -2, -6, 14, 36, -62, -15, 8, 28, 11, 68, -3, 16, 4, 8, -38, -14, -55, -57, 52, 33, 31, 1, 8, 17, -25, 49, -127, 3, -71, 2, -17, 45, 3, -7, -6, 59, -46, -56, -50, 26, 62, -4, -15, 0, 0, -40, -30, 40, -126, -98, 47, 12, 38, 8, -33, 19, -60, -48, 1, -4, 60, 9, 3, -13, 3, 3, -9, -58, 21, -26, -50, -73, -31, -33, -2, 10, 2, 16, -13, -54, -5, 6, -42, -100, 15, -4, -73, 26, -52, -16, 4, -12, 57, -8, -3, -62, -4, 3, 7, -63, -73, -76, -45, -116, -60, -51, 4, 24, -39, 3, -60, -124, 19, -15, -75, -66, -42, -14, -89, 64, 1, 2, 22, 3, 27, -16, 13, -38, 3, -8, -7, 9, -23, -74, -35, -78, -85, -35, 24, -1, -80, 11, -32, -62, 7, -20, -51, 14, -6, 8, -40, -19, 16, -58, 22, 36, 10, 18, 14, 4, 4, -6, 5, -127, 17, -5, -38, -31, -19, 17, -5, -21, 45, 32, -12, -35, -35, 14, -23, -34, 17, 8, -74, 14, 0, -66, 22, 16, 16, 23, 6, -7, -4, 11, -3, -99, -48, 9, -62, -60, -65, -14, -22, -33, 30, 35, -76, -121, -17, 4, -14, -38, -50, 11, -86, 14, 25, -45, 30, 13, 14, 4, 8, 10, -6, 1, -10, -29, -91, -64, -35, -25, 8, 29, 4, -50, 42, 39, -75, -65, -41, -16, -16, -34, -50, -6, 45, 27, 13, -48, 13, 31, 40, -4, 2, 16, -3, -2, 8, -14, -24, 5, -12, -27, -9, 41, 4, 23, 20, 32, 0, -49, -3, 19, 3, 16, -12, 13, 37, 11, -9, -2, 4, 5, 18, 15, 17, 14, -6, 18, 1, -4, -80, -23, 5, -2, -21, 13, 1, 30, 22, 22, 12, -37, -27, 6, 29, 25, -69, 11, 21, 28, 29, -2, 2, 22, 6, 32, 6, -5, 9, 5, 0, 17, -41, -21, 10, -16, 55, 20, -9, 17, 2, 27, 30, -26, 4, -1, 23, 31, -21, -4, -21, 42, -3, -5, -6, 14, -63, -30, -4, 0, -3, 9, 5, 6, 37, -81, -33, -24, 26, -2, 6, 12, -22, -57, 32, -18, -122, -15, -19, 2, 4, 5, -30, 23, 25, 4, -44, -12, -25, -76, 7, -31, 2, 8, 1, -15, 17, -45, -31, 15, 6, 18, -7, 22, 10, -39, 8, -17, -16, -39, -13, -15, -19, 9, -1, -15, 12, 4, -68, -46, 2, -49, -3, -82, 10, 6, -3, 1, -46, -109, 54, -34, 34, -5, -46, 26, -13, -39, 13, -8, -32, -43, -36, 3, 23, 4, -7, 41, -3, -38, -11, -22, -1, -6, 1, -28, 6, 0, 6, -12, 76, -90, -8, -25, 21, 2, 20, 11, 8, 29, 63, 17, -6, 17, -28, -26, 6, -7, -29, 18, -1, -22, -24, -24, -5, 13, 3, -21, -9, -10, 2, -27, 27, -25, -7, -4, -42, 35, 6, 21, -11, -11, 66, -24, -12, 0, -1, -13, -4, -2, -13, -13, -59, 22, -80, -61, -12, -21, -15, -26, 8, -7, 1, -30, -19, -37, -47, -17, 26, 52, 26, 44, -26, -79, 22, 26, -60, -35, 1, -16, -29, 15, -11, -43, 50, -40, 40, -16, 25, 0, -14, 29, 3, 6, 1, 1, 80, -73, -7, 21, 9, -1, 6, -20, -35, 4, 43, -3, -28, 47, -5, 4, 39, -2, -64, -9, 26, -42, 23, -98, -22, -65, -1, -99, 4, 6, -2, -14, 62, -48, 5, -19, 6, -30, -9, 46, 5, 2, 55, -23, 5, 56, -64, -18, 27, 6, -9, 8, 28, 5, -77, -127, -7, -57, 8, -45, 1, -4, -6, -35, 30, -93, -1, -22, -113, 9, -48, 10, 43, 18, 39, 31, -32, 9, -36, -51, 26, 3, 9, -32, 52, -32, 3, 2, 1, -42, 0, 1, -8, 1, -5, -51, 34, -6, 28, 38, 35, -32, -101, -29, -65, 35, -13, 53, 21, 12, 17, -24, -9, -11, 17, -44, 18, -40, -18, -1, -3, -67, 8, -50, 8, -2, 2, 26, 25, -32, 13, 8, 31, -10, -127, -72, -10, 42, -11, 64, 21, 14, -59, -78, 25, 1, 5, -37, 3, -2, -22, -18, 21, -41, 7, -40, -10, 1, -3, 10, 79, -25, 3, 8, -37, -92, -106, -45, 4, 19, 12, -23, 8, 23, -24, -28, 39, 3, -36, -53, 24, -1, -15, 25, 14, -7, 14, -31, 7, 6, 0, -14, -53, 28, 31, 14, -21, -101, -38, -39, -5, -34, -9, 12, 27, -5, -12, 4, 30, -3, -122, -50, 22, -47, 7, 12, 21, 12, 15, -85, 4, -2, -8, -53, -23, 10, 5, -21, -16, -88, -65, -37, 4, 11, 1, 12, 18, 18, -36, -5, 20, 3, 11, -15, 12, -77, 26, -13, 14, 8, 11, -30, 7, 7, 10, -6, 7, 1, -2, -28, 49, -74, -42, -6, 9, 31, -17, -4, -9, 30, -18, -8, 8, -5, -42, -12, -25, 22, -7, 56, -1, 11, 13, -46, -9, 0, -5, -84, -33, 27, 9, 25, 3, -15, -5, 10, 21, -78, -12, 5, -16, -1, -12, -42, 16, 5, -28, -4, -22, -115, -24, 41, 25, 25, 14, -99, -12, -10, -3, -36, -39, 49, 14, -2, 9, -49, -8, 15, 37, -45, 2, -3, -4, 23, -95, -24, -10, 8, -30, 7, 3, -67, -27, 11, 24, 6, 0, -22, -7, -1, -6, 12, -6, -8, 9, 1, 15, -5, -11, 12, 4, 19, -20, 13, -11, 9, -43, 3, -13, -1, 26, -38, -7, -27, -65, -98, 14, -69, -1, -42, 5, -6, -1, -23, 20, -99, 11, -26, 8, -21, -23, 29, -43, 1, -9, 15, -44, -15, -35, -26, -41, -4, 4, 28, 24, 14, 9, -6, 11, -50, -3, 9, -2, 13, 10, 14, 7, -23, 15, -5, 7, 12, 1, -12, 5, 22, -18, 10, -9, 7, 17, 10, -33, -2, -6, -13, 7, 24, 6, -20, 18, -19, 1, 18, 1, 5, -4, 8, 27, 7, 2, 41, -21, -1, 15, 5, 31, 18, 18, 13, 16, 28, 29, 8, 22, -2, -5, -11, 1, -23, -21, -46, -16, -79, 0, -77, -3, -2, -1, -13, 14, -127, -23, -5, -15, -19, -38, -1, -32, -25, -14, 4, -66, -36, -50, -40, -70, 4, -3, 7, 14, 11, -18, -24, -34, -33, -20, -3, 8, 1, -4, 16, 19, -16, -4, -6, 3, 9, 9, -5, -14, 19, -24, 28, -31, -35, 9, 7, -18, 4, -13, -17, 7, 2, 7, -9, -47, -32, -8, 1, 5, -1, -7, -2, 7, 12, -7, 41, -19, -10, -17, -5, -6, 10, 15, 28, -4, -16, 14, 11, 9, 2, 21, -7, -44, -21, -50, -26, -28, -54, -9, 7, 6, -8, -4, -16, 11, -100, -11, -12, 48, -6, -25, 5, 1, 6, -11, 18, -46, -39, 5, 16, -47, -6, 22, 39, 37, 15, 14, -15, -43, -17, -7, 9, -3, -4, 11, 2, 27, -19, -18, -19, 23, 22, -4, 5, 3, 26, 16, 12, -49, 27, 30, 24, -23, -3, 21, 4, -1, 30, -33, 9, -39, -21, -8, 24, 2, 7, 6, 8, 16, -5, -32, 18, 36, -3, 5, -15, 4, 27, 28, 6, -29, 31, 31, 10, 51, 2, -66, 4, 8, -5, 5, 24, -15, -1, 5, -38, -4, 0, -3, 4, 16, -18, 22, 24, 10, 17, 21, 11, 1, -2, 10, -26, -37, 18, -14, 37, 34, -2, 9, 13, -14, 8, -12, -31, -41, -4, 1, 8, 7, -3, 11, -22, 23, 10, -14, 16, -3, -24, 28, 7, -51, 19, -10, 14, -19, 14, 13, -17, 10, 0, 22, 26, 12, 20, -10, 1, -3, 25, 2, 24, -4, -6, 4, -21, 8, 21, 22, 13, 20, -51, 13, -27, -11, -5, -61, 9, -22, -16, 17, -13, 4, 0, -3, -2, -22, -8, -17, -30, 5, -14, 9, 1, -2, 5, 1, 6, 25, -48, -36, -23, 24, 13, 33, 25, -5, 4, 32, 3, -66, -16, 3, 2, 6, 0, 34, 18, -56, 9, -12, -65, 3, -4, -2, 23, -4, 3, -1, -25, -5, -18, -68, 2, 6, -14, 4, 5, -39, -35, -2, -3, -34, -15, 13, -34, 3, 6, 21, 2, 8, 12, 1, -10, -27, 31, 2, 20, -5, 3, 7, -14, -3, 6, -25, 9, 33, -33, 17, -36, -11, -19, -53, 2, -41, -22, 9, -15, -2, -2, 19, 14, -18, -10, -32, -1, -34, -6, 5, -18, 5, -6, 5, -27, 24, -35, -57, -43, -17, -7, -17, 3, -20, 52, 13, -43, -63, -20, -6, 15, -26, 0, 22, -7, -69, 11, 10, -40, -46, 13, 9, 13, 0, 4, 3, -53, 6, -31, -127, 4, -13, -16, -18, 1, -19, 22, 13, -33, -19, -40, 7, 9, -37, 0, 5, -30, -49, -1, 0, -36, -26, 20, 5, 17, 4, 3, -3, -44, 1, 1, -31, 5, -6, -45, -47, -23, 2, 32, -50, -2, 0, 13, 23, -4, 7, -5, -56, 36, -22, 11, -3, 3, -25, -10, 5, -61, 5, -4, -1, -28, -12, -49, -42, -25, -43, -38, 12, 39, -32, -12, -5, -40, -34, -5, -54, -53, -5, 0, -35, 45, 8, 20, 6, -3, -38, 6, 4, -45, -4, 6, -6, 3, -69, -13, -65, -56, -13, -26, 23, 25, 20, -26, -35, -38, 31, -20, -38, -42, -28, -1, -1, 24, 31, -14, -11, 21, -28, 16, -3, -34, -6, -1, -6, -7, -80, -59, -26, -54, -8, -17, 17, 16, 26, -16, -12, -82, -23, -74, -23, -15, 12, 2, -15, 14, -13, 14, 4, -6, -8, -42, 0, -25, -6, 7, 4, -2, 20, -77, 2, -7, -9, 6, -34, 18, 3, 16, 27, -12, -19, 6, 0, 7, 22, -2, 12, 5, 10, 37, 20, -2, -2, -34, -1, -35, 1, 8, 0, 13, 12, -53, 9, -33, -25, 13, -14, 34, -6, 13, 20, -38, -7, -4, -3, 2, 8, 3, -9, 3, -10, -40, -5, -19, -24, -25, 6, 2, -5, 0, -3, 12, -7, -127, 2, -35, -16, 32, -7, 30, -18, -14, 9, -47, -36, 8, 1, 5, -2, -7, 32, 16, 10, -19, -19, 10, -4, 26, 2, 22, 0, -2, -1, -8, 1, -33, -1, 18, 16, 6, 5, 22, 4, -6, 19, 5, -29, -20, 9, 8, 14, 3, 18, 13, 0, 6, -39, -18, -5, 12, 1, -17, 8, -5, 0, -7, -2, -69, -6, -7, 41, 3, -4, -8, -29, -3, 39, 8, 18, -12, -19, -14, 30, 2, 9, 20, 22, -40, -36, 9, -1, -20, -1, -44, 3, -3, 0, -5, -14, -68, 2, -13, 9, 11, -8, -1, -28, 1, 44, 4, -23, 4, -32, -31, 21, 8, -16, -9, 31, 12, 1, 18, -7, 10, 1, -3, -3, -5, 4, 4, -34, 25, 41, 4, 11, 26, 22, -29, -8, -7, -84, -5, 59, -48, -8, 13, -23, 4, -38, -17, 5, -29, 22, 8, 7, 39, -1, 23, -2, 3, -2, -2, -41, 27, 14, -3, -58, 11, 17, -4, 41, -16, -25, -6, -7, -42, 28, -23, 20, -2, 11, 13, -13, -3, 16, 0, 26, 33, -5, 33, 8, 10, 4, 26, -66, 24, -5, 0, -22, 1, 10, 2, 14, -67, 1, -6, -31, -71, 23, -31, -4, 5, 10, -46, -18, 1, -46, 7, -44, -17, 9, 6, 5, 0, -6, -52, -5, 15, 21, 1, -55, 21, 6, -12, -13, 10, -74, 31, -1, -80, 8, -20, -40, -9, 0, -63, -11, -14, -59, -14, -126, 24, 7, 30, -6, 9, 7, 4, -25, 4, 4, -6, -26, 19, 19, -30, 51, -16, -61, 22, -57, -89, 26, -19, 17, 3, 47, -10, -14, -9, -53, 6, -20, 21, 8, 22, -3, 2, -5, 31, -81, 4, -30, -8, -13, -9, -6, -49, 21, -77, -26, -11, -43, -19, 39, 15, -1, 2, 19, -41, 5, 18, -56, -30, -43, 0, 0, 7, 5, 8, -3, -35, -19, -11, 47, -9, -79, 6, 17, 15, -3, 20, -47, 38, -1, -42, 20, -50, -15, 7, -10, -24, -36, 14, -76, -98, -127, 3, -4, 24, 2, 6, -12, 10, 4, -20, -2, -32, -7, -8, 18, -11, 32, -53, -113, -3, -47, -88, 27, -35, -82, -4, -7, 48, -75, 46, -45, -47, -81, 8, 19, 14, -5, -9, 9, 14, -77, -17, -71, 36, -40, -11, -45, -18, 9, -54, -74, -27, 2, -45, 18, -58, -81 };
+static const int32_t conv5_b[64] = { 6, 50, -26, -23, -3, 50, 51, 88, 25, -16, 148, 16, -10, -40, 38, 66, 20, 65, 93, -6, 30, 6, -22, 1, -4, -47, 131, 36, 28, 3, 57, 70, 43, 26, 80, 9, 151, 36, -8, -19, 35, 21, -9, 58, -31, 34, 168, 27, 29, 45, 2, 1, 21, 69, 57, 37, 22, 37, 89, 61, 44, 18, 65, -18 };
+static const int32_t conv5_m[64] = { 1532590595, 1823144193, 1408408675, 1564523431, 1959022565, 1102869473, 1485466000, 2032673410, 1365091335, 1658764748, 1969957722, 1240638831, 1418920767, 2106136399, 1203450559, 1192598241, 1184686532, 1387499380, 1208199204, 1142991478, 1436757377, 1291878970, 1806895602, 1253883824, 1195763080, 1277461592, 1249912999, 1427023659, 1539808544, 2054427949, 1320338678, 1250950313, 2002015315, 1284566095, 1291937744, 1487510686, 1173228393, 2139800864, 1259030915, 1084904667, 1186602358, 1422672907, 1642640803, 1706249087, 1387439385, 1164643217, 1183422104, 1298684055, 1753065837, 1885358856, 1472795555, 2017453483, 1235026978, 1380080932, 1548761559, 1739982196, 1142055300, 1257533830, 1251865309, 1221975053, 1736419798, 2045648596, 1840124137, 1388663336 };
+static const uint8_t conv5_s[64] = { 38, 38, 38, 38, 38, 37, 38, 38, 38, 38, 39, 38, 37, 39, 38, 38, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38 };
+// conv6: input scale 1.36987, output scale 1.39707
+static const int8_t conv6_w[64][3][3][64] = { -52, 11, 6, 41, -12, 19, -38, -29, 30, 20, 4, 41, 18, -19, 8, 19, -7, 1, -17, -7, 26, -8, -10, -27, 53, 3, 10, 12, -9, 6, 34, 10, 25, 6, -7, 33, 14, 10, 25, 5, 36, -16, -26, -35, 34, -14, -35, 1, 12, 41, 49, -24, 19, -2, -11, 13, -7, -16, -14, 7, -47, -26, -39, 15, -7, -32, -3, -5, -33, -7, -47, -17, 21, -24, 0, 36, 19, -10, -17, -38, -5, 18, 2, -36, 13, -18, 26, 48, -22, -30, -47, 1, -21, 14, 23, -61, 5, -34, -13, -12, 6, 0, -9, -12, -1, -49, -32, -57, -26, -19, -18, -48, 2, 14, 9, 0, -1, -63, -11, -4, -33, -25, -9, 15, 3, 25, 1, -38, 26, 11, 7, -6, -32, -40, 5, 75, -29, -24, -25, -23, -14, -34, -52, 37, -21, 24, 32, -20, 4, 1, 13, 76, -104, -50, 13, -50, -1, 10, -43, 29, -36, 0, 28, -13, 23, -17, -52, -53, -60, -13, -79, 30, -122, -50, -9, -62, 10, -67, -87, 53, -24, 28, -46, -52, -48, 24, 17, -19, 23, -10, 22, 14, 8, 8, -12, -35, -16, -10, 0, -13, 14, 4, 15, -5, 2, -45, -31, 20, -23, 13, -2, -1, -13, -13, 3, 3, -39, -4, 16, 5, -61, -20, 9, -47, 12, -25, 46, 24, 5, 1, 26, -4, 1, 15, 8, 6, -13, 2, -59, -11, 2, 13, -36, 26, 26, 7, -3, 1, -6, -11, -16, 22, 9, -13, -17, 38, 24, -16, -17, -3, -31, -28, -37, -10, 26, 14, -6, -6, 2, -35, 24, -4, -63, 30, 3, 0, -27, -13, -3, 14, 14, -17, -9, -13, -16, -2, -26, -18, -17, -4, -15, -11, -12, -27, -7, -25, -35, 9, -16, -9, -68, -3, 1, -56, -6, -23, -15, 24, 3, 2, -48, -6, -30, 4, -10, 10, 12, -12, 9, -9, -42, 9, -42, 3, -16, -12, 9, -7, 49, -38, 23, 4, 3, 10, -67, 2, -63, 18, 14, -7, -21, -47, -20, -15, -25, -53, 19, -3, -7, 10, 6, 13, -16, 1, -13, -1, -49, -73, -68, 29, 19, 24, -28, -36, 44, -10, 1, -53, 22, -72, -11, 14, -58, -47, -26, 47, -40, -27, 15, -46, 0, -35, 4, -70, 17, 2, 6, 25, -50, 10, 13, 9, 16, 1, 30, -48, -20, -50, -20, 5, -35, -1, -50, -10, -35, 31, 34, -15, -2, -40, -21, 12, -8, 8, 7, -5, 12, 15, -6, 18, 18, 16, 7, -12, -9, 36, 14, -11, 18, -18, 18, -4, -56, 25, -37, -19, -9, -21, -25, 15, 16, -3, -29, 1, -32, 14, 38, 22, 52, -30, 18, 30, -42, 32, -9, 9, 15, -25, -2, -123, -18, 11, -34, -7, -27, -29, -9, -7, -84, 0, 8, -29, 28, 11, -71, 0, 19, 13, 6, -11, 8, -32, -47, -37, -3, 12, -22, -13, 0, -3, 23, -54, 15, 8, 13, -48, -46, 9, 18, -59, -31, -18, 32, -4, -18, -78, 8, -65, -6, 2, -5, 50, -63, -19, -26, 30, -5, 16, 10, -4, 32, -69, 28, -7, -62, -3, -44, -37, -57, 4, 22, -66, -44, -127, -26, -49, -21, 13, 14, -17, 15, -12, -9, -24, -8, -107, -17, -19, 19, -23, -11, -5, -49, -17, 25, -38, -19, -4, -22, -31, -81, -29, 37, -120, -27, -46, -24, -2, -107, -20, -4, -49, 7, 5, -13, -4, -13, 22, -23, -5, -47, -15, -84, -71, 18, 11, -7, -43, 37, -7, 2, 15, -24, 1, -27, -9, -75, 10, 43, -35, -14, 15, -59, 3, 3, 39, 4, 3, 1, 16, 22, 1, -48, -22, -6, 6, 24, -17, -15, 12, -29, 19, -12, -6, 50, 38, 12, 18, 17, 19, -78, 26, 5, 5, -11, -32, -78, -56, -19, 14, -70, 2, 12, 17, -15, 22, -25, 7, -9, 35, -1, 2, 28, -28, 56, 5, 2, -13, -30, -32, -105, -19, 21, -28, -6, 23, -65, -6, 4, 5, 18, -80, 13, -5, -32, -12, -8, -4, -1, 6, 29, -5, 19, -71, -51, 13, 0, -13, 32, -28, -2, 29, 13, 3, -61, 20, -2, 22, 7, -39, -37, -8, 6, -1, 15, 15, -7, 63, -4, 4, -7, 48, 7, -36, -3, -17, 15, -74, 15, -48, -3, 33, 5, -35, -83, -95, -37, 7, -20, 2, 0, -38, 9, -35, -4, -52, -53, -45, -1, -6, 9, -83, -45, -21, -48, -27, 14, 20, -34, -17, -2, -29, -21, -99, -67, 9, -78, -74, 34, -85, -54, -18, 30, -29, -8, -4, 43, 4, 2, -9, -21, 10, -25, -14, -62, -4, 21, -23, -23, -13, -2, 3, 25, -9, -31, 12, 5, 3, -70, 15, 0, 11, 6, -17, -64, 11, 22, 27, -6, -27, 1, 14, -38, -43, -34, 2, -2, -5, 26, 4, -6, 20, 4, -20, -11, -30, -2, -19, 32, -4, -20, 4, -21, 5, -7, 9, 0, 11, -69, -6, -34, -8, 11, -3, -6, -11, -35, 16, -83, 8, -58, 6, -25, -3, -14, 19, -19, -10, -85, -1, -12, -11, -91, 12, -75, -21, -41, -28, -38, 13, 0, 7, 5, -13, 7, 19, -54, 15, 6, 21, -10, 0, 4, 11, -14, -21, 27, -24, -26, -17, -1, -9, -11, -3, 3, -10, -26, 9, 2, -38, 30, -18, 0, 1, -36, 13, -19, -2, 49, -2, 0, 18, -35, 16, -127, -34, -18, 38, -3, -36, -89, -25, -28, -51, -8, -116, -51, -40, -62, -37, -20, -89, 24, 24, -14, 39, -23, 4, -3, -3, 2, 13, -11, -6, -19, 3, 24, 0, -67, -52, 12, -5, -13, -17, -46, -57, -19, 58, -29, -32, 16, 38, 15, -32, 25, -47, 9, -3, -33, -8, 19, 14, 1, 13, -87, -21, -41, 9, 21, -13, 15, 33, 2, 12, 10, 11, 7, 7, -14, -42, 15, 3, -8, -15, -15, -34, -39, -70, 43, -4, 19, -28, -38, 19, -47, -17, -25, -23, 25, 35, 3, -102, 6, -19, -17, 17, 30, -14, -10, 26, 43, -33, -4, -13, -34, 9, 10, 16, -12, -45, -29, 24, -10, -36, -61, 5, -3, -50, -46, -17, -79, 33, -10, -6, 12, -14, -36, -3, -26, 14, -64, 4, -31, -2, -28, 59, -67, -21, -23, -75, -15, -116, 39, -8, 2, -25, -76, 37, -46, -2, 20, -45, -46, 11, 38, -52, -58, 3, 16, 11, 16, -35, -53, 8, -96, -38, -18, -43, -23, 12, 23, 2, -20, -55, -12, 9, -56, -29, -28, 46, 4, -75, -10, -19, -61, 20, 1, -42, 19, -27, -57, -51, -60, 19, 7, 41, -88, -7, 0, 68, -65, -5, 3, -31, 25, -41, 17, -27, -18, -25, 26, 62, -39, 18, 11, -50, 21, 21, 13, 22, -78, 1, -38, 16, 28, -14, 10, 57, -57, -48, -22, -75, 44, -25, -47, -17, -40, -70, -13, 3, -6, -41, -4, 22, -19, -102, -34, -12, -35, 5, -105, 23, -17, 64, -84, 52, -51, 14, -5, 9, -49, -58, 26, 3, 24, -31, -25, 9, -51, -85, -4, -3, 43, -87, 5, -5, -28, -21, -20, -11, -55, 96, -48, -21, -9, -11, 30, 2, -5, 24, 39, 28, -12, -14, -56, -72, -15, 1, -24, 37, 6, 4, -19, -47, -49, 24, -10, 4, -81, -31, -41, 24, 24, -2, -10, -4, -14, 21, -3, -27, 15, 26, -40, -68, 26, -7, -26, -38, -32, 12, -59, 2, -41, 34, 14, -35, -26, -23, 35, -60, -55, -50, -12, -19, -31, -8, -54, -7, -32, 14, -37, -3, -9, -30, -3, 35, -76, -24, 52, -23, 7, -33, 44, 29, 12, 0, 53, 66, -22, -32, 63, -69, -34, -9, 5, -13, 72, -38, -52, 7, -35, 11, -57, 49, -31, -44, -39, -19, -5, -24, -57, -59, -39, 6, -18, -58, 32, -29, 11, -79, 30, -14, -13, -20, 6, 91, -11, -19, 28, -18, 28, -29, 10, -79, -36, 10, -22, -26, -1, -23, 50, -25, -6, 40, -41, 25, -29, -11, 0, -46, 28, -41, 21, -7, 42, -47, -40, -22, -28, -108, 16, -2, -66, 57, -41, 9, 39, 40, -54, 8, -34, -24, 29, 39, -28, 32, -6, -61, 4, -46, -19, 34, -46, 34, -77, -38, -2, 44, -7, -43, 1, -25, -37, -15, -62, -53, -21, -1, 11, -6, -18, -21, -12, -38, -24, 34, -35, -61, -1, -46, -26, 24, 15, -19, 3, -34, -31, -14, 4, -31, -21, 2, -24, -55, 32, -57, 9, -9, 7, 31, -27, -31, -7, -19, -23, -45, -25, 17, -27, -33, 59, 8, -23, -4, -47, -22, -9, -29, 19, -32, -30, 39, 9, -14, 2, -108, -26, -59, -14, -32, 18, -29, 7, -15, -13, -14, -32, -62, -44, -39, -37, -19, 25, 21, -43, 24, -45, -83, 60, 29, -64, -37, 25, -15, -28, 8, -19, -63, 45, -85, 4, -71, 16, -11, 25, -4, -37, -45, -24, 25, -39, -46, -25, 31, -29, -6, -19, -14, 11, 21, -40, -5, -35, 28, -96, -20, 9, 19, -49, -67, -1, -47, -22, -31, -9, -42, -11, 11, -39, -19, -30, -81, -37, -42, 4, -14, -3, -3, -59, -13, -2, -53, 35, -1, 48, 12, 15, 6, 1, -52, -1, 11, -3, 17, -52, 58, -5, 5, -61, 23, -22, 95, -55, -65, -55, -25, 51, -34, -16, 27, -10, 3, -50, -18, -52, -46, -22, -45, -18, -2, 29, -19, 11, -47, -41, -12, -4, -74, 18, 61, 47, 46, 23, 38, 8, -31, -48, 29, 9, -10, 30, -7, -4, 80, -53, -46, -40, -7, -22, 7, -79, -28, 11, -5, -29, -17, -2, 2, 2, 19, 11, 48, -32, -11, -45, 73, -71, -79, -44, -33, 26, -55, -7, 26, -87, -45, -66, 4, -60, -100, -75, -52, -43, -58, -11, -28, -29, 33, -22, -46, 28, -39, -35, 41, 24, -17, 19, 27, 21, -10, -38, -34, -28, -61, -46, 9, -9, 32, 5, -61, -40, -72, 0, -25, -50, -77, -63, 5, 2, -12, -58, -6, 80, 4, -9, -7, -13, -18, -30, -73, -58, 48, -49, -1, -15, -33, 12, -44, -65, 10, -9, -9, -12, -96, -78, -67, 33, -4, -71, 14, -50, 7, -16, -127, -54, -27, -4, -31, -49, -80, -83, -9, -30, -8, -39, -46, 34, -25, -10, -87, -55, -40, -35, 19, -84, -49, -31, -54, -16, -107, -23, -25, -45, -65, -41, -47, -34, -32, -10, -32, -30, -85, 1, -80, -54, -41, -14, -67, -17, -44, -37, 9, -14, -64, -49, -63, -66, -3, 21, -31, -68, -40, -9, -56, -45, -30, -63, -49, -13, -72, -38, -80, -86, -33, -14, -61, -59, -9, -8, -46, -102, -68, -73, -71, -6, -50, -33, -48, -51, -31, -56, -82, -20, -115, 19, -48, 8, -43, 53, -49, -67, -12, -5, -37, -47, 7, 15, -22, 3, -16, -54, -46, 23, 12, -48, -55, -24, -62, -63, -48, -7, -49, -69, -59, -27, -90, 18, -14, 29, -95, -18, -64, -62, -67, -35, -29, -29, -30, -16, 1, -7, -3, 28, -70, -69, -73, -48, -65, -52, -93, -51, -87, 2, -54, -29, -17, -8, -104, -8, 4, 45, -17, -69, -28, -22, -59, -44, -30, 9, -24, 20, -101, -4, -106, -3, -65, -31, -37, 15, -14, 18, -11, -17, -63, 5, -4, 11, -75, -42, -43, -77, -13, 20, -31, -6, -45, -59, -12, -65, 46, -31, -3, -24, -8, -51, -37, -56, -41, -78, -107, -43, -37, -12, -37, -91, -61, 15, -68, -87, -52, -43, -46, -47, -74, -2, -72, -26, -56, -30, -2, -26, -48, -1, -78, -52, -46, -68, -90, -14, 12, -29, -12, -59, -22, -36, -17, -13, -6, -66, -3, -38, 15, -32, -63, -62, -24, -56, -108, -44, -44, -18, -119, -66, -18, -10, -6, -19, -24, -21, -79, 4, 12, 3, -34, -3, -13, -63, -88, -57, -47, -50, -55, -89, 14, -2, -42, 6, -56, -27, -78, 10, -60, -35, 41, -64, 1, -41, -6, -11, -33, -71, -106, -7, -45, -31, -3, -10, 7, -64, -17, -7, -37, 7, -35, -45, -53, 7, -51, -16, -33, -55, -21, -80, -28, -44, -70, -66, -65, -62, -44, -39, -38, -64, -40, -33, -9, -20, -46, 11, -14, -37, -63, -114, -33, 7, 4, -103, -7, -9, -43, -24, 10, 14, 21, -33, -57, -86, -47, -72, -4, -47, -18, 8, -9, -42, -64, -23, -40, -19, 31, -72, -51, -67, 24, -9, -19, -58, -32, -2, -15, -35, -18, -21, -24, -8, -5, -6, 20, -102, -124, 7, -40, -21, -9, -49, -63, 3, 27, -61, -67, -47, -47, -11, -55, 31, -16, -15, 38, 27, -10, -76, 10, 29, -47, -35, -53, -32, 14, -39, -51, -16, 12, -33, -2, -12, 42, -48, -39, 4, -4, -36, -87, 17, 25, 9, -16, 1, -74, -29, -5, -9, -42, -14, -14, -31, -33, -12, -47, -47, -14, -109, -110, 14, -6, -52, -60, -47, -40, -59, -92, 10, -51, -52, 2, -48, -57, -59, -71, -50, 13, -47, -109, -15, -38, -49, -58, -46, -10, -43, -73, -53, -69, -55, -72, -25, -69, -26, -73, -8, -64, 22, -50, -12, -71, -36, -58, 47, -21, -3, -7, -20, -45, -116, -117, 7, -88, -24, -17, -102, -48, 6, -36, -61, -6, -79, -73, -65, -27, -71, -59, -38, -65, -87, 4, -100, 5, -69, -22, -121, -95, -24, 3, -24, -51, -21, -3, -30, -66, -75, -71, -41, -55, -2, -12, -53, -55, -45, 15, -27, -59, 1, -53, -42, 9, 36, 1, -9, -55, -111, 41, 28, -28, -14, -69, 6, -21, -25, -68, 49, -120, -38, -62, -77, -8, -19, 36, -89, -53, -23, -100, -34, -26, -127, 11, -94, -68, 18, -51, -41, -76, -9, -26, -123, 27, -80, -90, -21, -41, -20, 21, -29, -55, -4, -50, 25, 1, 17, -56, -41, -11, 33, -51, -11, 24, -44, 4, 9, -3, -10, -34, -12, 47, -2, 15, -21, -49, 50, 87, -47, -19, 34, -43, -53, -72, -112, -58, 5, 1, -9, -12, -25, -7, 3, -101, -65, -66, -5, -34, -34, -40, 7, -27, 8, 3, -1, -30, -35, -53, -35, -52, -3, -48, -47, 7, -39, 32, -18, 36, 29, 4, -13, 41, -58, -14, 9, 70, -8, -1, 4, -41, 49, 21, -28, -29, 40, -45, -39, -4, -33, 20, 20, 57, -53, -13, 24, -33, 57, -30, 50, 90, -32, -32, 28, -75, -42, 23, 20, -92, 6, -1, -15, 60, -16, -28, -46, -20, 16, -28, 13, -57, -10, -81, -64, -96, 26, -19, -21, 1, -39, 61, -1, -14, -4, -7, -22, -7, -13, 16, 24, -38, -13, 0, -92, 0, 47, -9, -7, -14, 3, -7, -85, 28, -24, 19, 6, -19, 28, 7, -21, 5, 26, -16, 10, 44, -1, 15, -72, -17, -64, 1, 24, 17, -24, -19, 20, 12, 25, -45, -4, -6, -24, 4, 59, -47, 18, -9, -9, -52, 5, -39, -49, -76, 27, 31, 10, -62, -60, 7, 24, -38, -53, 45, 27, 3, -56, 26, -29, 23, -39, 39, 20, 5, -20, -7, -39, -28, 8, 3, 17, -24, 63, 3, 29, -3, -34, -48, -99, -4, 7, -38, 1, 25, 11, 35, -5, -2, -27, -3, 37, 0, 22, -27, -52, -7, -21, 28, 18, -7, -5, -34, 20, 42, -10, -13, -2, 46, -1, -23, -33, 4, -10, 21, 29, 30, -68, 22, 25, 6, 8, -1, -18, -20, -68, 38, -2, 58, -8, 7, -51, 14, -9, 18, -20, -25, 32, -9, -7, 31, 41, -5, 1, 22, 31, 13, 29, -14, -2, -24, -27, -5, -16, 16, 22, -5, 33, -9, -6, -8, -39, 5, 17, 47, -26, -38, -14, -60, -14, -6, -23, -10, -29, -21, 14, -18, 2, -32, -14, 24, 6, 13, -64, -54, 3, -30, -22, -21, -61, -31, 0, -12, 74, -8, -35, -10, 17, -41, 1, -7, 28, -28, -21, -13, -20, 16, 25, -27, -12, 24, -13, -20, -8, 13, -2, 19, 35, 17, 47, 12, 45, 3, -12, 33, 16, -40, 48, 49, -3, -24, -1, -37, -27, 25, -105, -16, -43, -7, -41, 17, -5, 26, -8, -116, -30, -19, 30, -84, -19, 20, 34, 16, 4, -20, -2, 1, -56, 47, -46, 41, -126, -18, 58, -32, 15, 12, 34, 30, -41, -77, -93, -79, 66, -36, -20, 24, -13, -46, -51, 3, -13, -2, -24, -52, -26, -44, -57, -7, -32, -11, -19, -19, -13, -55, 8, 57, 10, -64, 12, 39, -26, -4, 9, 29, -6, 13, -15, 53, -81, -4, 17, -27, 21, 6, -9, 16, 13, 42, -39, -16, 33, 21, -8, 43, -29, -121, 31, -39, -20, 21, 60, -13, 9, -89, 54, -11, 55, -26, 1, -34, 0, 41, -64, 10, -5, -5, -79, -28, -39, -74, -29, -2, 14, 14, 6, -34, -9, -64, -33, 42, -12, -44, 18, 42, -12, -18, -29, -66, -59, -17, 1, 37, 5, 14, -127, 3, 71, 8, -58, 19, 2, -1, -6, -72, 37, 53, -40, 3, -25, -7, 24, 0, -9, 34, -59, -9, -78, 24, 38, 87, 30, -69, 9, -46, -46, 34, 25, 33, -110, -19, 22, 19, -11, -12, 9, 13, -20, 26, -8, 20, 12, -46, -22, 13, -13, 10, -60, 39, -15, 37, -79, -75, -51, 11, -13, -15, 9, 30, 11, -10, 45, -26, 3, 11, 44, -22, 35, -4, 4, -6, -45, 21, 16, 29, -54, -48, -40, 34, 21, -27, -16, -12, -4, 18, -13, -8, -16, 14, 0, 32, -1, -88, 7, -15, -46, 2, -56, -25, -32, -6, 13, -29, 18, -39, -22, -38, -46, -44, -12, -11, -67, 13, 18, -17, -42, -18, -35, -2, -6, 10, -35, -13, -18, -81, -20, 2, -16, 17, 19, 26, 6, -33, 41, -30, -39, -49, -94, -34, -22, -15, 14, 60, -1, 4, -42, -10, -19, 18, -6, 11, -21, 6, -15, -71, -4, 12, -30, -28, 32, -32, 0, 7, -29, 8, -13, -52, -41, 17, 26, 29, 5, -17, -17, 29, -113, -62, 28, -4, -88, 37, -5, -41, 6, 35, 3, 7, -70, -119, -26, 6, -12, -6, 7, -13, -5, -49, 3, -1, -117, -26, -116, 7, -25, 25, 7, 2, -48, 45, -2, 17, -42, -21, -6, 0, -26, 10, -75, -69, -31, 15, -12, 31, 32, 36, 40, 21, -42, -9, -20, -20, -25, 42, 32, 34, 10, -35, -4, 41, -10, 5, -26, -48, 19, 30, 4, 6, -10, -14, -21, -11, -25, -3, 13, -32, -23, -1, 4, -17, -15, -33, 50, -45, 0, -5, -44, 22, -7, -1, 11, -7, -15, 23, -1, 12, 39, 23, 32, -18, -48, -10, -6, 22, 2, 2, -4, 27, 1, -2, 14, -5, 10, -16, 11, 27, 41, -31, 13, -16, 11, -28, 19, -28, -10, 16, 1, 3, -25, 6, 3, -12, -44, 19, -30, -25, -26, -6, -59, -18, 2, 14, -13, -10, -42, -5, 3, -22, -30, -29, -32, 4, 5, 14, -1, -36, -19, 2, 11, 47, -5, 49, -46, 38, -9, -17, -15, -11, 5, 12, 5, 11, 1, 14, 3, 8, -3, -11, 2, -3, -36, -22, -1, 17, 0, -36, -10, -38, -21, -13, -5, 17, 1, 13, 19, -71, -1, -6, 31, 9, -54, -20, 29, 1, 31, -23, -25, 12, 6, -50, -17, -11, -59, -16, -43, -50, 12, 30, -9, -25, -5, -1, 25, 31, -27, -6, 28, -21, -1, -6, -9, -17, 16, -8, -20, 2, -10, 52, 3, -16, -12, -36, -3, -38, -20, -11, 0, 30, 10, -51, -1, -4, 21, -15, -24, 21, -32, -5, -21, 50, -16, 6, 22, 40, 2, -32, 16, -39, -1, -90, -11, -30, -42, -30, -40, -2, 50, 7, -60, 10, 22, -25, 68, 22, -31, 29, -31, 70, 58, 16, 42, 18, 28, -14, 2, -12, 15, 29, -12, -77, -7, -32, 40, -2, 12, -27, -66, -15, -34, 24, -16, -66, -1, 9, 26, 8, 8, -39, 10, 6, -30, -14, 38, -23, -6, 57, -20, -43, -38, -30, 34, -55, 20, -81, -79, -11, -29, -25, -20, -48, -40, -48, -66, -95, -19, -31, 26, -49, -20, -127, 36, 57, 9, -36, 9, -54, 6, -57, 0, -37, -20, 45, 10, -61, -6, 30, 61, 10, 13, -28, -20, -75, -84, -11, -1, 5, 14, -70, -65, -54, -8, -22, -20, 30, -21, -25, 8, -43, -1, -31, -25, -1, 0, -37, 1, 34, -20, 0, -51, 2, 14, -31, 39, 1, -33, -46, -59, -29, -23, -17, 14, -51, 26, -29, -41, 19, -60, -62, -13, -29, 16, 7, -17, 10, 7, -3, -38, 0, 16, 53, 22, -25, -11, -8, 15, 25, -22, 17, 21, -9, 28, -65, -43, -39, -38, 5, -14, 31, -1, -35, 3, 28, 30, 24, 5, 5, 8, -13, -16, -44, 2, -13, -10, -16, 18, -4, -64, -11, -16, 16, -65, 22, 4, -17, -127, -4, -10, -17, 13, -47, 10, -44, 16, 21, -29, -76, -5, -1, 55, -8, 27, -2, -10, -21, -30, -14, 0, -23, -103, -32, -8, -24, -11, 21, -45, 3, 49, 14, 21, 7, -77, 22, -5, -20, -83, -16, -53, 11, 42, -41, -13, 35, -1, -44, 10, -25, -58, 17, 32, -30, 18, -7, 18, -57, -65, -114, 24, 5, -6, 15, -38, 2, 18, 21, 32, -35, -33, -51, -14, -16, -32, 9, 0, 28, 4, -26, 2, -27, -12, -18, 9, -41, -47, -74, 21, -52, 25, -41, 17, -19, 34, -72, 12, -51, -14, -42, -30, -34, -4, -63, 39, -47, -8, 14, -20, 48, -36, 24, 3, 47, 22, 13, 34, -117, -29, -25, 20, -3, -38, 19, -6, 12, 17, -37, -31, -77, 42, -6, 6, 0, -19, -44, -1, 36, 20, 2, 15, 15, -74, -44, 16, -42, 1, 20, -50, -6, 11, -5, 5, -26, -44, -101, 21, 72, -48, -12, 43, -62, 27, -14, -18, -15, -7, 7, -6, 13, 5, -15, 7, -1, 31, -12, -11, -24, -65, -18, 21, 23, -26, 20, -19, -18, 12, -64, 1, -72, -4, -64, -10, 13, 19, 3, 13, -63, -6, 22, -16, -9, -13, 2, -30, -15, 21, -51, 27, -23, -3, 3, -7, -41, -23, -6, 49, 12, -40, 14, 38, 13, 3, 2, -16, -6, -42, 28, -57, -25, -13, -5, -19, -7, -20, -60, -16, 22, 15, -39, -45, -12, -36, 21, 12, -25, -2, -29, 34, -49, -2, -18, -7, -72, -21, -52, -7, 9, -18, 0, 8, -1, 35, -5, 11, -13, -52, -4, -6, 27, 13, -37, 8, 33, -14, -60, -34, -45, -3, 2, -1, -3, -20, -51, -29, 0, 3, 8, 9, -6, -10, -33, -18, -2, 24, -13, -18, -52, -10, -13, -75, 3, -66, -19, 13, 32, -3, 10, -21, -34, 16, 2, -3, 28, 2, -11, -10, -101, -14, 3, -77, -22, 22, 48, 14, 6, 36, -1, -8, 11, -23, -18, -3, -36, -2, -13, 33, -6, -44, 30, -24, -20, -2, -14, 17, 55, -41, -35, -4, -17, -1, -5, 3, -12, 7, -32, -1, -45, -81, 24, -44, 23, -24, 0, 32, 7, -30, 0, -76, -10, 9, -23, 29, 13, 12, 6, 17, 12, -18, -38, 32, -19, -6, -12, -5, 7, -14, 50, -12, 0, -6, -16, 22, -9, -2, -3, -1, 7, 19, -21, -13, -40, -54, 13, -8, -8, -6, 3, -11, -77, 23, -29, 5, 45, -29, -36, -20, -24, -26, -33, -38, -50, -100, -7, -39, -12, -1, -84, 18, 14, 16, -5, -64, -2, 6, 7, 14, -9, -6, 53, 43, 6, 19, 30, 6, -24, 1, -37, -16, 3, -68, 26, -12, 30, 20, 10, 40, -6, -88, -1, 6, 21, 51, -3, -38, 8, -21, -50, -31, 7, 14, 39, 15, 25, 13, -51, -38, 4, -42, -9, 16, -16, -17, -45, -1, -63, 25, -8, 14, -42, -13, 14, -90, 29, -10, 5, -7, 24, 25, 3, -13, -38, -20, 25, -26, 10, -17, 16, -29, -17, 1, -37, -91, 11, -26, 15, 5, 46, 27, 3, 10, -31, -20, 5, -13, 19, 32, -21, -36, -11, 51, 29, -20, 22, 30, 50, 19, 20, 18, -8, 18, -3, -1, 8, 17, -39, -24, 7, -8, 12, -48, -20, -22, -14, -43, -33, -51, -4, -30, -54, -20, 4, -27, -23, -18, -17, 1, -27, 3, -54, 10, 8, 9, -14, -10, -23, -32, -38, -61, 19, -6, -2, -13, -43, 0, -110, 8, -8, -6, -44, 5, 18, -4, 7, -49, -12, -5, -29, 16, -21, 25, 6, -50, 19, -26, -31, -75, 12, 2, 10, -14, -13, -10, 3, 9, -2, -23, -9, -33, -41, -32, 11, 0, -43, -7, -27, -19, -11, -41, 18, 6, 7, -39, -10, 0, -38, 0, 37, -74, -32, -13, -47, -22, -15, -109, -10, -62, 5, 10, -49, -18, -26, -50, -35, -14, 5, -72, 5, -30, -9, -4, -15, -35, -4, -16, 9, -38, -25, -45, -25, -28, -10, 2, 4, -36, 20, 6, 30, -37, -15, -28, -12, 3, -35, -37, 25, 13, -19, 11, -33, -40, 4, -71, 40, 7, 11, -20, -45, 3, -62, 8, 16, -67, -57, -12, -27, -12, -37, -75, 6, -93, -22, -18, -26, -23, 5, -4, -30, -8, -23, -21, -29, -37, 12, -4, 12, 22, 20, -49, -3, -29, 22, -67, -24, -43, -19, 16, 2, -66, -23, 19, 1, 12, -2, -5, -5, -27, 0, 19, -19, -25, -2, 6, 2, 22, 9, -1, -45, -26, 1, 23, -23, -87, -3, -4, -8, -16, -2, -12, 14, -39, -36, -16, -50, -14, 15, -19, -20, -30, -1, 10, -5, 12, 2, -9, 24, 12, -40, -6, -7, -9, 1, 5, 10, 4, -28, -10, -19, 17, 13, -15, -28, 2, -8, 11, -15, 3, 22, -3, -24, 5, -12, 28, -45, -28, 24, -18, 9, 4, -3, -11, 23, -16, -1, 38, -19, -51, -16, -15, -4, -3, -4, -10, -3, -1, -34, -28, -31, -20, 27, 9, -19, -37, -27, -14, -8, 24, -7, -13, -17, 12, -34, 4, -13, -5, 9, 7, 10, -3, -26, -47, -20, -19, 7, -18, -48, -2, -52, -20, 0, -51, 18, -45, -39, 17, -4, -58, -22, -28, -45, 1, 29, 3, 14, 0, 28, -24, 6, -8, -2, -22, -22, -33, 25, -19, 4, -22, -6, 8, -15, -21, -42, -16, 36, -1, -21, -13, 13, -12, 18, 28, -14, -7, -3, 56, -10, 0, -5, -14, -14, -35, 11, -9, -44, -20, -17, -15, 11, -14, 13, -6, -32, -12, -37, 18, -29, -16, 52, -16, 20, -67, 5, 11, 1, -10, -34, -10, 12, -6, -8, -7, -33, -28, 5, -35, 17, -4, -8, -44, -12, -28, 12, 19, 14, 15, 30, 27, 3, -17, -53, -12, 37, -3, -15, 15, 33, 7, 5, 13, 5, -22, 9, 6, -65, -62, 15, 2, 43, -6, -39, 10, 25, 33, -4, -1, 15, 26, 25, 17, -24, 1, 50, -45, 17, -46, -38, 10, -18, 3, -39, -15, 2, -4, -26, -37, -36, 33, 27, -6, 35, -10, -11, -17, -18, -47, 14, 3, -48, 47, 10, 16, -24, -29, -24, -36, 51, -60, -9, -23, 9, 23, 9, 16, 22, -29, -9, -7, -55, -26, 0, 2, 28, 8, -32, 3, 19, 29, 9, -14, 25, -17, 19, 51, -32, -19, 19, -4, 25, 7, 0, 46, 38, 33, -29, 10, 2, -43, -37, 6, -44, 46, 53, 14, 24, 35, -71, -30, -21, 26, 44, -9, -127, 33, -17, 18, -6, -8, -42, -45, 40, -44, -14, 5, 23, 4, 9, 7, 8, -23, -3, 32, -27, -22, -40, 11, 19, 9, -43, -13, -12, 27, 5, -35, -17, 2, -49, -5, 7, -7, -17, -17, -9, 5, -11, -17, -1, -36, -3, 31, -6, -8, 5, -51, -7, -61, 18, -57, -1, 13, 19, -41, -1, 16, -9, -30, -34, -19, -11, 10, 1, -38, -4, -27, -42, 1, -19, 1, 8, 11, -24, -88, -12, -41, -25, 19, -6, 7, 5, 9, -11, -43, 3, -2, 2, -7, -51, -7, 12, -32, -3, -5, 8, -12, 27, -18, -26, 23, -11, 4, -1, -18, -10, 20, 3, 5, 15, -52, 5, -30, 5, -22, -13, 11, 17, -21, 7, 13, -17, 17, -15, 4, -20, -4, 18, -16, -17, -22, -68, -3, -14, -23, -16, 7, -42, -53, -6, -23, -5, 13, -22, 0, 11, -3, -4, -31, -3, 3, 10, 16, -49, -10, 7, -11, -10, 18, -1, -15, 20, -17, 1, -4, -44, -14, 13, -3, 2, 28, -14, 21, 3, -51, -24, -67, 9, -12, -34, -5, 15, -26, 14, 6, -13, 5, 4, -1, -68, -8, 4, -31, 18, -5, -90, 10, -6, -9, -13, 10, -26, -42, -22, -6, 3, 8, -25, -12, 19, -1, -11, -9, -14, 13, 10, 17, -49, -1, -4, 10, -4, 2, 3, 6, -2, -10, 12, -1, 28, 15, -1, 23, 21, -23, 1, 12, -38, 5, 8, -1, 10, -44, -24, -24, -5, -4, 19, 4, 17, -1, -34, -32, -8, -13, -28, 1, -10, -16, 2, 8, -15, 14, 19, -30, 7, -9, -11, -33, 5, -18, -19, 4, -23, -5, 10, 7, -43, 10, -14, 8, -5, -11, 5, 7, -8, -9, 0, -4, 4, -18, 7, 6, -32, -1, -15, 5, 15, -17, -4, 11, -8, -18, 3, -5, 2, -62, -11, -28, 1, -2, 3, 11, 13, 14, 14, 16, -33, -9, -6, 3, 2, -21, -9, 22, -14, 11, -2, -4, -17, 3, -10, -13, 12, -17, 0, 11, 13, -10, 0, -1, -11, -7, -24, 16, -9, -9, -21, -22, 4, -2, -4, 1, -7, -5, 0, 1, -17, 22, -20, 4, -3, -16, 18, 18, -21, -6, 4, -5, 8, -55, 1, -18, -2, -49, 6, 9, 6, 3, 14, 9, -7, 12, -19, 14, 10, -25, -21, 18, 3, -9, 9, -3, -14, -4, -9, -12, 8, -5, 13, 30, 17, -26, 3, -14, -15, 20, -27, 4, -12, -13, -29, -35, -7, -6, 24, -15, -7, -13, 14, -10, 14, 9, -3, -2, -20, -7, 8, 3, 24, -13, -5, 6, -8, -57, -4, -30, -23, 11, 19, -6, -68, -40, -5, 12, 14, -33, 14, 26, -22, -15, -6, -23, 8, 12, 4, 14, 18, 26, 25, -27, -7, 2, -33, -18, 6, 28, 4, 6, -14, -19, -30, 16, -1, -6, -12, 5, 20, 1, 8, -3, -6, -18, 4, -7, -18, 10, -18, -12, -52, -41, 10, 5, 20, -36, -14, 12, -26, -25, -10, -31, -7, 24, 20, -47, -47, 7, 12, -30, -23, -66, 1, 38, -19, -11, 17, -42, -8, 49, -48, 27, 12, 7, 19, -11, -1, -9, -40, -55, -12, 34, 0, 11, -8, -1, -2, -72, -14, -8, 5, 6, 13, -7, 23, 24, -6, -18, -2, -13, 21, 12, -8, -40, -127, -27, 8, 3, 28, -24, 9, 20, -48, -36, 16, -36, -4, 22, 11, -39, -47, -19, 5, -43, 10, -46, 10, 14, -42, -9, 11, -46, -1, 44, -66, 13, 10, 22, 13, 3, -1, -32, -27, -70, 14, 29, -14, 10, -47, 4, -30, -67, -18, -4, -5, -5, 33, 21, -1, 23, -3, -27, -4, -35, -52, 27, 9, 21, -7, 44, -27, -58, -10, -63, 28, -56, -26, -17, 41, -3, -15, -109, -14, -10, 29, -44, -10, -58, -19, -31, 8, -52, 3, -7, -10, 1, -8, 14, -33, 12, -21, -16, -40, -13, 10, 11, 3, 2, 26, 22, 11, -54, 19, -18, 17, 11, -5, -66, -7, 0, -6, -39, -8, 2, -32, -16, -26, -12, -8, -20, -8, -27, -13, 19, -1, -27, 7, -18, 8, -35, -36, -13, -13, 9, -21, -127, -6, 14, -5, 13, 2, -50, 7, -48, -2, -35, -32, 14, -12, 12, -12, -14, -23, 3, 45, -62, 1, 1, -4, 18, -3, 1, -7, 8, -23, -75, -3, -15, 15, -35, 9, -15, -27, -27, -44, -42, 33, 37, -10, -26, -1, -14, -7, -15, -28, -23, 19, -8, -14, 4, -15, -11, 10, -54, 12, 0, -20, -11, 35, -6, 38, 0, -58, 15, -34, -36, 19, -4, 2, 11, -50, -11, -58, -21, 45, 5, -36, -19, 42, -73, -9, -10, -21, 26, -9, -18, -5, 0, -19, -83, -13, 13, 26, 15, 5, -18, -12, -5, -9, 18, 9, 7, 10, -24, 1, 26, 1, 30, 16, -26, 16, 28, 25, -6, -40, 4, 27, -1, -7, -58, -2, -14, -16, -44, -40, -6, 15, -17, -6, -41, 7, -15, 21, -17, -12, -8, 14, -7, -44, 24, 1, 3, -6, -7, -34, -58, 28, -4, 14, 19, -21, -9, 15, -18, 27, -25, -18, -39, 15, 14, 22, 14, -29, -14, -2, -17, -78, -12, -29, 49, -11, -64, -25, -18, 0, 6, -21, 12, 15, -40, 4, -1, 3, -83, 20, -15, 20, -88, -16, -19, -2, 8, 6, -31, 15, -52, 29, 38, 19, -23, -3, -21, -37, 22, -40, 16, -14, -35, -3, -3, -34, -11, -16, 26, -16, 9, -29, -72, 2, 9, -2, -14, 40, 1, -41, -35, -22, -11, 4, 0, -52, -12, -13, 35, 10, -111, -6, -9, 15, -10, -43, 0, 27, -16, -8, -32, -32, -87, 26, -5, 19, -49, -5, 1, -26, 20, 18, -10, 25, -50, 23, 25, -25, -2, -7, -28, -39, 64, -50, -23, 11, -1, -5, -6, -52, -15, 13, 0, 9, 38, 5, -33, 11, 25, 3, -19, 0, 23, -18, -40, 32, -38, 9, -50, -27, -74, 26, -8, 33, 14, 4, -37, 20, -20, 30, 14, -2, 25, 7, -26, 9, -5, 17, -41, -46, 11, 15, -55, -8, -64, 14, -38, 22, -20, 20, 8, -6, 26, 7, 3, -14, 70, 27, -26, 14, -13, -8, 18, -21, 31, -64, 31, 4, -15, 8, -34, -14, 1, 13, 14, -10, 1, 4, 56, -19, -7, -9, -46, 9, -34, 29, -2, 33, -12, -26, -15, -49, -26, 39, -17, 0, 15, 3, -51, -13, -28, 36, -13, -15, -66, -18, -46, 8, 22, 2, -22, 43, -18, 31, 0, 5, -11, 26, -17, -36, 5, 33, -2, -2, -29, -4, -20, -79, -26, -31, -60, -4, -14, 24, -32, 3, 0, -13, 47, -37, -52, -42, 7, -24, -29, -15, -65, -36, -7, -1, 15, 57, -5, -26, 21, -29, -54, 31, -8, -13, 6, 14, -19, -51, -51, 56, 17, -57, -61, -28, -43, 38, 32, 8, 15, 9, -13, 57, 21, -3, -45, -7, -15, -39, 21, 12, 28, 5, -8, 0, -5, -7, -43, 10, -37, -49, 15, -2, -19, -23, -9, -9, 27, -16, -18, -8, 19, -51, -29, 8, -1, 6, -52, -56, -2, -83, -43, -1, -85, -28, -56, -13, -35, -46, -47, -18, -10, -38, -4, -79, -53, 28, -2, -74, -65, -28, -46, -98, -27, 5, -23, -17, -98, -54, -3, -8, -21, 20, -26, -11, -18, -60, 36, -102, 37, -49, -35, -21, -67, -31, -26, -47, -40, -45, -26, -48, 2, 24, 12, -55, -92, -8, 2, -49, -73, -35, -123, -35, -36, 28, -13, 6, -72, -10, -1, 3, -42, -64, -29, -48, -59, -78, -38, -76, 25, -30, -25, -12, -8, 34, -75, -52, 37, -22, -22, 13, -34, -28, -31, -6, -81, -11, -50, 19, -64, -21, 26, -30, -82, -49, -11, -46, -27, -75, -10, -66, -45, 48, -26, -74, -17, -30, -48, -31, -31, -49, -54, -64, -44, -37, -60, -28, -63, -54, 41, -29, -66, -34, -15, 95, 1, -55, -55, -53, -17, -97, -46, 48, -65, -28, -26, -31, -60, 10, -60, 8, -2, -7, -26, 11, -27, -33, -86, 30, -64, -34, 13, -8, -15, -79, -38, -81, -39, -77, -24, -58, -19, -55, -91, -58, -16, -34, -80, -43, -11, -3, -67, -67, 14, -94, -26, -82, -58, -59, -53, -41, -34, -10, -109, -100, -73, -39, 11, -68, -47, 0, -74, 46, -34, -12, 21, -45, -47, 13, 9, 42, -6, -28, -78, -54, -79, -41, -28, -27, -10, -52, -42, 2, -59, -38, 52, -3, -12, -17, -70, -23, 15, 20, -44, -30, -71, -6, -36, -39, -45, -3, 30, -33, -102, -25, -70, -38, -61, -10, -49, 30, -22, -73, -73, -52, -86, -11, -65, -46, -25, -15, -71, -70, -1, 15, -80, 30, -18, -47, -32, -18, -50, -15, 15, -3, 21, -13, 10, -41, -2, -38, -107, -20, 7, -27, -108, -81, 9, -40, -71, -95, -29, 38, -32, -31, 0, -84, -7, -16, -61, -52, -7, -61, -31, -62, -32, 10, -40, -62, -121, 43, 42, 35, -34, 16, -27, 8, -59, -49, -60, -73, -88, -26, -50, -65, -16, -35, 2, -4, -34, 16, -83, -61, -57, 16, -56, -36, -13, -15, -8, -18, -35, -55, -61, -9, -86, 7, -22, 34, -111, -22, -7, 15, -71, -103, -9, 1, -10, -30, -15, -25, -89, -52, -72, -14, -26, -75, -9, -60, -33, -56, -48, -59, -84, -7, -62, -53, -39, -4, 5, -83, -25, -83, -1, -5, -68, -29, -50, -25, -26, 38, -29, -10, -31, -16, 5, -13, -79, -66, -40, -52, 65, -116, -53, -9, -49, -83, -104, -55, -108, 48, -25, 5, -93, -58, -73, 26, -5, -38, -3, -46, 40, 8, -50, 7, -15, 20, -38, -47, -50, -29, -13, 17, -111, -38, -93, -37, -48, -49, -55, -3, 10, -25, 12, -10, -62, -92, 35, -27, -33, 5, -80, -55, -127, -19, 0, -9, 3, -63, -35, -8, -40, -22, -32, -42, 11, -116, -38, -22, -20, -55, -36, -51, -86, -20, -31, -15, -92, 7, -36, 35, -20, -32, -28, -35, 27, 3, 10, -49, -21, 52, -30, -17, -62, -36, -16, -12, -37, -18, -16, -27, -96, 0, 24, 3, 5, 23, -2, -9, -40, -84, 45, 49, -68, -51, -66, -55, -88, 9, -97, -17, -59, -60, -42, -23, 14, -94, -13, -33, -16, -113, -61, -5, -52, -20, -64, -24, -86, 10, -48, -30, -48, -74, -75, -16, 24, -8, 20, -45, 26, -34, -6, 0, -55, 26, -100, -63, -40, 36, -83, -21, -73, 30, -47, -19, -62, -89, -2, 1, -44, -14, 39, 1, 9, -25, 3, -11, 29, -4, 17, 18, -16, -31, 34, -23, -3, -55, 10, 17, -6, -21, -32, 13, 2, -22, 19, -62, -14, -7, -75, -30, -75, -47, 12, 15, 26, 3, 4, -2, -9, -41, -23, 11, -6, -18, -33, -16, -16, -8, 4, -125, 12, -47, 9, 18, -10, -127, -10, -36, -4, 2, 4, -20, -18, 14, 2, -31, -1, -23, -5, -5, -29, -11, -8, -15, -12, -41, 24, -42, 14, 2, -13, -21, -66, 0, 11, 2, 11, -3, 19, -25, -3, 7, -77, 21, -19, 18, 34, 12, 24, 5, -28, 24, 27, -39, -8, 55, -10, -25, -22, -25, 12, 2, -9, 9, 12, -17, 17, 28, 36, -33, -43, -40, -28, 0, -3, 9, -11, 4, 30, -17, -4, -49, 18, -15, -57, 2, 8, 32, -39, 19, 15, -34, 20, 20, -52, 17, -89, -8, 39, -23, 33, 33, 29, 19, -67, 1, -78, -11, -31, -15, -12, 32, -30, 9, -26, 13, 27, -42, 35, 10, 9, -47, 2, -36, -48, -53, 29, 6, 36, 5, 37, 9, 25, -18, -82, -41, 23, 18, -58, -3, 23, -12, 18, -20, 2, -12, -14, -28, 26, -37, 5, -28, -10, 27, 14, -8, 12, -51, 18, -15, 0, 5, -30, -59, 3, -32, 7, -28, 2, -6, -29, -20, -31, -15, 7, -22, -17, 14, 14, -36, -36, 1, 23, 20, -13, -4, -29, -10, 14, 45, -5, -42, -37, 19, 8, -8, -25, -66, 4, 11, -10, 4, -13, -9, 22, -1, -12, -24, -37, -16, -3, -20, 50, 6, 9, -8, -7, 6, 26, -31, 1, 1, 31, -10, -10, -1, -3, -30, -15, -34, 19, -7, 2, 32, 17, -25, 15, 30, 22, 2, -1, -7, 16, -8, 6, -14, -1, 5, -28, -2, -19, -6, 30, -8, 9, 10, -16, -4, -18, 12, -4, -58, 0, -4, -52, -19, -42, -29, -36, 2, 23, -6, 21, -47, -54, -1, 2, -4, -7, 18, -74, 17, 43, -1, -2, 40, -41, -11, -25, 15, 7, -19, -3, -12, -12, -27, -14, -10, -16, -5, -19, 9, 9, 4, 2, -30, 16, 17, -2, -12, -18, 7, -9, 8, 9, -28, 8, -5, 21, -15, -5, 5, -12, 22, 20, -37, -17, -33, -49, -29, 1, -6, 9, -33, 2, -6, 5, -6, -39, 33, 4, 26, 14, -15, 28, -35, -20, -29, -30, -27, -6, 2, -47, -45, -11, -28, 14, 21, -22, -5, -6, -15, -3, 51, 32, -8, 6, -20, -6, 2, -38, -4, -55, -7, 22, 5, 61, 16, -15, 9, -9, -36, -47, -4, 32, 33, 10, -23, -21, -21, -4, -14, -4, -20, -37, 13, 26, 4, -5, 11, -51, 16, -22, 26, 4, -18, 0, -47, -9, -3, 13, -35, -1, -25, -19, -31, -33, -3, -37, -14, -19, 23, -14, 7, -12, 22, 19, 16, 5, -9, 25, -28, -26, 11, -23, -2, -20, -62, 5, 2, 13, 26, 4, -5, -18, -44, -19, -24, -8, 15, -9, -53, -22, -5, -18, -5, -6, -6, -9, -10, -8, 3, -12, 9, -15, -5, -79, 2, 11, -11, 28, 10, -4, 9, -8, -30, -23, 22, -12, 1, -70, 24, -65, -16, 18, -11, -59, 36, -19, -15, 23, 16, 23, -11, 26, -26, -40, 0, 7, -11, 21, 18, 3, -3, 12, 40, -16, -29, -3, -6, -26, 21, 1, 36, -37, -31, 1, -23, 24, -22, -39, -26, 26, -11, 28, -42, -12, -45, -79, 32, -32, -31, -29, -58, -7, 25, -71, -17, -15, -41, -32, -54, -21, -23, -26, 7, -23, -8, -52, -59, -46, -30, -14, 1, -53, -67, -37, 13, -36, -28, -7, -26, -66, -51, -38, -10, -27, 3, -23, -5, -81, -34, -85, 8, -81, -6, -55, 6, -6, 5, -8, -50, -7, -62, -64, -63, -88, -46, -16, -5, -99, -26, 11, -35, 12, 17, -18, -28, -26, -33, -14, -90, 38, -22, -7, 1, -65, -65, -64, -24, -39, -12, -34, -57, 6, -41, -5, -10, 8, -43, 12, 14, -44, -16, -4, -75, 15, -77, -61, -50, 15, -16, -27, -22, -39, -24, -94, -46, 2, -56, -2, -16, -56, -17, 40, -32, 8, -16, -32, -32, -73, -51, -46, -19, -35, -20, -32, -16, -41, -61, -8, -35, -41, -65, 7, -38, -76, -64, -41, -80, -61, -34, -77, -58, -1, -72, -23, 30, 8, -90, -15, -36, 16, -70, -66, -27, -32, 13, -4, -76, -65, -23, -26, -34, -34, -53, -14, -7, -27, 60, -60, -35, -1, -77, -14, 26, 6, -10, -31, -1, 23, -18, -49, -62, -11, -33, -30, -16, 19, -46, -64, -3, -42, -36, -68, -20, -9, -7, -93, -13, -45, -56, -25, 46, -70, -18, -25, -25, -6, 30, -17, 10, -36, 25, -87, -12, -46, -45, -7, -8, -66, -37, -77, -76, -25, 3, -41, -27, -53, -25, 7, -26, -15, 19, -6, 17, 0, -22, 19, -16, -46, -35, -9, -16, 22, 29, -61, -54, 0, -43, -71, -19, -101, -41, -48, -32, -67, -60, -36, -50, -24, -22, -26, -97, 9, -52, -22, -98, -79, -17, -46, 12, -127, 27, -54, -15, -16, 33, -17, 53, 25, 9, 5, -62, -31, -46, -7, 3, -14, -63, -44, -24, -46, -27, -60, 23, -77, -38, -4, -103, 2, -68, 11, -77, -17, -43, 40, -20, -37, -85, -30, -79, -12, 20, -29, -114, -70, -58, -19, -32, -75, -34, -2, 3, -28, -20, -11, -20, -29, 20, -4, -48, 33, -63, -67, -23, 19, -92, -56, -46, -12, 59, -5, -107, -51, -95, 21, -37, -35, -65, -37, -67, -24, -33, -96, 45, -28, -37, 4, -86, 4, -22, -72, -37, 58, 9, 33, -19, -42, -9, -46, -20, -69, -71, -55, -49, 34, -70, -63, -14, -63, -53, -24, -26, -32, -17, -23, -45, -49, -35, -27, -23, -72, 34, -54, -29, -20, -20, -25, 38, -17, -44, -42, -19, -62, -62, -26, 2, -37, -7, -51, -24, -14, -2, -41, -3, -24, -18, 24, -35, -44, -21, -82, -58, -4, -56, -36, -15, -10, -48, -29, -11, -42, -5, -63, -13, -12, -25, -30, -33, -43, -6, -2, -56, -1, -5, -54, -59, -42, -12, -75, 30, -52, -58, -105, -5, -59, 2, -49, 49, -17, -35, -44, 7, -67, -38, 2, -13, 3, -47, -53, -73, -29, -15, -66, -56, -76, 19, -80, 51, 10, -14, -28, -71, 5, -44, -10, -98, -127, -39, -66, -63, -36, 24, -21, -11, -56, -82, -75, -39, 10, -23, -61, 1, -65, -8, -26, -29, 34, 3, -61, -14, -56, -62, -15, -69, 8, -22, -60, -12, -75, -39, -44, -34, -10, -28, -31, -52, 14, -93, -29, -85, 9, -12, -24, -30, -18, -19, 8, 28, -36, -16, -57, -36, -37, -89, 18, -63, -7, -30, -46, -59, 30, -5, 59, -1, 26, 6, 20, 28, -62, -26, -49, -34, -91, -14, -1, -41, -47, -83, -8, -21, -6, -29, -9, -9, 3, -6, 2, 8, 31, -12, 23, -7, 11, -4, -11, 7, -26, 10, 13, -10, -14, 8, -40, 13, -8, 11, -40, -56, -16, -66, 0, -5, -78, -4, -35, -4, -16, -37, -2, 4, 16, -66, -68, -9, -20, -15, 5, 3, -26, -9, 32, 13, -54, -62, -23, -40, -20, -13, -9, 3, -27, 12, 6, -12, -23, -14, -19, -12, -5, -6, 12, 12, 1, -9, 36, -7, -10, -17, -16, 21, -16, -16, 3, -32, 14, -3, -50, -16, -24, 2, -45, -34, -3, -10, -8, -69, -32, -5, -15, -5, -13, -11, -8, -20, 9, -37, -62, -74, -28, -10, 0, 2, -31, 17, 11, 7, -61, -17, -3, -9, -3, -20, -18, 1, 1, -23, -41, -21, -23, -5, -8, -36, 6, -7, -1, -42, -17, -17, 35, -41, -26, -33, -15, 19, -8, -21, -7, 10, -23, -10, -37, -35, -24, 8, 5, -18, 11, 6, 3, -10, -14, -24, 2, -27, -6, 2, -29, -8, -4, -27, -127, -8, 11, 26, 17, 0, 29, 0, 1, -38, -30, -14, 1, 6, 5, -29, 39, -4, 16, -55, 7, -37, 8, -25, 4, 3, 12, -15, -6, 10, -15, -21, 3, 18, 0, -19, 0, -10, -25, -1, 11, -23, -10, -19, 15, -1, -11, 28, 11, 20, 25, -22, 1, -3, -32, -10, -2, 22, -1, -9, 4, -15, 32, -8, 12, -22, -8, 1, -2, -11, -8, -54, 8, -13, 3, -14, -4, -58, -60, -3, -1, -5, -14, -9, 17, -13, -16, -18, -20, -17, 4, -15, 10, 0, -20, -12, 8, 18, -14, 19, -29, 11, -44, -3, 15, -26, 6, -6, 19, -16, -6, 15, 15, 12, -13, 0, -17, 22, -22, -10, -15, 7, -23, -20, -13, 1, -2, 13, 18, -25, -11, -22, 10, 0, -7, -11, -10, -15, 15, 4, -1, -28, -22, 8, -15, 21, -20, -4, 19, -21, -28, -6, -18, -8, -20, -23, -16, -9, -16, -17, 28, 30, -12, -5, -24, 10, -1, 8, -11, 4, -1, -7, -13, -42, 22, 14, -2, -1, -5, 10, 1, 18, -14, -25, -2, -18, -18, -25, -9, -5, 5, 16, -48, -1, -8, -1, 22, 15, -1, -2, -5, -16, 8, 10, -5, 5, -16, 12, 12, 6, -14, -47, 25, -47, 17, 12, -8, -16, 9, -28, -9, 10, -4, -12, -16, -5, 0, -11, -14, 6, -5, 6, -17, -53, -9, -15, 32, 5, -4, 7, -1, -7, 1, -23, 14, -40, 1, 2, 17, -24, -23, -29, -21, -8, 19, 0, 9, -14, -46, 10, -37, -19, -5, -10, -4, -11, 12, 37, -34, -73, -37, 2, 3, -12, -14, -23, 23, -29, 10, 3, -50, 8, 16, 12, -9, 12, -2, -19, -4, 1, -3, -24, -10, -33, -30, 4, -3, -25, -6, -10, 35, 2, -1, 26, -4, 2, 4, -6, 22, -42, -21, 5, 17, -2, -34, -49, -42, 11, 17, 16, 6, -30, -42, -22, -12, -1, -5, 9, 9, 1, 31, -10, 0, -12, -4, 32, 6, 27, 1, -12, 5, -14, 1, 20, -2, 16, -23, 3, -27, 7, -18, 1, 12, 8, 13, -29, -27, -1, -17, 20, -4, 19, -10, 6, -52, -1, 19, 22, 19, -1, 18, 1, 22, 14, -29, -8, 9, -11, -24, -34, -70, -9, 20, 6, -16, -4, -4, -3, 5, 24, -5, -3, 12, 0, -28, -1, 14, 6, 12, 31, -7, -6, 5, -22, -31, -37, -27, -36, -18, -32, 14, -53, -33, -8, -121, 2, -14, 14, -38, -42, -44, -106, -74, -32, -34, -56, -24, -54, 12, -34, -31, -109, -6, -66, 29, -57, -74, -70, -114, 31, -85, -32, -59, -89, -59, -29, -96, -37, -55, -46, -3, -6, 40, -77, -37, -38, -73, -30, -33, -85, -22, -64, -52, -46, 7, 1, -34, 7, -55, -51, -68, -61, -6, -41, -18, -79, -7, -60, -71, 4, -36, 46, 13, -29, -7, -44, -16, -54, -43, 20, -65, -48, -51, 35, -42, -64, -90, -29, 21, -27, -63, -20, -25, -47, -45, -47, -50, -15, 1, -68, -21, -60, -16, -53, -26, -127, -21, -30, -61, -11, 20, -40, -16, -33, -14, -53, -9, 17, -2, -25, -56, -34, -2, -21, -16, 25, -65, 14, -69, -38, -23, -56, 4, -27, -40, 5, -13, -59, -56, -14, -69, -9, -24, -53, -36, -28, -84, -30, -26, -2, 33, 16, 20, -20, -28, -22, -46, -34, -37, -40, -42, -18, -29, 19, -36, -98, -66, 46, -16, -62, -66, -21, -14, -26, -62, -37, -21, -75, -5, -19, 20, -20, 12, 26, 21, -73, -28, -65, -52, -71, -90, -88, -30, -84, -54, 24, -33, 23, -36, -11, -43, -7, -53, -81, -75, -31, -12, 2, -63, 9, 25, -11, -59, -18, 8, -52, -29, -59, -41, -45, -53, 23, -45, 1, -46, -67, -7, -48, -71, -32, -59, -53, -22, -75, 3, -63, 14, -55, -95, -64, 13, -70, -61, -68, -17, -2, -40, -19, -71, -53, -57, -21, -27, -69, -10, -79, -28, -48, 7, -85, -61, 8, -59, 72, -78, -19, -32, -48, -20, -52, -67, 11, -53, 2, 13, 13, -79, -61, -17, -67, -11, -97, 11, -53, -51, 11, -127, -48, -94, -19, -104, -48, -43, -25, 9, -38, -30, -79, -88, -82, -16, -64, -8, -25, -14, 2, -17, -90, -5, -35, -55, -91, -78, -33, -39, -17, -7, 9, -66, -30, -54, -52, -16, -10, -31, -56, 5, -32, -59, -22, -53, -34, -23, -26, -46, -47, -24, -49, -27, -85, -41, -63, -30, 0, 35, -40, -28, -29, -47, -17, -26, -28, -84, -56, -3, -68, -83, -51, -2, 0, -55, 7, -20, -56, 24, -62, -81, -61, -32, -26, -26, -72, -4, -77, -45, -18, -42, -50, -38, -28, -26, -30, -24, -50, -22, -80, -71, -15, -50, -25, -80, -26, 28, -68, -45, -6, -47, -43, -22, 56, 24, 0, -31, 4, 11, -58, -70, -55, 7, 9, -62, 1, 10, -38, 8, -41, 37, -54, -54, -49, 23, -2, 4, -70, -3, -45, -73, -51, -23, -39, -69, -30, -49, -35, -51, -24, -82, -17, 42, -42, -97, -39, 16, 54, -41, -61, -52, -5, -70, -68, -29, -49, -41, 36, -41, -43, -49, 34, -73, -14, -30, 9, -77, -60, -46, -5, -40, -61, -78, 16, -15, -58, -14, -39, -28, 23, -7, -9, -50, -76, -13, -13, 49, -63, -11, -24, 18, 21, -34, -33, -56, -15, 3, -40, -1, -31, -27, -8, 2, -45, -37, -31, -19, -6, -21, -7, -29, 19, -29, 42, -12, -31, -82, -45, 69, -68, -43, 1, -31, -43, -49, -17, -63, -2, -59, -21, -24, -80, -77, -82, -79, -31, -33, -64, -27, 0, -18, -26, -51, -51, -113, -8, -21, -28, -30, 5, 11, -26, -30, -58, -5, -17, -45, -23, -25, -10, -9, -60, -82, -80, -34, 14, 1, -70, 21, -39, -23, -58, -43, -71, -32, -66, 13, -15, -12, 6, -4, -19, 18, 8, 38, 2, -55, -17, 10, -25, -15, 12, 11, -31, -127, -26, -7, 38, -27, -1, 21, -36, 32, 38, -14, -39, -44, -1, 20, 6, 37, -25, -25, -19, -28, -73, -35, -11, -29, -11, -42, 10, -29, 15, -14, -35, -84, -21, 9, -11, 2, -16, 7, -22, -1, -33, -44, -19, 3, -32, 1, -24, -47, -19, -8, -52, -29, 9, -29, 3, -84, 18, 28, -29, 29, 22, -49, -21, -91, -37, -9, -16, 25, 31, 21, -10, -24, 51, -37, -41, -35, -58, 6, -4, 31, -39, -14, -8, 5, -9, -27, 30, 0, -19, -74, 16, 2, 16, -31, -10, 3, -7, 42, -6, -25, -9, 15, -14, -2, -11, -80, 18, 14, -21, -1, 15, 29, 20, -54, 13, 35, 42, -13, 83, -77, 42, 25, 44, 51, 19, -35, 5, -85, 7, -36, -28, -51, 5, -5, -34, -14, 20, -64, 29, -17, 6, -40, -39, 39, 12, 26, 16, -30, -12, -12, 41, 7, -26, -27, 23, 22, -16, 56, -14, -13, 10, 5, -22, 0, -5, -30, 26, -49, 2, -77, 15, -22, -56, 8, 19, 8, 18, -15, -59, -3, 10, 18, 7, -8, -35, 1, -18, -15, -17, 4, -11, -19, -40, -11, -30, -12, -26, -15, -12, 32, -2, -73, -60, -62, -66, 20, -2, -32, 6, -19, -25, 4, -24, -26, 6, -37, -10, -37, 18, -8, -26, -39, 31, 37, -20, 20, 22, -9, -41, -14, 15, 2, 10, -24, -38, -4, -2, -23, -39, -5, 36, -43, -19, -37, 33, -61, -13, -31, -37, -25, -86, 15, -3, -20, -3, -13, -32, -10, -17, 29, -4, -22, -4, -93, 22, -52, -35, -17, -12, 23, -20, 6, 14, -17, -49, 17, -20, 13, 23, -10, -68, -63, -59, 11, -15, -18, -34, 18, -45, 9, 19, 19, -15, -50, -11, -52, -30, -41, 7, 4, 26, 22, 7, -1, -8, -64, -19, 22, 10, -33, 44, 7, 22, 12, 20, 3, -20, -27, -24, -19, 3, -1, -38, -6, 18, -65, -29, 20, -6, 6, 7, 24, 11, -65, -37, 20, -74, -32, 2, -5, 18, 25, 30, -1, -2, -16, -17, -30, 3, 35, -68, -1, -8, 1, 5, 13, -29, -3, 7, -33, 9, -46, 14, 2, -22, -36, 21, -16, 2, 17, -29, 34, 13, -9, 32, 37, 5, 5, -25, 10, 6, 19, 21, -17, -13, 13, -27, 18, -36, 22, 7, -19, -32, -16, -23, 17, -31, 39, 28, -30, 11, 19, -64, 29, -25, -39, 4, 22, -33, -4, 17, -9, 22, 10, -50, 2, -21, -7, 13, 9, -73, -74, 19, -22, -10, 39, -30, -36, 51, -38, -14, -10, 14, -70, -1, -41, -18, 5, 13, -12, 1, -6, 16, 53, 28, -12, 7, -39, -24, -5, -2, -10, 8, -18, -6, -59, -25, -60, 7, -19, 31, 26, 14, -38, 23, 40, 20, 52, -11, -33, 42, -1, -36, -27, -25, 0, 14, -34, -25, 2, 27, -43, 5, 35, -8, 19, 25, -82, -72, 37, 13, -35, 55, -41, -55, -4, 2, -110, 15, -30, -76, 17, -44, -40, 45, 22, 39, -31, 35, -39, -16, -47, 10, 18, 9, -8, 11, -71, -54, 11, -6, -27, 61, -41, 25, -61, -27, -10, -86, -53, 40, 36, -35, 14, 30, 27, 37, 7, -43, -36, -46, 34, 36, 1, -17, -60, 3, 27, 24, -16, -61, -21, -32, -18, 5, 75, 18, 6, 20, -39, 13, -56, 10, 17, 32, 14, 12, -6, 3, -6, 0, 10, -7, -3, -11, 12, 6, -1, 21, -7, -11, -90, 5, 22, 2, 19, 11, 15, 21, -60, -3, -18, 2, -22, -11, -4, -3, 29, -18, 10, 9, 5, -57, -13, 1, 15, 6, 15, -17, 42, -3, 13, -13, 2, -2, -56, 28, -17, 2, -11, 1, -21, 3, 2, 10, -1, -20, -13, -63, -8, -18, 0, -23, -24, -4, -13, 6, 9, -12, -13, 33, -11, -10, -74, -19, -63, -12, 8, 9, 10, -9, -18, 9, 8, -32, 26, -25, 11, -40, 9, -24, -9, 19, -60, -7, 3, -54, -88, -19, -1, 2, -53, -42, -56, 19, -29, -7, 0, -18, 21, 17, 1, -73, -2, -127, -15, 26, 14, -36, -7, -19, 23, -32, 11, 13, -3, -11, -70, -40, -12, 21, 15, 7, -25, -16, -17, 6, -69, -55, 20, -29, -5, 13, -47, 12, -32, -107, 33, -11, 21, -9, 9, -79, -49, -40, -12, 30, -40, -28, 39, -43, -14, -22, -18, 4, -38, 1, -61, -62, -7, 0, -13, -20, -41, -17, 29, -66, 9, 22, -19, 9, -13, 6, -27, 13, 25, 21, 17, 8, 3, -11, 2, 14, -2, 16, -20, 8, 18, 24, -5, -3, -4, -19, -15, -13, -8, 0, 15, 16, 8, 5, 8, 15, -22, -8, -3, 10, 17, -5, -24, 16, -37, 15, -27, -34, 15, 3, 22, -38, -11, -9, -13, 14, 5, -26, 1, 7, -60, 12, 8, -11, 13, -38, -17, 4, -18, -16, 24, -18, -22, 41, 4, -27, 0, 11, -47, -29, -8, 5, 16, -56, -7, -13, -4, 34, -13, -3, -71, 11, -19, -12, 4, 25, 5, -22, 7, 0, 21, -5, -9, 0, 5, 11, -52, 12, -50, -13, -1, -37, -20, -33, 5, 16, -91, 10, -7, -2, -28, -50, 21, -19, 14, 18, 17, -35, -21, -86, -23, 18, 12, -17, 25, -15, -28, -26, -5, 15, -24, 13, -42, -24, -18, 0, 11, 6, -17, 43, -10, 21, 0, -40, -9, 8, -33, 11, -19, 2, 3, -63, 24, -2, -9, -32, -13, -42, -36, -5, 14, -1, -53, -40, 21, -27, -35, -11, -23, 15, -17, 19, 22, 4, 38, 22, 15, -40, -30, -22, 22, -6, 14, 33, 13, 13, -44, 19, 0, -6, 34, -18, -20, -1, 18, -21, 21, 4, 25, -13, -29, 0, -24, 19, 9, -26, -10, -6, -19, 3, -22, -19, 20, -33, -1, 34, 3, 7, -33, 5, 10, 10, 25, 0, -3, 20, -3, -11, -38, -22, -2, -5, 28, -6, 16, 7, -38, 4, 2, 3, -12, 36, -57, -1, -14, 26, 1, 6, 6, 15, -27, 25, 21, -7, 0, 0, -5, 5, -3, -9, -71, -5, 40, -3, 16, 17, -23, 16, -28, -18, -10, -28, -31, 1, -5, -11, -1, 7, 7, 28, 46, -7, -27, 43, -14, -4, 43, -11, -25, 12, -48, -67, 19, -40, -9, -5, 8, -13, -82, -30, -44, -26, 2, -32, -13, 31, -15, 9, -25, -27, -13, -52, -27, 17, 16, -3, 32, 7, -20, -15, -22, 31, -1, -21, -26, -15, 24, 6, 23, -10, 23, 5, 10, -5, -5, -68, 5, -3, -41, -4, -7, 17, 27, -60, 23, -11, -23, 19, -17, -46, 18, 3, -6, 14, -20, -55, 27, -42, -11, 27, 4, 2, -43, 0, -41, 36, -30, -2, 10, 22, -27, -33, -8, -2, 1, 15, -5, -3, -20, -2, 26, -127, 12, 13, -22, 3, -14, 7, 16, -4, -27, -9, -36, 3, -29, 5, 4, -19, -27, 3, 1, 1, -15, -12, 15, 4, 11, 18, 12, 7, -39, -47, 32, 12, 10, 2, -22, 4, 7, 9, 12, -1, -25, 10, 12, -14, -1, 16, -13, 0, 11, -46, -21, 6, 1, 3, -10, 11, -4, 7, 5, -13, -10, -3, -13, -45, -8, 2, -3, -29, -62, 33, -11, -6, -23, -6, -15, 1, -34, -18, -2, -10, -24, 13, -54, -5, -11, 8, -1, -11, -2, 16, 15, -10, -39, -25, -87, 10, 28, -27, -13, 33, -21, 8, 9, -10, -41, 5, -1, -17, 12, 13, -38, -4, -6, -7, -24, -14, -10, 13, -27, 4, -67, 16, -24, -20, 1, -16, 30, 4, 3, -39, 6, 1, -56, 23, -41, 24, 36, 9, 53, 7, -31, -35, -44, -13, -18, -34, -12, -1, -2, 13, -8, -14, 6, 16, 25, -5, -24, -17, -5, 22, 25, -8, -15, 50, -26, 2, 10, -11, 4, 13, 4, 9, -6, -8, -61, 22, -1, -11, -24, 17, -10, -44, -25, 7, 11, 2, -17, 17, -27, -14, -9, 5, 24, 0, 0, 6, 3, -18, 16, 16, 20, 12, 12, -7, -47, 26, -25, -19, -11, -26, -3, 1, 13, -32, 5, -1, 14, 20, -16, 2, -12, -5, 1, -7, 3, -4, -43, -25, 2, 3, -20, 16, -26, 20, 2, -14, -12, -6, 8, 2, -30, -40, -12, 13, -4, 1, -7, 26, -3, -14, -20, -4, 5, -5, -1, 6, -6, 12, 10, 10, 2, -6, -46, 5, 4, 22, -8, -22, -47, 6, -20, -15, 0, -30, 12, 16, -7, -10, -19, -10, 3, -4, -38, -10, 9, -16, -15, -3, 6, 20, -7, -3, -3, -9, -7, -2, -1, 18, 19, 10, 12, 2, 8, 1, -32, 3, 12, 4, 4, 21, 5, -5, -10, -8, -17, -12, 0, -12, 7, -17, 1, -11, 5, 5, 13, 8, -46, -4, -3, 13, -14, 3, -17, -9, 7, -21, -49, -20, 7, -2, -19, 0, -20, -1, -3, -14, -11, 5, 18, -60, 5, -1, -5, 28, -16, -35, -17, 12, -13, -4, -14, 3, 12, 4, 0, -24, -17, 18, -21, -19, -10, 1, -11, -19, -8, -31, 3, -2, -11, 19, -31, -2, 31, 8, 5, 17, -19, 11, -11, 27, 3, -37, 21, -25, 21, 19, -42, 12, 18, -68, -3, 7, 6, 8, -11, -4, 25, -2, 12, 9, 10, 27, -17, -1, 3, -33, 3, 5, -12, -1, -15, -51, -24, -8, -30, 18, 10, -30, 4, -10, -14, 9, 7, -16, 10, 24, 5, -32, -17, 1, 11, 8, -9, -3, 2, 12, -41, 5, 4, -29, -10, -7, 2, 1, -17, -44, 16, 15, -2, 9, -41, -32, 8, -56, -2, -6, -28, 10, -27, -42, 5, -26, 5, -23, -14, -2, 18, 5, -1, 6, -26, 11, -3, 15, -9, -20, -33, -6, -21, 22, -32, -3, -9, -5, -3, 44, -17, -7, 20, 23, 1, 21, 0, -49, 23, -25, 6, -1, -4, 30, -2, -1, 32, -17, -5, -57, 4, -22, -51, -48, -11, -8, 5, -6, -77, -43, -26, -37, 13, -31, -32, 21, -26, -51, -12, -24, 6, -21, -13, 8, 11, 11, -22, -4, -52, 31, -34, 7, 11, -10, -24, 7, -29, 4, -13, 6, -44, 8, 22, 40, -30, -29, 2, 13, -7, -18, 10, -52, 4, 18, 34, -3, -63, 28, -24, 48, -16, -20, 10, -3, -7, -15, -31, -2, -27, -3, -4, 14, 26, -25, -21, -8, -44, -2, -12, 34, -9, 16, 12, -34, 0, -12, -69, -23, 41, 53, 8, 18, -5, 2, 62, 29, 15, -2, 17, -40, -50, -44, -19, -5, 29, 3, -83, -59, -39, -6, -3, -11, -28, -11, -36, 38, 0, -14, -40, 22, 1, -42, -21, 18, -4, -20, 23, 23, 39, -71, -13, 3, 12, -25, 9, -8, -17, 32, 21, -29, 41, 2, -40, -9, 12, -18, 31, 6, -12, 23, -9, -22, 6, -38, -41, -18, -20, -1, -37, 9, -7, -55, -22, 6, 16, -34, -14, 32, 11, -28, 13, -2, -47, -10, 2, -55, -7, -24, -8, -49, -26, -35, -5, -2, -11, -29, -6, 10, 11, 34, -13, 24, 16, -59, 51, -29, 2, -56, -7, -28, -1, -23, -63, -60, 33, -32, -10, -36, 10, -28, -20, 14, -9, -58, 11, -7, -1, -28, 46, 10, -43, -5, 13, 37, -2, -17, 2, 35, 14, -31, -29, -36, -53, 21, 15, -127, -33, -41, -6, -38, -5, 26, 24, -6, -5, 15, 6, -30, -22, -9, 0, -18, 5, 40, -35, -4, -35, -45, -38, 14, 4, 1, -13, 2, -54, -8, -49, -9, 12, -52, 9, 18, 16, 32, -31, 48, 30, -13, 3, 36, -63, -41, 14, 14, -40, 24, -75, 15, 35, -10, -3, -43, -4, -14, -62, -13, -35, -11, 14, 17, 5, -16, 4, -56, -51, -45, -3, 21, -32, -76, -50, -70, -17, -24, -36, -18, -11, 13, 21, -47, -15, -4, -11, -33, 27, 7, -34, 8, -26, -42, -24, 12, -5, -18, -45, -60, -29, 21, 11, -5, 10, -34, -52, -20, -3, 17, -52, -5, 49, -57, -13, -41, 0, -31, -1, -9, -18, -33, 7, -23, -32, 25, 18, 27, 8, 13, -32, -62, -11, 18, -3, -58, 12, -41, -32, -6, -41, -28, 12, 3, -63, 60, -20, -46, 15, -34, 9, -5, -16, -11, 4, -75, -34, -107, 38, 2, -47, 22, 4, -30, -34, -17, -34, 3, -48, 34, 11, -47, 10, -11, -22, -92, 25, -87, -58, -38, 42, -37, -22, -6, -20, -58, -29, -3, 44, 20, -9, -77, 28, -18, -26, -47, -36, -30, 16, 4, 3, -16, 7, -16, -27, -16, 9, 28, -28, 25, -22, 36, -5, -19, 1, -20, 7, -24, -47, -3, -2, 58, 35, -64, -20, 0, 8, -31, 13, 33, -7, 16, 1, 22, -12, -1, -26, -31, 3, -31, -19, -68, 7, -27, 20, -38, -14, -31, -30, -23, 7, 0, -14, 33, -8, 22, 40, 31, -25, 22, -24, -13, -14, -24, -10, -19, -51, -12, -55, -20, -17, -14, -64, -21, 26, -17, 15, 3, -1, -30, -17, -18, -16, -47, -59, 1, -32, -84, -22, -8, -16, 39, 30, -2, -3, -56, 0, 43, -2, -11, -1, 37, 16, 6, 2, -9, 15, 0, -34, -29, 28, -33, 24, -6, 3, -76, 60, -36, -30, -42, -7, -10, -66, 13, -57, -24, -49, -21, -46, -120, -29, 37, -32, -84, -34, -4, -3, -65, -10, -11, 6, -44, 8, -45, -1, -42, -43, -24, -31, -21, -44, -83, 3, -18, -54, -6, -4, 0, 12, 21, 13, -61, 2, -20, -41, -25, 6, -22, -44, 5, -50, -2, 11, -11, -4, -19, -3, -19, -16, -26, -27, -82, -38, -31, -24, -65, -53, -7, -68, -1, -18, -23, -28, -43, 83, -42, -13, -53, 0, 31, 8, -56, -66, -122, 23, -66, -10, -2, 38, -37, -23, -122, 25, -39, 41, 39, -66, -32, -55, -72, 5, 8, -39, 10, -3, -30, -49, -67, -21, 36, 22, -41, 12, -10, -63, 22, -101, -38, 2, 22, -32, 56, 6, -25, -82, -90, -82, -23, -83, -101, -77, 57, 1, 65, -55, 31, 18, 7, 34, 14, -90, 8, -69, 35, -46, 21, 12, -77, -99, -26, -43, -45, 21, -61, -34, 19, 42, -7, 62, 75, 20, 32, -60, -47, -84, -1, -21, 30, 51, -9, -11, -49, -99, -1, -71, -102, -51, 68, -45, -33, -87, -25, -68, -53, -11, 55, -127, 51, 7, 45, -12, -66, -69, -54, -5, 28, -10, 50, -57, 101, 26, -104, 6, -14, 30, -57, 13, 19, -63, 8, 54, -28, 4, -18, -96, 73, 6, 3, -78, 4, -7, -42, 63, 23, -40, -16, -28, 38, 40, 18, 57, 24, 56, 32, -79, -86, -48, -55, -36, -45, -85, 23, 57, -22, 13, -29, -55, -18, 40, -8, -2, 11, 15, 13, -2, -18, -19, -21, -16, 43, -42, 2, -1, 2, 39, 44, 58, -24, 26, 15, -40, 31, -3, 16, 31, -61, -74, 18, -28, -11, -1, -24, -22, -9, -90, 51, 20, -11, 10, 19, -8, -27, -21, -98, 10, -11, -27, 25, 16, -2, -46, -99, -20, -13, -6, 98, 29, 4, -37, -39, -58, -33, 1, -43, -36, 51, -27, 75, -35, -18, -38, -2, 21, -43, 23, 33, -45, 44, 26, -63, 4, -6, -52, 9, -20, -92, 4, -2, -65, -49, -19, 28, -72, 23, -24, -50, -10, -40, -100, -37, 38, 31, 19, -13, -15, 72, -40, -28, -36, -74, 8, -6, -82, -28, -69, -60, -78, -21, -48, 78, 24, -4, -5, -6, -63, -50, -4, 20, -41, -18, -22, 18, -18, -7, -18, 13, 2, -17, -20, 31, -72, 62, 16, -116, -14, -19, 0, -29, 19, 3, -52, 7, -59, 18, 20, -22, 8, -10, -23, -21, -16, -5, -77, 82, 36, 18, 30, -10, -30, 37, -52, -55, -5, -16, -2, -75, -17, -30, -28, -72, -42, -24, -54, 14, 46, 52, 7, 19, -109, -20, 31, -1, 6, -8, 8, 5, 4, 25, 21, 39, 16, 26, -16, -41, 23, -4, -5, -7, -35, 80, 1, 1, -8, 22, -28, -5, 0, -30, 2, -30, -46, -13, -47, -61, -41, 20, -15, 4, -5, -36, 12, -116, -41, -12, -26, 83, 56, 40, -33, 12, -19, -76, -2, -39, -55, 18, -37, -13, -27, -19, 22, 42, -36, 21, -86, -49, -20, -31, 3, -16, 7, -36, -89, -120, -1, -77, 21, -31, -63, -17, 12, -95, -2, -33, -32, -2, -7, -89, -110, 2, -84, 36, 19, -57, -21, -1, -37, -69, 10, -29, -26, -59, -30, 10, 25, -24, -5, -39, -78, -36, -124, -44, -43, -88, -36, 10, 16, -2, -50, -21, -40, -37, 35, -31, -11, 24, -33, -20, 48, -91, 18, 18, 2, -5, 23, -86, -50, 28, -81, -34, 37, 10, -59, -31, 19, 0, 34, 1, -8, 42, -8, 24, -4, 36, -55, 53, 15, -25, 42, -58, 35, -19, -48, 27, -17, 4, -77, 30, 7, 4, 35, -21, 47, -13, -96, -51, -22, -21, 22, 53, -77, 58, 23, -3, -39, 4, 13, 44, 29, 17, -44, -23, 40, -62, 37, 38, -20, -9, 10, -14, 35, 19, -27, 3, -6, -15, -23, 6, -42, 10, -13, -16, -50, 6, 3, -17, -10, -23, -93, 1, 0, -8, -25, 5, -29, -6, -31, -27, -94, 1, -31, 16, -41, 16, -49, 4, -94, -11, -7, 0, 42, -11, -19, 1, -17, 13, 31, 34, 24, 19, -14, 16, 40, 34, 11, 42, -5, -13, -10, 10, 7, 39, -28, 4, 10, 35, -111, -15, -107, -83, -15, 38, -18, -12, 15, 15, 17, 39, 6, 45, -7, -33, -1, 17, 3, -84, -56, -6, -70, 0, 23, -25, -112, 0, -22, 56, -93, -23, -43, 17, -17, 23, -34, 9, -35, -20, -65, -47, 21, 58, 2, 5, -1, 37, 3, -22, 88, -44, -20, -18, -3, -18, -12, -10, 2, 30, -32, 17, -17, 16, 28, -28, -56, -61, 38, 4, -69, 16, 22, 0, -43, 21, -33, 41, -5, -51, 30, -3, 32, -42, -76, -2, 5, -7, 47, -24, -91, 4, -58, 5, -74, -50, -7, 7, -7, 22, 13, 25, -18, 16, -43, -11, -6, 39, 22, -38, 5, 6, 19, 34, -21, -42, -6, -17, -16, -71, -14, -41, -23, 25, -71, -5, -12, -32, 19, -23, -18, -14, 21, -108, 3, 2, -13, 27, -57, 26, 39, -47, 21, 27, -26, -2, -36, -13, -19, 9, -7, -8, -41, -7, -7, 6, 16, -41, -37, 11, -50, -26, -17, -50, 25, 2, 7, -6, 6, -5, 8, 1, 30, 26, 30, -31, -27, 17, -4, 25, 15, 8, -19, -34, 16, -17, -2, -17, -44, -11, -7, -8, -63, -38, -92, -25, 6, 8, -25, -37, 2, 14, -38, 31, -1, 8, -25, 2, -34, -15, -18, -39, 4, -18, -30, -22, -27, 14, -8, 20, -8, 0, 14, -2, -69, 32, -66, -12, -12, 27, 2, -88, -29, -52, 14, 38, 7, 16, 4, 36, -7, -26, 41, 6, -14, -50, -8, -65, 10, 3, 22, 25, -30, -20, 2, 31, 29, -35, -46, -26, 12, 20, -34, -30, 38, 15, 13, 23, 47, 7, -7, 26, 20, 2, -43, -11, -74, -37, -8, -6, 19, -23, -24, -2, 4, -78, -41, 12, 26, 24, -47, 18, -10, 7, -16, -103, -1, -40, -4, 18, 19, -26, -37, 13, 12, -31, 4, -19, -41, -63, 7, -45, -39, -1, 26, 5, -42, -4, -17, -64, 8, -36, 5, -82, 5, -49, 25, -31, -11, 32, 13, -26, -21, -25, 4, 12, 14, -26, 26, -5, -30, -73, 8, -4, 48, 20, -99, 5, -42, -49, 6, 1, -50, 35, -78, -32, 40, 44, 24, -84, 7, -28, 8, 36, -15, 11, -46, 40, -25, -8, 14, 23, -18, 4, -31, -15, 39, -36, -10, 23, -29, -12, -52, -44, 17, -25, -48, -17, -2, -9, 13, -4, -12, -42, -39, 12, -36, 8, 9, -4, -22, -81, -14, -22, 20, -1, -5, -14, -59, -1, -80, 45, -5, -15, 20, 9, 18, -24, -36, -10, 19, 16, 24, -21, -55, -63, 44, -25, -57, 21, 17, 1, -12, -20, 46, 14, -25, -4, 28, 5, 53, -12, -20, 28, -53, 4, -27, -78, -57, -19, 2, -9, -46, -2, -18, 9, 4, 26, -9, 36, 26, 8, 39, -37, 24, -44, -89, 60, 10, 26, -61, -26, -7, -43, -127, -5, 31, -70, 21, 49, 13, -35, -11, 14, -31, 27, 10, 1, -34, -5, -5, 2, -18, 7, -13, -19, 11, -6, 12, 16, 13, -49, -98, -112, -47, 20, -14, -3, -41, -5, -10, -23, -29, -53, 10, -15, -13, -4, 14, -4, -36, -26, -48, -7, -22, -36, -14, 24, 51, 8, -46, 17, -22, -16, 1, 2, -82, -13, -82, -17, -67, 35, 13, -66, -18, 56, -20, -3, 10, -3, -28, 0, -111, -18, -12, 7, -92, 12, -21, 55, -76, -2, 15, 6, 0, 37, -90, -34, -25, 16, -58, -5, -26, 59, -43, -20, 37, -72, -59, -19, 34, -46, -24, -34, -59, -107, -42, -6, -35, -12, -66, -58, 34, -50, -41, 33, -75, 9, 17, -61, -35, -35, -81, -32, -36, -25, -53, -69, 36, -52, -21, 32, -4, -96, -48, 2, -51, -5, -36, 26, -62, -13, 5, -46, -22, -30, 12, -33, -10, -56, -32, -57, -10, 13, -68, 45, -32, 43, -44, -13, -33, 60, -46, -42, -66, 17, -34, -53, -34, 35, -61, 12, -27, 40, 3, -22, -12, -10, -25, -5, -13, -29, -1, -85, -23, 12, -86, 30, -71, -76, -60, -92, 8, 44, -2, 16, 13, 22, -18, -48, 15, -43, 19, 43, -37, -90, -18, -10, -17, 22, -92, -35, -48, -79, -1, 34, -40, -11, -32, -31, -57, -6, -23, -80, -1, 31, 0, -5, -127, -80, -22, -46, -9, 31, -15, 19, -32, 36, -4, -3, -1, -27, 14, -40, -43, -62, -5, -39, 0, 7, 0, -42, -7, -18, -16, -42, -28, 43, -60, 10, 16, 7, -22, 9, -25, 8, 15, -9, -11, -71, -20, 18, 48, 10, -9, -18, -14, -21, -1, 8, -38, 40, -18, -10, -17, -12, -44, -35, 40, 16, -59, -6, 27, -14, -10, 10, -19, -8, -80, -12, -20, -5, -14, -15, -5, -23, -33, -35, -32, 5, -2, -26, -8, -32, -1, -3, 2, -17, -40, -14, -14, 32, -4, 54, -13, 3, 23, 14, -37, 2, 29, -10, 15, -13, 31, 6, 10, -29, 43, -11, 12, 0, 0, 0, 4, -1, -47, -49, -33, 5, -3, -11, -2, -6, -4, -14, -9, -25, 32, 20, -24, 14, -22, -29, -48, 17, -25, 30, 11, 22, -24, -29, 12, 7, -6, -25, 4, 30, 2, 2, 12, -50, -107, -36, 21, 11, 41, 7, -22, 4, -9, 9, 26, -49, 11, 6, 23, -49, 2, -36, -5, -24, -36, 3, 13, -33, -3, 19, -24, 7, 26, -9, 15, -44, -48, -19, 6, 10, 6, -18, 3, -18, -23, 47, -30, -37, -22, 23, 11, 53, 25, -4, -31, 8, -2, -33, 27, 28, -16, 39, -34, -4, -28, 20, -14, -1, -26, 30, -10, 13, 11, -4, 9, 9, 32, 15, -10, 29, 23, 37, 18, 34, 10, -20, -14, -10, -35, -23, 2, -18, -16, 16, 32, 26, 13, 2, 0, 32, -12, -11, 4, 0, -21, -39, 8, -3, -17, 39, -19, -33, -30, 27, 4, 56, 2, -40, -30, -45, -32, -29, 32, 31, -1, 22, 12, -54, -66, -3, -29, -22, -13, 36, -27, -31, 19, 3, -5, 9, -61, -9, -13, 35, 12, -7, -18, 15, 26, -18, -35, 14, -28, -8, -7, -31, -51, -44, 4, 15, -10, 5, -6, 3, -11, 3, -15, -41, -7, -27, -4, 9, 0, 60, 8, 9, 2, 5, -40, 20, 3, -55, -20, -80, -25, -14, 14, 45, -27, -5, 23, -29, -50, 0, -56, -8, 5, 47, -40, -35, 24, -23, -13, -3, -41, 4, 30, 3, -13, -18, -43, 11, 47, -22, -15, -12, -13, -4, -35, -12, 7, -7, -31, 50, 6, 1, -16, 28, -6, 10, -10, -48, 26, -27, -5, 4, -42, -39, -9, 30, -43, -4, -36, 24, -11, -62, -4, 1, 0, 41, -61, -16, 16, -28, 23, -16, -84, -64, 0, 26, -48, -2, -41, -31, 28, -7, 38, -4, -32, -8, -7, -58, 24, 28, -18, -1, 24, 23, 14, 2, -11, 12, 19, 0, -68, -68, -21, 42, 0, 12, -30, 3, -29, 35, 22, 2, 15, -4, -28, -17, -23, 10, 18, 2, -46, -7, -9, -68, -9, 5, -19, -37, 11, -6, -22, -19, -14, -15, 5, -29, -84, -13, 6, 12, -22, -51, -30, 13, -40, -7, -10, 13, 1, -10, -3, -2, -14, 11, -32, -48, -29, -4, 9, -12, -27, -18, -20, -20, -2, -23, -12, 48, 26, 22, -19, -24, -35, 9, 11, -30, 7, -26, -31, -9, 30, 29, 30, -3, 7, -18, -13, -2, -13, 15, 21, 25, -35, 16, 10, -42, 43, -7, -20, -1, -57, 7, 22, 10, -6, -31, -45, -23, -4, 28, -15, -19, -4, 14, 17, 25, -29, -31, -36, -27, -28, -7, -27, 3, -22, 16, -15, -21, -61, 32, -18, -45, -46, 24, 26, -21, -31, -7, 15, -22, -24, 27, -13, -11, -3, -53, -1, 7, -51, 26, 8, 2, -30, -24, 0, 5, -10, 10, 0, -6, -12, -15, 1, -63, -14, -34, -34, 24, -22, -19, -28, -21, 3, -25, 12, -4, -36, -9, -15, -32, 1, 2, -7, 9, 9, 19, 2, 4, 16, -3, 18, -41, -4, -50, -13, 8, -34, -66, -8, 7, -21, -3, 13, 3, -6, 7, 36, 10, 12, -18, -7, 6, -37, -40, 11, -32, 3, -11, -46, 2, 16, 21, -37, -27, 12, 30, 22, 6, -39, 6, -22, -58, 11, 10, 4, -25, -59, -40, -22, 6, 21, 5, 15, -4, -36, 6, -12, -59, -25, 9, 31, 12, -31, -38, -27, -8, 21, -28, -5, -9, -11, -4, -11, -42, -13, -31, -4, 14, -17, 6, 4, -15, -9, 21, 19, 2, 4, -13, -9, -20, -7, 10, 18, 21, 1, 9, -15, -21, 26, 18, 6, 6, -23, 7, -43, -17, -23, -24, -22, 14, 8, 22, -3, 23, 43, -14, -9, -17, -29, 4, -6, -9, -14, 0, -37, 11, -38, -2, 1, 3, 8, 21, 4, -49, -58, -16, 12, -12, -21, 0, -25, 8, -32, 31, -26, -20, -36, 27, -32, -17, -40, 20, 12, -17, -3, -5, -41, -17, -12, -9, -17, 0, 12, -30, 15, -25, -35, -18, -6, -24, 0, -35, 10, -41, 15, -18, 9, -7, 26, 16, 5, -15, 25, 9, -20, -23, 10, 0, -34, 25, -15, -14, 10, -37, -41, -61, 12, 15, -32, 39, 2, 30, -39, -31, -8, 3, 9, -2, 1, -16, -12, -87, -30, 20, -5, -37, 35, -40, 24, -24, -69, 8, 8, 41, 0, -65, 26, -67, 45, -4, 26, 10, 10, -45, -16, 22, 4, 10, -59, -13, 3, 49, -6, -32, 31, 4, -79, 47, -15, -127, 12, -23, -13, 21, -4, -106, 22, -63, -13, -29, 19, 16, -32, -13, -46, -67, -8, -82, -30, 18, -15, -28, 0, -51, 15, 7, -12, 26, 32, -5, -43, 2, -3, -28, 33, 16, -10, 43, -23, -38, 50, 27, 1, 4, 6, 11, 33, -31, 4, -8, 12, -20, 10, 31, 1, 38, 13, 2, 7, -46, -53, 38, -9, 22, -5, -28, -37, 24, 0, -16, 23, -25, -30, 29, -30, -46, -14, 1, 33, 24, -4, -19, 12, 25, -31, 38, 12, -38, -12, -46, -1, -15, -24, -25, 7, -3, -22, -9, 8, 29, -56, -59, 16, -7, 10, 4, -13, 1, -29, -1, -6, -8, -18, -40, -5, -1, -14, 10, -27, -7, -6, -40, -21, 21, -2, 9, -17, -49, -5, -43, -2, -6, -11, 0, -26, -10, -35, -36, -11, -11, -57, -37, 1, -35, -22, -3, 24, -11, -8, -22, -2, -41, -28, 19, -23, 17, -42, 25, 24, -3, -5, -13, -38, 5, -46, -10, 12, 6, 18, -21, 2, 3, -10, 17, 8, -19, -21, 1, 13, 9, 12, 8, -15, -11, -11, 11, 16, 14, 7, 8, -6, -25, 22, -30, 21, 5, 2, -28, -6, -17, -4, 4, 5, -36, -28, -15, -21, 21, 17, -22, -8, -3, 1, -25, -51, 33, 8, 14, -38, 11, -47, 6, -6, 6, -3, -36, -27, -12, -27, 9, 24, 7, 4, 2, -17, -7, -15, 16, 3, 1, 6, -4, 27, -1, -32, 0, -44, -18, -18, 5, 18, 10, -27, 12, -1, 9, 22, -1, 10, 17, 31, 26, 5, -16, 20, 12, -24, -8, -23, 11, -14, 6, 17, -6, 4, -6, -29, 12, -33, 36, -67, -25, 18, -8, -9, -24, 3, -5, -8, 2, 8, 8, 14, -32, 8, 25, 0, -6, 4, 7, -12, 23, -56, 5, -20, -10, 2, -18, -6, -41, -8, -1, -5, -8, 9, 25, -2, -18, 3, -5, -23, 4, -14, -2, -6, -2, -36, 2, 7, -27, -4, 9, -43, -58, -9, -17, 4, -29, -8, -21, 7, -16, -5, -14, -25, 7, 7, -19, -15, -28, 26, -42, -19, 0, -11, 34, -16, 5, 1, 12, -28, -1, 15, 11, 6, -6, -26, -3, -16, 2, -1, -55, -21, -10, -6, -25, -18, 13, 14, 18, -23, -58, -5, -6, 24, -21, 0, -26, -3, -44, -5, -1, -18, -37, 9, -37, -13, -14, -18, 8, 13, -30, -32, -33, 3, -2, -3, -1, 1, -13, -9, 2, -12, 3, -17, 13, 27, -18, 14, 3, -41, 18, -9, -29, -68, 2, -22, -1, 2, -4, 1, 1, 19, 9, -15, -11, -21, 5, 4, -9, -17, -18, 15, -2, -4, -16, -46, -22, 6, -53, 13, -3, 10, -4, -7, -7, 19, -44, 15, 28, 8, 16, -8, -9, 9, -12, 2, -20, 14, 11, -34, 2, -74, 14, -4, -9, 0, -2, 14, 28, 4, -17, 23, 10, 5, 18, -4, 8, 30, -54, 24, 30, -1, 31, -19, -8, -36, -12, 14, -22, -8, -53, -7, 8, -12, 26, 35, 4, -1, 17, 7, -37, -20, 17, -10, 14, -24, -46, -57, -7, 13, 6, -18, 4, -33, -70, -15, 8, -7, -12, -5, 26, -6, -2, -2, -10, -127, 14, 1, 10, -16, -17, 20, -21, 6, -25, 11, 4, -8, 5, 23, 20, 0, -13, 7, 14, 7, 7, -11, -10, -39, -15, 21, -9, -6, -2, 20, 2, -59, 29, 26, 8, -36, -28, 51, 3, 21, 12, -13, -6, 18, -34, 19, -9, -9, 20, -5, -29, -30, -32, -25, 23, 8, -59, -2, -6, -3, -9, -11, -10, -24, -13, 2, -31, -25, -3, -60, -46, -23, -66, 7, -33, -64, 17, 13, -7, -62, -15, -28, -1, 7, -8, 53, -4, 9, 7, -71, -29, 7, 24, 17, -3, -16, 0, -12, 9, -33, -43, -3, -7, -24, -79, 46, -68, 4, 16, 15, 7, 2, -4, -56, 35, 2, 9, -5, 20, 25, -33, -22, -51, 28, 20, 2, 12, 29, -22, 2, 36, -16, 9, -43, -11, -87, 16, -84, -13, -35, -8, -37, 5, -57, 35, -20, 24, -112, -11, -21, -4, -31, -17, -74, 28, 7, 6, -34, -65, -3, -3, -72, -88, 79, 31, 7, -36, -13, 11, 11, -54, 5, -13, -31, 8, -42, -7, -50, 6, 46, 21, -5, -13, -39, -29, 33, 16, -56, 4, -29, -14, -18, -49, 33, 11, -6, 12, -68, 2, -14, -70, -11, -54, -23, -15, -58, 1, -23, -57, 52, -42, -88, 28, -20, -30, -3, -50, -119, 17, -31, 15, -14, 15, 33, -44, -29, -6, 34, 39, -55, -38, -26, 3, -5, -47, -23, -12, -87, -9, -50, 29, -22, 31, 41, -54, -81, 15, -41, -64, -5, 32, -2, -22, -72, -52, -34, -58, -27, 18, -32, 42, -83, 3, -48, 29, 29, -19, 5, 20, -68, -54, 2, -70, 9, -21, -127, -18, 14, 0, 10, -110, -4, 40, 3, -27, -9, 15, 48, -50, -52, 10, 9, 48, -78, 45, -72, 26, 33, -49, -26, 24, -78, -2, -41, 6, 7, -46, 4, -19, -59, -10, -41, -93, 18, 30, 0, -19, -31, -71, -10, 13, -50, -76, -32, -3, 25, -60, -93, -62, 1, -1, -47, 0, 45, 49, -50, 33, -54, -71, -95, 14, -1, -2, -21, -4, -62, -56, 20, 32, -1, -64, -58, 28, 8, -31, 56, 38, 21, 2, 61, 25, 27, 11, -26, 27, 18, -52, -1, -23, -7, 29, 2, 4, -31, 26, -6, -15, -58, -29, -23, -15, -114, 26, -25, 16, -49, -3, -5, -5, -1, -12, -62, -64, -16, -24, 20, -26, 47, 33, -25, 42, 41, 3, -48, 1, -64, 7, -81, -50, -28, 9, -2, -2, -42, -78, -94, 22, 2, 18, 27, 40, -27, 14, 29, 51, 18, 3, -13, 0, 12, -45, 19, 0, -49, 43, -33, -16, -46, 46, -15, 22, 19, 31, 2, -39, -41, 43, 28, 26, -15, 4, -12, 3, -1, -1, -42, -35, 25, -18, 22, -27, -50, 55, -29, 19, 28, 27, -123, -44, -40, -88, -45, -56, 3, -1, -25, -16, -10, -7, 7, -24, 4, -19, -17, 5, -22, -6, 57, 24, -18, 8, -3, -15, -23, -28, -73, -40, -22, 34, -66, 0, -39, 5, -59, -19, 47, 33, -40, -21, -1, -37, 11, 9, -60, -35, -41, -3, 24, -7, -49, -59, -25, 14, -29, -1, 10, -18, -12, -65, -17, -9, -44, 32, -65, -72, 24, 2, 10, 27, 31, 45, -39, 16, -16, 28, 12, 9, -7, -25, -1, 5, 22, -11, -44, -8, 1, -10, 48, -72, -75, 8, 24, -42, -11, -28, -87, -4, 41, -11, -111, -85, 35, 0, -49, -15, 31, 13, 15, -54, 39, -72, 57, -13, -35, -46, -11, -10, -17, 16, -17, -6, 18, 17, 15, -6, -53, -11, 20, -52, 18, -4, -8, 16, 41, 13, -41, -54, -63, 41, -1, 3, -37, -10, -55, 15, 21, -37, -48, -21, -6, -12, 29, -42, -58, 23, 36, -12, 15, -17, -9, 22, -5, -52, -93, -30, -25, -21, 7, 21, 28, -35, 41, 5, 30, -18, 18, 13, -1, 14, 32, 5, -5, 23, -23, 0, -7, -31, 1, 11, -119, -28, 14, -112, -6, 14, -9, -4, -17, 6, -5, 5, 3, 0, 8, 15, -13, -31, -44, 1, -9, -4, -35, -41, 15, -32, 23, -27, -36, 22, 19, -24, -5, -47, 29, 10, -6, -6, -6, -15, -38, 2, -40, -15, 23, -35, -27, -37, -18, -65, 9, 12, -14, -54, -23, -32, 16, -23, 2, -20, -5, -49, -11, -26, 1, -28, -5, -23, -35, -91, 34, -64, -34, 1, -93, 5, -15, -12, 29, -19, -25, 2, 21, -47, 19, -25, 1, -6, -22, -5, -23, -22, 30, 16, 26, 3, -35, 6, -27, -3, 25, 43, 1, 2, 9, -17, -28, 2, 12, -65, -37, -42, -8, -1, -2, 11, -23, -26, 26, -31, 3, -47, -22, -24, 11, -7, -12, -20, 1, -57, 2, -9, 2, -29, -25, -127, -11, 20, -71, -4, 23, -52, -33, -44, 6, 20, -18, -59, 20, -5, -24, 4, -7, -14, 20, -37, -14, 12, -34, 40, -7, 19, 24, 22, -22, 36, 8, 17, 11, 12, 6, -84, 7, -53, -3, -5, -6, -31, 56, -44, 10, 23, -26, 19, -32, 2, 34, -22, -4, -32, -15, 11, -2, 44, 4, -19, 25, 13, -23, -102, -73, -44, 18, -3, -7, -72, 6, 45, 15, -26, -34, -38, -74, 32, 35, -26, -2, 4, -14, -71, -37, -9, 7, 3, -8, -18, 57, -7, -19, -13, -33, -13, 30, 36, -2, -10, 25, -7, 9, -24, 0, -41, 34, 22, -30, 11, -9, 21, 38, 23, 1, -7, -45, 8, -16, -7, -26, -20, 12, -100, 19, -24, 23, 54, -17, 7, -26, -16, -9, 19, 30, 6, 1, -21, -10, -31, -35, 1, 13, 10, -20, 15, -55, -26, -3, 25, -13, -43, 25, -1, 23, 32, -17, -20, -6, 2, -2, -3, 26, -60, 5, 24, 2, -27, -1, 32, -17, 25, 10, 4, -2, 16, 6, 14, -42, 17, -27, 39, 3, 34, -26, -32, 2, -26, -13, -26, -8, 8, -31, -15, 11, 18, 29, -25, -15, -18, -15, 10, -10, 20, 26, -10, 8, 5, -15, -38, -11, -7, -9, 8, 8, 12, 5, 8, -2, 27, 6, 14, -15, 4, -45, -39, -11, -31, -68, -12, -30, 3, -27, -13, 16, -62, -8, -13, -69, -11, -4, -14, 18, 50, -24, 44, 14, 26, -5, 17, 10, -24, 23, -12, -15, -17, -69, 22, -21, 5, 38, -15, -7, 19, 12, 20, -66, 28, -29, 2, 16, -3, -17, -20, -4, -24, -2, 8, 2, 40, 5, 20, 0, -14, -16, 49, -34, -13, 1, -53, -23, -10, 48, -22, 23, 5, -33, -4, 11, -48, 7, 24, -49, 3, 23, 27, -32, -46, -1, -31, -46, -8, 11, 1, -30, 8, 2, 13, 23, 22, -13, -13, -21, -56, 33, -14, 15, -31, -10, -10, 22, -21, -8, -27, 14, 14, -21, 3, -36, 9, 28, 26, -10, 13, -5, -11, 23, 0, 52, -8, -24, 20, 19, 7, 9, 13, 36, -29, -45, 4, -25, 42, -5, -6, 29, -10, -63, -7, -8, 36, 8, -58, 24, -82, 0, 31, 9, 19, -15, 9, -29, 5, -17, 5, -58, 6, 16, 26, 38, -33, 30, -33, -70, 23, 23, -88, -8, 38, 5, 56, -45, -44, -14, -9, 7, -8, 4, -2, -15, 29, -29, -44, 46, -19, 26, 49, -41, -63, -4, -50, -34, -40, -48, 30, -55, -12, -36, -31, 1, 3, -70, 11, 24, 62, -10, -70, 27, -44, 30, 27, -17, -4, -55, 17, 11, 39, -87, 5, -57, -18, 9, 50, 18, -74, -14, 12, -38, 7, -8, 18, -85, 37, -12, 51, 6, -8, 30, -17, -18, -7, 17, -42, 11, -3, -47, -23, -33, 3, -17, 29, -26, -47, -41, -23, -7, -46, -8, 1, 4, -69, -16, 1, -21, 3, -2, -13, -25, -2, -5, -18, -17, -52, -46, -34, 5, -39, -1, -26, -16, -57, -16, -89, -6, -8, -37, -30, -1, -30, -33, -22, -30, 17, -17, 28, 10, -32, -19, -35, 4, 11, -27, -26, -12, 3, -58, -24, 3, -45, -49, -48, -28, -39, 16, 7, -17, -64, -6, -40, -1, 18, -19, -13, -38, -24, -21, -29, -16, -7, -56, -27, -31, -73, -15, -49, 0, -94, -41, -21, -1, -8, 17, -16, -33, -35, -30, -59, -79, 40, -33, 5, -47, -2, -16, -20, -23, 8, -12, -18, -17, -4, -8, -27, 25, -40, -42, -78, -4, -7, -75, -3, -12, -48, -21, -17, 14, 2, 15, 13, -51, -34, -47, -20, -8, -17, 16, 15, 11, -39, -77, -12, -27, -95, -75, -26, -23, -82, -16, -52, 21, -24, -27, -41, 5, -2, 14, -20, 2, -101, -47, -33, -6, 35, -52, 21, -27, -5, -34, -26, -47, -19, -17, -6, -67, 44, -2, 39, -40, -34, -40, -29, 10, 10, -49, -16, -27, -42, -40, -47, -9, 31, -23, 19, -49, -22, 4, -41, 50, 40, -5, -6, -15, 10, 22, 10, 6, 26, -21, 3, 16, 30, -3, 39, -3, -5, 2, 55, 7, 14, -4, 2, -15, -2, 8, -28, 25, -33, 8, -10, 23, -2, 18, -7, -31, -1, -12, -20, -15, 24, 13, -16, 9, 28, -27, -6, -2, 6, 3, -13, 18, 5, 16, -8, -34, -42, -3, 24, -24, 25, -37, -4, 45, -1, 3, 0, -58, -52, 7, -21, 20, 19, -127, -17, 11, -4, -59, 33, -3, -13, -22, 4, -3, 19, -2, 27, -5, -10, -13, -12, -15, 6, -3, -4, -1, 0, 9, -29, -48, -11, -36, -24, -52, 19, 0, -26, -17, 13, -15, -64, -9, -25, -39, -13, -11, -48, 2, 41, -17, -9, -47, 13, -49, 36, -69, 38, 47, 2, -15, -41, 10, -5, 54, 25, -59, 13, -33, -27, -13, 3, -30, -5, 27, -61, -30, -19, -15, -57, 31, -26, -77, 8, 10, -35, -53, -26, -88, -15, -40, -26, 9, -66, 12, -14, 0, -34, -33, 0, 48, 41, -14, 6, -36, -41, 3, -43, -32, -21, -17, -5, 26, 8, -15, 17, -48, 41, -48, 18, -9, 23, 31, 35, -2, -9, -58, 26, 21, 76, 13, 7, -41, 0, 19, -7, -15, 22, -6, -13, 0, 15, 8, 22, 20, -1, -6, 25, -11, 27, -11, -7, 7, 24, 28, -7, -33, 0, 13, 11, -6, 16, -21, 13, 30, 29, 19, 7, -42, -20, 22, 7, -2, -11, 19, 13, 23, 29, -1, 21, -4, 0, -2, 23, -3, 19, -13, 9, 17, 14, -77, -9, 25, 6, -2, -8, -86, -19, 3, 0, -17, 17, 25, -11, -23, -27, 4, 42, 22, -16, 2, -3, -10, -4, -35, -12, -39, 32, -37, -20, 17, 16, -1, -32, 16, -11, 14, -29, 3, 26, -2, -2, -35, 7, -12, -2, -8, -1, -13, -36, 18, -16, 18, 11, -50, -60, -10, 3, 17, 10, 22, -13, 24, 1, 5, -7, 4, 9, 0, 13, 10, -17, -14, 39, 9, -37, 73, -6, -39, -8, -5, -14, 26, -33, 12, 9, -1, -19, -15, -11, -50, -10, 4, -15, 38, -9, -18, 11, 6, -18, -10, -8, 33, -42, -23, -10, -31, -4, -39, 11, -44, 5, -6, -3, 20, -29, 4, 21, 58, -22, -22, -14, 66, -7, 31, -48, 14, -1, -12, -12, 17, -4, 8, 17, -25, 12, 0, 14, -2, 21, -53, 11, -32, 11, -67, 10, 0, -12, 28, -17, -5, 4, -7, -14, 10, 44, -8, -5, -58, -10, -6, -51, 9, -13, -10, 7, 0, -23, -14, -16, -29, -9, 19, -12, -1, 14, -5, 4, 11, -47, -37, -27, -39, -20, 10, 4, -1, -2, 25, -23, -8, 23, -46, -55, 14, -28, -14, 14, -62, 14, 31, 12, -14, -1, -34, 23, -38, -6, -112, -28, -1, 8, -8, -12, 3, 21, -3, 24, -40, 12, 12, -40, -63, -13, -42, -82, -11, -19, -19, 18, -11, -72, 12, 0, -53, 4, 7, 15, 7, -15, 3, 8, -6, -26, -17, -5, 27, 21, -19, -3, -11, 7, -5, 12, 9, 14, -17, -7, 3, -33, -8, 9, -3, 18, 24, -12, -20, 8, -28, 19, -65, -7, -127, -16, 31, 3, 5, 4, 15, 3, -3, -8, -22, -8, 13, -1, -60, -25, -2, -14, -2, 16, 8, 1, 3, -36, 15, 13, -32, -1, 1, 18, 12, 21, 11, 4, 8, -12, 10, 12, 18, -9, -20, -14, -28, 8, 15, -6, 11, -44, 2, -23, 7, -2, -14, 6, 16, 34, -22, 21, -5, 23, -27, -65, -18, 4, -60, -4, -44, -23, 23, 8, -8, -2, 17, -27, -18, -45, 28, 19, 10, 17, -3, -94, -8, -16, -60, -15, -10, -30, -35, 12, -40, -20, -68, -9, 27, -78, -18, -28, -15, -15, -11, -36, 42, -14, 2, 4, -56, -9, -1, 0, -8, -4, -51, 9, 7, -67, -22, 24, -28, 15, 6, -6, -47, -7, 3, 3, -14, 20, -70, -27, -17, -16, 25, 14, -9, 3, 16, 0, -8, -43, -4, -65, 3, 20, 4, -58, -4, -24, -5, -32, -33, -18, -31, 19, -29, 5, -25, 54, 4, -13, -12, 7, -10, -49, 8, -10, -28, -2, 7, -2, -40, 4, 17, -10, -10, 10, -24, 4, -19, -29, -3, 23, -11, 23, -22, 7, -41, -2, 34, 31, -10, 7, -94, -46, 32, -55, -34, 3, 17, 7, -31, -19, -6, 8, 18, -17, -2, -17, 17, 6, -3, -16, -14, 3, -5, 12, -17, -24, -13, -4, -9, 22, -12, 4, 7, 9, 2, -23, -13, 11, -15, 15, -1, 6, -18, 1, 12, -4, 11, -47, -5, -97, -12, -36, -35, -40, 30, -61, -57, 19, -30, 0, -57, -38, 11, -35, -94, -2, -67, -11, 8, 13, -22, 8, 33, 1, -23, 10, 3, -50, -29, -5, 13, -44, -60, 24, -79, -22, 24, -39, 26, 27, -32, 2, -39, -3, -19, -44, 19, 1, 9, -37, -16, -35, -16, -33, 15, -5, -31, 21, -19, -2, 6, -58, -71, -9, 5, -51, -30, 7, -16, -37, -30, 40, -39, 23, -10, -34, -3, 7, -84, -20, -17, -9, 16, 14, 5, 20, -32, 2, 18, 10, 19, -14, -16, -3, 33, -18, -62, 7, 15, -14, 27, -18, 12, 16, -12, 2, 19, -20, 23, -6, 31, 10, 0, -55, 9, 14, -19, -3, 16, 1, -7, 19, 21, -18, -1, 8, -49, -21, -31, 6, 14, -19, -52, -49, -14, 15, -82, -9, 9, -23, -11, 9, -62, -63, 39, 2, -23, 6, -3, 11, -75, 32, -43, 3, 3, -57, -15, -56, 16, 41, -80, 0, 36, -2, 6, 19, 11, 3, -6, 3, 1, 16, -37, -13, 42, 11, 22, -24, 3, 24, -34, 37, -15, 32, -27, 28, -66, 0, -75, -29, -2, -28, -6, -20, -54, -69, -4, 15, -15, -1, -4, 29, -2, 24, -56, -10, 2, -38, -3, -42, -86, -4, -52, -45, 39, -8, 46, -45, -50, 3, 15, -14, -4, -3, -16, -29, 18, -8, 22, -34, -81, -15, -17, 9, -29, -14, -12, 20, -43, -16, 1, -30, 3, -40, -14, 0, -30, -33, 9, -61, -50, 8, -105, -13, 1, 38, -10, 9, -23, -53, -6, -7, -27, 2, 19, -70, 15, 18, -35, -1, 10, 45, 21, -62, -71, -29, -43, -9, -26, -15, -36, -1, -36, 11, -45, -24, -6, 9, -25, -36, -4, 28, -4, 7, -100, -12, 11, -36, -20, 6, -14, 13, -27, -13, -86, 5, 14, -12, 10, 21, -50, -47, 15, -45, -40, 10, -58, 14, -6, 22, -59, -3, 10, -96, 14, -67, -43, -3, -35, 23, 4, 1, -50, -14, 7, 13, 12, -24, -81, -31, -77, -19, 8, -17, -44, 1, -41, 2, -79, -93, -4, 22, -43, -72, 22, 30, -35, -65, -91, -12, 3, 17, -2, 12, -68, 6, -33, -38, -127, -3, 24, -25, 10, -1, -33, 3, 14, -45, 22, -31, 14, -45, -2, 5, -7, -34, -10, 17, -42, 6, -28, -28, 19, 20, -15, 16, -2, -60, 3, -2, 26, 22, 7, -28, 5, -13, -24, 13, -22, -13, -31, -13, 23, -21, -22, -18, 9, -7, 11, -3, -16, -1, -16, 4, 27, 0, -5, -35, 7, 17, -9, 21, 9, -14, -18, -11, -37, 0, -9, -10, -2, 18, 11, -11, 1, -23, -19, -23, -6, 10, -21, 33, 0, 18, 2, -17, -3, -9, -45, 8, -18, -34, 10, 7, 11, 15, -15, -49, 4, -11, -20, 18, 19, 27, 37, -24, -17, 20, 22, -11, -6, 28, 13, -12, -20, -28, 17, 11, 6, 0, 12, 3, 1, 33, -14, 5, -1, -13, -19, -5, 6, 1, -7, -7, -22, -13, 16, -14, -1, 5, -11, -21, 9, -14, -6, 38, 1, 36, 16, 2, 5, -14, -26, -23, -25, -16, 3, -9, 6, -32, -6, -32, 24, -3, -65, 13, 3, -9, 20, 0, -43, 15, 20, 4, 8, -21, 8, -23, -8, -41, -15, -13, -18, 2, 35, -7, 17, 13, -2, -8, -21, 7, 12, 0, -9, 14, 16, -23, -20, -68, 12, -10, 2, -46, -12, -6, -1, -23, -16, 17, -23, 23, -23, -58, 7, 4, 46, -3, 2, -40, -25, -14, 20, 18, 0, -3, 16, -11, -18, -1, -46, -32, -26, -23, 29, -11, -28, 9, 14, -32, 3, 14, -12, 51, 11, 15, 3, -11, 12, -22, 21, -1, -1, -5, -3, -39, -15, -11, -5, 16, -27, -24, 2, 7, 17, 23, -1, -3, -58, -11, 4, -21, 9, 29, -6, 16, 17, -11, -4, -13, 3, -27, 4, -5, -21, 3, -6, -5, -11, -14, -3, -3, -13, 0, -19, -5, 21, -24, 6, 5, -12, 18, 10, -39, 15, -22, -14, 33, -6, -21, -37, -28, 29, 9, 1, 4, -3, -34, -12, -51, -14, -18, -20, 13, -14, -11, -50, -20, 32, 9, -15, 23, -2, -25, 0, -46, 10, 19, 13, 24, 27, 3, 9, -36, 9, 4, -15, -4, -8, 1, -14, -6, -31, -15, -5, 1, -23, 22, 3, 46, 10, -4, -11, -4, -32, 14, 24, 2, -29, -10, 4, 17, -17, 9, -5, 15, 6, -11, -2, 11, 12, 0, -6, -6, 11, 2, -17, -1, -1, -2, 0, -28, 15, 4, -10, -49, -43, -31, 3, 51, 14, 50, -73, 12, -27, -2, 24, 10, 30, -75, -23, 17, -38, 38, -32, -21, -9, -14, -32, -9, -19, -37, -36, 14, 31, 6, -25, 13, -72, -21, -38, 12, 13, 21, -30, 14, -13, 13, -21, -11, 9, -23, 8, 21, 27, 21, 3, -17, -8, -42, -99, -6, -35, 34, -36, 2, 5, 23, 4, -28, -65, -19, -3, -45, 2, 23, -48, 20, -32, 21, 18, 6, 13, -25, -43, -15, -54, 22, -19, -15, 3, 3, -64, -23, 6, -20, -11, -13, 11, 26, -96, 4, -29, -48, 16, 5, 10, 42, -31, -19, -5, 25, 8, -16, -14, -20, 11, -28, 3, 18, -22, 17, 3, 11, -71, -21, -14, 9, -59, 22, -3, 6, 13, 19, 3, 27, -7, -82, -57, -10, -15, 2, -8, 14, 31, 30, -17, 8, -26, 3, -71, 5, -30, -5, 19, -4, -61, 15, -23, -4, -20, -22, 9, 10, -62, -10, -7, 30, -27, 8, -3, -26, 40, -42, 21, 3, -36, -21, 21, -23, -29, -1, 35, 7, -12, 37, -9, 34, -13, -42, 17, 12, -21, 3, -43, -21, -11, 14, 3, -15, 8, 12, 41, 21, -23, 17, -2, -35, 21, -7, -3, -34, -9, 28, -53, 9, 16, -93, -13, -32, 7, -11, 0, -15, -3, -10, 15, 3, -19, 14, -15, -3, 1, -29, 6, 4, -46, 15, -23, -45, -37, 12, 9, 3, 27, 17, -41, -33, -46, -44, -24, -3, -51, 23, -47, -5, 10, -62, -7, -19, -38, -2, -33, -44, 18, 48, 5, -5, -24, 3, 3, 23, 15, -13, 3, -58, -24, 3, -46, 35, -20, -60, -10, -6, -36, -23, 38, 25, 5, -9, 12, 27, -15, 34, -46, 7, -28, 16, 15, 12, -1, 4, -17, 0, 6, 10, -7, -15, 6, 8, -30, -15, -21, -22, 2, -1, -29, -27, -34, 0, -73, 15, -46, -4, -56, 21, 2, -38, 44, -6, 15, -60, -7, -21, -10, 30, 51, -12, 33, 10, -52, 39, -77, 54, -23, -17, -21, -19, 41, -9, 5, 5, -7, -1, -12, -2, 30, 49, -42, -36, 48, 10, 3, 13, -1, 4, -21, 36, -10, -37, 8, -5, -1, -36, 8, 23, -52, 2, 15, -1, -4, -43, 5, -20, -35, 44, -17, -9, -127, 36, 3, -11, -25, -11, 42, 2, 8, -7, 21, 2, -14, 25, 19, -9, 25, 17, -19, -22, 39, -80, -30, 32, 13, -15, 19, 4, 4, 33, 13, 23, -8, -36, -17, 27, 8, -52, 4, 33, -3, 38, -71, -28, -19, -9, -7, -6, -18, -3, 40, 15, -41, -41, -29, -32, 9, 56, -60, -52, -28, -44, -78, 8, -61, 8, -8, -17, -8, 16, 10, 4, 3, 15, -21, 2, -8, -15, 29, -7, 23, 2, 5, 4, 20, -31, -7, -5, 25, -34, 13, -8, 3, -13, -34, 20, -12, 21, 16, 55, -10, 22, 2, 7, 3, 33, -19, -32, 4, 44, 15, 17, 27, -3, -45, -49, -72, 25, -3, 2, -12, 29, -50, -53, -56, -40, -84, 11, -65, 19, 22, 6, -58, 4, -4, -39, -1, 17, 13, 6, -1, -30, 12, 29, 5, -7, -54, 6, -94, -53, 0, -71, -5, -59, 46, -17, 5, -27, -5, 1, 12, 22, -14, -33, 21, 16, -12, 8, -22, 8, -38, 13, -1, -23, -1, -2, -28, 15, -73, -89, -94, 21, -34, 4, -35, -28, 23, -38, -60, -13, -6, -32, 4, -18, -3, -10, 20, -19, -29, 2, -22, 3, 26, 8, 23, 4, -20, -30, -6, 8, -33, -9, -38, 2, -18, 9, -2, -60, -12, -62, -48, -36, -2, -41, -19, -8, -8, 7, 27, -45, -13, -9, -50, 8, -46, -50, -4, 50, 21, 7, 8, -1, -38, -2, -18, -22, -28, -30, -56, -4, -22, -15, 9, 5, -37, 16, -4, -33, -40, -27, 14, 19, 2, -21, -30, -52, -52, -29, 37, -29, 6, 9, 3, -33, -15, -7, -31, 3, 0, 11, 4, -34, -46, 5, -31, 2, -74, 19, 33, -13, -33, 3, -18, -48, -19, 4, -14, 13, -69, -70, -5, -27, 19, 10, -16, -13, -46, -34, -36, -23, -9, 50, -36, 8, -28, -9, -68, 23, 2, 6, 20, -64, 11, -7, -13, -8, -14, 4, -67, 29, -45, 11, 31, 2, 36, 26, -73, 8, -42, -47, -25, -13, 56, 14, 3, 3, -15, 20, -43, 9, -15, -27, -18, -40, -48, -22, -19, -9, 14, 1, -9, 9, 30, 4, 13, -36, 0, 1, 26, 26, -19, 11, 2, -39, 2, 19, -61, -5, -15, -13, -32, 32, 17, -2, 12, -47, -33, -46, 27, 22, -50, 11, 18, 13, 1, 53, -24, -10, 2, -40, -6, 13, -15, 15, -36, -20, 17, 3, 3, -2, -45, -21, -17, -19, 1, 10, -13, 13, 10, -25, -18, -16, -34, -14, 7, -26, -22, -39, -48, 14, -17, -13, 42, -3, 8, -19, 15, -15, -36, -50, -12, 12, 0, 18, -32, 7, 44, -8, -38, -61, -30, -13, 20, -10, -21, 4, -34, -14, -7, 40, -4, -35, 1, -39, 5, -6, -15, 15, -6, -21, 23, -23, 22, -5, -20, -16, -18, -7, -37, 0, 38, 6, -45, -8, -20, -19, -16, 5, 27, 14, -6, -33, 1, -47, -9, -15, -27, -20, 42, -21, -3, 20, -18, 4, -61, 17, -21, 4, -43, -28, 28, -17, -18, -13, 1, -55, -41, -2, -27, 12, -36, 4, -15, 24, -14, -26, 18, 17, -51, -12, -22, 9, 19, 9, 24, -9, -9, 4, -21, 23, -21, 27, -52, -14, -9, -55, -1, -8, 1, 7, -14, -4, 21, 4, 24, 2, 13, -11, 7, -3, 23, -14, 35, -7, 6, 4, 5, 15, -47, 10, -45, -16, -22, -15, -9, 17, 1, -37, -11, -20, 17, 4, -27, -2, 21, -23, -14, 27, 15, -8, 1, -6, -1, -10, 11, 8, -23, 12, 4, 34, -7, -10, -32, -18, -16, 12, 2, 39, -12, 8, 10, 12, -10, -34, 6, 20, 11, 22, -24, 3, 3, 15, 18, -10, -26, 37, -4, -4, 37, -23, 25, 31, 3, 12, -14, -3, -8, -7, 22, -9, -24, -13, -12, -14, 26, 4, 38, 6, -64, 15, -16, 55, 10, -2, 13, -5, 14, 5, 24, 12, -1, -2, -67, 4, 7, 5, -18, -20, -9, 32, -16, -18, -1, 20, -53, 9, 25, -31, -22, 0, 1, 29, -50, -119, -11, -79, -13, -25, 5, 8, -20, 0, -51, -77, 18, 6, 10, 18, -22, -31, 24, -13, 11, -12, -68, -1, -4, -37, -62, -5, 41, -127, 23, -23, 7, 51, -2, 0, 25, 12, -21, 10, 15, 25, 45, -2, 33, -9, -84, -4, -5, 9, 13, 61, -24, 12, 13, -45, -32, -13, -19, -10, -14, 5, -10, 25, 56, 8, 10, -10, -37, -1, 6, -34, -40, -2, -23, -1, 14, -2, 14, -17, 3, -2, 37, -6, 24, -47, 25, 20, 13, 38, -1, 33, -3, -3, 4, 4, -1, 0, -6, 8, -46, 42, 3, -23, -53, -24, -29, 11, -18, 30, -42, 39, 5, 30, -13, 6, -43, -10, -35, -11, -15, 18, -10, -5, 24, -15, 58, 25, 24, -1, -29, 21, -65, -34, -6, 32, 16, -37, 3, -67, -12, -20, -5, 41, -26, -4, -41, 15, 3, -6, 22, -9, -29, 7, -19, 29, -7, 31, 4, -2, 9, -26, -39, -3, -1, -41, -16, 4, -22, -12, -20, 41, -17, 20, -43, 12, 22, -17, -2, -18, -25, -16, -34, -44, -12, -15, -7, -7, 12, 15, -4, 31, -28, -15, -49, -14, -36, 5, -17, -27, 12, -2, 0, -51, -7, 2, -7, -8, -5, 3, -18, 0, -7, -1, 25, -4, -22, 16, -12, -19, 54, -11, 4, 10, -14, -27, 46, -7, -11, -15, -14, 31, -8, -15, -76, -9, -65, -54, -25, -64, 19, -54, 18, -35, 21, -33, -12, 16, -11, -69, 21, -53, -20, -3, -7, -15, -54, -19, -36, -6, -25, -3, -21, -2, -33, 23, -33, -40, -29, -25, 24, -72, -10, -33, -18, -61, -52, 0, -27, -30, 7, -2, 24, -11, -35, -4, -5, 12, -31, -20, 50, -18, 43, 2, -58, 20, 8, 36, 1, -1, 8, 17, -33, -25, 20, 32, -2, -17, -26, 17, -6, 43, 15, -2, -17, 0, 7, 20, -58, -31, 14, 18, 35, 12, 15, -6, 8, -50, -12, -24, -7, 40, 25, -9, -37, -8, -35, -49, -74, 18, -23, -11, -17, 19, -43, -6, -36, -10, -1, -22, -9, -48, 17, -60, -18, -5, -50, 6, -71, 22, -26, -8, -20, -23, -25, 30, -27, -44, -9, 2, -43, -21, -5, -6, -24, 0, -7, 26, -15, 6, 17, -46, 0, -17, -1, -3, -28, -8, -25, -16, -26, 47, -40, -4, 10, -6, 14, -6, -24, -25, 0, -16, -47, 8, -18, 28, -16, 47, -4, 21, -52, 19, 13, -55, -26, -28, -41, -41, -8, -5, -25, 42, 17, -127, -45, -2, -32, -31, -31, 19, -4, -92, -25, 27, 3, -48, -27, -24, -27, -6, -8, 25, -15, -16, -8, -76, -17, -45, -12, -11, -45, -14, -22, -61, -24, 5, -13, 3, -32, -30, 13, -11, -75, -13, -3, -37, -60, -14, -10, -24, 0, 1, 6, -14, -37, 1, 24, 5, -20, -31, 13, 18, -5, -7, 4, -3, 0, 18, -6, -2, -42, -17, -14, 4, -53, 36, 12, -30, 14, 0, 20, -12, 24, -6, -24, -33, -6, -12, 0, -11, 24, 1, -8, 5, 19, 0, 14, 42, -12, -88, 21, -3, -57, -21, -65, -75, -1, 22, -14, 9, -75, 5, -64, -11, -13, 37, -50, -11, -70, 15, 26, 14, 11, -46, 5, -39, 7, -25, 20, 24, -64, -17, 25, -46, -23, -9, -50, -22, -10, 26, -24, -62, 2, -22, 18, -8, -45, -59, 33, -9, -37, 21, -23, -8, -7, -13, -18, 11, -12, 8, -6, 45, 13, 15, 33, -5, -9, 23, -57, -22, 47, -26, 24, -32, 8, -17, -79, 12, -81, 74, -10, -20, -37, -35, 54, -65, 17, -21, -39, -18, -8, 7, -58, -2, -19, -29, -54, 21, 4, -48, -4, -15, 1, 31, -9, -42, 9, 40, 31, 5, -15, -15, 15, -66, 22, 14, -25, 24, 14, -68, -78, 14, 19, 12, -26, 39, -15, -21, 54, -49, -64, 10, 2, 1, 7, -122, 5, -33, -11, -35, -11, 13, -4, -91, -43, -60, -1, -30, 2, 4, 18, 40, -78, -76, 15, 7, -4, 15, -1, 15, 6, -52, 4, -21, -18, -27, 16, -56, -70, 24, -21, 3, 27, -30, 45, -6, 14, 3, -9, 3, 9, -2, -36, 25, -19, 5, -54, 11, -4, -50, -38, -7, 14, 11, 27, 31, -9, 3, -32, 15, -18, -52, -43, -15, -25, 15, -28, -9, -56, -27, 20, -23, -13, 12, -59, 20, -40, -80, 20, -2, 21, 19, -15, 7, -4, -14, -10, 6, -39, -6, 21, -7, -52, 22, 23, -20, 1, 2, 24, -20, 16, 12, 19, -59, 1, -7, -11, 43, -47, -4, -59, -43, -33, -20, -42, -11, 0, 25, 6, -33, 2, 7, 18, 26, -39, -40, -3, -34, -48, 18, -39, -6, -22, 22, 18, 8, 26, 16, -18, 24, -60, -24, 21, -6, 9, 2, -28, 8, -25, 30, -41, -6, -48, -13, 42, 7, 12, 29, -9, -36, -4, -17, 25, -8, -8, 8, 20, -30, 11, 29, 1, 41, -23, 10, -5, -4, -21, -15, -33, -57, -22, 35, -12, -25, -6, -24, 10, 7, -27, -62, 7, -15, 26, -14, -7, -16, -5, 9, 23, 7, 12, -16, 29, -3, 8, 21, 6, 1, -36, -5, 2, 3, -83, -8, -6, -36, 0, 7, 13, -50, -32, -37, -34, -62, -48, 22, 22, 11, 1, -10, 14, -5, 2, 7, -12, -10, -5, -5, 19, -20, -22, -9, 16, -10, 7, 19, 9, -36, 20, -10, -32, 21, 9, -2, -23, -2, 25, 2, 7, 23, -15, -45, -9, -45, -17, 3, -27, -15, -15, -1, 30, 1, -1, 2, 6, -31, -83, 5, -33, -25, 3, -26, -10, 11, -19, -7, 35, -14, -12, 7, 26, 2, -12, -15, 3, 2, -11, -29, -4, 1, 3, -22, -14, -27, 22, -11, -12, 55, 19, 35, 2, 32, 3, 39, 30, 14, 3, -18, 2, 12, 13, -30, -11, -53, 3, -24, -13, -21, 0, 24, -10, 13, -14, -15, 31, 4, -23, -1, -20, -7, -36, -12, 18, -12, 13, -68, -17, -9, 2, 5, -37, -1, -4, 4, -10, 2, -3, -17, 8, 8, 6, 6, 6, 13, 4, -35, -46, 3, 32, -10, 0, 59, -10, 10, 21, 38, -11, 5, 28, 4, -3, -7, 15, -2, 31, -27, -5, 6, -4, -40, 16, 0, 7, -31, 20, -26, 24, 27, -7, -3, -16, -8, 2, -6, -127, 6, 11, -60, 33, -30, 4, -36, 5, 11, 24, 31, -22, -22, 2, -7, 11, -34, -47, 20, -48, -22, -38, -16, 15, -12, 13, -54, -80, -50, 7, -45, -3, -13, 19, -21, -21, 1, -67, -15, 15, 34, -25, -10, -3, -19, -49, -13, 10, -4, 19, -59, -31, -6, 0, 17, -6, 9, 10, -20, -11, -43, -2, 10, -103, -2, 30, -35, 18, -19, -21, -20, -32, 18, -6, 17, -11, 13, -3, -19, -2, -78, -40, 6, -30, -62, -55, -21, 6, 26, -8, -11, -92, -32, -1, -36, 5, 1, 22, -41, -7, -75, 4, -60, 24, 7, -55, 13, -10, -28, -15, -44, 5, -15, 29, 21, -31, -10, -68, -1, 6, 10, -5, 3, -12, -31, -72, 25, -87, 15, -26, -37, 11, 13, 0, -10, -20, 5, -27, 25, -7, 3, -14, -21, -21, -5, -50, -6, 18, -27, 31, -16, 16, 8, -6, 8, -55, -23, -39, 12, 18, 15, 23, -38, 0, -33, 12, -7, 12, 23, -33, 26, -2, 19, 13, 18, -66, 14, -57, -38, 20, -3, 26, -4, 5, -15, -35, 5, -1, 12, 3, 12, 1, -42, -15, 2, 5, 21, -127, -1, 26, 1, 6, -19, 24, -10, -17, -13, -6, -8, -25, 4, -16, -11, 24, -37, 17, 4, -21, -3, -17, 3, -7, -4, 8, 6, -7, 13, 16, 24, 1, -6, -63, -36, 1, 4, -83, 18, -2, -12, -6, -8, -13, 0, 6, 22, -3, -55, -2, -58, -46, 17, 10, -18, 28, -13, 15, -28, -10, -2, -51, 9, -69, -12, 13, -13, 18, -13, 19, -13, 12, -29, 38, -18, -9, -13, 2, -17, -50, -25, -24, 5, -1, -7, -32, -11, 16, -30, 8, 24, -73, 7, 8, -2, -2, -11, 4, -5, -5, -4, -20, -27, -41, -21, -15, -12, -6, 14, 22, -18, 18, -5, -5, -35, -87, -14, -10, -6, 25, -7, 20, -5, -10, -11, -7, -30, 13, -15, 12, -11, 22, 10, 25, -20, -1, 19, 29, -5, 34, 8, 7, -15, -78, 24, -59, -14, 19, 3, -5, -17, 4, -68, -39, -17, -2, 34, -11, -46, -8, -8, -17, 13, 6, -23, -10, 12, -47, 1, -85, -2, -26, 5, -9, -10, -25, 6, 30, -12, -7, 29, -22, 2, 1, 16, -18, -34, 5, 6, -42, -1, -45, 23, -8, -8, -11, -19, 14, 2, -3, 2, -10, 21, 7, 5, 23, 2, 4, -34, 1, -3, -25, -9, 0, 3, 2, 1, 8, 9, -35, 2, 5, 27, 12, -14, -65, -39, 3, 17, -36, 0, -73, 1, -5, -6, 11, 14, -4, -50, -32, -11, 13, -41, -11, 32, 8, -5, 15, -5, -6, 7, -8, -7, -59, 11, -55, 3, -18, -19, -3, -15, 10, -2, 24, -29, -4, 1, -29, 8, 10, 4, -25, 17, -6, -11, -24, -31, 12, 3, 11, -3, -4, -4, -45, -1, 9, 5, -10, 11, -16, -43, -2, 8, -19, -24, -15, -7, 5, 5, 11, 18, 29, -30, 4, 0, 3, -8, -29, -38, -18, -29, 14, -25, -14, 18, -48, -48, -54, 21, -1, -43, 2, -10, 11, 27, -3, -13, 3, 15, -3, -9, 0, -23, -6, -13, -54, 27, -49, -25, 11, -29, -22, -29, 12, -71, -59, -81, -34, -13, 22, -39, 3, -9, -18, -24, 13, -24, 0, 17, -12, -35, -20, -10, 25, -14, -10, -5, -8, 9, 5, -11, 21, 23, 7, -5, -13, 10, 19, -6, 0, 6, -63, -5, -23, 3, -31, 6, -28, -17, -3, -13, 14, -2, 7, 0, 17, 13, 7, -10, 8, 21, -3, 10, -6, 8, -13, 16, 6, 2, 0, 12, -20, -1, 13, 8, -36, 23, -30, -22, -25, 9, -27, 1, -12, -5, -15, 0, 15, -16, -25, -10, -22, -11, -3, -48, 19, 25, 4, -8, -6, 1, 21, -13, -20, 10, 1, 23, -48, -7, -13, -2, -31, -11, -23, 3, -3, -11, 9, 15, -38, -2, 18, -14, -6, 6, -17, -6, -12, -24, -9, -5, -13, 10, 15, -10, -9, 9, 17, 1, -52, 17, -18, -53, -28, 8, -62, 9, -13, 10, -16, 17, 4, 5, -3, -7, -14, -20, -9, -9, -4, 12, 7, -16, 17, -64, 11, 24, -39, 9, 5, 16, 5, 0, 9, -36, -1, -3, -31, 31, -4, 35, -4, 31, -18, 1, 5, 2, -76, 23, -41, -30, 7, -23, 4, -2, -42, -30, -40, -28, -11, -30, 21, -20, -21, 11, -5, -62, -12, -30, -13, 24, -10, 28, -29, 13, 40, -15, -15, 39, -11, -12, -54, -12, 49, 26, -29, -3, 4, 23, -13, 9, -5, -31, 11, 18, -91, -3, 27, 2, 34, -80, 31, 7, 3, -19, 3, 32, -37, -3, 23, -1, 16, 9, 22, 10, 4, -26, 3, -2, 1, 8, 48, 2, 23, 1, 26, -25, -1, -6, -61, -45, -8, 33, -22, -47, -76, -3, -42, 3, -22, 36, 6, 4, 38, -69, -27, -34, -19, -21, -2, -37, 11, -40, -12, -26, 10, -66, -34, -44, -69, 8, -3, -4, 34, 14, -17, 36, -51, -17, 3, 32, -28, -52, 32, 21, -17, -12, -3, -23, -39, -54, -65, -14, 9, -13, -37, -12, -111, -59, -33, -86, 13, 17, 18, -16, -34, -27, 8, -10, -21, 0, -26, -22, 6, 8, 5, 4, 17, -26, -36, 10, -62, -14, 12, -65, 41, -32, 13, 3, -10, -36, -40, -11, -19, -7, -26, 2, -11, 22, -11, -5, -27, 31, -13, 20, 1, -14, -46, 5, -8, 13, 9, -21, -15, -8, -22, -8, -39, -24, -3, -66, -123, -1, -23, -11, 14, 11, 15, -19, 20, -46, -43, -1, 12, -11, -4, -53, 2, 16, 20, 12, -17, -24, -4, -23, 22, 7, 18, -15, 9, 43, 20, 0, 18, 20, 2, 2, -50, 16, -1, -23, -19, -6, 9, 11, -3, 9, 10, 0, -3, -35, 21, 6, -28, 5, 3, -33, -2, -11, -16, 21, 0, 23, 20, -4, 21, -20, 17, -27, 10, 17, -34, -15, 10, 30, -2, -24, -6, -59, -31, -31, -3, 27, 1, -38, -29, -48, -39, -34, 25, -14, 20, -32, -4, -14, 14, -14, -1, 4, -25, 16, -44, -27, 1, 1, -25, 10, -42, 40, -34, -75, -28, 9, -35, -18, 40, 7, -14, 41, -29, -68, -6, -35, -35, -11, -38, -18, -36, -4, 10, -43, -4, -31, -16, 19, -38, -23, -35, 20, 25, 30, 7, -10, 3, 17, -4, -1, 34, 17, -25, -30, -21, -21, 6, 9, -4, -14, 17, 31, -11, 20, -18, -24, -45, -38, -4, -20, 5, 15, -17, 21, 9, 24, -33, -11, -74, -44, -23, 12, -56, -2, 16, 53, 0, -39, -9, 34, 18, 4, -48, 52, 7, 24, -40, -30, 22, 0, -14, 9, -14, -71, 12, 20, 1, 12, 10, 8, 1, -22, -28, -48, 47, 6, 7, -32, -18, -3, 14, 14, -30, 0, 59, 11, 25, 26, -52, 25, -15, 31, -26, -8, -21, -19, -22, -10, -19, -2, 7, 7, 27, 29, -35, -53, 30, -36, 8, -4, -13, -29, -3, 13, 5, 7, -33, -20, 1, -13, -22, -42, 9, -41, 1, -12, -24, 14, 1, 30, 14, -74, 9, -127, -67, -52, -60, 45, -46, 13, -52, -24, -55, -32, 2, -59, 33, -49, -16, -63, 30, -47, -54, -10, 34, -11, -33, 30, -70, -34, -36, -48, 2, -60, -19, -47, -18, 23, -77, -17, 17, 17, 8, 58, 5, -52, -8, 6, 27, 5, -16, 43, -27, 10, -1, -30, -7, -30, 15, 10, -34, 15, -59, -12, -10, 26, -6, 15, -4, 36, 18, 26, 37, 6, -49, -7, -26, 19, 51, -24, 11, -51, -1, -39, -20, -20, -63, -16, 2, 3, -34, -18, 6, -19, -10, 3, 25, 5, -57, -7, -49, -15, -23, -46, -55, -2, 17, 43, 6, -67, -28, 25, 27, 7, -2, 10, -9, -29, -26, -3, 25, 20, 7, -12, -21, -56, 1, -27, 13, -8, -8, -4, -57, 15, -4, -17, 12, -3, 11, -1, 9, 23, -16, -15, -42, -33, 36, 58, -47, 9, -75, -43, -40, 39, 9, -34, -25, 7, 65, -37, 7, -22, -35, 11, -5, 66, -25, -28, 7, -9, -24, -14, -11, -51, -56, -16, -90, -48, 4, -7, -15, -10, -11, 6, -59, -44, 21, 14, 12, -52, -76, -10, -4, -43, 24, -20, -18, -68, -67, -40, -67, 11, 19, 20, -91, 32, -24, 5, 4, 14, -96, -51, -13, 0, -14, -15, 26, -7, -53, -73, -75, 19, -9, 63, 23, 0, -35, -2, -35, 32, -81, -3, 10, -10, -35, -17, 6, -26, -1, 27, 23, 36, -24, 15, -22, 0, 24, -9, 38, -37, 80, -31, 14, -19, -9, 31, -29, -23, 48, -43, -31, -57, -20, 2, -40, -27, -5, -27, -36, -31, -64, -21, 18, -4, -19, -72, -19, -71, -11, 17, -61, -1, -6, -4, -27, -6, -45, 17, -56, -47, -39, -58, -20, -12, -26, 13, 28, -36, 8, -20, -6, -26, -18, -10, -43, -8, -37, 41, 25, 8, 19, -30, -42, -17, -28, -25, 19, 3, -25, -2, -31, -49, -64, -3, -47, -27, 21, 17, 44, 3, -29, 5, -25, 34, 21, -4, -86, -34, 42, 55, -86, -18, -77, -39, -2, -18, -25, 0, -45, -10, 44, -59, -10, -13, -27, 28, -53, 30, 27, -63, -94, 28, 6, -11, -17, -14, -31, -48, -69, -27, 12, -64, -47, -64, -11, 18, -21, -79, -75, 15, 11, -65, -62, -67, 13, 24, -50, 69, -106, -44, -27, 62, 27, 16, 52, 18, 24, 7, 10, 13, 38, -45, -6, 29, -41, 14, -41, -28, 8, 5, 26, 43, -20, 18, -7, -10, -9, 1, 31, 10, 42, -5, 48, -61, -8, 17, -14, 38, 13, -61, -31, -31, 30, -23, 36, 32, -16, -47, -31, 10, 0, 6, 29, -60, -14, -33, -22, -55, -31, 4, -18, -3, -38, -68, -28, -83, -51, -48, -13, -39, 22, -41, -24, -35, 28, 51, -7, -32, -23, -18, -7, 8, -3, -38, 10, -39, 0, 39, 20, -13, -86, 41, -83, -53, -19, -28, 5, 1, -4, -26, -22, -42, 12, -73, -15, -23, 5, -57, -2, 52, 12, -18, 9, -56, 22, 42, -54, -62, -59, -57, -1, 1, -80, -99, -84, -47, -70, -44, -29, -82, -36, -28, -67, -16, -42, 26, -36, -62, -109, -37, -39, -17, -14, -10, -112, -95, -15, -37, -58, -37, -127, -50, 4, -81, -38, -46, -57, 32, -1, -54, -69, -60, -68, -9, -94, -24, -70, -67, -84, -23, -73, 1, -109, -55, -26, -3, -46, 5, -38, -72, -29, -21, -31, -69, -10, -68, 28, -47, 9, 16, -49, 24, -5, -12, -41, 1, 11, -30, -25, 75, -3, 8, 56, -44, 41, 20, -4, 57, 20, -20, -85, 22, 36, -24, 21, 47, -9, 46, -60, -3, 22, -6, -54, -2, -5, 41, 76, -76, 42, 3, 57, -61, 45, 38, 2, -38, 63, 31, -29, -41, -17, -12, 11, 48, -41, -51, 29, -34, -53, -24, -80, -24, -5, -5, -40, -39, -33, -20, -26, -62, -103, 39, 21, -13, -66, -41, 46, -30, -19, 5, -30, -29, -12, -17, -41, -21, -80, 30, -10, -3, -53, 25, -46, -19, -44, -84, 29, -20, -45, -21, 43, 5, 40, 21, -47, -37, 51, -49, 18, 7, 15, 1, 23, -44, -9, 7, -2, 37, 15, 88, -27, -29, 15, -37, 19, -34, -58, 10, -22, 59, -24, -45, 44, 48, 24, -20, -3, -12, -52, 36, -62, -10, -20, -13, -51, -12, -13, -51, -75, 32, -66, 45, 6, -22, 8, -41, 20, -10, -28, -35, 26, 16, -51, 21, 81, -11, -12, -64, -17, 43, 32, -38, 16, -17, -52, -9, 17, 44, -66, -87, 4, -54, -85, -25, -90, 11, -3, 2, -4, 5, -25, 46, -31, 8, -15, 58, -11, -3, 15, -9, 21, 42, 13, -33, -2, -37, 35, 25, -68, -5, -42, -11, 9, -1, -48, -17, -69, 38, 4, 50, -40, 7, 5, -10, -47, -20, 56, 24, -96, 17, -15, 41, 37, -43, 32, -26, -14, -7, -12, -62, 7, -56, -39, 26, -8, -17, 34, 19, -43, -50, 8, -89, -40, 4, -5, -19, -40, 58, -17, 14, 32, -22, 10, 19, -39, 2, 11, -8, -14, 30, -14, 9, -47, -14, 21, -32, 31, 33, -20, -52, 32, 28, 24, -16, 25, -9, -22, 23, -44, -62, -6, 0, 29, -21, 12, 18, 32, 13, 14, -39, -8, -11, -7, -25, 33, -13, -1, -22, -4, 44, -40, -24, -21, -19, -37, 7, -51, -20, 11, -49, 21, -12, 19, 55, -14, -7, 12, 8, -7, -17, -13, 40, 4, -42, -18, 8, 4, 31, -11, 6, -34, -25, -37, -28, -10, -38, -20, -21, -13, -10, 4, -29, -18, 10, -27, 11, 24, -32, -5, 13, 40, -2, 35, 12, -21, -54, -47, 1, -42, 0, -46, -12, 16, -43, -3, 15, -37, 2, -8, 0, -27, 15, -28, 11, -30, -10, -39, 44, 4, 3, -29, -46, -14, -26, -10, -44, -64, -4, -15, 0, 9, 11, -97, -16, -21, 6, 23, -3, -50, -3, -20, 71, -11, -35, 24, -48, -94, -33, -9, 8, -44, 9, -23, 65, -26, -71, 39, -32, -17, -36, -37, -31, -37, 55, -59, -33, -6, 6, -15, -12, -75, -73, -49, -11, -38, 11, -30, -38, -30, 38, -8, -3, 14, 17, -40, -30, -22, 13, 27, -2, 0, -11, -32, -19, -30, 36, -67, 1, -11, -38, -23, -30, 28, 11, 14, -29, 23, -21, -60, 37, -58, -47, -28, -8, 0, -79, -63, 5, -13, -11, 26, -61, -32, -24, -39, -24, -16, -15, 25, 5, -33, -2, 23, 14, -23, -24, -16, -10, -63, 11, -75, -23, -28, -38, -24, -31, -43, 33, 1, -30, 15, -12, -21, -27, 13, -17, 7, -17, 36, -5, -1, -6, -14, 16, -28, 5, -51, -21, -24, -11, -28, 8, -11, -13, -2, -3, -6, 6, -17, -24, -37, -8, 12, -13, 6, -65, 9, -21, -67, -56, 6, 49, 5, -22, 33, -9, -2, 11, -61, -46, -24, 12, -47, -5, -20, 5, -25, 73, -113, -9, 35, -25, -22, 0, -54, 4, -17, 17, -9, 40, -63, 15, 16, -29, 1, -47, -21, -28, -59, 23, -36, -33, -46, 7, 28, -33, -9, -12, -55, 36, 29, -57, -8, -6, -31, -24, -41, -63, -63, 12, -50, 19, -21, -23, -11, -17, -8, -17, -39, -14, 25, -31, -96, -127, -55, -42, 22, -24, -24, -14, -57, 14, -99, -13, 7, -59, -15, -57, -30, 29, -8, -28, -30, 10, -5, 40, 7, 10, -8, 4, -4, -36, -59, -12, -12, -4, -1, 29, 1, -19, 14, -76, -29, -69, -31, 8, -57, -13, -9, -62, 54, -11, -39, -45, -44, -59, 5, -62, -52, -20, 3, 2, 44, -44, 73, -28, 21, -5, -4, -36, 1, 9, -41, -31, -21, -7, 9, -6, -31, -33, -25, -1, 4, -13, 3, 0, -20, -10, 10, 36, -34, 24, -15, 10, 15, -3, 20, -4, -11, -31, -10, 35, -27, -23, 28, 20, 1, 44, 23, -71, -6, 28, -18, 14, -34, 5, -8, -17, 1, -85, -10, -124, -32, -40, 6, -46, -27, -64, -44, -2, -13, -4, 20, -9, 1, 21, -12, -36, -66, 15, 23, -44, -11, -13, -4, -18, 25, 7, -2, 7, -42, -5, -29, 2, -14, 27, 15, 2, -3, 5, 38, 5, 3, -27, -18, -6, 3, -7, 30, -10, -16, -46, 9, 17, -14, -11, 4, -37, 13, 25, -32, -8, -8, -11, 19, -61, -10, -6, 20, 14, -2, -11, 0, -51, 0, 12, -16, -4, -36, 26, -23, 2, -23, 2, -23, -24, -19, 1, -19, 14, 26, -19, 10, 4, -29, 20, -23, 0, -29, -13, -30, -14, -39, 2, -77, 10, -4, -1, 0, -56, 22, 14, -44, -50, -29, -9, 11, 4, -9, -38, 15, -68, -29, 9, -15, 5, 9, 35, 32, -1, 17, 12, -26, 1, -8, 4, -14, -48, 3, 13, -14, -17, 10, -67, 35, 3, -4, -27, 4, 3, 5, 0, -1, 3, -25, -22, -3, -10, -25, -16, 7, -4, -71, 10, -42, -57, 17, 8, 11, -14, -18, -37, -11, 11, -27, -75, 8, -2, -10, 34, -37, -3, -65, 15, 28, -15, 35, -30, -23, -23, -33, -45, -18, -54, -27, -47, -16, 24, -21, -109, 0, -3, 1, -34, 20, -21, 5, 6, 15, 4, -46, 21, -27, 15, -29, 4, -7, 7, -10, -9, 21, -14, 3, 16, -25, -14, -102, -6, -12, -1, 3, -2, -7, 33, -23, 2, -32, 1, 11, -21, 3, 0, -12, -2, -9, 13, -41, -16, 27, -22, 24, -6, -8, -47, -40, 8, -10, 0, 37, -8, -2, 5, 10, 20, -28, 4, 7, -30, -29, 13, -7, -7, 3, 18, 22, -15, -11, 17, -18, -20, -32, -47, 10, -33, -19, -5, -36, 2, 12, -16, -72, -21, -16, 4, -9, -17, -65, 24, -8, -7, -13, -11, 9, -36, -28, -48, -2, -6, 4, -5, -11, -9, -7, -10, -5, -23, -29, -10, -40, 14, 2, 20, 22, 19, 7, -1, 8, 22, -3, -17, -33, -21, -5, 11, -37, -16, -36, 39, -16, -34, 4, -12, 45, -28, -25, 4, 12, 13, 12, 0, -3, -20, 18, -9, -14, 18, -53, -66, 20, 22, 17, -21, -15, -26, 23, 32, 20, -62, 13, 23, -7, 26, -25, -19, -30, 12, -34, -9, 3, -37, -5, -18, -13, -35, -10, -51, -48, -127, -35, 67, -27, -67, 3, 7, -2, -51, -4, -25, -46, 5, -12, -17, -47, -16, -17, 1, -34, -29, -33, -6, -45, -13, -9, 21, 16, 10, 35, -32, -7, 19, -30, 4, 10, 0, 0, -29, -23, 12, -34, -14, -6, -9, 55, 7, 0, -6, -6, 17, -31, -44, -64, -3, 2, 37, -2, -13, 53, 17, 14, 28, -42, 11, -12, 30, -6, 32, -57, -27, 19, -43, -7, 29, -37, 19, -1, 5, 6, -20, -36, -13, 7, 11, -16, -21, -7, -44, -20, 5, -20, 10, -1, -67, -19, -6, -7, 2, 7, -3, -49, -45, 16, 26, -12, -6, 0, -9, -10, -13, 20, -89, -34, 3, -22, -62, -11, -24, -21, 16, -7, 9, 3, 58, 28, 13, -29, 20, -42, 8, -4, 28, -50, -80, 17, 11, -9, 18, -4, -92, -23, -37, -17, 9, -13, -49, -17, 28, -37, -17, 14, 17, 3, -49, -91, 2, 17, -10, -40, -34, -7, 26, 49, 19, -13, 31, -42, -49, -6, 6, -45, -7, 24, -7, 4, -2, -50, -8, -69, 11, -5, -8, 52, -1, -64, -12, -15, -29, -17, -29, -29, 2, 30, 43, -5, -20, -56, 23, -4, -11, -28, 11, -3, 0, -11, -1, 6, 36, 17, 26, 3, -9, -9, -10, 48, 3, -71, 4, -87, 1, -3, -20, -74, -84, 11, 34, -32, -3, -38, 31, -2, -4, 28, -17, 15, -3, -3, -35, -28, -3, -48, 6, -43, 38, 32, 17, 38, 22, -28, -23, -2, 7, 7, -21, -11, -8, 29, 13, 11, 19, 15, 30, -125, -11, -12, 1, -37, 26, -18, 9, -13, 37, -5, 2, -26, -110, 14, 26, 16, -27, 18, 0, -29, -3, 9, 11, -113, 10, -104, -7, 13, -11, -26, 18, 47, -39, 31, 5, -51, 45, 16, 42, -33, 4, 4, -22, 13, 17, -6, 48, -19, 12, 5, -11, 1, -40, 33, 19, -44, -31, -28, 9, 8, 27, -6, 11, 16, -12, -6, -41, 3, -96, -34, -82, -10, -3, -5, -9, -58, -4, -62, 7, -36, -26, 23, -52, -40, -42, 6, -72, -110, -14, 11, -26, 30, 11, -13, 12, 10, 2, -42, -19, -88, 39, -6, 4, 16, 13, 27, -31, -28, -29, 71, 4, 13, -1, -72, -61, -15, -20, -45, 45, -14, 22, -4, -44, 11, -38, 7, 27, -25, -14, -53, 16, 40, -50, -24, 3, 32, -11, -66, 6, 8, 15, 22, -35, 16, -4, -98, -51, -51, -31, -28, -8, -120, -54, -21, -10, 21, -4, -77, 16, -42, 20, 16, 11, 3, 4, -13, -15, -19, -5, -67, -10, -1, 4, 62, 0, 22, 9, -9, -72, -34, -13, -48, 5, -4, -5, 18, -25, -16, 11, 6, 34, -35, 23, -26, 7, 44, 36, 26, -16, 7, 8, 16, 27, -14, -15, 16, -33, -22, -10, 6, -25, 3, 11, -10, -23, -117, 4, -32, 1, -71, 6, -13, -20, 16, -30, 27, -9, 16, -9, 27, -12, 9, -18, 11, 11, 22, -25, 16, 46, -7, -5, 12, -33, -45, -63, -42, -8, -20, -27, -42, -17, -14, 21, -17, 29, 20, -29, -19, -31, 13, -108, -21, -127, 5, -9, -18, -82, 16, -44, 22, -68, -106, -12, 19, -51, -64, -34, -12, -46, -115, 1, 19, 5, 49, 28, -35, -49, 37, 14, -23, 24, -66, -28, 23, 17, 35, -76, -24, -33, -67, -40, 64, -10, 34, -28, -19, 9, -5, -64, -34, 51, 39, 27, 20, -50, 41, -35, -57, -12, 1, -26, -67, 22, 43, -75, -5, -20, -3, -10, 33, 21, -27, -10, -36, -71, -6, 8, -47, -55, -15, -34, -16, 2, -93, -105, -8, -5, 39, 30, -18, 10, -28, 29, -9, -30, -15, -59, -20, -59, -26, 43, 31, -29, 14, -15, 4, -23, 1, -2, 16, -6, 5, -40, -35, 7, 12, 8, 24, -56, 8, -6, -24, 35, 1, 60, -82, 14, 54, 25, 24, -19, 16, -1, 16, 36, -15, 42, -23, -89, 5, -16, -48, -87, 12, 0, -20, 12, -40, -23, -24, -12, -72, 2, -41, 5, -28, -4, -5, 7, 21, -48, -28, 6, -20, 3, 17, 0, -21, 9, -25, 21, -37, -17, -35, 11, -11, 9, -6, -5, 2, -1, 22, -58, -26, -44, -15, 24, -25, -85, -3, -11, -9, -15, 21, 32, -41, 4, 4, -42, 10, 9, 54, 19, 23, 42, 8, 30, 4, -4, 11, -18, -33, -19, 2, -29, -54, 9, -10, -6, -22, 4, 15, -36, 20, -3, -14, -41, 8, -23, -37, -11, 29, 11, -4, 3, -25, -2, -35, -37, 10, -7, 6, 22, 23, 8, -2, -39, 11, 29, -14, 0, -6, 10, -2, 12, -44, -11, -8, 10, -21, -9, -5, 13, 17, -16, 37, 16, 35, 16, -33, -64, 21, -8, 8, -41, -33, -48, 6, -12, -34, 21, 1, -33, -19, -1, -8, -69, -8, -52, 14, -83, 19, 14, -14, -23, 7, -7, -3, 17, -78, 12, -13, -66, 3, 2, 5, -21, -14, -7, -40, -86, 3, -17, 10, -3, 21, -21, 2, -29, -53, 16, -26, 0, -5, 10, 12, 21, -6, -62, 31, 16, 23, 19, 19, 13, 50, 28, 14, 31, -49, 19, 28, 46, -13, -8, -23, -29, -5, -46, -1, -6, -24, 24, -6, 0, 27, 2, -14, -24, -65, 16, 0, 30, -14, 31, 5, 16, -43, 9, -27, 40, 37, -21, 5, -32, -14, 5, -1, 19, -33, -54, 29, -55, -9, 9, 15, 28, -63, 2, -20, -26, 6, 23, 8, 6, 7, 7, 15, 4, -20, 12, -6, 41, 19, 5, -40, 6, 19, 18, -51, 30, -5, -12, 22, 1, 16, 33, -14, 13, 2, -2, -46, 14, 4, 37, -30, -24, 8, -5, -2, 5, -14, 7, 37, 2, -22, 2, -4, -12, -1, -10, 8, -11, 2, 18, -15, 26, -39, -22, 1, 9, -74, -3, -16, 25, 12, 10, -37, -7, -77, 15, -14, -3, -13, -8, -29, -15, 17, -46, -17, 1, 14, 16, -35, -13, -2, 5, 4, -23, 15, -10, -9, -40, 18, -36, -29, 34, 8, -10, -30, 31, 13, -23, 3, -17, 3, -7, -11, 6, -59, -12, -14, -21, -2, 13, 9, -61, -62, -33, -70, 10, -67, -6, -31, -2, -1, 20, 4, 14, 18, 0, -13, 6, -52, 24, -18, -25, -6, -24, 16, -20, -27, -10, -15, -6, -38, 24, -28, -22, 12, 10, 2, -28, 51, -42, 16, 1, 3, -33, -30, 11, 19, -3, -45, 32, 13, -19, -10, -22, -61, -27, 52, -3, 9, -20, -9, -26, 17, 49, 6, -28, -34, -51, -22, -16, 16, -24, 34, 23, -8, -36, 14, -36, -12, 4, -7, 3, -23, -34, -11, 36, 0, -36, 42, 26, -25, -43, 34, -29, 11, -30, -37, 15, -43, -12, -8, -27, 24, 9, -35, -6, 17, 22, -28, 22, 53, -27, 8, 17, -24, -34, -27, -14, -49, 33, -14, -8, 20, -31, 1, 12, 5, -26, -68, 23, 13, -9, -90, -28, -84, -19, -80, -1, -34, -63, 9, 3, -21, -27, -20, -46, -42, -10, 10, -46, 19, -47, 42, 3, -14, -34, 44, -71, 13, 10, -22, -10, -44, -42, 5, -12, 27, -5, -32, -32, 15, 18, -54, -13, 5, 3, -14, 27, -41, -65, -1, -40, 8, 26, -11, -8, 14, -36, -33, -12, 9, 20, -48, 23, 20, -56, -61, -127, -59, -22, -33, -5, -1, -19, 43, 36, -23, -27, -16, 20, -17, 21, 20, -3, -34, -24, 28, -17, -16, 3, 8, -45, -3, -14, -30, -14, -22, -13, 0, 9, 22, -21, -25, -15, -17, 5, -32, -6, -12, 9, -16, 37, -27, -30, -12, -22, -6, 10, 9, -31, -63, -53, -103, 5, -22, -7, -4, -1, 46, -57, -3, -92, 0, -12, 12, 6, -12, -5, -20, -6, 18, -4, 13, 15, -52, 3, -2, -5, -19, 15, -2, 24, -127, -3, -52, -35, 29, 4, -48, 13, 6, -4, 15, 5, 9, -9, 3, -32, 17, -21, -16, -6, -22, -11, 24, -3, -3, 5, 11, -1, -96, -28, 9, -16, -60, -20, -42, 1, -47, 14, 23, -24, 19, 13, -22, -61, -31, 2, 9, -22, -14, -41, -17, -16, 0, -25, 23, 3, -58, 0, -42, 11, -7, -8, 21, -12, -92, -38, -23, -12, -73, 5, 7, -42, 16, 12, 6, -38, -23, 15, -5, -26, 22, -36, -14, -4, 12, -16, -14, 11, -15, 1, 2, -19, -48, -24, -12, 1, -62, -33, -49, 7, -14, -2, -17, 4, 1, -7, -7, -20, -43, 9, -10, -22, -23, -39, -25, 1, -50, -40, 15, -8, -4, -31, -49, -20, -13, -13, 11, -27, -48, 18, -31, -21, -16, -14, 20, -19, 11, 6, -18, 35, -43, 5, -9, -1, 18, -18, -3, -10, -50, -9, -35, 13, -52, -9, 5, -19, 0, 7, -35, 18, -27, -3, -49, -22, -47, -4, 0, 6, -10, -19, -10, -38, 20, -38, 0, 5, -13, 12, 3, 11, 16, -6, -15, 4, 22, -9, -14, 2, 23, -23, 32, 2, -9, -8, -10, -8, 6, -42, -27, 9, -47, -21, -20, 5, 11, -9, 27, -6, -36, 23, -42, 20, -23, 3, -5, 18, 20, -7, -30, -6, -10, -4, -27, -13, -31, 32, -40, -10, -55, -8, 7, 13, -9, -40, 2, -16, 6, -34, -8, 15, -23, 24, 11, 5, 22, -1, 1, 2, 26, -6, -47, -3, -4, -2, 7, -19, -6, -20, -20, 0, -15, -36, -13, 33, -50, 2, 1, 11, 24, -22, 31, 9, -10, 12, 7, 16, -6, 14, 7, 13, 18, -12, -24, -14, -7, 15, -2, -13, -5, 2, -21, 6, -25, -6, 3, -10, -11, 6, 3, 15, 2, -15, -15, 18, 2, -29, -4, -3, -28, 0, 0, 3, 12, -22, -38, -14, -4, 16, -16, -20, -6, -21, -19, 11, -37, -25, 2, 2, -14, 19, -10, 15, -1, -9, -17, 2, 6, -3, -14, 13, 5, -2, -19, -8, -30, 0, 0, -30, -22, 21, -1, 14, -12, 6, -36, 12, -30, 0, -2, -13, -17, -21, 9, -6, 31, -1, 11, 18, 6, -6, 0, 7, -27, 2, -56, 4, 10, -5, 3, -2, 25, -66, 24, -17, 24, 31, 18, -36, -92, -9, -22, -1, 32, -31, -14, 1, -31, 20, 26, -4, -30, 28, -17, -19, 16, 14, 12, -2, -7, -12, -16, -28, 17, 20, 36, 14, -3, -1, -19, -11, 11, 22, -13, 22, -31, -56, -24, -10, -17, 1, 15, 20, 10, 19, 18, 17, -7, 10, 1, 9, -15, 9, 2, -9, -7, -56, 13, -22, -7, 16, 6, -43, -9, 10, -41, -6, 21, -17, 19, -15, -15, 9, 38, 7, -7, 9, -17, -38, 1, -18, 1, -6, -19, -21, 13, -27, -7, -6, -1, 1, -11, -11, -7, 8, 16, 11, -11, 26, -24, -3, -20, 9, 7, 14, 20, 29, 15, 23, 6, 0, 13, -2, -4, -19, -17, 15, -18, -17, -6, -42, 8, -8, -21, 11, -14, -30, -22, 14, -35, -32, 27, -8, 11, -15, -25, 15, 5, -1, 1, -26, -2, 13, -3, -26, 16, -10, -24, -13, 10, 0, -28, 6, -20, -49, -43, -54, -30, -31, 29, -17, 8, 7, 0, 0, -1, 4, -43, 0, -3, -43, -25, -34, 29, -8, 34, 9, -1, 17, -26, -56, 1, 40, -15, 46, -23, -54, -35, -30, 20, 10, -3, 6, 22, 36, 7, -34, -13, -33, 23, 8, -28, -10, -24, -17, 19, -10, -19, 9, -57, 12, 5, 12, -6, 1, -23, 43, 13, -10, -14, 11, -9, 48, -92, -34, 25, -6, 0, -6, -1, 0, 3, -8, 6, -39, -44, 9, -31, -32, -49, 6, -4, 19, -19, -44, -2, 2, -7, 19, -20, -64, -8, -67, -17, -8, 48, 31, 2, 22, -6, -13, 13, -14, 35, -44, -18, -26, -61, -5, 25, 9, -39, -12, -64, -46, 24, 24, 18, -35, -48, 0, 0, 33, 36, -6, 20, 24, -3, -16, 8, -89, 6, -26, -79, 5, 3, -19, 3, 8, 4, 29, -50, 65, 51, 8, 1, 19, -39, 13, -57, -23, -44, 26, -30, -26, -38, -54, -24, -3, 50, 38, -55, 13, -35, 15, 26, 3, 44, -61, 2, -13, -63, -15, 33, 13, -43, -93, 24, -86, 53, 14, 16, -24, -57, -16, -24, 19, 11, -29, 31, -21, -8, 15, -44, -87, 42, -12, 4, -2, 47, -51, -60, 39, -9, -32, 11, -19, 3, 43, 28, 29, 17, -40, 44, -1, 10, 9, 48, -34, -42, 47, -36, -94, 4, -12, 24, -71, -24, 3, -12, 25, -53, -72, 52, 3, -23, 58, 9, -13, -34, -75, -23, -29, -28, 8, -12, 9, -33, -43, 2, -14, -62, -1, -22, 19, -46, -42, -4, -24, 4, -13, -19, 34, -4, 22, -98, -21, -15, 15, 1, 8, 16, 9, -4, 16, -22, -39, 12, 30, 26, 47, 48, -8, -24, 11, -62, -38, -1, -63, 27, -81, 2, -2, -27, -8, -28, 11, 25, 11, 6, 14, 9, -28, 5, -64, -82, -24, -17, 6, -24, -31, -16, -44, -10, -34, -52, 75, -18, 49, -16, -24, 52, -12, 9, -58, 27, 9, 7, -1, -43, -7, -18, -22, -55, -15, 35, 13, -1, -14, -19, -46, -12, -11, 23, 30, 19, -49, -45, 6, -77, -15, 11, -123, -10, -36, 15, 0, -5, 13, 27, -4, 0, 14, -4, -32, 46, 23, -79, -50, -39, 14, 27, -24, -9, -32, -40, -12, -46, -38, -21, -5, 11, 29, 10, 20, -12, 7, 9, 6, -12, -4, 49, 20, 12, -18, -18, -37, 10, -93, -48, -34, 17, -56, -53, 19, -41, -44, -57, -59, 4, -12, -63, -19, 9, -78, 31, 14, -22, 9, 10, -31, 38, -33, -64, 15, 29, -67, 7, -119, 0, 18, -14, -52, -11, -32, -16, -11, -22, 9, -73, -69, -40, 11, 0, 39, 7, -34, -22, -64, 11, -83, 7, 4, -17, 31, 5, -21, -34, 23, -14, 21, 23, -86, 1, 32, -10, -64, -31, 30, -17, 19, 0, -11, 5, 2, -46, 18, -21, -66, -51, 42, 16, 55, -2, 17, -2, -12, -26, -37, 50, -48, 2, -14, -20, 15, -14, -31, -39, -29, -34, 2, -13, 10, -6, -37, -12, 4, 27, 36, -17, -41, -27, -51, 29, -60, 38, -30, -29, -27, -4, 7, -98, -43, -8, -4, 19, 2, -9, -26, -40, -9, 1, 42, 33, 18, 63, -15, 8, 22, 4, 34, -22, -127, -95, -25, 18, 1, -8, 1, 1, -20, 11, -6, 42, -15, -26, 22, 28, -2, 75, -4, -62, -2, -106, 30, 18, -13, 9, 26, 17, -9, -21, 42, -61, -23, -49, -44, 12, -26, 12, -59, 37, -24, 17, 6, -16, -34, -1, -24, -8, -5, -24, -5, -12, -13, -25, -20, -11, 3, 15, 18, 25, -32, -3, 44, -48, -20, 48, -57, -20, -12, -24, -23, -19, 13, -22, -21, -2, -15, -21, 3, 3, -31, 13, -1, -52, 50, 12, -30, -38, 19, -6, -12, -23, 33, 10, 2, 18, -43, 34, -36, -58, -12, 13, -5, 10, 1, 21, -50, -9, -2, -1, 10, -24, -19, -6, -2, -16, 18, -81, -25, -43, 10, 16, 10, 1, -17, 12, -21, -26, 28, 13, -74, -3, 11, -2, -6, 4, 50, -45, -48, -17, -33, -4, 5, -18, 11, 8, 6, -30, 1, 34, -13, -34, 15, 4, 18, -21, -23, -12, -21, 8, -17, 11, -41, -26, 1, 17, -14, 10, 5, 7, -31, -3, -38, -35, -14, -42, -61, 21, -7, -43, -9, -127, -23, -23, 14, 22, 15, -61, -40, 27, -17, 22, 8, 19, -36, 28, 9, -24, 4, -60, -24, -3, -5, -25, -39, -36, 8, -7, 25, 12, -27, -3, -7, 22, 18, -36, 20, 14, 30, -15, -13, 19, 8, 23, -17, -9, -56, -46, 9, -15, -5, -41, 19, -28, -5, -5, -14, 10, -38, 13, 0, -27, -15, 12, 17, 3, 12, 22, -13, -10, -18, 6, -8, -26, -6, -19, -32, 18, -20, -11, -27, -3, 12, -32, 23, -35, -14, 7, 0, -8, -16, 6, -23, -28, 30, -18, 37, 24, -3, 11, 7, 7, -35, 5, -53, -7, -3, -29, -41, -1, -32, -39, 3, 9, -23, -7, -23, -31, -12, -27, -11, -5, -15, 4, 9, 4, -2, -32, 5, 15, -12, 15, 7, -11, 13, 30, -10, -13, -53, -19, -58, -2, 8, -6, -20, 19, 46, -32, 3, -22, -23, 8, -11, 0, -10, -1, 18, 2, -20, -24, 24, -35, -8, -14, -11, 10, 2, -7, 2, 16, -3, -9, 14, -7, 1, -52, -10, 11, -36, -23, -35, 4, -11, 7, -14, -43, -30, -15, -21, -31, 20, -55, 15, 1, 1, 0, -48, -7, 40, -6, -5, -7, -24, 24, -11, 8, 29, -15, -35, -34, 32, -40, -6, -1, -19, -5, -9, 51, -30, 16, 14, -74, -53, -9, 14, -4, -15, -31, 0, -22, 10, 15, 10, -5, -30, -9, -6, -12, 5, -55, -13, 3, -23, -12, -41, -16, -24, 3, -30, -12, -33, 6, -11, -24, 0, 17, 42, -34, 6, 12, 8, 30, -28, -20, 17, -31, -19, -45, -27, 8, 24, 1, -30, 18, -12, -15, 15, -4, -9, 4, 6, 5, -1, 15, -18, -29, -15, 14, 15, 8, -19, 5, 0, 4, -23, -5, -72, -41, -12, 5, -26, -4, -41, 20, 19, 3, -3, -28, -18, -7, 24, -35, -14, -45, 30, 12, -3, -8, 1, -62, 23, 10, -1, 19, 21, 14, 10, -1, 19, -39, 26, -26, 6, -41, 18, -5, 2, -42, -25, -27, 23, -9, -19, -2, 3, -26, -5, 38, -6, 4, -27, -17, 6, -21, -53, -22, -36, 34, 13, -16, -51, 21, 13, -17, -9, 59, -3, -38, 16, -8, -38, -48, 0, -29, -9, -35, 3, -65, -19, -7, 16, -21, -29, -12, 6, 9, 5, 13, -3, 23, 14, 19, 8, -41, 20, 5, 4, -62, 14, -27, 8, -2, -15, -23, 41, -25, 8, -7, -38, -3, -14, 18, 13, 26, -40, -11, 14, -54, -23, 12, -23, -7, -6, 37, -16, 31, 16, -22, 8, 27, -3, -28, 4, -27, -46, 7, 2, 22, -4, 33, -51, -2, 26, 24, -22, 1, 30, -53, 4, -39, 4, -17, -18, -18, -17, -15, 16, -4, -3, 6, 5, 1, 8, -35, 13, -16, -47, -11, 11, 12, -14, -25, 8, -25, 5, -77, -8, 12, 46, 0, 24, 14, 10, -28, 1, -19, -34, 2, 17, 13, 35, 3, -13, 15, -17, -15, -15, 17, 22, 28, 19, 5, 7, -5, 14, 4, 24, -13, -30, 23, 28, -18, -16, -58, 30, -24, 7, -6, -15, -34, 13, -25, -18, 7, -23, -37, 24, -39, 8, -31, -17, 22, -15, 17, -9, -27, -12, -37, 21, -87, -3, 33, 8, -17, -13, 20, -7, -24, -15, -36, -9, 7, -1, 0, 2, 17, 21, 25, -63, 9, -56, -89, -55, 23, 8, -79, 5, -66, 2, -11, -13, -66, -14, 7, -106, 4, -55, -68, -14, -76, 1, 16, -17, 4, -17, 7, -51, -3, -38, -56, -2, -73, 14, -7, 37, 39, -13, 8, 10, -10, -29, -49, -11, 6, 6, 10, -13, -84, -24, -30, -16, 24, -29, -70, 22, 44, -3, -24, -13, -99, 28, -24, -73, -14, -17, -3, 14, -32, -43, 3, -5, 23, -60, -10, -26, -9, -15, -17, 34, -9, 16, -41, 1, -57, 12, 6, 14, -20, 23, -31, -26, -30, 20, 7, -28, 13, -45, 3, 24, -12, 15, 35, -1, -15, 1, 23, -16, -12, -11, 1, 27, -34, 29, 38, -10, 21, 36, -25, -28, -4, -6, 9, -31, 11, -10, -27, -6, -33, 5, -19, 8, 4, -7, 4, 9, 30, -19, 15, 12, -1, -32, -7, 5, -21, 12, -15, 34, -43, 17, 14, -10, -21, 35, -3, -41, -4, 25, -4, -37, -2, -10, -11, 11, 0, 37, 1, -23, -10, -3, -35, 6, -7, -25, 6, 33, -15, -13, 19, -16, -24, -7, -26, -5, 27, -50, 6, -13, -12, -25, -6, -10, -7, -8, -65, 22, -69, -8, -46, 26, 35, -6, -20, -7, 7, 2, 2, -11, -20, 15, 26, -41, 34, -10, -8, 36, -23, 12, 9, 8, -6, -7, 22, -37, -4, 17, 13, 35, 13, 30, -6, -5, 26, 37, -28, -13, 20, -35, -14, 3, -31, -4, 4, -7, -12, -6, 10, 27, -6, -26, -17, -23, 12, -29, -23, -7, -9, -1, -9, -19, 5, -71, -75, -23, 2, -78, -4, -12, 17, -30, -74, 45, -3, 32, -36, -33, -16, 24, 14, -10, 11, 39, -41, 5, 16, -15, 14, -7, 17, -18, -16, 11, -53, -49, 18, -50, 13, 8, 41, -7, -20, -62, -36, 6, -30, 22, -33, -27, -16, 14, -14, 40, 13, -9, 7, -18, 10, 20, 17, -41, 12, 12, -15, -44, -10, -41, -33, -21, 14, 3, -42, 0, 11, 28, -28, 4, -37, 19, 19, 3, -7, 11, 10, -57, -9, 33, -16, -5, 19, -24, -35, -5, -17, 12, -28, 0, 12, 8, 24, 9, 26, 17, 16, 4, 28, -27, -23, 11, -20, 7, -2, -127, -55, -52, 12, 47, 26, 5, 0, -41, -38, -16, 15, -25, 14, 36, -8, -19, -24, -54, -22, -22, -27, -7, -64, 16, 1, 37, 6, -25, -39, 14, -6, 10, 22, -76, 25, -39, -14, 0, -36, 22, -11, -22, -55, 6, -59, -2, -60, 32, 11, 26, 38, -42, 31, 6, -31, -6, 21, -37, 3, 16, -40, -3, -46, -79, -2, -29, -26, 17, -6, -19, -9, 13, -38, -38, 7, -15, -16, -4, 23, -37, 6, -24, -15, 21, 18, -34, -28, -8, 18, -28, -29, 3, -75, 12, 37, 16, 1, -21, -32, 5, -57, 5, 14, -7, -30, 0, 46, -10, -10, -11, -76, -41, -113, 5, -16, -47, -6, 7, 1, 2, -8, 4, -17, -28, 21, -23, 29, 44, -127, 4, 13, 4, 16, -3, 1, -25, 27, -6, -8, -14, -18, 3, -6, 7, -54, 12, 13, 13, -21, 3, -24, 6, -51, -65, 40, 31, -15, 32, 18, 13, 16, -14, 11, -27, -41, 26, 20, -2, 10, -11, -99, 0, -62, -37, -20, -11, 4, 11, 15, 4, 19, -25, -32, -34, 3, -23, -43, -14, -73, -1, -17, -9, -4, -22, -5, -6, 18, -7, 33, 8, -77, -34, 16, 8, -61, 2, -90, 21, -43, -40, 1, -7, 21, -14, -45, -72, -10, -40, 17, -27, -21, -43, -33, 29, -32, -61, 38, -15, -6, 0, 13, -2, 34, -54, 45, 57, -28, -42, -14, -13, 19, 4, -15, 18, -84, -40, -16, -4, -10, 4, -22, -25, 27, -49, 0, 16, 18, 18, -60, -8, 36, -12, 5, 8, -54, -20, 14, -3, -55, 27, 29, 54, -96, 9, -1, 24, 2, 0, -57, 21, -21, 16, -16, 2, -46, 15, 18, -10, 10, 3, -2, 7, -38, 12, 7, -19, 0, -10, 39, -4, -27, 16, -25, -17, -62, 8, 10, 17, 9, -24, -29, 27, -8, -3, -17, 20, 22, -21, 37, -4, -65, -35, 15, 39, -11, -7, 26, 10, 21, 4, 3, -5, 15, -1, -41, 8, -42, 19, 16, 4, 20, 1, -31, 8, -39, -40, 9, 16, -37, 8, -21, 20, -17, -5, 15, -1, -1, 8, 7, 1, 6, -21, -35, 8, -62, -20, -48, -12, 27, 3, 28, 8, -3, -22, -35, -18, -10, -15, -9, 3, -49, -16, -2, -33, 8, -28, -53, 6, 19, -16, 7, -10, -66, -28, 5, 1, -38, 2, -43, 22, -37, -10, -2, -52, -37, -22, -61, -49, -41, -44, -2, -29, -33, 7, -40, 30, -12, -60, 14, -42, -15, -29, -8, -20, 11, -54, 35, 44, -30, -19, -32, 10, 1, -12, 26, -28, -44, -22, -13, 3, -45, -4, 5, -14, 21, 0, 11, 18, -1, -4, -11, -6, 33, 15, -2, -3, -48, -22, 11, -7, -36, 10, 10, 42, -34, 2, 12, 21, 21, 15, -77, 48, -25, 17, 12, 26, -26, 4, 26, -16, 14, 10, 12, 9, -13, 3, -75, -25, -8, 14, 45, 25, -28, 14, 6, 12, -20, 23, 35, 5, 23, -24, -20, 7, -21, 9, -40, 28, 4, 10, 28, -4, -60, -53, 16, 28, -28, 10, 37, 27, 29, -4, 10, -5, -32, -9, -70, -40, -60, 5, -21, 21, -7, 15, -55, 11, -75, -16, 27, 27, -20, -52, -15, 21, 31, -16, 33, -20, 20, -43, -12, 24, -23, -25, -9, 8, -25, -32, -20, 21, 38, 26, 39, 23, -25, -37, -12, -3, -2, -25, 1, -21, -69, 1, -2, -10, 9, -45, -20, -20, 29, 9, 8, -9, -105, -23, 13, -32, -75, -40, -13, 16, -51, -17, -6, -35, -22, -45, -40, -42, -33, -3, 10, 3, -27, -8, -44, 64, 3, -35, 30, -34, -15, -1, -74, -11, 22, -68, 25, 27, -40, 15, -12, 4, -13, -3, 25, -10, -25, -50, -43, -6, -23, -29, 18, -2, 23, 16, 30, 9, 5, -1, -27, -2, 41, -9, -22, -5, -44, -21, 21, -18, -15, -13, 3, 46, -25, -12, 2, 8, 14, 36, -5, 2, -51, -38, 62, 0, 29, -7, -15, -26, -28, -35, 15, 36, 2, -27, -37, 0, 12, -5, -15, 0, 29, -61, 19, -47, -76, 34, -23, -20, 20, -43, -15, 11, 9, -84, -21, 14, 16, 34, -39, -5, -10, -6, 13, -34, -47, -4, -46, -6, -22, -28, -32, 11, -69, 50, -3, 7, 15, -67, -67, 25, -9, 1, -81, -41, -6, -58, -4, -60, -2, -32, -49, -25, 28, 39, 23, -4, -35, -32, -54, 6, 48, 40, 29, -62, 41, -11, 31, -46, -22, -9, -18, 40, 2, -4, -2, 16, -5, 10, 56, 19, -7, 20, -7, 14, 1, -38, 19, -3, -11, -25, -10, -43, 18, 21, -39, -66, -28, 38, -37, -60, -7, -59, 0, 11, -21, -11, -37, -49, 6, -47, 4, 6, -39, -13, -8, 6, 20, 27, 16, -29, -24, 31, -50, 8, 6, -10, 41, 4, 19, 12, -17, 37, -37, 13, -58, -2, 20, 26, -50, 11, 9, 13, 22, 38, -39, 26, 34, 20, -5, -22, -20, -13, -17, -59, 12, -16, 39, -33, 27, -62, 2, 41, -15, -33, -64, 34, 34, -22, 9, 59, 7, 70, -17, 16, -6, 11, 22, 37, -8, -3, 21, -17, -37, -56, -7, -59, -4, 0, 6, 0, -31, -13, 6, 22, 46, 26, -12, -1, -45, -51, 7, -5, 4, 12, -30, -64, -11, -60, 12, 21, -8, -4, -55, -10, 33, -43, -17, 46, 4, 22, 41, -26, 28, 10, -7, -37, 21, 10, 29, -15, -4, 9, 10, 47, -30, 57, -40, 29, 49, -47, -13, 9, -28, -47, -5, -56, 13, -43, -12, -34, -16, 9, 24, 5, 18, -12, -9, 13, 7, 4, 10, 16, -33, -63, -1, -11, -19, -3, -48, -67, -24, -13, 33, 38, 1, -11, -27, -19, 9, 19, 15, -33, 5, -71, 8, 21, 36, -26, 11, -10, -35, -63, -35, -60, -29, 43, -12, 19, 9, 24, -6, -2, 46, -22, 33, 1, -31, -11, 8, 44, -23, -9, 17, 16, -31, 12, -46, 16, 51, 19, 6, -9, 15, -3, 34, 11, -62, 3, 2, 7, -30, -21, -63, -21, -25, -2, 48, 36, 38, 21, 4, -4, -53, -12, 14, -65, -8, -34, -7, 9, 15, -42, -8, -17, -11, -50, -41, 3, -15, -88, 5, -25, 16, -64, -55, -24, -49, -13, 18, 14, 18, -13, -5, -46, 25, -43, 10, -9, 31, -18, 55, 20, -12, -76, 4, -96, 72, 48, -18, 35, -127, -15, 12, -20, 6, 12, 4, -25, -25, 4, -2, 15, -6, -9, -42, -23, 32, 6, -67, -61, 11, -46, 8, -31, -24, -31, -64, 25, 16, 22, 19, -31, -103, -27, 3, -17, -93, 45, -111, 30, -56, -16, -53, -5, -36, -45, -20, -88, 31, 2, -24, -113, 5, -28, 24, 18, -1, -13, -2, -78, -24, 6, -106, 2, -98, -69, -8, -47, -3, -9, -56, -22, -50, 54, 47, 52, 1, -43, -74, -38, 93, 81, -52, -4, -26, -33, -29, 8, 48, -31, -31, 2, -86, -111, -27, -98, -88, 39, 11, 6, -7, -3, -66, -69, -1, -74, 14, 16, -25, 15, 35, 10, -27, -10, -12, -62, -43, 20, -69, 32, 0, -2, -96, -91, 27, -17, -8, 19, -120, 7, -14, 16, -55, -53, -34, 4, -24, 7, 13, 55, 9, 24, 4, -15, -12, 0, -36, 16, -58, -54, -26, -12, 10, -74, -50, -24, 31, -57, -4, -31, 40, 21, -14, 3, -93, -2, 23, -94, -4, -1, -119, -34, 49, 27, -18, -23, -123, 0, -100, -8, -66, -56, 14, -6, 38, -5, 1, -15, -60, -60, -32, -26, -21, -11, -75, 8, -7, -48, 4, 22, 24, -5, 8, -45, 3, 25, -24, -20, 23, 19, 39, -6, 23, -17, -39, -17, -7, 12, -90, -30, -9, -19, -7, 11, -23, -14, -37, -12, -52, -40, -49, -56, -13, -19, -54, 13, 31, 73, -7, 32, -53, -22, -80, 7, -27, -32, 22, 4, 27, 4, -29, -27, -6, -53, -35, -52, -23, 3, -46, -12, -5, -97, 19, -1, 27, -4, -23, -19, 7, 1, 27, -12, 56, 20, 13, 2, 25, -29, -33, -19, 4, -4, -67, -19, -72, -1, -28, 15, -50, 27, -24, -8, 4, -11, -32, -31, -31, 2, -14, -5, -19, 44, -4, 24, -66, -20, -35, -6, -36, -24, 44, -9, -11, 5, -20, -49, 42, -29, -1, -37, 18, 11, 19, -49, 0, -84, -42, 7, -12, -64, -5, -25, 1, 11, 7, -51, -5, -7, -55, 34, 30, 34, -17, 14, 15, 26, -15, -39, -26, -53, -2, -4, -4, 0, 15, 23, -98, 10, 9, -12, 26, 9, -51, 1, 39, 16, -3, 42, -14, -23, -65, -9, -19, -9, 13, 2, 10, -10, -7, 11, 1, -3, 14, -22, 11, -4, -14, -17, 9, -34, -23, -15, 21, 48, 6, 7, 0, -23, 10, 19, -17, -38, 8, 39, -17, -4, 12, -22, 18, 16, -4, -3, -24, 21, 38, -14, -9, -7, -11, 18, -46, 4, -57, -43, 23, -32, -4, -8, 15, 31, -110, 28, -5, -40, 2, 17, 2, 6, -12, 16, 8, -8, -52, 2, -3, -26, -7, 14, -47, -12, 2, 0, -4, -23, -49, -6, 12, 18, -10, -7, -1, -16, 6, 50, -71, -38, 38, -11, -11, -50, -77, 2, 10, 33, 5, -4, -36, -7, -12, 17, -57, 27, 10, -14, -33, -27, -68, 18, 33, 4, 19, -34, 0, 33, -83, 17, 46, -28, 17, -17, -5, 29, -38, 6, -54, 9, -22, 33, 4, -22, -1, 12, -28, 25, -16, -67, -47, -18, -39, 8, 18, 45, -56, -31, 15, -10, -24, -7, -64, -14, -10, 4, 5, -25, -17, 17, -17, -1, 2, -55, -13, 1, -29, -2, -64, -10, 19, 7, -57, 35, -24, -6, 2, -11, -28, -17, -73, -48, 25, 0, 7, -4, 25, 12, -6, 32, -24, 6, 14, 24, -12, 9, -48, -21, 20, -23, -19, 0, 16, 0, -33, 28, -23, 17, 31, 20, -75, 12, 38, -22, -62, -24, -32, -25, 17, -23, -89, 6, -29, 32, 20, -3, 68, 9, -15, -70, 55, 7, -20, -77, -3, 42, 6, 9, -12, 3, 25, -43, -62, -104, -29, 13, -110, -14, -30, -3, 73, -52, -19, -38, -23, 23, -32, 5, -62, 38, -127, -42, -4, 33, -3, -89, 17, -48, -80, 29, -73, 53, -15, 41, -21, -13, 71, -34, -73, -23, -31, -11, 13, -29, -62, 20, 29, -1, -15, 8, 46, -2, 28, -3, 44, 50, -69, -66, 14, 1, 17, -9, -42, 14, 28, -11, 10, 21, -23, 30, -77, -5, -2, 37, 13, -17, 18, -31, 19, -72, -58, -88, -49, 50, -79, -40, 2, 21, 13, -69, 32, -19, -24, 28, -65, -25, -50, 11, 4, -11, -22, -10, -79, -16, -40, -3, 15, -45, -63, 26, -52, -21, -94, -83, 34, -15, -1, 19, 10, -44, -41, 19, 4, 7, -28, 11, -4, 11, 23, -41, 6, 15, -102, -10, -4, -30, 1, 18, -45, 43, 9, -26, -20, 2, -78, 4, -59, -12, -16, 32, 43, 14, 40, -20, -65, 10, -21, 10, -22, 15, -2, 4, -58, -8, -24, -28, -60, -52, -30, -1, -17, -12, 19, 32, 39, 15, 17, -15, 18, 4, -70, -50, 5, -12, -45, -14, -55, 8, -16, 16, -25, -2, 3, -28, 14, -37, -93, -17, -116, -58, -12, 24, 24, 21, 1, 2, -9, -26, -22, -9, -67, -50, -2, 21, 25, 28, 20, -57, -3, -60, -19, -1, -47, -66, 24, -11, -65, -35, -29, -20, -45, -8, -53, -45, -67, 4, 2, 46, -127, -53, 6, -2, 3, -14, -36, 7, -4, -61, 13, -18, -2, -17, 10, -27, -14, 25, -17, -6, -10, -2, -46, 16, -70, 9, 17, 6, 13, 39, 0, -52, -13, 6, 23, -57, 28, 10, -9, 14, -37, 2, 8, -16, 21, -48, -58, 27, -40, 56, -8, -12, -35, -27, 14, 20, -1, -3, -29, -20, -98, -14, -57, 27, -32, 21, -46, -45, 4, -2, 25, -11, 5, 21, 32, -7, 5, 37, -25, 5, 16, -16, 26, -6, -27, -10, 26, 18, 17, 5, -54, 9, -52, 13, -21, -44, -6, 9, 17, 8, -7, 7, -12, 14, 22, -35, 27, -8, -59, 8, -57, 24, 22, 18, 1, 32, 0, -12, 0, 11, -38, -15, 28, -9, 29, 8, 5, 9, 41, 2, 18, 1, 0, -12, -45, -18, -26, 8, 0, 4, 47, 24, -39, 8, 21, -41, 0, 11, 3, 5, 15, 13, -3, -20, -3, -35, 19, 27, -1, -8, -19, 9, -13, 9, -40, 9, 1, -23, 17, -29, 58, -8, 57, 40, -8, 11, 23, -22, 12, 12, -2, -56, -20, -28, -30, 12, 3, -1, 23, 4, -6, -23, -72, -20, -18, -26, -8, -19, 1, 0, -12, -33, 4, -26, -16, 28, -2, -1, 17, -5, -4, -5, -27, -41, 4, 36, -31, -16, 35, -77, -3, 4, -19, -14, -52, -1, 8, 31, -8, 43, -23, -40, -9, -30, 60, -32, 33, -13, -32, 38, -23, -76, 52, 1, -1, -13, -25, -28, 14, -25, -39, 8, 21, -22, -46, -62, -30, -35, -6, -33, -19, 25, 16, -19, -5, 12, -24, 16, -6, -28, -44, -3, -12, -28, 5, 16, 6, -12, 10, -7, 10, 34, -40, 29, -55, -1, 3, 14, -52, -27, -10, -38, -16, -31, 34, -34, -8, -14, 15, 31, -23, -5, -2, -47, 33, 8, -6, -6, -4, -20, -13, 19, -1, -52, -7, -28, 15, -59, -19, -2, 11, -12, -31, -7, -21, -16, -52, -31, -17, 5, 14, 23, -3, -7, -60, -9, 13, -77, 0, -21, 3, -43, 15, -4, -11, 12, -5, 11, 8, -22, 29, 39, -17, -4, -11, -56, -66, -50, 54, -29, 21, -5, 13, 60, 47, 14, 0, -58, 28, -5, 37, -18, -4, -36, -26, 15, -20, -30, -18, -54, -17, -52, -5, 10, -42, 2, -43, 21, -23, -30, -29, 2, -35, 3, -6, 48, -37, -40, -9, -9, -6, -6, 10, -17, -5, -11, -23, 19, -73, 11, 71, 28, 13, 1, -23, 57, -33, -35, 9, -37, -11, -32, 29, -39, 18, 24, 22, 74, 15, -4, -42, -19, 14, 12, 35, -52, -31, 22, -15, 6, 31, -32, -51, -31, -42, -95, -71, -26, -34, -17, -17, 33, -30, 43, -4, -6, -26, 0, -32, -10, -36, 15, -41, -30, -21, -4, 23, 11, -4, 42, 33, 16, 14, -5, 21, -32, 11, -11, -83, -25, 18, 0, -71, 32, 20, 20, -16, -35, 22, -33, 40, -4, 53, -33, 33, -27, 20, -43, 6, 12, 23, -21, -75, 9, -78, -21, 29, 25, -17, -10, 46, 27, -9, -12, 6, 6, 26, -11, -49, -10, 20, -9, -64, -7, -1, 7, -25, -4, 14, 14, -3, 12, -8, 25, 36, -9, -82, 24, 24, 6, 13, -27, -46, -37, 19, 17, -61, -21, 8, 23, -18, -36, 19, -34, 28, 7, 43, -8, 7, 14, 10, -16, -5, 18, 7, 11, -76, -32, 16, -19, 15, 31, -30, -11, 26, 8, -20, 3, 10, 2, 16, 16, 1, -19, 2, 3, 21, -21, 4, 6, 5, -31, 1, 21, -46, -27, -30, 16, 34, -9, -67, 30, 33, 17, -10, -94, -57, -32, 11, 38, 20, -19, -24, -10, 6, -22, -6, 5, 3, -2, -6, 2, -37, 45, -28, -7, -20, 25, -16, 68, -29, -33, -5, -3, -8, -14, -63, -29, -25, -28, 30, -37, -21, -4, 10, 28, 2, 3, 17, 34, -1, 0, 29, 0, -17, 8, 3, 19, 17, 28, -18, -8, -20, 0, -26, -1, -12, 17, -33, 2, -23, -46, -4, -44, -14, 2, 26, -37, -24, -28, -20, -44, 45, -45, 20, 26, 14, -15, -16, -32, -3, -45, -42, -5, -26, -25, -69, 16, 23, -6, 3, -22, -80, -26, 6, -21, -59, -39, 1, -1, -34, -15, -85, 26, -43, -1, 18, 24, -25, 3, 30, -26, 2, 7, 5, 1, 2, -30, -13, 15, -17, 16, -2, 28, -20, -13, -46, -82, 14, 8, 3, -35, 1, -60, -3, -11, 14, 0, 10, 36, -10, -9, -23, -12, 11, -16, -42, 11, -3, 14, -18, 15, 34, -22, -9, -40, -49, -26, -7, -53, -56, -19, 15, -2, -18, -34, -55, 31, -23, -5, -41, 18, 1, 26, -1, -18, 9, 0, -25, 15, -35, 6, 31, 16, 14, -41, 7, -23, 1, 1, -7, -104, -69, 37, 40, -5, 4, -42, -3, 4, 15, -22, 29, 30, 0, 6, 31, -19, 5, -18, -20, 37, -5, -7, 24, -3, 34, -41, 34, -48, -45, -31, -31, -9, -16, -11, -13, 26, -8, 4, 5, -4, -12, 38, -68, -3, -15, 25, -16, -16, -69, -16, -27, -1, -18, 11, 5, -4, 17, -24, -26, 41, -96, 9, 18, -47, -15, 16, -32, 12, -34, 26, -1, -22, 5, -6, -12, -54, 34, 1, -33, -48, -7, -28, 16, 24, -57, -39, 32, -60, -23, -19, -18, 28, 26, 18, 32, 33, 41, -27, -36, 41, 1, 7, -30, 6, -48, -1, -45, 11, -22, 5, 15, -52, -55, -27, -13, 20, -30, -28, 10, -55, 2, -69, 2, 4, -97, -49, 9, -74, -29, 3, -49, 13, -56, -15, 17, -15, 15, -75, -64, 15, -14, 5, -94, 4, -28, 0, 33, -24, -28, -71, -31, 11, -58, -3, 12, 28, 41, 35, 33, 22, 21, -16, 28, 6, -12, -41, 0, 21, -19, -27, -65, 46, -6, 20, 25, -33, -13, -14, -17, -4, -17, 2, 0, -45, -15, -104, 20, -26, -57, -38, 4, -59, -77, -28, 24, 28, -62, -9, 6, 1, 63, -127, 36, 3, -31, 4, -57, -22, -17, -24, 2, -10, -15, -16, -47, -19, -54, -16, -10, 21, 27, 34, -16, -53, 15, -2, 36, -39, 42, -51, 34, 27, -32, -100, -27, -59, -28, -78, -45, -94, -2, -86, 4, -5, -47, -4, -22, -44, 12, -41, 34, -81, 8, -24, 15, 12, 10, -57, -8, -126, -46, -49, -77, -4, -99, -65, -32, -37, 14, -4, 28, -33, -4, -1, -47, 0, -29, -43, -12, -3, -2, -10, -83, 11, -76, -34, 11, -37, -33, -36, -127, 3, 7, 1, -35, 6, 15, 5, -18, -7, -36, -18, -7, 29, -12, -20, -21, -34, -27, 22, -63, 28, -9, -34, -38, -46, 13, -46, -17, 25, 5, -56, -9, -45, 2, -24, -18, 14, 39, -3, -10, -22, -10, -2, -54, 11, -39, 18, -71, -27, 19, 16, 13, 42, -3, 14, -26, -37, -34, 29, 8, -54, -20, -49, -8, 0, 9, 20, -9, -11, 17, 29, 18, -10, -8, 18, 25, -18, -1, 12, -5, 4, -62, -3, -2, 28, 11, 20, 36, 18, 10, -74, 0, -2, 1, 2, -19, -25, -17, -17, 32, 14, 62, -7, -29, 17, -10, -12, -53, 4, -34, -15, -72, -15, -2, 29, -16, -17, -67, 8, -10, -47, -22, -5, 13, -26, -48, -60, -4, -31, 28, -1, -13, -14, 0, -10, 26, -24, -14, -74, -29, -12, -30, 39, 11, 29, -23, -10, 1, -4, -12, -7, -6, -44, -46, -23, -2, -32, -24, 23, 5, -55, -33, 18, -25, 49, -25, -23, -52, -5, -27, -10, -4, -13, -6, 4, -50, 56, -52, -25, -1, -8, 14, -50, -1, -33, -65, -14, -2, -83, -19, -27, -67, 20, -15, -18, -17, 16, -10, 32, 64, -7, -34, 16, -25, 17, 8, -23, 17, 30, -22, -8, 11, 1, 22, 10, -15, -33, -19, -4, 2, -69, 19, 58, 3, -21, 1, 12, 16, 53, 29, -29, -5, 24, -29, 30, 16, 41, 5, 18, 45, 12, -6, -53, -7, 24, -27, -34, 17, -5, -16, -7, -41, -20, 9, 3, 7, 5, 0, 8, -6, 21, -8, 19, 16, 20, 10, -10, 3, -3, 33, -11, 16, 16, 8, 3, -34, -9, 50, 3, 33, 0, -32, 12, -59, -25, 7, 10, -4, -6, 5, 44, 14, 40, 53, -9, -30, 20, -33, 3, 18, 15, -33, 11, 3, -12, 15, -28, -11, 6, -15, -13, -9, -1, -47, -65, -15, -28, -26, -28, -6, -15, 15, 5, 23, -16, -11, 0, -36, -28, -39, -31, 17, -24, 4, -42, -11, 0, -21, -36, 41, -6, 2, -45, 18, -17, -2, 20, -31, -17, -18, -8, -3, -105, -61, -4, -7, 24, -17, 31, 25, -40, -2, 5, 2, 3, 3, -20, -58, 12, -25, 15, 1, -38, -11, -18, 27, -10, -1, 10, 11, 6, 9, -57, -51, 23, -7, -27, -36, 17, -4, 18, 1, -14, -27, 28, 5, -24, -44, -38, -58, -12, -35, 4, 39, -27, 56, -5, 22, 12, -27, 26, 11, 3, -59, 6, -6, -49, -25, -3, -35, 18, 2, -5, 61, -27, 4, 47, 22, 45, 40, -34, 1, 31, 5, -36, -35, 0, 0, -1, 13, 1, -1, 13, -17, 25, 3, -20, -30, 16, 4, -2, -78, 15, 2, -2, -59, 33, -27, 48, 14, -31, -34, -95, -33, -31, -19, -7, 13, -8, 28, -72, 44, 38, 13, 26, -4, -27, 4, 9, -22, 11, -9, 20, 10, 56, -7, 9, -8, -72, -1, 15, -44, -5, 12, -26, 18, 11, -6, 4, -6, -15, -46, -47, 5, -5, -6, 16, -14, -5, 2, 1, -1, -7, 22, 17, 13, -14, -69, -90, 2, -11, -20, -68, -23, 8, -77, -28, 11, -6, -23, -26, -61, -28, -16, 5, -49, -79, -42, -29, -12, 0, -40, -46, -15, -88, -75, -7, -35, -55, -22, -108, 8, -18, -1, -44, -3, -46, -58, -37, -13, -50, -19, 23, -4, 22, -33, -3, -18, -11, -54, -63, -10, -31, -4, -32, 20, -12, -30, -49, -19, -78, -18, -17, -8, -5, -6, -27, 7, -53, -54, -26, -70, 0, -32, -5, -22, -6, -67, 20, -45, -39, -46, 10, -63, 23, 54, 25, 3, -45, -16, -41, -107, -28, -29, -73, -72, -5, -52, -34, -43, -66, -16, -60, -54, -86, 26, -71, -1, -73, -23, -4, -25, -48, -41, -4, -1, -26, -9, -24, -27, -25, -13, -53, -7, 25, 35, 40, -56, 5, -37, -81, -19, -55, 7, -32, -25, -23, -10, -16, -72, -75, -72, -13, 14, -43, -41, 33, 7, -1, -46, -32, -85, -54, -8, -67, -81, -70, -32, 24, -20, -8, -62, -49, -32, 49, 14, -92, -62, -84, -42, 2, -4, -79, -33, -45, -52, -71, -37, -1, -76, -15, -17, -65, -22, -71, -57, -47, -85, -19, -65, -72, 52, -68, 1, -49, -48, -50, -96, -8, 5, 10, -28, -77, -26, -43, -52, -2, -98, -11, -68, -60, -40, -3, -56, -36, -18, -69, -12, -47, -78, -61, -23, -59, -24, -34, -22, -90, 2, -51, -57, -9, -30, -31, -29, 4, -1, 25, -56, 11, -21, -2, -47, -57, -38, 9, -27, -19, 17, -89, 16, -17, -23, -85, -20, -23, -3, -17, -18, -68, -10, -81, -65, 16, -60, 19, 6, 8, -54, -42, -72, 4, -10, -48, -35, 16, -50, -65, 11, 7, -36, -47, -81, -55, -88, -72, -6, -42, -50, 3, -28, -66, -41, -83, -10, -30, -37, -53, -21, -71, -53, -72, -58, -37, -39, -44, -59, -75, -3, -30, -28, -32, -44, -15, -25, -38, -41, -33, -3, -59, -49, -31, -47, -83, -22, -10, -57, -21, -84, -26, -49, -19, -40, -86, 12, -98, 11, -51, -57, -26, -11, -73, -34, -17, -62, -15, -93, -52, -83, -45, -12, -37, -54, -33, -56, -42, -29, 7, 14, -58, -33, -65, 14, -86, -39, -89, 4, 3, -17, -22, -17, -9, -34, -20, -56, -54, -61, -25, -58, -93, -51, -21, -69, -60, -14, -70, -2, -102, -59, 18, -57, -70, -12, -33, 8, -7, -47, -53, 8, -49, -61, -48, 3, -9, -36, -30, -83, -53, -21, -56, -34, -14, -54, -56, -29, -68, -24, -10, -3, -56, -30, -59, -62, -52, -15, -86, -46, 34, -45, -15, -89, -39, -37, -22, -112, -110, -13, -58, -54, -69, -6, -75, -21, -9, -4, -81, 13, -44, -11, -23, -46, -30, -2, -92, -77, 22, -52, -3, -1, 0, -63, 8, -51, -18, 0, -38, -41, -33, -18, -33, -19, -30, -27, -95, -88, -40, -85, -22, -7, -38, -80, -29, 15, -9, 2, -87, 1, -27, -17, -24, -15, -91, -78, -26, -68, -11, -30, -29, -22, -56, 11, -39, -10, -62, -11, -29, -13, -19, -17, -21, 11, -61, -42, -39, -20, -43, -21, -7, -57, -8, -101, 9, 26, 4, 3, -108, -13, -66, 13, -35, -21, 6, 0, -43, -74, -16, -49, -39, -127, 2, -22, 10, -35, 9, -15, -10, -88, 17, 11, -13, -6, -38, -14, -11, -2, -52, -71, -110, 4, -22, -53, -24, -6, -22, -23, -29, 1, -36, 16, -24, -27, -91, -47, 10, -26, 19, 19, 8, 4, 6, 6, -16, 16, -15, 25, -18, -48, -35, -5, -14, 0, -29, 3, 8, -54, -18, 2, 2, -22, -24, -4, -17, 1, -13, -4, 10, -8, -6, -20, -16, -8, -3, -29, 25, 7, -26, 10, -6, -32, 13, 11, 7, -12, -51, -14, 2, -7, -7, -11, 10, -10, -18, -10, 2, -16, -10, -38, -61, -8, 9, 12, -10, -16, -6, 12, -15, -7, -1, 1, -7, -53, 3, 7, -1, 2, -15, -16, 23, -34, 29, 0, -28, -20, -9, 2, -62, 14, -4, 4, -6, 6, 6, -7, 19, 39, -13, -9, -4, -4, -2, 26, -9, -26, 1, 3, -13, -16, -16, 6, -28, -12, -8, 14, 0, -11, -31, -18, -22, -2, -3, -35, -15, -5, 10, -1, -12, -24, -11, 16, -65, -4, 17, 4, -10, -94, 1, 16, 8, -20, 6, -4, 9, -44, 18, -9, -22, -14, -17, -11, -11, -7, 17, 10, 8, 29, 12, 0, 29, 11, -87, 15, 16, 19, -9, -51, -8, 11, 2, -6, -9, -127, 13, 0, -54, -16, 2, 6, 7, 21, -23, -22, -25, 1, 0, -46, 2, -12, 0, -13, 1, -1, 9, -4, -10, 15, -12, 12, 10, 3, -28, 32, -37, 5, -11, -1, -2, -31, -17, -20, -38, -38, -29, 13, 4, -3, -8, -13, 0, -3, 1, 30, -7, -4, 7, 8, -18, 12, -13, -29, 29, -20, -3, -27, -4, -5, -47, 4, -4, -6, 1, -5, 7, 24, -22, 16, 8, -22, -13, 7, -30, -12, 3, -12, -16, -36, -26, -13, -15, 8, 0, 28, -2, 6, -8, 8, -22, 2, 25, 5, 18, -41, -1, -7, -16, -7, -28, -4, -26, -12, 12, -6, -5, -2, -23, -5, 4, 17, 3, 13, 19, -11, -23, -11, 9, -18, -12, -17, 4, -12, -8, -18, -18, -5, -3, 0, 0, 19, -23, 2, -14, -19, 14, -13, 10, 2, -8, -11, 4, 17, -16, 18, -37, -20, 7, -29, 10, -26, 8, 4, -9, -16, -11, 0, 7, -56, 0, 8, -33, -14, -3, -38, 1, -44, 16, 6, -17, 22, -14, -29, 17, -28, -38, -1, 7, 11, 9, 3, -14, -16, -29, -19, -24, -59, 25, 26, -25, -10, 7, 9, 4, 13, -46, -8, -14, -11, -23, -21, 5, 18, -25, -8, -5, -7, 34, -34, 25, 4, -7, -47, -15, 15, -24, 24, -29, 15, -17, -19, 3, -21, 5, -12, -25, -24, -8, -3, 16, -26, 0, -10, 19, 26, -12, 17, -24, -44, 24, -11, -38, 13, 40, -7, 29, 18, 3, -42, -3, 23, 13, 4, 1, -12, 23, 4, -17, -10, 1, 9, 30, -14, 1, 0, 22, 1, -6, -26, 36, -14, 29, -29, 26, 9, -43, -20, -51, -4, 7, -3, 1, 25, -25, 11, -6, -4, -5, 22, -7, -3, 11, -28, 14, -14, 4, -8, 17, 12, 8, -2, -55, -20, 45, -31, -19, 10, 26, -6, 24, 7, 19, 6, -1, 21, -15, -2, -9, -8, 39, -18, -28, 5, -45, 4, 23, 0, 7, 15, 17, 31, 1, -3, 16, 10, -2, -39, 6, -11, -37, -38, -19, 3, 23, -2, 13, -4, -23, -6, -22, -33, 3, 0, -3, 21, 16, -51, -26, 5, 22, 2, 12, -13, 10, -23, -9, -14, -10, 1, 19, 21, -7, 25, 6, 18, 9, 16, -8, -26, 19, -15, -5, -6, 26, 3, 3, -3, -14, 2, -4, -4, 31, -4, 28, -50, 2, -47, -5, -19, 11, -32, -11, 16, -36, 7, -2, -1, -49, -23, 33, 6, -13, -12, 18, 1, 31, 1, 5, -31, 10, -34, -52, 8, 17, -33, 17, -12, -23, -25, 25, 13, -9, -25, -72, 24, -7, -20, -58, -62, -45, -63, -35, -8, 11, -6, 52, -31, -74, 11, 17, 30, -14, 2, -16, -29, -30, -24, -2, -26, -2, 19, -16, -17, 12, -49, 6, -35, -26, 0, -23, -11, -17, -6, -73, 18, -1, 28, -12, 11, -20, -13, -38, 12, -47, -6, 13, -29, -22, 9, 4, -22, -6, 47, -74, -14, 20, -26, -47, -26, -2, 3, 2, -57, -27, 4, -38, 40, -22, 27, 5, -31, -10, -22, -2, -16, -45, 3, -11, -19, 12, 14, -79, -31, -14, -17, -15, 7, -32, 5, -3, -34, -43, -19, 20, -11, -17, -53, -9, -9, 26, 8, -21, 3, -11, 8, -12, -36, -41, 0, 7, -38, 9, -37, 5, -35, 49, 5, -81, 9, 23, 37, -69, 2, 25, -9, 15, -38, -51, 14, 3, 29, -67, 23, -7, -27, -54, 21, 41, -41, -44, -6, -37, -7, -30, 8, -19, -42, 9, -12, 37, -41, -12, -20, -5, 12, -7, -51, 5, 17, -7, 21, 8, -10, 22, -32, 8, -10, -6, 11, 4, 14, -3, 27, -5, -30, 15, -77, 1, 18, -27, -6, 27, 14, -21, -6, -29, 28, 14, 0, -1, -27, -19, -24, -21, 11, 5, -6, 33, -25, -8, 9, -33, 39, 7, 15, -20, -26, -31, 8, -30, 7, -6, 0, 0, -37, -22, -40, -2, 23, 15, 5, 13, 3, -14, 13, 26, -10, 20, -6, -8, -8, -27, 10, -11, -11, -29, -2, -3, 21, 65, 55, 36, 17, -45, 15, 23, 33, -21, 15, -25, -3, 4, -5, -12, 19, -20, 0, -30, -4, -8, 14, -2, -19, -26, -9, -56, 13, -20, 25, -6, 3, -15, 8, -26, -34, -50, -28, -8, -26, 36, 9, -4, 35, -63, -31, -44, 6, -30, -17, 9, -6, -2, -41, -16, 1, -22, -31, -33, -7, -18, -29, 40, -50, 22, 18, 6, 47, 5, 17, -30, -16, 19, 6, -45, 0, 37, 1, 27, -37, -56, -1, -33, 0, -37, 27, -87, -86, -44, -51, -49, -71, -60, 6, -21, 9, 25, -2, 12, 1, -14, -2, -56, -15, -11, -3, -52, -22, 15, -39, 5, -4, -6, 6, 13, -18, -25, 4, -17, -9, -3, -25, 17, -18, -15, -8, 20, -68, 9, -127, -2, 3, -18, 1, -11, -31, 16, -18, -16, 40, -20, 0, -11, -14, -13, -35, -33, 25, -5, -16, 36, 11, 35, 7, -38, 17, 6, -24, 29, -16, -14, -43, 30, -15, -41, 14, 13, -44, 4, -14, -6, 4, 20, -7, 8, 9, -37, 4, -50, -2, -7, -21, -25, -36, -3, -10, -26, -5, -25, 2, 7, 3, 32, 30, -28, 29, -30, 11, -3, -16, 3, -2, -38, 0, -16, 2, -6, -49, 16, -37, -16, 24, 12, 2, 22, 15, 13, -13, -45, -10, 1, -16, 17, -32, -15, 0, -29, -16, -8, -51, 39, -60, 58, -1, -20, 26, 7, -22, 0, 7, -39, 5, -35, -3, -11, -32, -19, 16, -24, -21, -14, 58, 18, 21, -9, -2, 8, 47, 22, 38, -39, -18, -8, 11, -13, 9, 10, -43, -4, 13, 11, -10, -34, 8, -8, -7, 2, 28, -39, -22, -57, -78, -8, -25, -4, 12, -5, 19, 26, -7, 13, 23, -83, 17, 32, 18, -9, 9, -40, -8, -24, 3, 19, 6, 23, -39, -17, 1, -69, -15, -32, -47, -21, -5, -81, -3, -56, 3, 13, -10, -26, -94, 33, -25, -64, 0, -11, -19, -19, -3, -20, -115, -11, -1, 16, -25, -12, -71, 38, -25, -5, -12, -17, -16, -53, -26, -26, -31, -49, -45, -21, 5, -7, -58, -54, -21, 8, 8, -20, -13, -16, -9, -31, 13, -39, 19, -14, 62, 19, -26, -18, -8, -5, 20, 11, -61, -59, -52, 8, -66, -61, 18, -26, 21, -2, -52, 9, -39, -20, 11, -27, 12, -8, -3, -12, -14, -40, -9, 30, -27, -8, -36, -40, -7, -26, -5, -23, -49, -45, -40, -38, -101, -20, -61, 17, 14, -3, -18, -18, -5, -31, -34, 7, -97, 10, 37, 23, 37, -81, -116, -20, 4, 2, 16, -52, 29, -11, 30, -5, -83, 3, -38, -42, -29, -14, 45, -18, -89, -2, -31, 13, -33, -13, 31, 18, -12, 16, 20, -31, -27, 3, 19, 27, -4, -36, -22, -41, 29, -9, 12, 13, -57, -14, -24, 0, -57, -25, -8, 24, 11, -21, 16, -124, 8, 4, -5, -31, -15, 0, -17, -31, 15, 17, -2, 7, 47, -16, 3, 3, 11, 21, 24, -21, 9, -8, 13, 0, -21, -33, -12, -59, -2, -4, 5, 9, -26, 3, 1, -20, -8, 39, 2, -20, 5, -74, -19, -28, -25, -21, -39, -18, -1, 15, -11, 13, 13, -12, 2, -21, -30, -26, -32, 8, 6, 7, -25, 2, 27, -24, -1, -56, -11, 4, -11, -37, -2, 1, -16, -20, -27, 18, -2, -19, 9, 19, -15, -24, 22, 5, 9, 13, 22, 8, 5, -33, 35, 20, -30, -6, 60, 9, -36, -28, -4, 3, -20, -4, -25, 14, -29, -3, 7, -27, 20, -12, 21, -3, -43, 25, -2, 3, 21, -29, -15, 15, -3, 1, -9, 12, -20, -11, 24, 2, 7, 12, -7, 55, 15, 7, 14, -33, -25, -9, -61, -36, -6, -64, 11, 3, -18, -39, 12, -15, 7, -1, -12, 24, -56, -3, -9, -28, -40, -6, 9, 10, -19, -5, -23, 15, -49, 0, -5, -27, -6, 24, 26, -57, -7, -31, 0, -14, -2, -7, -75, -39, 18, 27, 8, 23, 6, 8, -12, -9, -17, -13, 20, -33, -4, -127, -53, -22, 19, -51, -4, 56, -59, 40, -26, 17, 8, 27, 37, -12, -13, 32, -63, 15, 17, 52, -7, -7, 2, -11, -30, -4, -32, 18, -36, 22, -8, -8, -53, 4, 5, -102, 3, -13, -56, 7, 18, -36, 9, -59, -15, -28, -8, -63, -63, -36, 26, -38, -18, -55, -69, 17, -27, -2, -37, 30, -12, 9, -37, -81, -26, -30, 26, 27, 25, -21, 25, -5, 30, -9, -26, 49, 46, 12, -23, 62, -33, 10, 33, 12, -35, 29, 12, -7, 26, -34, -35, -21, 21, -13, -4, -11, -8, 27, -9, -67, 8, 40, 1, 19, -14, -35, 7, -47, -33, -26, 8, -108, -30, -60, 3, -79, -22, -42, -39, 80, -25, 27, -36, 31, -59, 5, -34, -17, -25, 30, 34, 5, -12, -48, -15, 8, 19, -3, -1, 29, 36, 2, -8, 28, -52, 24, 27, -14, -13, 57, 20, -22, -6, -91, -29, 1, -74, -62, -20, 13, -36, -22, 14, 45, -49, 37, 28, 15, -54, -87, -60, -6, -7, -23, 65, -16, -6, -78, -44, -69, -56, -2, -39, 11, -11, -31, 12, -12, -48, 37, -12, 17, -39, 49, -6, -77, 20, 2, -22, -28, -68, 36, 1, 34, -47, -2, 50, -33, -127, 30, 3, -52, -55, -26, -20, 10, 8, -1, 40, 23, 37, 14, -50, 11, 15, 12, -16, 11, 39, -8, -46, -22, -23, -11, 3, -5, 57, -81, 27, -14, -12, 18, -85, 7, -13, -48, -10, -14, -43, 30, -47, 10, -7, -95, 12, -14, -38, -55, -45, 26, -35, -20, 45, -4, 5, 51, 16, -46, -27, -2, 11, -56, -122, -48, -23, -18, -9, -18, -1, 9, 14, 3, 3, -29, -13, -56, -41, -15, 1, 43, -5, 15, 2, -27, 7, -23, -4, 22, -23, 8, 45, -20, 40, 24, -18, -22, 16, -29, -18, 14, 10, 0, -26, 23, -63, -34, 17, -21, 23, -28, 8, -38, 11, 28, 3, 23, 77, -8, 9, -7, -3, -33, 1, -17, 10, -8, -95, -25, -46, 25, 3, -3, 31, -16, -45, -30, -28, -62, -15, -59, -114, -23, 34, -9, -39, 22, -34, 18, -18, -11, 8, -5, -34, 16, 23, -27, 27, 8, -7, -28, 40, 15, -56, 31, 26, -17, -1, 39, -57, -12, -106, 15, -65, -3, -23, -24, 14, -55, 1, -36, -46, 32, -13, 13, 22, 22, 4, 0, 29, -11, -46, 31, -22, -31, -58, -37, 5, -7, 28, 43, 15, 8, -12, 43, 47, 16, -6, -10, 8, 10, 21, -6, -26, 44, -23, 16, -8, 14, 11, -6, 37, 31, -41, -23, -37, 4, -11, 5, -14, 34, -48, 5, -50, -39, -27, -14, -60, -44, -25, -16, -21, 9, -50, 3, 1, 17, 4, 32, 16, -4, 9, -5, -12, -10, -20, -4, -26, -19, -2, 24, 3, 28, 17, -53, -48, -48, 15, -19, 14, 5, -27, 26, -19, 7, 19, -4, -43, 30, -14, -49, -10, -8, 2, -9, 17, 37, 5, -29, 2, -1, 13, 10, -11, 1, -63, 5, -45, -3, 24, 37, -6, -3, 24, 39, -60, 37, -21, 5, 7, 6, 28, 5, 10, -19, 14, -16, -34, 4, -46, -18, -76, -23, -24, -35, -8, -10, -49, -10, -46, -3, 8, -42, -54, 16, -55, 18, -15, 35, -89, 18, -15, 13, -32, -81, -65, -7, 19, -12, 23, 4, 5, -7, -20, 16, 0, -15, 11, -13, -41, 27, 6, -18, 17, -22, 32, 28, -16, 17, -4, -24, 6, -13, -45, -24, -62, 14, -55, 39, -3, -68, -12, -37, 27, -26, -7, -15, -15, 38, 12, 20, 9, -27, -8, -8, -11, -19, 41, -25, -5, 27, 3, -19, 11, -66, -7, 9, -19, 62, -29, -45, -9, -15, 13, -35, -15, 5, 4, -39, -20, -25, -17, 48, -4, 32, -34, 24, 14, 8, 53, -19, -65, -7, 0, 10, -58, 21, -81, 15, -6, 11, -26, -25, 23, -33, -26, -13, 27, -31, 6, -14, -65, 4, 5, -4, -107, -35, -59, -15, 25, -57, 21, -13, -32, 39, -4, -18, 22, 27, -35, 3, -8, -4, -40, 14, 15, 61, -8, -39, -32, 22, -20, 12, 8, 17, 9, 55, -40, 32, -9, 25, -37, 64, -6, -8, 32, 22, -58, 50, -17, -14, -68, 6, -21, -38, 8, -1, 55, -15, -58, -40, 2, 6, 21, -9, -25, 5, -17, 8, -22, -15, -62, 36, 11, 19, 23, -10, -40, 18, 3, 15, -6, 14, 34, 26, 51, -39, -28, 28, 14, 28, -46, -13, 15, -9, -47, 32, 19, -10, 5, 18, -105, -122, -19, 14, -44, 1, 10, -5, 9, 24, -7, 3, -34, -78, -28, -28, -7, -9, -2, 12, 0, -4, -1, 1, -2, 37, -47, 35, -20, -16, 6, -16, -35, -20, 33, 22, 17, 5, 1, -48, 1, -4, -3, -55, 52, 43, -52, 25, -35, -33, 13, 49, 37, -11, -24, -3, -43, -49, 9, -22, 38, -63, -60, -23, 32, 32, -3, -55, 56, 24, -27, 21, -13, 44, -12, -29, 51, -34, 27, -24, -24, -21, -17, 9, -5, 3, -5, 39, 6, 17, -8, 27, 14, 6, -5, -64, -17, -11, 13, 6, 58, -12, -3, 3, 8, -13, -24, -22, 17, -7, -68, -23, -7, -32, 11, 19, 8, 35, -22, -60, -19, 5, 51, 31, 28, -71, -52, -41, 11, 37, -6, -13, -1, -97, 28, 24, -72, -38, -2, -37, 50, -11, -32, 7, -46, -9, -14, 0, 7, -11, -13, -15, -1, -110, 62, 17, 31, 78, -7, -86, 6, -31, 35, -103, 0, -16, 20, 4, -44, -25, -53, -21, -17, -40, -34, -1, 19, -76, 20, 53, -22, -1, 11, -49, 29, -24, -10, -53, 16, -4, -15, 4, -29, 23, -104, 25, -67, -6, -16, -21, 13, 1, -4, 22, 23, -56, -13, -34, -34, -33, 46, 1, 13, -1, 5, -54, 8, 48, 19, -8, 11, 7, 8, -45, 13, 24, -32, 2, 2, 52, -11, -3, 9, -4, -9, -12, -17, -7, -56, 54, 28, -32, 18, -11, 7, 12, -21, -23, -7, -26, -24, -24, -21, -28, -59, 23, 16, 18, -12, 36, -32, 7, -56, 1, -36, -32, 23, 7, -19, -26, -51, -18, -19, -34, 14, 39, 11, -47, 31, -6, -16, -2, 17, -31, -36, 4, -15, -90, -19, 27, 4, 0, -9, 6, 10, 19, -10, -25, -30, -26, -27, 4, -16, -27, 6, -38, -29, -50, 4, -47, 6, -31, -3, 14, 0, -41, -10, -36, -48, 10, -1, -11, -1, 15, -28, -54, -53, 38, -25, -76, -2, 29, -44, -15, 23, 22, 26, -52, 21, -13, 11, -24, 38, -16, -23, -9, -23, -74, -26, -34, 9, -11, -90, 24, -44, 19, -29, 18, 37, 17, -50, -28, 16, -106, 17, 29, 9, -37, -23, -70, -81, 16, 36, -35, 19, 7, 22, 36, 27, 26, 38, 5, 13, -8, -21, -38, 26, -26, -11, -30, -52, 8, -27, -30, 24, 57, -32, -16, -22, -6, 52, -22, 2, -58, 17, 5, 43, 36, 10, -6, 64, -63, 10, -1, 10, 16, -21, 2, -38, 36, -45, -42, 19, -68, -43, 2, -1, -41, 45, 48, 5, 35, -12, -53, -42, -32, -36, -47, 47, -33, 57, 11, 5, -29, 4, -5, -7, 2, -18, -48, 27, -56, 10, 0, 24, -37, 12, -70, -12, -2, -91, 45, 20, 37, -2, -37, -34, 36, 9, 34, -9, -45, 7, 12, 18, 12, 38, -31, -69, -1, -13, 54, -31, 45, -93, 64, -59, -20, -28, 27, -103, -8, 26, 19, -29, -5, 2, -30, 7, -22, -39, -13, -17, 18, 29, -16, 17, -28, -22, 11, -29, -37, 6, -17, 19, -36, 23, 18, 64, -44, 20, 3, -52, -18, 12, 15, -57, -22, -82, 33, -68, 26, -57, 21, -31, -38, -41, -1, -37, 34, -12, -6, -48, -9, 37, 42, -13, 46, -49, 10, -3, 4, 12, -73, -32, 9, 43, -75, 4, -67, -2, 22, -24, -9, -47, -14, -86, 48, -30, 11, 46, -38, -18, 14, -22, -127, 29, 7, 14, 3, -3, -61, -17, -51, 0, -75, -31, 24, -4, 15, -39, -18, 19, -53, 21, -52, -3, -37, -9, -90, 15, -4, -39, -18, -2, -59, 15, -23, -32, 3, -81, 2, -87, -6, -47, 24, 7, -81, 6, -82, 36, 23, 15, 9, -66, -19, -23, -5, 10, 74, -23, -48, -88, 10, -40, -3, 1, -24, -50, -45, -40, -3, -36, -78, 24, 2, -26, -75, -50, 9, 4, -26, 9, -51, -22, 0, -91, -27, -3, -22, 10, -70, -88, -63, -13, 10, -16, -22, 43, -41, 17, -9, -29, -37, -57, -45, -66, 51, 24, -1, 1, -35, -31, -16, -30, -30, -33, -58, -35, 3, -59, -34, -30, -6, 16, -53, -97, -18, -55, 22, 17, -73, -33, -29, -8, 22, -45, -46, -14, -116, -20, -71, 18, -54, -5, 5, -40, -2, 3, -41, 8, 41, -54, -54, 0, 8, -38, -14, -33, -29, -36, -25, -3, -55, 17, 1, -41, -32, -43, -71, -49, -72, -48, -90, 6, -85, 4, -92, -24, 4, -23, -36, -60, -6, -31, 12, -10, 45, -35, 12, -80, -75, -60, -62, -57, -16, 7, -29, -64, 21, 16, -24, -12, -37, -48, -46, 22, -16, -52, -14, -28, -45, -21, -3, 33, 16, -49, -62, 9, -39, -36, -99, -43, -6, 10, -26, -18, -13, -11, -29, 5, -55, -61, -49, -16, -18, -48, -26, -45, -48, -14, -24, 10, -40, 0, -29, 20, -27, -24, -15, -34, 48, -41, -39, -7, -35, -29, -14, -58, -35, -38, -24, -12, 17, -65, -23, -3, 5, -29, -31, -77, -14, -49, -24, -38, 21, 12, 5, -35, -38, -14, -37, -25, -24, -82, 6, -5, -33, -4, -12, -99, 21, -35, -33, 9, -64, -118, -4, -27, 15, -10, -17, -63, -27, 3, -35, -19, -21, -42, -21, -75, -71, 10, -19, 11, -28, 11, 12, -28, -27, 26, 34, -25, -46, -52, 25, -52, -27, 2, 4, 27, 42, -23, -16, -44, -57, 7, -20, -16, 22, 18, 7, -15, -9, -37, -55, -32, -19, -23, -37, -23, -2, -7, 36, -25, 33, -42, -26, -30, -92, -32, 9, 30, 12, -38, -5, -19, -39, 30, -33, -10, -30, 3, -59, -28, -20, -19, -18, -14, -6, -11, 24, -80, -59, 1, -15, 39, -36, 17, -2, -42, -33, -6, 20, -30, -54, -32, -5, -1, -36, 10, 0, -3, -39, -34, -24, -38, -36, 2, -66, -3, 2, 3, -58, -37, -13, -14, -42, -11, 7, 2, -37, 5, -43, -52, -20, -124, -46, -10, -55, -18, -54, -41, -95, 29, 4, -22, -48, -29, 9, 19, -48, -4, -17, -36, -6, -47, -17, -54, -49, -5, -58, 24, -59, 3, -7, -9, -3, 17, -5, -10, -37, -66, -45, -36, -18, 16, 8, -15, -46, 1, -18, -47, -55, -28, 16, -59, 17, 16, 7, 18, -49, -42, -61, -13, -19, -57, -75, -127, -33, -39, 24, -39, -83, -3, -11, 8, -43, -44, -1, 7, -35, -47, -76, -4, -9, -8, -45, -22, -38, -66, -37, 10, 25, -11, -33, -4, -49, -54, -5, -8, -4, 16, -19, -42, -20, 1, -8, -45, -28, -45, -24, -19, -29, -51, -13, -8, -19, 19, -30, -66, -9, 0, -18, -27, -1, -59, -49, -41, 17, -48, -65, 48, -59, 47, 13, 11, -38, -5, -6, 15, -63, -48, -22, -28, -73, -22, 16, 8, -35, -47, 33, -20, -22, -109, -46, -40, -27, -50, -68, 3, -33, -11, -30, 15, -64, -47, -36, -24, -38, 8, -12, 2, 12, -32, -37, -27, 0, 4, -20, 14, -42, -1, -27, -50, 11, 11, -17, -6, -18, -46, 34, 10, -56, -34, -80, -89, 8, 24, -127, -8, -41, -21, 21, 1, -68, -4, -44, -30, -37, -39, -14, -17, -11, 12, 7, 25, 32, -41, 27, -34, -11, -54, 32, -70, 1, -27, -10, -8, -10, -21, -109, -30, -65, -20, -29, -17, -9, -45, -70, -20, -17, 26, -23, -40, -46, 9, -34, -34, 16, 2, -38, 20, -20, -12, 6, -12, -49, -33, -47, -75, -23, 5, -127, -20, -59, 3, -4, -25, -66, 2, 9, 6, -17, -77, 2, 6, -32, 13, 7, -12, 31, -12, 25, -6, -10, 9, 33, -55, 0, 8, 7, -13, -11, 4, -42, -18, -16, -32, -61, 48, 2, 5, 20, -18, -6, 32, 2, -19, -101, 25, 29, 4, 38, 4, 17, 11, -9, 75, -27, 10, 19, -71, -43, -18, 7, 36, -2, -29, 17, -19, -13, -56, -15, -63, 38, 21, -21, 20, 19, -45, 11, 10, 30, 44, 38, -11, 24, 27, -61, -14, 38, 28, 0, 34, 5, 28, -23, 5, 13, -3, -12, -21, -49, 47, -18, -6, -12, 9, -6, 40, 12, 20, -18, 3, -26, -28, 14, -12, 11, -5, -13, 2, 13, 24, 18, -8, -51, -58, -45, 9, 57, 31, -12, -9, -10, -5, 22, -21, 28, -9, 13, 29, 15, -43, -2, -8, 5, -7, 6, 20, -16, -5, 21, -50, 12, -11, -3, 16, -4, -4, 7, -4, -9, -16, -28, -19, -28, 9, 8, 26, -15, -14, -51, -8, -14, 9, -8, 35, -7, -2, -36, -20, 52, -7, 1, -31, 19, 8, -13, -45, -44, -59, -54, -81, -18, 4, -3, -9, -30, -3, 5, 25, -9, -8, 25, 3, -5, -21, -20, -12, -10, -31, 43, 3, 36, -41, -9, 5, 8, -43, -8, -56, -22, 25, 24, -28, -45, 18, -12, 5, 0, -4, -7, -27, -30, -17, -54, 7, 20, -50, -39, -11, 12, 16, -23, -25, -49, 8, -28, 8, -22, -6, 11, -59, 11, -19, -17, 11, -32, -4, -14, 31, -61, -33, -22, -58, 3, -6, 15, 0, -46, -49, 0, -12, -4, -50, 24, 3, 37, -15, -39, -41, 15, 8, -32, -31, -43, 30, -49, 16, 9, -4, -26, -43, 19, -49, -20, -11, -9, -10, -41, -7, -11, -15, -17, -28, -1, -22, -30, -37, 34, 24, -42, 17, 14, -32, -14, -27, -85, -6, -20, -27, 0, -71, -15, -2, 10, -34, 28, 53, 5, 0, -35, 33, 25, -23, -1, -39, -8, -61, 13, -1, 9, 13, -22, -1, 22, -53, -16, -23, -14, -35, 41, 19, -92, -27, 26, -49, -33, -48, 40, 10, -11, -32, -72, -16, 52, -58, -26, 10, -57, 15, -19, 21, 42, 18, -40, 16, -26, 2, 6, -38, -5, -19, 65, -20, 4, -8, -66, -56, 53, 25, -29, 11, 14, -1, 22, 34, -11, 18, 2, 46, -17, -20, -18, -1, 2, 6, -77, 5, -1, -6, 13, -13, 20, 27, 32, 33, -64, 27, 57, 1, -30, -7, 11, -8, 22, 21, -30, -1, 74, -31, -52, 31, -5, -8, -21, -22, 52, 1, -4, 27, -9, 8, 2, -36, 17, 15, 23, 38, -33, -10, -22, -4, 21, 1, -30, -83, 20, -1, 43, 11, -43, -44, 9, 20, 4, 14, -3, 27, -18, -18, -32, 9, -7, 51, 20, -62, -41, 57, -29, 35, 28, 23, 11, -67, 19, -47, -37, 21, 38, 11, 1, -14, -4, -23, 0, -12, 20, 10, -5, -19, 19, 8, 7, -9, 12, -60, 16, -7, -1, 32, 10, 21, 19, 3, 23, -26, -19, -41, 14, 17, 2, 39, -13, 5, -4, 5, -10, -30, 28, -5, 6, 32, 0, -13, 16, 1, 23, 5, 18, -65, 5, 18, -21, -9, 19, 6, -38, -38, -38, 12, -7, 11, 7, -20, 0, -22, 24, -34, 36, 32, 23, 39, -11, -10, -14, 4, 13, 26, -3, -56, 13, 16, -9, -11, -34, 4, 8, -11, -18, -42, -42, -72, 25, 11, 3, -38, 30, -24, -7, 13, -63, -48, 32, -43, 24, 41, -28, -16, 2, 3, 7, -31, 8, -16, -16, -23, -32, -48, -4, -53, -43, 8, -36, -17, 47, 6, -6, -6, 27, -44, 45, -31, 16, 21, -7, -17, 26, 22, -21, 33, 14, -1, -5, -16, -25, 9, 41, 20, 19, 3, -14, 39, 8, -1, -39, -34, 15, -1, -11, -19, -25, -11, 13, 0, -38, 2, -17, -28, 21, -51, -23, -47, -32, -6, -5, -3, -21, 20, -25, 18, -58, -33, 5, 2, 13, 2, 4, -35, -34, 26, -25, -2, 12, 19, -32, -6, -2, -55, -1, 34, -21, -13, 1, -10, -2, -1, -25, -65, -3, 20, -17, 3, -12, -10, -2, 34, -22, -4, -22, -8, 0, -18, 1, 4, 25, -18, 0, -29, -4, 18, 8, 25, -13, 21, -17, -35, 15, 13, 13, -9, 6, -86, -12, -29, -42, 36, 1, 6, -12, -20, 6, -15, -1, 8, -27, -3, 28, 17, 11, 7, -7, -75, -6, 14, -14, -5, -15, -5, -2, -7, -27, -18, -5, -6, -16, -13, -64, -24, 1, 5, -20, -2, 7, -14, -22, -10, 2, -24, -48, -30, -34, -10, -13, -20, -8, -16, 16, -7, -7, -9, -3, -12, 12, -29, -6, -25, 1, -30, -43, -3, 18, 21, 3, -5, -33, -39, 11, 7, 29, 15, 20, -29, 13, -17, 22, -5, 8, -26, 46, 4, -31, -1, 8, 31, -29, -12, -10, 27, -24, -13, -45, -3, 14, 19, 10, 3, 0, -15, 4, 15, -2, -29, -63, 17, 9, -2, 1, 24, -61, -40, 40, -69, 1, -17, 19, -31, 31, 5, 16, -6, -13, -1, -45, 8, 4, 34, 35, -12, 12, -58, -13, 26, 35, -4, -26, -18, -38, -81, 11, -101, 15, 34, -8, -48, -19, -8, -34, -21, -41, -68, -10, -44, -40, 30, 38, 31, -12, -11, -65, 0, -24, 9, 7, -32, 24, 15, -41, 7, 2, -55, 15, 2, 30, 1, -12, 15, -3, -16, -4, -23, 34, 16, -11, -56, 24, 16, 8, -8, 1, -22, 24, 9, 12, 31, -36, 36, -21, -3, -5, -33, 3, -47, -23, -107, -12, 23, 6, -59, -19, -43, -76, -31, -36, -48, -2, -25, -55, 10, 3, 15, -59, 29, -23, 11, -18, -6, -11, -26, -7, -33, -127, -14, -11, -25, -64, -10, 2, 7, -1, 5, -4, -13, -18, -29, -27, 12, -62, 0, 15, 3, -55, -52, 6, -55, 25, 22, -13, -27, 10, 21, 16, 14, 27, -42, 11, -47, -44, -56, -61, -14, 27, -69, -20, -93, -76, 23, -14, -17, -35, 16, 0, 16, -42, -21, -12, 24, 27, 27, -78, 8, -3, -10, -81, -40, -95, -11, 10, -15, -61, -120, -49, 26, -30, -38, -74, -32, -13, -5, -52, 4, -65, 13, 19, -4, -8, -48, -28, -66, 1, -45, -35, -47, 21, -52, -14, 28, -82, -14, -10, -61, -10, -2, -16, -24, -48, 21, 9, 30, -24, -57, -71, 1, -84, 6, 26, -127, 32, -58, -3, 12, -62, -77, 29, -6, -33, -52, -9, -8, -34, -78, -69, 11, -47, -54, 0, -59, 34, -61, -39, -41, -51, -21, -9, 25, 2, -51, -32, 19, -52, -8, -43, -12, -17, -17, -10, 2, 21, -36, -28, -9, 9, -3, -18, 2, 16, -14, 19, -16, 10, -7, 5, 3, 5, -19, -50, -69, -42, 4, 14, -59, 9, 11, 14, -35, 3, -7, 15, -20, -64, -9, 16, 46, 7, -45, -26, 24, -75, -32, -8, -16, 43, -46, -48, 26, -49, -43, -55, 1, 10, -72, -53, 13, -62, 17, -38, -24, -25, 5, -59, -47, -24, -38, -7, -11, -13, -9, -21, -9, -16, -48, 16, -70, -2, -5, 35, 11, -45, -42, -51, -50, -20, -18, 28, -71, 14, -47, 12, -40, -33, 14, 3, 0, -1, 10, 9, 41, -31, 24, -16, -1, 1, -55, 5, -35, -18, -2, 31, -3, -28, -28, -36, -17, -16, -71, -19, -10, -31, 0, -21, 5, 32, -36, -29, 42, -7, -23, 7, -6, 8, 6, 1, 0, -42, 0, -53, -34, 12, 8, 18, -11, -48, 30, 25, 4, -23, -6, -14, 19, 18, -13, -14, -20, -6, -8, -4, -70, -35, 16, 12, 28, -36, -33, -44, -40, 2, 16, -4, 9, 26, 4, -26, -35, -24, 28, 17, 14, -11, -28, -62, 11, -37, 3, 3, -43, 35, -12, 36, -5, 17, 1, -30, -8, -32, -16, -60, -10, -34, -6, -20, -27, -12, -29, 23, -28, -31, 34, 3, -81, -25, 18, 2, 32, -1, 39, -7, -28, -12, 11, -27, -29, -35, -2, 18, 16, -12, -3, -1, 6, -57, -22, 0, 3, -21, 15, -39, -26, -64, 8, 8, 11, 6, -14, -8, 3, -25, -7, -39, -47, 16, 12, 70, -10, -18, 30, 2, -15, 23, 8, -42, -6, -41, -3, -13, 2, -53, -9, -68, -35, -46, -18, 16, -53, -1, -21, 16, 14, -2, -10, -98, 18, 6, 18, -17, -1, -2, -5, 8, 66, -30, -17, -4, 4, -4, -32, -2, -6, -17, 40, -6, -30, -71, -32, -3, -13, -27, -2, 29, 10, -11, -9, 15, -5, -6, -65, 6, 19, -47, 33, -32, -23, -23, 14, 51, 9, -14, -14, 13, 4, -17, 25, 16, 13, -21, 17, 8, -28, 10, -23, 58, 27, -22, 10, 7, -46, 22, -20, 6, 11, -7, 31, 5, -10, -38, -18, -108, -67, -60, 28, 1, 27, 5, 7, 0, -14, 18, 25, -28, 1, -42, -85, -53, -28, -6, -2, 11, -60, -5, -16, 20, 16, 5, -14, -69, -7, -10, -16, -7, -32, -1, 79, -28, 65, 3, -28, -21, -28, -32, 7, -13, -89, -3, -21, 68, 37, -24, 3, 26, 44, 7, 9, 38, 1, 2, 47, -17, -5, -42, -37, -76, -10, -76, -34, -14, 20, -3, 7, -23, -13, 26, 31, -21, -24, -16, 17, -23, -28, -3, 14, -39, -5, 4, -5, 25, -9, -31, -75, -23, -6, 1, -7, -21, 12, -62, 61, -48, 66, 26, 5, -17, -18, -9, -7, 45, -55, 46, 0, 28, 30, -10, 50, -60, 19, -6, 21, 30, 12, -75, 33, 6, 36, -39, -44, -61, -5, -41, -29, -13, 10, 11, 25, 61, 40, -14, 27, 3, 4, 7, -3, -25, 2, -9, -36, 6, -107, 11, 10, -6, 19, 36, 41, -51, -22, -40, -27, 2, 12, -26, 0, -8, 33, 5, 1, 6, -10, -40, -17, 30, -9, -12, -49, 4, -52, -7, -32, 4, 59, -35, -4, 16, -22, -16, 6, 43, -51, 50, -12, 24, -39, -43, 33, 15, -42, 33, -65, -11, -70, -29, -27, 32, 25, 6, 22, -94, 21, -13, -51, 38, -53, -6, -10, -27, 6, 18, 5, -58, -22, -7, -33, -49, 19, 0, -6, -42, 13, -31, 7, -22, -23, 2, 21, -23, -32, -48, 27, -16, -24, -11, -48, 31, -9, -61, -12, 6, -36, 2, -4, 9, -55, -8, -4, -24, -17, -2, 10, 6, -15, 0, -38, -6, -7, 19, -31, 10, 27, 14, -4, -33, -8, 8, -35, -5, -2, -24, 5, -33, 16, 2, -17, -41, -6, -21, -39, 31, 17, -8, -6, -7, 25, -8, 13, 7, -13, -14, -20, 15, -44, -49, -30, -30, -38, 9, -54, 23, 54, -3, -19, -10, -34, -17, -46, -16, -29, -23, -37, -21, -32, -15, -3, -11, -7, -66, 13, -34, -10, 6, -16, -30, 0, 13, -3, -3, -13, 16, -29, 15, 11, -34, -8, 6, -6, 29, 17, -12, -23, -4, 1, 9, 25, -11, -25, -46, -33, 36, 5, -33, -11, 0, -18, 27, 16, -38, -8, -34, -35, -1, 31, -34, -24, -11, 9, -20, 28, -41, -22, 27, 1, -16, -25, -20, -20, 8, -2, -40, 27, -23, 10, -3, -8, 17, -7, 1, 12, -73, -2, -1, -1, 1, -4, 23, -11, 0, -31, 25, 6, 6, 17, -7, 3, -11, 13, 5, -15, 12, -33, -22, -51, 30, -20, 25, 20, 14, -29, 14, 30, 19, 36, -33, -10, -7, -3, 30, -16, -10, -29, -33, 1, -3, -10, -5, 4, -22, 3, 3, -24, -4, 1, -54, 13, -7, 19, 0, -6, 25, 15, -4, -3, 9, -15, -2, -40, 25, -14, 15, -27, 27, -8, 25, 35, -23, 49, -7, 17, 6, 26, 26, -27, -6, -65, 5, -47, 21, -17, 42, 19, 10, 1, 4, 30, -7, 5, -24, 2, -23, -2, -25, 3, -18, -34, -66, 6, 20, 5, -8, -7, -17, 4, 22, -16, -6, -6, -2, 17, -7, 2, -17, 20, 26, 20, -3, 2, -14, 9, 3, -15, 23, 9, -53, -4, -34, -26, -21, -11, 30, -31, -1, -60, 1, -67, -18, -16, -5, -38, -44, -25, -42, -65, 3, -14, -12, 33, -78, -22, -62, -26, -21, -56, 2, -65, -56, 11, -48, -42, -6, -51, -19, -12, -42, 9, 36, 26, 15, -37, -4, -34, -127, -17, -16, -52, -8, 4, -27, -13, -45, -26, -19, -13, -17, -2, -16, 1, -42, 65, -68, -48, -48, -16, -47, -25, 60, -57, 21, -47, 2, -17, 10, -23, 11, -18, -71, -31, -30, -106, -3, 33, -58, -3, 18, -25, -14, -60, 11, -18, -4, -4, -25, -44, -30, 17, -29, -1, -46, -25, -6, 41, 3, -8, -39, 29, -30, 11, 54, -46, -23, -7, -94, -68, -19, -105, -64, -28, -16, -26, -22, -1, -18, 54, 7, -45, 31, -45, -24, 26, 45, -19, -5, -91, 31, 7, -26, 7, -16, 7, -89, -46, -43, -125, 5, 21, -28, 6, -9, -20, 12, -24, -7, -17, 11, -31, -4, -14, -17, 50, -17, -15, -70, 15, -35, 47, -16, 3, -23, -3, -3, -29, 51, -33, -61, -1, -35, -46, 9, 6, -87, -32, -15, -14, -23, -2, -2, -32, 5, -17, 22, -37, 19, -4, -16, -38, -11, 13, -17, -49, -2, 7, 9, 27, -11, 0, -6, -16, -35, -11, -66, -30, 18, -8, -33, 42, -38, 14, -8, -19, -12, -4, 21, -38, -32, 36, 21, -10, 4, 6, -10, -15, 31, 7, -16, -44, -1, 1, 17, -38, -25, 18, -25, 44, 26, -37, -37, 18, 17, -21, 13, -31, 21, 16, 33, -54, 50, 16, -12, -18, -12, -3, -56, -16, -33, 6, -8, 25, -20, 6, -9, -5, -11, -41, -30, -41, -9, -30, -32, 31, -9, 5, -63, -19, 2, 17, 12, -41, -26, 5, -13, -40, -5, -85, -74, -25, -28, -12, 11, -55, -20, -22, -39, -91, -32, 3, -6, 41, 14, -30, -41, -13, -59, -32, 4, -74, -13, -27, 43, -125, 20, 12, -25, 28, -19, -40, -68, -41, -11, 21, -29, -5, -45, 16, -13, -15, 2, -39, -90, -27, -4, 13, 28, 2, 4, 47, 3, -32, -65, 0, 7, -46, -70, 11, 9, -34, 13, -79, -12, -31, 21, 13, 3, -81, -22, -62, -85, -75, 10, -12, -14, 26, 2, -13, -23, -37, -97, 19, 29, -1, -2, -12, -6, 18, 21, -14, 19, -45, -21, -4, -16, 11, 15, -2, -25, -17, -14, -12, 40, 16, 17, -12, -11, 12, -20, -37, 9, -12, -9, -21, 9, 13, 0, 17, 25, 27, -30, 10, -48, -38, 13, -22, -16, 11, -1, 14, 25, 13, -11, -20, -3, 12, 13, 1, -26, -74, -13, -9, 2, -5, 13, 40, 62, 9, -21, -6, 16, -7, 40, -28, 8, -34, -14, 4, 5, -16, -19, 10, -31, -12, 35, -10, 15, 13, 1, -47, -7, -6, -20, -13, 3, -39, -14, 16, 15, 14, -27, 14, -29, 14, -55, -20, 4, 7, 14, -38, -32, -34, -18, -11, 0, 6, -31, -24, -19, 17, 44, 2, -13, 25, -6, -19, 27, -32, -8, 37, 53, -15, 5, -10, 41, 15, 2, -34, -17, -19, 21, -2, -15, 40, 6, 19, -19, -47, 1, 4, 2, 16, -5, -46, 24, -15, -12, 21, 14, 5, 3, -9, 9, -44, -41, -13, -60, 16, -48, -41, 7, 41, -19, -50, 9, -10, -3, -36, 7, -11, -3, 20, 0, -31, 26, 0, 20, -1, -22, -27, -47, 6, -21, -71, -39, -29, -58, -25, -61, 17, -46, -56, -14, 31, -25, 5, 2, 21, 0, 1, -70, -36, 23, 12, 44, 0, 29, -25, -22, 19, -32, -12, -10, -44, 52, -57, 2, 28, 8, -21, 7, 2, -68, -23, -18, -6, 8, -44, -27, -54, -12, 14, -50, 31, -6, -39, -47, 28, -21, 5, -73, -18, 1, -23, -25, -32, -59, -52, 26, -2, -74, -46, 15, 18, 12, -42, -38, -18, 24, 31, -2, 5, 18, 2, -12, -18, 37, 14, 9, -16, 6, -29, -5, 19, -19, -4, -8, -84, -1, -66, 22, -9, -11, -14, 24, -15, 12, 12, 9, 10, 2, -23, -43, -69, -7, 15, -17, 28, -3, 10, -22, -9, -11, 2, 33, -81, -37, 7, -18, -9, -6, -20, 39, 17, -42, 8, -11, -127, -16, -38, -47, -38, 21, 5, 5, 52, 5, 24, -10, -81, 25, -8, 20, -5, 28, -40, 9, -44, -9, -14, -25, -66, 23, -30, -14, 4, -10, -39, 21, -52, 28, 12, -37, -10, -1, 1, -9, -38, -39, -64, -20, -68, 1, 8, 20, 18, 13, 19, 27, -40, -54, 17, -82, 7, 21, 26, -12, 0, -42, -11, -7, 8, -115, 11, 36, -100, 1, -62, -25, 23, -11, 10, -25, 6, 9, 11, 19, -8, 16, 22, -5, -23, 3, 7, 3, 16, 0, -35, 5, 3, 15, 19, -40, -35, -4, -49, 1, -7, 18, -23, 4, -1, -7, 9, 47, -16, 41, 15, 22, 13, 1, -13, -52, -6, 18, 13, -2, 12, -11, 41, 9, 3, 16, -46, -33, -6, -54, 10, 23, -2, -8, -38, 35, 4, -33, -67, -5, -6, -15, -40, 15, -9, -3, -13, -1, -18, -2, 12, -7, 37, -29, -6, -4, -22, -3, -10, -29, -13, -2, 27, -36, -27, -44, -37, -8, 1, -49, 44, 44, 12, 38, 19, 30, -24, 44, 15, -9, -23, 8, -6, 29, -66, 22, -11, 18, -7, -5, -13, -56, -2, -59, -8, 48, -32, 48, 25, -45, -15, 13, -43, -4, 47, -34, -61, 10, -31, -32, -43, -2, -4, -23, 6, 14, 6, 30, 18, 16, -127, -26, -2, -45, 35, 1, 29, -60, 16, -28, -50, 37, -12, -21, 52, 53, -26, 10, 17, 13, -49, 6, 25, 8, -17, -46, 31, 15, -48, -9, 37, -37, 13, -64, -37, -90, 25, -28, -15, 27, -14, -9, -35, -29, -3, -8, -1, -26, 15, 21, -2, -8, 20, 9, 15, -30, -11, 7, -21, -46, -37, -27, 13, -14, -12, -17, -18, -39, 26, -42, -48, 26, 5, -5, -10, -10, -19, -6, 7, 3, 2, 63, 28, 29, 15, 31, -22, -22, 9, 4, 2, 31, -59, 1, 19, -7, -6, -1, -45, -12, 29, 33, -11, 15, -11, -27, -11, 14, -9, 0, -24, -2, 13, 24, 0, 5, 11, -6, 28, -17, -9, -26, -14, -21, -3, -4, -2, 16, 18, -13, -14, -50, -1, -51, -44, -21, -4, 11, -20, -30, 4, 7, 26, 28, -23, 17, 10, 1, -3, 24, -1, -1, -37, 11, -15, 37, -61, -7, 31, 7, -37, 0, -6, -32, -17, 31, -6, 7, -27, 15, 21, -53, -14, -7, -18, -19, 22, -41, -25, -17, -49, -1, -35, -56, -40, -45, -6, 2, 14, -30, -11, 5, -6, -19, -1, -38, 13, -18, -10, 12, -25, -7, -55, -7, 5, -18, -12, 30, 0, -7, -1, 21, -57, 28, -8, 10, -16, 13, 4, 5, 9, -7, 52, -33, 21, -55, 9, -41, 18, -20, 1, 35, -14, 12, -18, 5, -2, -10, -20, -50, -9, 38, -87, -14, -11, -84, 26, -50, 11, -17, -49, -66, -35, -45, -18, -47, -38, 2, -29, -26, 22, -88, -20, -27, 4, -21, -17, -33, -90, -5, -39, 1, 10, -41, -42, -29, 13, -41, -21, -2, -41, -13, 1, 22, 6, -38, -51, 8, -67, -2, -44, 6, 53, -22, 39, 4, 38, -4, -35, 25, 5, 11, -17, -16, -39, 30, -72, 7, 29, -58, 8, 8, -18, -51, 23, -37, 31, -3, 30, 11, -10, 6, 30, -46, 0, -13, -50, 33, -9, -19, -53, -3, -1, 7, -54, 43, 37, 18, -24, -28, -8, 9, -10, 28, 12, -13, 17, 1, 16, -14, -60, 18, -92, 7, -27, 55, 41, -35, -7, -46, 28, 32, -34, -17, 33, -4, -5, 10, -39, 35, -73, 32, 9, -69, -41, -13, -38, -35, 27, -22, 10, -77, -2, 20, 19, 19, 28, -18, 15, -21, -16, 4, 4, -45, -65, 23, 5, -31, -99, 15, -15, -58, 13, 1, 26, 4, 12, -7, 11, -92, 15, 38, 5, 0, -30, 21, -25, 17, -6, -81, 29, -5, 12, -30, -51, -7, 2, 3, 9, -10, -6, -11, 21, 13, 15, 8, 15, -10, -22, 14, 9, -63, 19, -10, -49, -9, -23, 13, 22, 19, 3, 0, 13, -12, 10, 18, -2, -29, -37, -16, -9, -82, 3, -6, -7, -3, 1, 4, -20, 8, -9, 19, -22, 6, 14, -17, -11, -6, -44, -8, -51, -13, 4, -25, -72, 31, 23, -46, -16, -43, -14, 22, -42, -18, -2, 7, -21, -4, 8, 1, 21, 0, 23, -25, -21, -48, 20, -21, -27, 0, 7, -9, -13, -17, 23, 4, -40, 7, -4, -1, -9, 8, -7, 20, 28, 11, 2, -3, -22, 23, -19, 4, -4, -7, -15, 3, -7, 7, -58, -32, 18, -1, -20, -38, -52, -3, 3, -31, -36, 7, 12, -20, -11, -94, 5, -27, -72, 4, -3, -14, 2, 5, 7, -7, 2, 5, -54, -57, -40, 5, 2, -52, 9, -5, 9, -1, -32, -78, -24, 16, -19, 7, -17, 18, -47, -8, 2, 7, 8, 11, -10, -8, -30, 3, -18, -12, -47, 10, -33, -55, 13, 11, 7, 25, 13, 6, 18, 9, 4, 23, -22, -8, 14, -55, -1, 7, 13, 4, -7, 3, 28, 16, -46, -12, -18, -16, -91, 4, -1, -27, 18, 11, 7, -11, -31, -22, 33, 0, 16, -23, -1, -39, -56, -43, 22, 16, 1, 8, -10, -36, -4, 0, -26, -17, 20, -4, 34, 7, 18, 11, 1, -24, -18, -7, 5, -3, -9, 11, -16, 19, 9, 15, -24, 14, -37, -26, 10, -48, 2, -2, 19, 16, -28, -5, 42, -5, -72, -19, 21, -37, -65, -13, 11, -9, -1, 12, 2, -21, -2, -25, 2, -40, -8, 2, -10, -14, -33, -4, 10, 4, -5, -58, -5, -39, 15, -14, 1, -6, -12, -2, 17, -1, -1, 7, 6, -25, 3, 21, -49, -13, -12, -5, -26, 19, 21, -5, 38, 10, 16, -24, -30, 19, 0, -13, -2, -19, -17, 1, 42, -6, -44, -24, 20, -28, -43, -16, 17, 9, -20, 8, -48, -13, -4, -9, -7, -16, -1, 1, -16, -41, -28, 30, -26, -24, 11, -2, 16, -28, 31, -8, -6, -13, -5, 8, -11, 28, 1, 14, -2, -55, 20, 20, 1, 10, 20, -18, 13, 18, 6, -24, 2, 19, -50, -27, 11, 1, -21, 18, -20, -14, 9, 12, -28, -23, -4, 18, -4, 12, 5, -8, -9, -12, 3, -37, -9, -9, -20, 3, -13, 19, 23, -17, -17, 8, 8, 10, -25, 10, -29, 17, -40, -32, -10, -11, -53, 14, -20, 34, 29, -19, -15, -20, -11, -17, -46, -40, 4, 8, 13, 5, -23, -7, -9, 6, 12, 3, -54, -4, -4, -28, -41, 9, 9, -27, 10, 3, -20, 5, -1, 17, 32, -8, -5, -18, -64, 5, 18, -31, -44, 3, -60, -32, 4, 9, 24, -50, 9, 20, -22, -30, -3, 8, -6, 28, -76, -4, -17, -6, -57, 28, 18, 8, -1, 1, 9, 4, -3, -12, -55, -15, 33, -5, 4, -3, 20, -17, -4, 4, 8, -17, -14, -1, -18, -18, 14, 47, -15, 14, -20, 0, 3, 13, 10, 8, 7, 32, 10, -39, -127, -8, 21, -62, -29, -16, -29, -30, 19, -30, 32, -35, -20, 39, -14, -41, -24, 10, 7, 9, -29, -60, -16, -7, -37, 30, 31, 32, 37, -19, -22, -5, -25, -11, -99, -20, 20, -54, 15, 0, -21, -28 };
+static const int32_t conv6_b[64] = { 16, -6, 42, -48, -13, -18, 26, -9, -29, 14, -51, -10, -39, 0, -56, -6, 9, -7, -30, -49, 12, -15, 16, 1, -72, 9, -45, 18, 9, -51, 18, -30, 42, 20, 17, -4, 23, 12, 1, 9, -20, -17, 23, -12, -37, -5, 7, 10, -1, 25, -43, -10, 21, 17, 13, 2, -4, -1, 28, -33, -28, 6, 19, 3 };
+static const int32_t conv6_m[64] = { 1719910131, 1859538806, 1078092305, 2111765832, 1385846695, 1704002938, 1764584430, 2113233307, 1274041217, 1866659871, 2088939587, 1873910595, 1079610125, 1233572388, 1115603416, 1707063371, 2078179371, 1295224032, 1098152725, 1201211037, 1561984889, 1802511458, 1977715863, 1168337252, 1638641433, 1678834249, 1876148554, 2084160459, 1184798748, 1789249667, 1931477066, 1754968367, 1795059480, 1237450994, 1786900013, 1736525698, 1154849540, 1079499189, 1505760409, 1877075893, 1263403196, 1538645452, 2074917178, 1910594172, 1869716130, 1617385504, 1639037870, 1727009566, 1537260452, 1635445397, 1986057231, 1308584743, 2053822784, 1555246093, 1620738015, 1480072329, 1131630147, 1630993260, 1874885623, 1792457088, 1763397143, 1803031861, 1681408307, 1118716598 };
+static const uint8_t conv6_s[64] = { 38, 38, 38, 41, 38, 38, 38, 38, 37, 38, 41, 38, 40, 37, 40, 38, 38, 37, 38, 38, 38, 38, 38, 37, 38, 38, 38, 38, 37, 38, 38, 38, 38, 37, 38, 39, 38, 37, 38, 38, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 40, 37, 38, 38, 38, 38, 40, 38, 38, 38, 38, 38, 38, 37 };
+static const int8_t linear1_w[11][64] = { 78, 30, 27, 56, 77, -59, 15, -36, 79, 36, -11, 65, -46, -15, 61, 50, 47, -36, 89, -83, -63, 5, 20, 65, 46, -67, -10, -17, 26, -40, -64, 60, -127, 33, -45, -102, -24, 24, -23, -62, -80, -21, 79, 29, 29, 69, -44, -25, -54, 120, -27, -71, 97, -11, 28, -36, -65, -95, 30, -15, -3, 12, -41, -90, 28, 66, 1, 2, 15, -87, -28, -83, 38, 16, -37, -4, -56, -17, 5, 47, -26, 8, -13, -127, -48, -87, 61, -25, 4, -7, 63, 63, 23, 78, 29, 47, -43, -81, -39, -90, -55, 13, -116, 15, -74, 12, 52, -43, -74, -41, 50, 36, 65, 7, 19, 48, 94, -1, -6, 9, -26, 16, -25, 62, 62, 102, -11, -2, 8, 24, -47, -64, -8, 18, 34, 57, 5, -39, 40, -34, -66, 41, 73, 8, 6, -44, -127, 89, -36, -74, 19, -127, -37, -10, -7, 91, -18, -27, -79, -4, -32, -46, -24, 24, -64, 12, 41, 31, 31, -6, -84, 78, 90, -25, 61, -18, -54, 21, 35, -26, -14, -41, 48, 31, 58, 4, 64, -8, 34, 23, -1, -34, -5, 29, -54, 20, -54, 30, -49, -23, 38, 0, 35, 1, -48, -26, 7, -28, -63, 51, 8, -18, 16, 46, 46, -60, -26, -40, 88, 20, -46, 60, 9, 66, -29, 46, 22, -101, -16, 63, -70, 52, 22, -27, -16, 3, 2, 1, -1, -6, -26, -14, 8, 59, -31, 73, 73, -25, -27, -6, -49, -23, 127, 46, -42, 41, -41, 51, 31, 53, 60, -59, -73, -40, 15, -13, -23, -100, -48, 51, -18, -44, 44, 97, -66, 30, -64, -58, 53, -86, -82, -37, 101, 14, 4, -7, -28, 72, -48, -90, 10, -14, -67, 20, -46, -1, 34, 17, 0, 32, -36, -111, -12, -3, -21, -6, -60, -35, 75, -73, -49, -127, 25, -54, 2, 79, 16, -63, 15, -58, -79, -51, 32, -2, 47, -67, 86, 30, -79, 2, -30, 42, 31, 27, -6, -27, 35, -50, -81, -66, -1, 42, -55, -42, 11, -2, -115, 79, 54, -127, 31, -31, 7, 48, -13, -4, 9, 19, 62, 50, -12, -84, 9, 32, 6, 40, 25, -38, 49, -57, 2, -3, -30, 18, 91, -40, -49, -46, 125, -5, -75, 25, -25, 1, -34, -86, -115, -11, -7, -56, -20, 14, -37, -46, 13, 123, 36, -32, -17, -32, -15, -31, -78, -15, -113, 34, -23, 73, 95, 18, 80, -39, 68, -90, 62, 36, -60, -61, -49, 70, -10, -86, 67, 53, -107, -13, -19, -127, -39, 97, 82, -33, 64, 12, -65, 91, 9, 60, -52, -56, -10, 35, 23, 59, 23, -32, -8, 6, 17, 25, -87, -37, 52, 77, -3, 39, -16, 76, 49, -53, 55, -44, -5, -14, -2, -34, 40, -39, 62, -79, 8, 32, -3, -62, 127, 43, -6, -32, 51, -18, 6, -79, 113, -50, 62, -67, 75, 6, 6, -46, 69, -20, 27, 11, 59, 1, -37, -31, 39, 23, -90, 12, 31, 42, 31, 45, -1, -14, 98, 39, -29, -21, -51, 34, -60, 2, -31, -22, 33, -61, 55, -18, -33, -79, 23, 7, 40, 15, -27, -18, -106, 82, -119, -42, 43, -5, -58, 41, 11, -122, 9, 71, -6, -49, 4, -34, 127, -86, 106, -57, -21, 17, 55, 52, -22, -88, 2, -40, -52, -21, 13, 86, -39, -92, -73, 53, -62, 37, 38, 8, -23, -17, 24, -106, -8, -48, 1, -97, 48, -38, 0, 127, 41, -60, -44, -6, 2, -70, -28, -28, 52, 31, 13, 64, 45, 4, -28, -90, -4, 19, -38, 23, 3, -28, 55, -13, 5, -77, 87, -72, -73, 76, -98, 41, -31, 42, -40, -32, -115, 4, -46, -13, -16, -18, 79, 33, -1, -65, 9, -1, 27, 12, -5, -106, 11, -20, -60, -91, 36, 55, -73, 47, 26, 4, 29, 65, 12, 30, 11, 48, 43, 44, -53, 41, -4, 35, 10, -15, 77, 18, -47, 94, -23, 98, 47, 23, 53, 26, 24, 19, 3, 127, -26, -2, 9, 123, -76, 77, -12, -49, -22, 27, 55, -32, 26, -52, 71, -17, -46, -56, -29, -60, -39, -96, 34, -38, 15, -75, 37, -65, -112, 40, 9, 12 };
+static const int32_t linear1_b[11] = { -5735, -4068, -1158, 1244, 2798, 1240, 3272, -5578, 6725, 2337, -6669 };
+// logit = acc * linear1_scale
+static const float linear1_scale[11] = { 6.7682778e-05f, 6.83329195e-05f, 5.82547654e-05f, 8.85341718e-05f, 6.94826333e-05f, 5.91876487e-05f, 6.48473278e-05f, 8.04707216e-05f, 7.64312476e-05f, 6.6711634e-05f, 7.30709067e-05f };
@@ -0,0 +1,183 @@
+#include "melspec.h"
+#include <math.h>
+
+static const int Q15 = 15;
+static const int32_t FFT_HEADROOM = 1 << 14;
+static const int64_t DB_PER_LOG2_Q16 = 197283; // 10 * log10(2) in Q16
+
+// log2(x) in Q16 for x > 0
+static int32_t log2Q16(uint64_t x) {
+    int e = 63 - __builtin_clzll(x);
+    // mantissa in [1, 2) as Q30
+    uint32_t m = e >= 30 ? (uint32_t)(x >> (e - 30)) : (uint32_t)(x << (30 - e));
+    int32_t frac = 0;
+    for (int i = 0; i < 16; i++) {
+        m = (uint32_t)(((uint64_t)m * m) >> 30);
+        frac <<= 1;
+        if (m >= (2u << 30)) {
+            m >>= 1;
+            frac |= 1;
+        }
+    }
+    return (e << 16) | frac;
+}
+
+static float hzToMel(float f) { return 2595.0f * log10f(1.0f + f / 700.0f); }
+static float melToHz(float m) { return 700.0f * (powf(10.0f, m / 2595.0f) - 1.0f); }
+
+void LogMelExtractor::begin() {
+    // periodic Hann window, as torch.hann_window
+    for (int i = 0; i < MEL_WIN; i++) {
+        window[i] = (int16_t)lroundf(32767.0f * (0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / MEL_WIN)));
+    }
+    for (int k = 0; k < MEL_WIN; k++) {
+        cosTable[k] = (int16_t)lroundf(32767.0f * cosf(2.0f * (float)M_PI * k / MEL_WIN));
+        sinTable[k] = (int16_t)lroundf(32767.0f * sinf(2.0f * (float)M_PI * k / MEL_WIN));
+    }
+
+    // HTK triangular filters, unnormalised, on torchaudio's 201 bins
+    float fPts[MEL_BINS + 2];
+    float melMax = hzToMel(MEL_SAMPLE_RATE / 2.0f);
+    for (int i = 0; i < MEL_BINS + 2; i++) {
+        fPts[i] = melToHz(melMax * i / (MEL_BINS + 1));
+    }
+    int offset = 0;
+    for (int m = 0; m < MEL_BINS; m++) {
+        melOffset[m] = offset;
+        melStart[m] = 0;
+        melLen[m] = 0;
+        for (int k = 0; k < MEL_N_BINS; k++) {
+            float f = (float)k * MEL_SAMPLE_RATE / MEL_WIN;
+            float up = (f - fPts[m]) / (fPts[m + 1] - fPts[m]);
+            float down = (fPts[m + 2] - f) / (fPts[m + 2] - fPts[m + 1]);
+            float w = fminf(up, down);
+            if (w <= 0.0f) continue;
+            int16_t q = (int16_t)lroundf(32767.0f * w);
+            if (q == 0) continue;
+            if (melLen[m] == 0) melStart[m] = k;
+            // bins between start and k that fell to zero keep their slot
+            while (melStart[m] + melLen[m] < k) {
+                melWeights[offset++] = 0;
+                melLen[m]++;
+            }
+            melWeights[offset++] = q;
+            melLen[m]++;
+        }
+    }
+}
+
+// DFT of `frame` into `power` for bins 0..MEL_N_BINS-1, as the true
+// transform divided by 512: 16 from the >> 1 per radix-2 stage and 32
+// after the 25-point sums, which keeps power within 32 bits.
+void LogMelExtractor::dft() {
+    // n = 25 n1 + n2: a 16-point FFT over n1 for every n2, then twiddled
+    for (int n2 = 0; n2 < MEL_FFT_N2; n2++) {
+        int32_t *r = &re[n2 * MEL_FFT_N1];
+        int32_t *i = &im[n2 * MEL_FFT_N1];
+        for (int n1 = 0; n1 < MEL_FFT_N1; n1++) {
+            // 4-bit reversal, so the butterflies below run in place
+            int rev = ((n1 & 1) << 3) | ((n1 & 2) << 1) | ((n1 & 4) >> 1) | ((n1 & 8) >> 3);
+            r[rev] = frame[MEL_FFT_N2 * n1 + n2];
+            i[rev] = 0;
+        }
+        for (int half = 1; half < MEL_FFT_N1; half <<= 1) {
+            int step = MEL_WIN / (half << 1); // W16^(k * 8 / half) on the 400-entry table
+            for (int start = 0; start < MEL_FFT_N1; start += half << 1) {
+                for (int k = 0; k < half; k++) {
+                    int32_t c = cosTable[k * step];
+                    int32_t s = sinTable[k * step];
+                    int a = start + k;
+                    int b = a + half;
+                    int32_t tr = (r[b] * c + i[b] * s) >> Q15;
+                    int32_t ti = (i[b] * c - r[b] * s) >> Q15;
+                    r[b] = (r[a] - tr) >> 1;
+                    i[b] = (i[a] - ti) >> 1;
+                    r[a] = (r[a] + tr) >> 1;
+                    i[a] = (i[a] + ti) >> 1;
+                }
+            }
+        }
+        for (int k1 = 1; k1 < MEL_FFT_N1; k1++) {
+            int32_t c = cosTable[n2 * k1];
+            int32_t s = sinTable[n2 * k1];
+            int32_t tr = (r[k1] * c + i[k1] * s) >> Q15;
+            i[k1] = (i[k1] * c - r[k1] * s) >> Q15;
+            r[k1] = tr;
+        }
+    }
+    // k = k1 + 16 k2: a 25-point DFT over n2, only for the bins needed
+    for (int k = 0; k < MEL_N_BINS; k++) {
+        int k1 = k % MEL_FFT_N1;
+        int k2 = k / MEL_FFT_N1;
+        int32_t sumRe = 0, sumIm = 0;
+        int t = 0; // MEL_FFT_N1 * n2 * k2 mod MEL_WIN
+        for (int n2 = 0; n2 < MEL_FFT_N2; n2++) {
+            int32_t yr = re[n2 * MEL_FFT_N1 + k1];
+            int32_t yi = im[n2 * MEL_FFT_N1 + k1];
+            sumRe += (yr * cosTable[t] + yi * sinTable[t]) >> Q15;
+            sumIm += (yi * cosTable[t] - yr * sinTable[t]) >> Q15;
+            t += MEL_FFT_N1 * k2;
+            if (t >= MEL_WIN) t -= MEL_WIN;
+        }
+        sumRe >>= 5;
+        sumIm >>= 5;
+        power[k] = (uint32_t)(sumRe * sumRe) + (uint32_t)(sumIm * sumIm);
+    }
+}
+
+// Fills `power` for one frame and returns the block exponent applied to it.
+int LogMelExtractor::computeFrame(const int16_t *pcm, int length, int padLeft, int t) {
+    int32_t maxAbs = 0;
+    for (int i = 0; i < MEL_WIN; i++) {
+        // torchaudio centres frames with reflect padding of MEL_WIN / 2
+        int idx = t * MEL_HOP + i - MEL_WIN / 2;
+        if (idx < 0) idx = -idx;
+        if (idx >= MEL_TARGET_LEN) idx = 2 * (MEL_TARGET_LEN - 1) - idx;
+        idx -= padLeft;
+        int32_t s = (idx >= 0 && idx < length) ? pcm[idx] : 0;
+        frame[i] = (s * window[i]) >> Q15;
+        int32_t a = frame[i] < 0 ? -frame[i] : frame[i];
+        if (a > maxAbs) maxAbs = a;
+    }
+
+    // block floating point: use the full headroom for quiet frames
+    int norm = 0;
+    if (maxAbs >= FFT_HEADROOM) {
+        norm = -1;
+    } else if (maxAbs > 0) {
+        while ((maxAbs << (norm + 1)) < FFT_HEADROOM) norm++;
+    }
+    for (int i = 0; i < MEL_WIN; i++) {
+        frame[i] = norm >= 0 ? frame[i] << norm : frame[i] >> -norm;
+    }
+
+    dft();
+    return norm;
+}
+
+void LogMelExtractor::compute(const int16_t *pcm, int length, uint8_t *out) {
+    if (length > MEL_TARGET_LEN) length = MEL_TARGET_LEN;
+    int padLeft = (MEL_TARGET_LEN - length) / 2;
+
+    for (int t = 0; t < MEL_FRAMES; t++) {
+        int norm = computeFrame(pcm, length, padLeft, t);
+        // |X|^2 = power * 2^(-12 - 2 norm), filter weights are Q15
+        int32_t shiftQ16 = (27 + 2 * norm) << 16;
+        for (int m = 0; m < MEL_BINS; m++) {
+            uint64_t acc = 0;
+            const int16_t *w = &melWeights[melOffset[m]];
+            for (int k = 0; k < melLen[m]; k++) {
+                acc += (uint64_t)power[melStart[m] + k] * (uint16_t)w[k];
+            }
+            int32_t q = 0;
+            if (acc > 0) {
+                int64_t db = ((int64_t)(log2Q16(acc) - shiftQ16) * DB_PER_LOG2_Q16) >> 16;
+                q = (int32_t)((db - (int64_t)MEL_DB_MIN * 65536 + MEL_DB_STEP_Q16 / 2) /
+                              MEL_DB_STEP_Q16);
+                if (q < 1) q = 1;
+                if (q > 255) q = 255;
+            }
+            out[m * MEL_FRAMES + t] = (uint8_t)q;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef MELSPEC_H
+#define MELSPEC_H
+
+#include <stdint.h>
+
+// Log-mel front end matching the Ultra96 preprocessing
+// (torchaudio MelSpectrogram(sample_rate=8000, n_mels=64) + AmplitudeToDB).
+// Only depends on <stdint.h>/<math.h> so it also builds on the host.
+#define MEL_SAMPLE_RATE 8000
+#define MEL_TARGET_LEN 16000 // waveforms are centre padded to this length
+#define MEL_WIN 400          // torchaudio n_fft / win_length
+#define MEL_HOP 200
+// The 400-point DFT is split as 16 x 25: 25 radix-2 16-point FFTs, then
+// 25-point DFTs for the MEL_N_BINS outputs, so the bins are exactly
+// torchaudio's.
+#define MEL_FFT_N1 16
+#define MEL_FFT_N2 25
+#define MEL_N_BINS (MEL_WIN / 2 + 1)
+#define MEL_BINS 64
+#define MEL_FRAMES (MEL_TARGET_LEN / MEL_HOP + 1)
+
+// 8-bit feature quantisation: dB = MEL_DB_MIN + q * MEL_DB_STEP_Q16 / 65536.
+// q = 0 is reserved for digital silence, which AmplitudeToDB maps to -100 dB.
+#define MEL_DB_MIN (-80)
+#define MEL_DB_STEP_Q16 32768 // 0.5 dB
+
+class LogMelExtractor {
+public:
+    // Builds the window, twiddle and filterbank tables. Call once.
+    void begin();
+    // Writes MEL_BINS x MEL_FRAMES quantised log-mel values, mel-major
+    // (the same row-major [64][81] layout cnn_accel streams in).
+    void compute(const int16_t *pcm, int length, uint8_t *out);
+
+private:
+    int16_t window[MEL_WIN];
+    int16_t cosTable[MEL_WIN]; // e^(-2 pi i k / MEL_WIN), Q15
+    int16_t sinTable[MEL_WIN];
+
+    // sparse filterbank: filter m covers bins [melStart, melStart + melLen)
+    int16_t melWeights[2 * MEL_N_BINS];
+    uint16_t melOffset[MEL_BINS];
+    uint16_t melStart[MEL_BINS];
+    uint16_t melLen[MEL_BINS];
+
+    int32_t frame[MEL_WIN];
+    int32_t re[MEL_WIN]; // 16-point transforms, [n2][k1]
+    int32_t im[MEL_WIN];
+    uint32_t power[MEL_N_BINS];
+
+    void dft();
+    int computeFrame(const int16_t *pcm, int length, int padLeft, int t);
+};
+
+#endif
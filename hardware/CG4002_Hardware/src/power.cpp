@@ -0,0 +1,129 @@
+#include "power.h"
+#include "helpers.h"
+#include "Logger.hpp"
+#include "driver/gpio.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_wifi.h"
+#include "hal/gpio_ll.h"
+
+static const int WAKE_PINS[] = {BUTTON_SELECT, BUTTON_DELETE, BUTTON_MOVE, BUTTON_ROTATE,
+                                BUTTON_SCREENSHOT};
+
+static esp_pm_lock_handle_t awakeLock = NULL; // held while active
+static esp_pm_lock_handle_t cpuLock = NULL;   // FUSION_CYCLE_BUDGET assumes 240 MHz
+static volatile bool idle = false;
+static volatile uint32_t wakeUs = 0; // non-zero while a wakeup waits for its publish
+static uint32_t stateSinceMs = 0;
+static PowerStats stats = {0, 0, 0, 0, 0, 0, false};
+
+static void IRAM_ATTR buttonWake() {
+    // the wake sources are level triggered, so mask them until UiTask runs
+    for (int pin : WAKE_PINS) gpio_ll_intr_disable(&GPIO, (gpio_num_t)pin);
+    if (wakeUs == 0) wakeUs = micros() | 1;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(taskStats[TASK_UI].handle, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+static void configureSleep(bool lightSleep) {
+    esp_pm_config_esp32_t pm = {};
+    pm.max_freq_mhz = 240;
+    pm.min_freq_mhz = 80;
+    pm.light_sleep_enable = lightSleep;
+    stats.lightSleep = esp_pm_configure(&pm) == ESP_OK && lightSleep;
+}
+
+void powerInit() {
+    esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "active", &awakeLock);
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "active", &cpuLock);
+    if (awakeLock) esp_pm_lock_acquire(awakeLock);
+    if (cpuLock) esp_pm_lock_acquire(cpuLock);
+#ifdef ALWAYS_ON_MIC
+    configureSleep(false); // light sleep would stall the I2S DMA
+#else
+    configureSleep(true);
+    if (!stats.lightSleep) {
+        LOG_WARN("automatic light sleep unavailable, idling in modem sleep only");
+    }
+#endif
+    esp_sleep_enable_gpio_wakeup();
+    stateSinceMs = millis();
+}
+
+void powerEnterIdle() {
+    if (idle) return;
+    uint32_t now = millis();
+    stats.activeMs += now - stateSinceMs;
+    stateSinceMs = now;
+
+    imuSuspend();
+#ifndef ALWAYS_ON_MIC
+    i2s_stop(I2S_NUM_0);
+#endif
+    esp_wifi_set_ps(WIFI_PS_MIN_MODEM); // stays associated, wakes for DTIM beacons
+    wakeUs = 0;
+    idle = true;
+    for (int pin : WAKE_PINS) {
+        attachInterrupt(digitalPinToInterrupt(pin), buttonWake, ONLOW);
+        gpio_wakeup_enable((gpio_num_t)pin, GPIO_INTR_LOW_LEVEL);
+    }
+    if (cpuLock) esp_pm_lock_release(cpuLock);
+    if (awakeLock) esp_pm_lock_release(awakeLock);
+}
+
+void powerExitIdle(bool timed) {
+    if (!idle) return;
+    if (awakeLock) esp_pm_lock_acquire(awakeLock);
+    if (cpuLock) esp_pm_lock_acquire(cpuLock);
+    for (int pin : WAKE_PINS) {
+        gpio_wakeup_disable((gpio_num_t)pin);
+        detachInterrupt(digitalPinToInterrupt(pin));
+    }
+    esp_wifi_set_ps(WIFI_PS_NONE);
+#ifndef ALWAYS_ON_MIC
+    i2s_start(I2S_NUM_0);
+#endif
+    imuResume();
+
+    uint32_t now = millis();
+    stats.idleMs += now - stateSinceMs;
+    stateSinceMs = now;
+    stats.wakeups++;
+    if (!timed) wakeUs = 0;
+    idle = false;
+}
+
+bool powerIsIdle() { return idle; }
+
+void powerPublished(const char *topic) {
+    uint32_t woke = wakeUs;
+    if (woke == 0 || idle) return;
+    // clock syncs, status and voice go out on their own schedule
+    if (strcmp(topic, GESTURE_DATA) != 0 && strcmp(topic, COMMAND) != 0) return;
+    wakeUs = 0;
+    uint32_t ms = (micros() - woke) / 1000;
+    // a press that published nothing, not a slow wakeup
+    if (ms > WAKE_ANSWER_WINDOW_MS) return;
+    stats.lastWakeMs = ms;
+    if (ms > stats.maxWakeMs) stats.maxWakeMs = ms;
+    if (ms > WAKE_PUBLISH_TARGET_MS) {
+        stats.overTarget++;
+        if (stats.lightSleep) {
+            // trade the light sleep savings for wakeup latency
+            LOG_WARN("Wakeup took %u ms, turning light sleep off", ms);
+            configureSleep(false);
+        }
+    }
+}
+
+PowerStats powerStats() {
+    PowerStats s = stats;
+    uint32_t elapsed = millis() - stateSinceMs;
+    if (idle) {
+        s.idleMs += elapsed;
+    } else {
+        s.activeMs += elapsed;
+    }
+    return s;
+}
@@ -0,0 +1,31 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+
+// Time spent in each power state and how quickly the glove answers a wakeup.
+struct PowerStats {
+    uint32_t activeMs; // CPU at full speed, radio always on
+    uint32_t idleMs;   // automatic light sleep, radio in modem sleep
+    uint32_t wakeups;
+    uint32_t lastWakeMs; // button wakeup to its first gesture or command going out
+    uint32_t maxWakeMs;
+    uint32_t overTarget; // wakeups slower than WAKE_PUBLISH_TARGET_MS
+    bool lightSleep;     // false if unsupported or turned off to meet the target
+};
+
+// Enables automatic light sleep and GPIO wakeup. The glove starts active.
+void powerInit();
+// Stops the IMU and microphone, lets the radio doze and arms the buttons
+// as wake sources. Called by UiTask once nothing has happened for a while.
+void powerEnterIdle();
+// Undoes powerEnterIdle. `timed` measures the wakeup against
+// WAKE_PUBLISH_TARGET_MS; voice presses publish only after the utterance.
+void powerExitIdle(bool timed);
+bool powerIsIdle();
+// MQTTClient's sent callback. Only gesture frames and commands answer a
+// wakeup; one not answered within WAKE_ANSWER_WINDOW_MS is not measured.
+void powerPublished(const char *topic);
+PowerStats powerStats();
+
+#endif
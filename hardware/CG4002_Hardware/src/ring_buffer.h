@@ -0,0 +1,54 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free single-producer / single-consumer queue.
+// N must be a power of two; one task (or ISR) pushes, one task pops.
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert((N & (N - 1)) == 0, "RingBuffer size must be a power of two");
+
+public:
+    RingBuffer() : head(0), tail(0), dropped(0) {}
+
+    // Producer side. Returns false (and counts a drop) when full.
+    bool push(const T &item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side.
+    bool pop(T &item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: discards everything queued so far.
+    void flush() { tail.store(head.load(std::memory_order_acquire), std::memory_order_release); }
+
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    size_t capacity() const { return N; }
+    uint32_t drops() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    T items[N];
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+    std::atomic<uint32_t> dropped;
+};
+
+#endif
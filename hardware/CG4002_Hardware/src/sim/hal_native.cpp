@@ -0,0 +1,196 @@
+#include "sim.h"
+#include "../constants.h"
+#include "../hal.h"
+#include <algorithm>
+#include <chrono>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+uint64_t simNowUs = 0;
+std::vector<int16_t> simAudio;
+std::vector<SimButton> simButtons;
+std::vector<SimImu> simImu;
+std::vector<SimPublish> simPublished;
+bool simVerbose = false;
+
+static uint32_t uplinkKbps = 0;
+static const uint32_t SAMPLE_US = 1000000 / SAMPLING_RATE;
+
+static const struct {
+    const char *name;
+    int pin;
+} BUTTONS[] = {
+    {"select", BUTTON_SELECT},   {"delete", BUTTON_DELETE}, {"move", BUTTON_MOVE},
+    {"rotate", BUTTON_ROTATE}, {"screenshot", BUTTON_SCREENSHOT},
+};
+
+const char *simButtonName(int pin) {
+    for (const auto &b : BUTTONS) {
+        if (b.pin == pin) return b.name;
+    }
+    return "?";
+}
+
+static uint32_t le32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+static uint16_t le16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+// Skips to the samples of a WAV file and sets `samples` to their count;
+// false if it is not 16-bit mono PCM at SAMPLING_RATE. Files without a RIFF
+// header are raw PCM to the end.
+static bool skipWavHeader(FILE *f, size_t &samples) {
+    samples = SIZE_MAX;
+    uint8_t riff[12];
+    if (fread(riff, 1, sizeof(riff), f) != sizeof(riff) || memcmp(riff, "RIFF", 4) || memcmp(riff + 8, "WAVE", 4)) {
+        rewind(f);
+        return true;
+    }
+    bool format = false;
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), f) == sizeof(chunk)) {
+        uint32_t size = le32(chunk + 4);
+        if (!memcmp(chunk, "data", 4)) {
+            samples = size / sizeof(int16_t);
+            return format;
+        }
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            uint8_t fmt[16];
+            if (fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt)) return false;
+            format = le16(fmt) == 1 && le16(fmt + 2) == 1 && le32(fmt + 4) == SAMPLING_RATE && le16(fmt + 14) == 16;
+            size -= sizeof(fmt);
+        }
+        fseek(f, size + (size & 1), SEEK_CUR); // chunks are padded to even sizes
+    }
+    return false;
+}
+
+bool simLoadAudio(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    size_t remaining;
+    if (!skipWavHeader(f, remaining)) {
+        fclose(f);
+        return false;
+    }
+    int16_t block[1024];
+    size_t n;
+    while (remaining > 0 && (n = fread(block, sizeof(int16_t), remaining < 1024 ? remaining : 1024, f)) > 0) {
+        simAudio.insert(simAudio.end(), block, block + n);
+        remaining -= n;
+    }
+    fclose(f);
+    return true;
+}
+
+bool simLoadImu(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        SimImu r;
+        int v[6];
+        if (sscanf(line, "%u,%d,%d,%d,%d,%d,%d", &r.us, &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) != 7) {
+            continue; // header or comment
+        }
+        r.ax = v[0];
+        r.ay = v[1];
+        r.az = v[2];
+        r.gx = v[3];
+        r.gy = v[4];
+        r.gz = v[5];
+        simImu.push_back(r);
+    }
+    fclose(f);
+    return true;
+}
+
+bool simLoadButtons(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[128], name[32];
+    while (fgets(line, sizeof(line), f)) {
+        SimButton b;
+        int pressed;
+        if (sscanf(line, "%u,%31[^,],%d", &b.ms, name, &pressed) != 3) continue;
+        b.pin = -1;
+        for (const auto &known : BUTTONS) {
+            if (strcmp(known.name, name) == 0) b.pin = known.pin;
+        }
+        if (b.pin < 0) {
+            fprintf(stderr, "unknown button '%s'\n", name);
+            continue;
+        }
+        b.pressed = pressed != 0;
+        simButtons.push_back(b);
+    }
+    fclose(f);
+    std::stable_sort(simButtons.begin(), simButtons.end(),
+                     [](const SimButton &a, const SimButton &b) { return a.ms < b.ms; });
+    return true;
+}
+
+void simSetUplink(uint32_t kbps) { uplinkKbps = kbps; }
+
+uint32_t halMillis() { return (uint32_t)(simNowUs / 1000) + SIM_START_MS; }
+uint32_t halMicros() { return (uint32_t)(simNowUs + SIM_START_MS * 1000ULL); }
+
+uint32_t halCycleCount() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// The microphone hears the audio trace at the current replay time, and
+// capturing it takes as long as it would in real time.
+size_t halReadMic(int16_t *samples, size_t count) {
+    size_t start = simNowUs / SAMPLE_US;
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = start + i < simAudio.size() ? simAudio[start + i] : 0;
+    }
+    simNowUs += count * SAMPLE_US;
+    return count;
+}
+
+uint64_t halMicCycles() { return 0; }
+
+bool halButtonPressed(int pin) {
+    bool pressed = false;
+    for (const SimButton &b : simButtons) {
+        if (b.ms * 1000ULL > simNowUs) break;
+        if (b.pin == pin) pressed = b.pressed;
+    }
+    return pressed;
+}
+
+float halBatteryPercent() { return 100.0f; }
+void halShowBattery(float percent) {}
+void halShowRecording(bool on) {}
+
+void halBuzz(uint16_t note) {
+    if (simVerbose) printf("%10.3f ms  buzz %u Hz\n", simNowUs / 1000.0, note);
+}
+
+void halLog(const char *format, ...) {
+    if (!simVerbose) return;
+    va_list args;
+    va_start(args, format);
+    printf("%10.3f ms  ", simNowUs / 1000.0);
+    vprintf(format, args);
+    va_end(args);
+}
+
+bool halPublish(const char *topic, const uint8_t *data, size_t length) {
+    simPublished.push_back({simNowUs, topic, length});
+    if (simVerbose) printf("%10.3f ms  publish %s (%zu bytes)\n", simNowUs / 1000.0, topic, length);
+    return true;
+}
+
+bool halPublishAndWait(const char *topic, const uint8_t *data, size_t length) {
+    if (uplinkKbps > 0) simNowUs += (uint64_t)length * 8 * 1000 / uplinkKbps;
+    return halPublish(topic, data, length);
+}
+
+bool halPublishPartsAndWait(const char *topic, const uint8_t *header, size_t headerLength,
+                            const uint8_t *data, size_t length) {
+    return halPublishAndWait(topic, data, headerLength + length);
+}
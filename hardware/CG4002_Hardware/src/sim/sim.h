@@ -0,0 +1,55 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Native replay of recorded glove traces (env:native). hal_native.cpp
+// implements hal.h against a fake clock and an in-process MQTT sink.
+//
+// Trace formats, all timed from the start of the replay:
+//   audio   raw signed 16-bit little-endian mono PCM at SAMPLING_RATE, or
+//           a WAV file in that format
+//   imu     CSV "t_us,ax,ay,az,gx,gy,gz" with raw MPU6050 LSB; the first
+//           second calibrates the gyro bias, so start with the glove at rest
+//   buttons CSV "t_ms,button,pressed" with button one of
+//           select, delete, move, rotate, screenshot
+
+#define SIM_START_MS 10000 //fake uptime when the replay starts, past setup() and DEBOUNCE
+
+struct SimButton {
+    uint32_t ms;
+    int pin;
+    bool pressed;
+};
+
+struct SimImu {
+    uint32_t us;
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+};
+
+struct SimPublish {
+    uint64_t us; // replay time the broker has the whole message
+    std::string topic;
+    size_t length;
+};
+
+extern uint64_t simNowUs; // replay time; halMicros() adds SIM_START_MS
+extern std::vector<int16_t> simAudio; // one sample per SAMPLING_RATE tick
+extern std::vector<SimButton> simButtons;
+extern std::vector<SimImu> simImu;
+extern std::vector<SimPublish> simPublished;
+extern bool simVerbose;
+
+// Appends to simAudio, so several files play back to back.
+bool simLoadAudio(const char *path);
+bool simLoadImu(const char *path);
+bool simLoadButtons(const char *path);
+const char *simButtonName(int pin);
+// Uplink speed used to delay blocking publishes; 0 sends instantly.
+void simSetUplink(uint32_t kbps);
+
+#endif
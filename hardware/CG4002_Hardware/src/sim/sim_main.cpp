@@ -0,0 +1,172 @@
+// Replays recorded traces through the glove logic on the host:
+//
+//   pio run -e native
+//   .pio/build/native/program --buttons presses.csv --audio speech.raw
+//       --imu imu.csv [--uplink-kbps 2000] [--duration-ms 20000] [-v]
+//
+// UiTask and AudioTask are stepped cooperatively on one thread: recording
+// advances the fake clock in real time, so UI steps are skipped while it
+// runs, as a 2 s capture would have kept them busy on one core anyway.
+// Reports the latency from every button press to its first publish.
+#include "sim.h"
+#include "../constants.h"
+#include "../glove.h"
+#include "../hal.h"
+#include "../imu.h"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s --buttons FILE [--audio FILE] [--imu FILE] [--uplink-kbps N]\n"
+            "       [--duration-ms N] [-v]\n",
+            name);
+    exit(2);
+}
+
+// Publishes a press should cause, in the order the firmware makes them.
+static bool answers(int pin, const std::string &topic) {
+    switch (pin) {
+    case BUTTON_SELECT:
+    case BUTTON_DELETE:
+        return topic == VOICE_DATA || topic == VOICE_FEATURES;
+    case BUTTON_SCREENSHOT:
+        return topic == COMMAND;
+    default:
+        return topic == GESTURE_DATA;
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *buttons = NULL;
+    uint32_t durationMs = 0;
+    for (int i = 1; i < argc; i++) {
+        bool more = i + 1 < argc;
+        if (!strcmp(argv[i], "--buttons") && more) {
+            buttons = argv[++i];
+        } else if (!strcmp(argv[i], "--audio") && more) {
+            if (!simLoadAudio(argv[++i])) {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--imu") && more) {
+            if (!simLoadImu(argv[++i])) {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--uplink-kbps") && more) {
+            simSetUplink(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--duration-ms") && more) {
+            durationMs = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-v")) {
+            simVerbose = true;
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (!buttons) usage(argv[0]);
+    if (!simLoadButtons(buttons)) {
+        fprintf(stderr, "cannot read %s\n", buttons);
+        return 1;
+    }
+    if (durationMs == 0) {
+        // leave room for the last utterance to be captured and sent
+        durationMs = (simButtons.empty() ? 0 : simButtons.back().ms) + RECORD_TIME * 1000 + 1000;
+    }
+
+#ifdef EDGE_FEATURES
+    featuresInit();
+#endif
+    double hostUiUs = 0;
+#ifdef EDGE_FEATURES
+    double hostFeatureUs = 0;
+#endif
+    uint32_t uiSteps = 0;
+    size_t nextImu = 0;
+    uint32_t lastImuUs = 0;
+    const uint64_t stepUs = UI_POLL_MS * 1000;
+    while (simNowUs < durationMs * 1000ULL) {
+        while (nextImu < simImu.size() && simImu[nextImu].us <= simNowUs) {
+            const SimImu &r = simImu[nextImu++];
+            ImuSample s = {r.us + SIM_START_MS * 1000, r.ax, r.ay, r.az, r.gx, r.gy, r.gz};
+            imuProcess(s, lastImuUs ? r.us - lastImuUs : 1000000 / IMU_SAMPLE_HZ);
+            lastImuUs = r.us;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        uint32_t events = gloveUiStep(halMillis());
+        hostUiUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        uiSteps++;
+        if (events && gloveAudioStep(events)) {
+#ifdef EDGE_FEATURES
+            start = std::chrono::steady_clock::now();
+            computeFeatures();
+            hostFeatureUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            sendFeatures();
+#endif
+        }
+        uint64_t nextStep = (simNowUs / stepUs + 1) * stepUs;
+#ifdef ALWAYS_ON_MIC
+        // AudioTask keeps the mic history filling until the next UI step
+        while (simNowUs < nextStep) gloveListen();
+#endif
+        if (simNowUs < nextStep) simNowUs = nextStep;
+    }
+
+    printf("press -> first publish (replay time)\n");
+    std::vector<double> latencies;
+    for (const SimButton &b : simButtons) {
+        if (!b.pressed) continue;
+        const SimPublish *hit = NULL;
+        for (const SimPublish &p : simPublished) {
+            if (p.us >= b.ms * 1000ULL && answers(b.pin, p.topic)) {
+                hit = &p;
+                break;
+            }
+        }
+        if (hit) {
+            double ms = (hit->us - b.ms * 1000ULL) / 1000.0;
+            latencies.push_back(ms);
+            printf("  %8u ms  %-10s -> %-22s %8.1f ms\n", b.ms, simButtonName(b.pin), hit->topic.c_str(), ms);
+        } else {
+            printf("  %8u ms  %-10s -> (nothing published)\n", b.ms, simButtonName(b.pin));
+        }
+    }
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        double sum = 0;
+        for (double l : latencies) sum += l;
+        printf("latency min %.1f  median %.1f  mean %.1f  max %.1f ms over %zu presses\n",
+               latencies.front(), latencies[latencies.size() / 2], sum / latencies.size(),
+               latencies.back(), latencies.size());
+    }
+
+    std::map<std::string, std::pair<size_t, size_t>> topics;
+    for (const SimPublish &p : simPublished) {
+        topics[p.topic].first++;
+        topics[p.topic].second += p.length;
+    }
+    printf("published\n");
+    for (const auto &t : topics) {
+        printf("  %-22s %6zu messages %9zu bytes\n", t.first.c_str(), t.second.first, t.second.second);
+    }
+    printf("host cost: %.2f us per UI step", uiSteps ? hostUiUs / uiSteps : 0.0);
+#ifdef EDGE_FEATURES
+#ifdef KWS_FALLBACK
+    printf(", %.1f ms of log-mel extraction and int8 KWS", hostFeatureUs / 1000.0);
+#else
+    printf(", %.1f ms of log-mel extraction", hostFeatureUs / 1000.0);
+#endif
+#endif
+#ifdef ALWAYS_ON_MIC
+    printf(", %u mic frames into a %u byte history", gloveListenStats().frames,
+           gloveListenStats().historyBytes);
+#endif
+    printf(", %u fusion updates avg %lu ns\n", fusionStats.updates,
+           (unsigned long)(fusionStats.updates ? fusionStats.totalCycles / fusionStats.updates : 0));
+    return 0;
+}
@@ -0,0 +1,328 @@
+#include "tasks.h"
+#include "helpers.h"
+#include "Logger.hpp"
+
+EventGroupHandle_t gloveEvents = NULL;
+TaskStats taskStats[TASK_COUNT];
+#ifdef EDGE_FEATURES
+TaskHandle_t featureTask = NULL;
+#endif
+
+static QueueHandle_t buzzerQueue = NULL;
+static uint32_t localReadyMs = 0; // setup() done with the local peripherals
+static volatile int intFlag = 0; //interrupt flag
+
+void interruptCallBack() { intFlag = 1; }
+
+void registerTask(TaskId id, const char *name, TaskHandle_t handle) {
+    taskStats[id].name = name;
+    taskStats[id].handle = handle;
+}
+
+void markLoop(TaskId id) {
+    TaskStats &s = taskStats[id];
+    uint32_t now = micros();
+    if (s.loops > 0) {
+        uint32_t gap = now - s.lastLoopUs;
+        if (gap > s.maxGapUs) s.maxGapUs = gap;
+        s.totalGapUs += gap;
+    }
+    s.lastLoopUs = now;
+    s.loops++;
+}
+
+void resumeLoop(TaskId id) { taskStats[id].lastLoopUs = micros(); }
+
+void tasksInit() {
+    localReadyMs = millis();
+    gloveEvents = xEventGroupCreate();
+    buzzerQueue = xQueueCreate(BUZZER_QUEUE_LEN, sizeof(uint16_t));
+
+    TaskHandle_t handle;
+    xTaskCreatePinnedToCore(NetTask, "NetTask", 8192, NULL, NET_TASK_PRIORITY, &handle, 0);
+    registerTask(TASK_NET, "net", handle);
+    xTaskCreatePinnedToCore(AudioTask, "AudioTask", 6144, NULL, AUDIO_TASK_PRIORITY, &handle, 1);
+    registerTask(TASK_AUDIO, "audio", handle);
+    xTaskCreatePinnedToCore(UiTask, "UiTask", 4096, NULL, UI_TASK_PRIORITY, &handle, 1);
+    registerTask(TASK_UI, "ui", handle);
+}
+
+// Commands and results jump ahead of everything else; gesture frames are
+// stale by the time a reconnect finishes, so they are not kept; voice data
+// is worth replaying after an outage.
+struct TopicClass {
+    const char *topic;
+    uint8_t priority;
+    uint8_t qos;
+};
+
+static const TopicClass TOPIC_CLASSES[] = {
+    {COMMAND, PRIORITY_CONTROL, 1},
+    {VOICE_LOCAL_RESULT, PRIORITY_CONTROL, 1},
+    {CLOCK_SYNC_REQUEST, PRIORITY_CONTROL, 0},
+    {GESTURE_DATA, PRIORITY_NORMAL, 0},
+    {VOICE_DATA, PRIORITY_BULK, 1},
+    {VOICE_FEATURES, PRIORITY_BULK, 1},
+};
+
+static const TopicClass &topicClass(const char *topic) {
+    static const TopicClass other = {NULL, PRIORITY_NORMAL, 0};
+    for (const TopicClass &c : TOPIC_CLASSES) {
+        if (strcmp(c.topic, topic) == 0) return c;
+    }
+    return other;
+}
+
+bool enqueuePublish(const char *topic, const uint8_t *data, size_t length) {
+    const TopicClass &c = topicClass(topic);
+    return mqttClient.enqueue(topic, data, length, c.priority, c.qos);
+}
+
+bool publishAndWait(const char *topic, const uint8_t *data, size_t length) {
+    const TopicClass &c = topicClass(topic);
+    return mqttClient.enqueueAndWait(topic, data, length, c.priority, c.qos);
+}
+
+bool publishPartsAndWait(const char *topic, const uint8_t *header, size_t headerLength,
+                         const uint8_t *data, size_t length) {
+    const TopicClass &c = topicClass(topic);
+    PayloadSource source = [=](size_t offset, const uint8_t *&span) -> size_t {
+        if (offset < headerLength) {
+            span = header + offset;
+            return headerLength - offset;
+        }
+        span = data + (offset - headerLength);
+        return headerLength + length - offset;
+    };
+    return mqttClient.enqueueStreamAndWait(topic, headerLength + length, source, c.priority, c.qos);
+}
+
+void buzz(uint16_t note) {
+    xQueueSend(buzzerQueue, &note, 0);
+    xTaskNotifyGive(taskStats[TASK_UI].handle); // in case UiTask is idling
+}
+
+// Stack high-water marks and loop gaps of every registered task.
+static void publishTaskStats() {
+    char json[1536];
+    PowerStats power = powerStats();
+    int n = snprintf(json, sizeof(json),
+                     "{\"type\": \"TASKS\", \"imuDrops\": %u, \"logDrops\": %u, "
+                     "\"power\": {\"activeMs\": %u, \"idleMs\": %u, \"wakeups\": %u, \"lastWakeMs\": %u, "
+                     "\"maxWakeMs\": %u, \"overTarget\": %u, \"lightSleep\": %s}, \"tasks\": [",
+                     imuSamples.drops(), Logger::dropped(), power.activeMs, power.idleMs, power.wakeups,
+                     power.lastWakeMs, power.maxWakeMs, power.overTarget,
+                     power.lightSleep ? "true" : "false");
+    for (int i = 0; i < TASK_COUNT && n < (int)sizeof(json); i++) {
+        TaskStats &s = taskStats[i];
+        if (s.handle == NULL) continue;
+        n += snprintf(json + n, sizeof(json) - n,
+                      "%s{\"name\": \"%s\", \"stackFree\": %u, \"maxGapUs\": %u, \"avgGapUs\": %u}",
+                      json[n - 1] == '[' ? "" : ", ", s.name, uxTaskGetStackHighWaterMark(s.handle),
+                      s.maxGapUs, (uint32_t)(s.loops > 1 ? s.totalGapUs / (s.loops - 1) : 0));
+    }
+    if (n < (int)sizeof(json)) n += snprintf(json + n, sizeof(json) - n, "]");
+    // outbound queue: depth now and at worst, losses, and enqueue-to-wire
+    // latency per priority (control, normal, bulk)
+    const OutboundStats &out = mqttClient.outboundStats();
+    if (n < (int)sizeof(json)) {
+        n += snprintf(json + n, sizeof(json) - n,
+                      ", \"outbound\": {\"enqueued\": %u, \"sent\": %u, \"rejected\": %u, \"dropped\": %u, "
+                      "\"retries\": %u, \"spilled\": %u, \"replayed\": %u, \"spillBytes\": %u, \"queues\": [",
+                      out.enqueued, out.sent, out.rejected, out.dropped, out.retries, out.spilled,
+                      out.replayed, out.spillBytes);
+    }
+    for (int p = 0; p < PRIORITY_COUNT && n < (int)sizeof(json); p++) {
+        n += snprintf(json + n, sizeof(json) - n,
+                      "%s{\"depth\": %u, \"maxDepth\": %u, \"avgLatencyUs\": %u, \"maxLatencyUs\": %u}",
+                      p ? ", " : "", out.depth[p], out.maxDepth[p],
+                      (uint32_t)(out.delivered[p] ? out.totalLatencyUs[p] / out.delivered[p] : 0),
+                      out.maxLatencyUs[p]);
+    }
+    if (n < (int)sizeof(json)) n += snprintf(json + n, sizeof(json) - n, "]}");
+    // reconnect cost: full against resumed TLS handshakes, and how long the
+    // last outages lasted end to end
+    const TlsStats &tls = mqttClient.tlsStats();
+    const ConnectionStats &conn = mqttClient.connectionStats();
+    uint32_t fullHandshakes = tls.handshakes - tls.resumed;
+    if (n < (int)sizeof(json)) {
+        n += snprintf(json + n, sizeof(json) - n,
+                      ", \"tls\": {\"handshakes\": %u, \"resumed\": %u, \"failures\": %u, \"lastMs\": %u, "
+                      "\"avgFullMs\": %u, \"avgResumedMs\": %u, \"connects\": %u, \"lastConnectMs\": %u, "
+                      "\"lastOutageMs\": %u, \"maxOutageMs\": %u}",
+                      tls.handshakes, tls.resumed, tls.failures, tls.lastHandshakeMs,
+                      fullHandshakes ? tls.totalFullMs / fullHandshakes : 0,
+                      tls.resumed ? tls.totalResumedMs / tls.resumed : 0, conn.connects, conn.lastConnectMs,
+                      conn.lastOutageMs, conn.maxOutageMs);
+    }
+#ifdef GESTURE_GATEWAY
+    // gesture frames that went out as datagrams instead of over TLS
+    const DatagramStats &udp = mqttClient.datagramStats();
+    if (n < (int)sizeof(json)) {
+        n += snprintf(json + n, sizeof(json) - n, ", \"udp\": {\"sent\": %u, \"failed\": %u, \"bytes\": %u}",
+                      udp.sent, udp.failed, udp.bytes);
+    }
+#endif
+    // heap headroom: now, the lowest since boot, and the largest block left
+    if (n < (int)sizeof(json)) {
+        n += snprintf(json + n, sizeof(json) - n,
+                      ", \"heap\": {\"free\": %u, \"minFree\": %u, \"maxAlloc\": %u}", ESP.getFreeHeap(),
+                      ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
+    }
+#ifdef ALWAYS_ON_MIC
+    // continuous capture: history and DMA memory, and the CPU share of
+    // copying every frame at 240 MHz
+    ListenStats listen = gloveListenStats();
+    uint32_t frameCycles = listen.frames ? listen.micCycles / listen.frames : 0;
+    if (n < (int)sizeof(json)) {
+        n += snprintf(json + n, sizeof(json) - n,
+                      ", \"mic\": {\"historyBytes\": %u, \"dmaBytes\": %u, \"frames\": %u, "
+                      "\"cyclesPerFrame\": %u, \"loadPermille\": %u}",
+                      listen.historyBytes, (uint32_t)(I2S_DMA_BUFFERS * I2S_DMA_LEN * sizeof(int32_t)),
+                      listen.frames, frameCycles,
+                      (uint32_t)((uint64_t)frameCycles * 1000 * SAMPLING_RATE / VAD_FRAME_SAMPLES / 240000000));
+    }
+#endif
+    if (n < (int)sizeof(json)) n += snprintf(json + n, sizeof(json) - n, "}");
+    if (n >= (int)sizeof(json)) n = sizeof(json) - 1;
+    mqttClient.publishBinary(DEBUG, reinterpret_cast<uint8_t *>(json), n);
+}
+
+// Bring-up milestones in ms since boot, sent once the first publish (the
+// "online" status) is out. ntpMs stays 0 if the clock has not synced yet.
+static void publishBootTimes(uint32_t firstPublishMs) {
+    const BootTimes &boot = bootTimes();
+    const TlsStats &tls = mqttClient.tlsStats();
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"type\": \"BOOT\", \"localMs\": %u, \"wifiMs\": %u, \"cachedAp\": %s, \"staticIp\": %s, "
+             "\"tlsMs\": %u, \"firstPublishMs\": %u, \"ntpMs\": %u}",
+             localReadyMs, boot.wifiMs, boot.cachedAp ? "true" : "false", boot.staticIp ? "true" : "false",
+             tls.lastHandshakeMs, firstPublishMs, boot.timeMs);
+    mqttClient.publish(MQTT_STATUS_TOPIC, json);
+}
+
+// Owns mqttClient. Until WiFi is up it polls the association, which
+// setup() started before initialising the local peripherals, and spills or
+// drops whatever is queued. After that queued publishes are sent from
+// mqttClient.loop() as soon as they arrive, and keepalives and inbound
+// messages are serviced at least every NET_POLL_MS (NET_IDLE_POLL_MS while
+// the glove idles).
+void NetTask(void *parameter) {
+    while (!wifiReady()) {
+        markLoop(TASK_NET);
+        // a voice press this early would otherwise block AudioTask until WiFi is up
+        mqttClient.drainOutbound();
+        mqttClient.waitForOutbound(NET_POLL_MS);
+    }
+    // right away rather than after MQTT_RECONNECT_DELAY
+    mqttClient.connect();
+
+    unsigned long stats_debounce = millis();
+    unsigned long sync_debounce = millis();
+    bool online = false;
+    while (1) {
+        markLoop(TASK_NET);
+        mqttClient.loop();
+        if (!online && mqttClient.isConnected()) {
+            online = true;
+            publishBootTimes(millis());
+            traceClockRequest();
+            buzz(NOTE_C5);
+        }
+        timeReady(); // records the first NTP sync
+        mqttClient.waitForOutbound(powerIsIdle() ? NET_IDLE_POLL_MS : NET_POLL_MS);
+        if (millis() - stats_debounce > TASK_STATS_INTERVAL) {
+            stats_debounce = millis();
+            publishTaskStats();
+        }
+        if (online && millis() - sync_debounce > CLOCK_SYNC_INTERVAL) {
+            sync_debounce = millis();
+            traceClockRequest();
+        }
+    }
+}
+
+// Records an utterance per button press; publishing blocks only this task.
+void AudioTask(void *parameter) {
+    while (1) {
+#ifdef ALWAYS_ON_MIC
+        // keep the mic history filling until a press arrives
+        EventBits_t bits = xEventGroupWaitBits(
+            gloveEvents, EVT_VOICE_SELECT | EVT_VOICE_DELETE | EVT_VOICE_RESEND,
+            pdTRUE, pdFALSE, 0);
+        if (!bits) {
+            gloveListen();
+            continue;
+        }
+#else
+        EventBits_t bits = xEventGroupWaitBits(
+            gloveEvents, EVT_VOICE_SELECT | EVT_VOICE_DELETE | EVT_VOICE_RESEND,
+            pdTRUE, pdFALSE, portMAX_DELAY);
+#endif
+        markLoop(TASK_AUDIO);
+        if (gloveAudioStep(bits)) {
+#ifdef EDGE_FEATURES
+            xTaskNotifyGive(featureTask);
+#endif
+        }
+    }
+}
+
+#ifdef EDGE_FEATURES
+// Runs on core 0 so the log-mel front end does not hold up the UI or IMU
+void FeatureTask(void *parameter) {
+    featuresInit();
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        computeFeatures();
+        sendFeatures();
+    }
+}
+#endif
+
+// Buttons, buzzer, gesture streaming and battery checks. Drops the glove
+// into idle after IDLE_TIMEOUT_MS without activity and blocks until a
+// button or a buzz wakes it.
+void UiTask(void *parameter) {
+    TickType_t lastWake = xTaskGetTickCount();
+    uint32_t lastActivity = millis();
+    while (1) {
+        markLoop(TASK_UI);
+        uint32_t now = millis();
+        uint16_t note;
+        while (xQueueReceive(buzzerQueue, &note, 0) == pdTRUE) {
+            tone(BUZZER, note, NOTE_DURATION);
+            lastActivity = now;
+        }
+
+        EventBits_t events = gloveUiStep(now);
+        if (events) xEventGroupSetBits(gloveEvents, events);
+        if (!gloveIdle()) lastActivity = now;
+
+        if (intFlag == 1) {
+            intFlag = 0;
+            battMonitor.clearInterrupt();
+            tone(BUZZER, NOTE_A5, NOTE_DURATION);
+            vTaskDelay(pdMS_TO_TICKS(NOTE_DURATION));
+            noTone(BUZZER);
+            vTaskDelay(pdMS_TO_TICKS(NOTE_DURATION));
+            tone(BUZZER, NOTE_A5, NOTE_DURATION);
+        }
+
+        if (now - lastActivity > IDLE_TIMEOUT_MS && mqttClient.outboundWaiting() == 0) {
+            powerEnterIdle();
+            // the timeout keeps the battery checks going
+            uint32_t woken = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BATTERY_DEBOUNCE));
+            if (woken || !gloveIdle()) {
+                bool voice = halButtonPressed(BUTTON_SELECT) || halButtonPressed(BUTTON_DELETE);
+                powerExitIdle(!voice);
+                lastActivity = millis();
+            }
+            resumeLoop(TASK_UI);
+            lastWake = xTaskGetTickCount();
+        } else {
+            vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(UI_POLL_MS));
+        }
+    }
+}
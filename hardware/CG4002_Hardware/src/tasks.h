@@ -0,0 +1,55 @@
+#ifndef TASKS_H
+#define TASKS_H
+
+#include "Arduino.h"
+#include "constants.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+// Per-task health, published on DEBUG every TASK_STATS_INTERVAL.
+struct TaskStats {
+    const char *name;
+    TaskHandle_t handle;
+    uint32_t lastLoopUs;
+    uint32_t maxGapUs; // longest time between two loop iterations
+    uint64_t totalGapUs;
+    uint32_t loops;
+};
+
+enum TaskId { TASK_NET, TASK_AUDIO, TASK_UI, TASK_IMU, TASK_LED, TASK_FEATURE, TASK_COUNT };
+
+extern EventGroupHandle_t gloveEvents; // EVT_VOICE_* from glove.h
+extern TaskStats taskStats[TASK_COUNT];
+
+// Creates the queues and starts NetTask, AudioTask and UiTask.
+void tasksInit();
+void registerTask(TaskId id, const char *name, TaskHandle_t handle);
+void markLoop(TaskId id);
+// Restarts the gap measurement after an intentional long block (idle).
+void resumeLoop(TaskId id);
+
+// Both go through mqttClient's outbound queue, at the priority and QoS of
+// the topic (see TOPIC_CLASSES in tasks.cpp), and are sent by NetTask.
+// Copies the payload and returns immediately; false if the queue is full.
+bool enqueuePublish(const char *topic, const uint8_t *data, size_t length);
+// Publishes `data` without copying it; blocks until NetTask has sent,
+// spilled or dropped it.
+bool publishAndWait(const char *topic, const uint8_t *data, size_t length);
+// Same, for a payload of `header` followed by `data`; they are streamed to
+// the socket one after the other instead of being joined in a buffer.
+bool publishPartsAndWait(const char *topic, const uint8_t *header, size_t headerLength,
+                         const uint8_t *data, size_t length);
+// Plays a note from UiTask, so tone() is only ever called from one task.
+void buzz(uint16_t note);
+
+void NetTask(void *parameter);
+void AudioTask(void *parameter);
+void UiTask(void *parameter);
+#ifdef EDGE_FEATURES
+extern TaskHandle_t featureTask;
+void FeatureTask(void *parameter);
+#endif
+void interruptCallBack();
+
+#endif
@@ -0,0 +1,167 @@
+#include "trace.h"
+#include "hal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct VoiceTrace {
+    uint16_t id;
+    uint32_t stageMs[TRACE_STAGES];   // halMillis(), 0 if the stage did not happen
+    uint32_t chunkMs[TRACE_MAX_CHUNKS]; // each publish done
+    uint8_t chunks;
+};
+
+struct ClockSample {
+    int64_t offsetMs;
+    uint32_t rttMs;
+};
+
+static VoiceTrace trace;
+static uint16_t nextTraceId = 1; // 0 marks an untraced utterance
+static ClockSample clockSamples[CLOCK_SYNC_WINDOW];
+static uint32_t clockSampleCount = 0;
+static uint32_t clockRequestId = 0;
+
+uint16_t traceBegin() {
+    memset(&trace, 0, sizeof(trace));
+    trace.id = nextTraceId++;
+    if (nextTraceId == 0) nextTraceId = 1;
+    trace.stageMs[TRACE_PRESS] = halMillis();
+    return trace.id;
+}
+
+void traceMark(TraceStage stage) { trace.stageMs[stage] = halMillis(); }
+
+void traceChunkSent(int index) {
+    if (index >= TRACE_MAX_CHUNKS) return;
+    trace.chunkMs[index] = halMillis();
+    if (index >= trace.chunks) trace.chunks = index + 1;
+}
+
+// The value after `"key":` in JSON text. A flat search is enough for the
+// replies parsed here, which never use a key twice.
+static const char *jsonValue(const char *json, const char *key) {
+    char pattern[24];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(json, pattern);
+    if (!p) return NULL;
+    p += strlen(pattern);
+    while (*p == ' ') p++;
+    return p;
+}
+
+static bool jsonInteger(const char *json, const char *key, int64_t &value) {
+    const char *p = jsonValue(json, key);
+    if (!p) return false;
+    char *end;
+    value = strtoll(p, &end, 10);
+    return end != p;
+}
+
+// Reads up to `max` integers of the array at `key`; returns how many.
+static int jsonIntegers(const char *json, const char *key, int64_t *values, int max) {
+    const char *p = jsonValue(json, key);
+    if (!p || *p != '[') return 0;
+    int count = 0;
+    for (p++; count < max;) {
+        char *end;
+        int64_t value = strtoll(p, &end, 10);
+        if (end == p) break;
+        values[count++] = value;
+        p = end;
+        while (*p == ' ' || *p == ',') p++;
+    }
+    return count;
+}
+
+// Payloads are not terminated; false if one does not fit `json`.
+static bool terminate(char *json, const uint8_t *payload, size_t length) {
+    if (length >= TRACE_REPLY_SIZE) return false;
+    memcpy(json, payload, length);
+    json[length] = '\0';
+    return true;
+}
+
+void traceClockRequest() {
+    char json[64];
+    int n = snprintf(json, sizeof(json), "{\"id\": %u, \"t0\": %u}", (unsigned)++clockRequestId,
+                     (unsigned)halMillis());
+    halPublish(CLOCK_SYNC_REQUEST, reinterpret_cast<const uint8_t *>(json), n);
+}
+
+void traceClockReply(const uint8_t *payload, size_t length) {
+    uint32_t t3 = halMillis();
+    char json[TRACE_REPLY_SIZE];
+    int64_t id, t0, t1, t2;
+    if (!terminate(json, payload, length) || !jsonInteger(json, "id", id) || !jsonInteger(json, "t0", t0) ||
+        !jsonInteger(json, "t1", t1) || !jsonInteger(json, "t2", t2)) {
+        halLog("Bad clock reply\n");
+        return;
+    }
+    // only the latest request; a late reply has a round trip that says nothing
+    if (id != clockRequestId) return;
+    int64_t rtt = (int64_t)(uint32_t)(t3 - (uint32_t)t0) - (t2 - t1);
+    ClockSample &sample = clockSamples[clockSampleCount++ % CLOCK_SYNC_WINDOW];
+    sample.offsetMs = ((t1 - t0) + (t2 - t3)) / 2;
+    sample.rttMs = rtt > 0 ? (uint32_t)rtt : 0;
+}
+
+bool traceClockOffset(ClockOffset &offset) {
+    if (clockSampleCount == 0) return false;
+    uint32_t count = clockSampleCount < CLOCK_SYNC_WINDOW ? clockSampleCount : CLOCK_SYNC_WINDOW;
+    const ClockSample *best = &clockSamples[0];
+    for (uint32_t i = 1; i < count; i++) {
+        if (clockSamples[i].rttMs < best->rttMs) best = &clockSamples[i];
+    }
+    offset.offsetMs = best->offsetMs;
+    offset.rttMs = best->rttMs;
+    offset.samples = clockSampleCount;
+    return true;
+}
+
+void traceResult(const uint8_t *payload, size_t length) {
+    trace.stageMs[TRACE_RESULT] = halMillis();
+    char json[TRACE_REPLY_SIZE];
+    int64_t id, complete, dmaStart, dmaDone, sent;
+    int64_t received[TRACE_MAX_CHUNKS];
+    if (!terminate(json, payload, length) || !jsonInteger(json, "traceId", id) || id != trace.id ||
+        !jsonInteger(json, "completeMs", complete) || !jsonInteger(json, "sentMs", sent)) {
+        return;
+    }
+    int chunks = jsonIntegers(json, "chunksMs", received, TRACE_MAX_CHUNKS);
+    if (chunks > trace.chunks) chunks = trace.chunks;
+    if (chunks == 0) return;
+    // a FAILED reply has no inference; its DMA stages stay 0
+    bool inferred = jsonInteger(json, "dmaStartMs", dmaStart) && jsonInteger(json, "dmaDoneMs", dmaDone);
+    if (!inferred) dmaStart = dmaDone = complete;
+
+    const uint32_t *stage = trace.stageMs;
+    uint32_t uploadFrom = stage[TRACE_FEATURES] ? stage[TRACE_FEATURES] : stage[TRACE_CAPTURED];
+    uint32_t lastSent = trace.chunkMs[chunks - 1];
+    char out[TRACE_JSON_SIZE];
+    int n = snprintf(out, sizeof(out),
+                     "{\"type\": \"TRACE\", \"traceId\": %u, \"captureMs\": %u, \"featuresMs\": %u, "
+                     "\"uploadMs\": %u, \"assembleMs\": %d, \"preprocessMs\": %d, \"dmaMs\": %d, "
+                     "\"postMs\": %d, \"totalMs\": %u",
+                     trace.id, (unsigned)(stage[TRACE_CAPTURED] - stage[TRACE_PRESS]),
+                     (unsigned)(stage[TRACE_FEATURES] ? stage[TRACE_FEATURES] - stage[TRACE_CAPTURED] : 0),
+                     (unsigned)(lastSent - uploadFrom), (int)(complete - received[chunks - 1]),
+                     (int)(dmaStart - complete), (int)(dmaDone - dmaStart), (int)(sent - dmaDone),
+                     (unsigned)(stage[TRACE_RESULT] - stage[TRACE_PRESS]));
+    // the stages across the link need the Ultra96 times on the glove clock
+    ClockOffset clock;
+    if (traceClockOffset(clock) && n < (int)sizeof(out)) {
+        n += snprintf(out + n, sizeof(out) - n, ", \"networkMs\": %d, \"replyMs\": %d, \"clockErrorMs\": %u, "
+                                                "\"chunkNetworkMs\": [",
+                      (int)(received[chunks - 1] - clock.offsetMs - lastSent),
+                      (int)(stage[TRACE_RESULT] - (sent - clock.offsetMs)), (unsigned)(clock.rttMs / 2));
+        for (int i = 0; i < chunks && n < (int)sizeof(out); i++) {
+            n += snprintf(out + n, sizeof(out) - n, "%s%d", i ? ", " : "",
+                          (int)(received[i] - clock.offsetMs - trace.chunkMs[i]));
+        }
+        if (n < (int)sizeof(out)) n += snprintf(out + n, sizeof(out) - n, "]");
+    }
+    if (n < (int)sizeof(out)) n += snprintf(out + n, sizeof(out) - n, "}");
+    if (n >= (int)sizeof(out)) return;
+    halPublish(DEBUG, reinterpret_cast<const uint8_t *>(out), n);
+}
@@ -0,0 +1,53 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "constants.h"
+
+// End-to-end timing of a voice command. recordVoice() starts a trace whose
+// id travels in the voice header; the glove stamps its own stages, the
+// Ultra96 returns its timestamps with ultra96/voice_result, and the offset
+// between the two clocks comes from request/response exchanges on
+// CLOCK_SYNC_REQUEST / CLOCK_SYNC_REPLY:
+//
+//   glove  t0 --request--> t1  Ultra96
+//          t3 <--reply---- t2
+//   offset = ((t1 - t0) + (t2 - t3)) / 2, good to within rtt / 2
+//
+// Of the last CLOCK_SYNC_WINDOW exchanges the one with the lowest round
+// trip is used, as NTP does. The breakdown goes out on DEBUG as a "TRACE"
+// object; only the network and reply stages cross clocks, so only they
+// carry the offset error.
+#define TRACE_MAX_CHUNKS ((SAMPLING_RATE * RECORD_TIME + VOICE_CHUNK_SAMPLES - 1) / VOICE_CHUNK_SAMPLES)
+#define TRACE_REPLY_SIZE 512 //largest voice_result or clock reply parsed
+#define TRACE_JSON_SIZE 320 //QUEUE_INLINE_SIZE, the most halPublish copies
+
+enum TraceStage {
+    TRACE_PRESS,    // recording started
+    TRACE_CAPTURED, // utterance cut by the VAD
+    TRACE_FEATURES, // features and local keyword done (EDGE_FEATURES)
+    TRACE_RESULT,   // voice_result received
+    TRACE_STAGES
+};
+
+struct ClockOffset {
+    int64_t offsetMs; // Ultra96 time minus halMillis()
+    uint32_t rttMs;   // of the exchange it came from
+    uint32_t samples; // exchanges answered so far
+};
+
+// AudioTask and FeatureTask: the utterance being recorded and sent.
+uint16_t traceBegin();
+void traceMark(TraceStage stage);
+void traceChunkSent(int index);
+
+// NetTask: clock exchanges and the final breakdown.
+void traceClockRequest();
+void traceClockReply(const uint8_t *payload, size_t length);
+// False until an exchange has been answered.
+bool traceClockOffset(ClockOffset &offset);
+// Publishes the breakdown if `payload` answers the current trace.
+void traceResult(const uint8_t *payload, size_t length);
+
+#endif
@@ -0,0 +1,57 @@
+#include "vad.h"
+#include "constants.h"
+
+VoiceActivityDetector::VoiceActivityDetector() { reset(); }
+
+void VoiceActivityDetector::reset() {
+    // an idle room; the first frames count as speech if they clear the floor
+    noise = VAD_ENERGY_FLOOR / VAD_ENERGY_RATIO;
+    onsetCount = 0;
+    trailingSilence = 0;
+    settled = false;
+    speechStarted = false;
+}
+
+bool VoiceActivityDetector::process(const int16_t *frame, int n) {
+    if (n <= 0) return false;
+
+    uint64_t sumSq = 0;
+    int crossings = 0;
+    for (int i = 0; i < n; i++) {
+        int32_t s = frame[i];
+        sumSq += (uint64_t)(s * s);
+        if (i > 0 && ((frame[i - 1] < 0) != (s < 0))) crossings++;
+    }
+    uint32_t energy = (uint32_t)(sumSq / (uint32_t)n);
+    // normalise crossings to a VAD_FRAME_SAMPLES frame
+    crossings = crossings * VAD_FRAME_SAMPLES / n;
+
+    // noise floor follows quiet frames down immediately and rises slowly
+    if (energy < noise) {
+        noise = energy;
+    }
+
+    uint32_t loud = noise * VAD_ENERGY_RATIO;
+    uint32_t soft = noise * 2;
+    if (loud < VAD_ENERGY_FLOOR) loud = VAD_ENERGY_FLOOR;
+    if (soft < VAD_ENERGY_FLOOR) soft = VAD_ENERGY_FLOOR;
+
+    bool speech = energy > loud ||
+                  (energy > soft && crossings >= VAD_ZCR_FRICATIVE);
+
+    if (speech) {
+        trailingSilence = 0;
+        if (!speechStarted && ++onsetCount >= VAD_ONSET_FRAMES) {
+            speechStarted = true;
+        }
+        // loud ever since the press: a word or a noisy room, so creep up in
+        // case it is the room
+        if (!settled) noise += (energy - noise) >> VAD_SETTLE_SHIFT;
+    } else {
+        settled = true;
+        onsetCount = 0;
+        trailingSilence++;
+        noise += (energy - noise) >> VAD_NOISE_SHIFT;
+    }
+    return speech;
+}
@@ -0,0 +1,29 @@
+#ifndef VAD_H
+#define VAD_H
+
+#include <stdint.h>
+
+// Energy / zero-crossing voice activity detector.
+// Runs entirely in integer arithmetic on fixed-size frames of 16-bit PCM.
+class VoiceActivityDetector {
+public:
+    VoiceActivityDetector();
+
+    void reset();
+    // Classifies one frame of `n` samples. Returns true if the frame is speech.
+    bool process(const int16_t *frame, int n);
+
+    bool inSpeech() const { return speechStarted; }
+    // Number of consecutive non-speech frames since the last speech frame.
+    int silentFrames() const { return trailingSilence; }
+    uint32_t noiseFloor() const { return noise; }
+
+private:
+    uint32_t noise; // running mean-square estimate of the background
+    int onsetCount;
+    int trailingSilence;
+    bool settled; // a frame quieter than speech has been heard
+    bool speechStarted;
+};
+
+#endif